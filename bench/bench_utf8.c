@@ -0,0 +1,120 @@
+/**
+ *     st7735 display library
+ *
+ *     Copyright (c) 2020 Vitaliy Nimych (Cvetaev) @ cvetaevvitaliy@gmail.com
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *          http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Host benchmark of UTF-8 text drawing: LCD_ST7735_MeasureString and LCD_ST7735S_DrawString
+ * on long strings and on log-view lines. Time per character must stay flat as the string grows.
+ * The panel is a no-op SPI, drawing goes to the screen buffer. Build from the repository root:
+ *
+ *     gcc -O2 -Ibench -I. -Ifonts -Ipicts st7735s.c fonts/Font_8x10.c bench/bench_utf8.c -o bench_utf8
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "st7735s.h"
+
+#define BENCH_MAX_CHARS 65536
+
+static char text[BENCH_MAX_CHARS * 3 + 1];
+
+
+static uint8_t Bench_SpiWrite(uint8_t *data, uint16_t size)
+{
+    (void)data;
+    (void)size;
+    return 0;
+}
+
+
+static void Bench_WritePin(uint32_t port, uint32_t pin, uint8_t state)
+{
+    (void)port;
+    (void)pin;
+    (void)state;
+}
+
+
+static double Bench_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+
+/** chars characters of mixed 1, 2 and 3 byte sequences, like a log with units and names */
+static void Bench_Text(uint32_t chars)
+{
+    static const char *const pieces[] = { "a", "7", " ", ":", "\xC2\xB0", "\xC3\xA9", "\xE2\x82\xAC" };
+    char *p = text;
+
+    for (uint32_t i = 0; i < chars; i++) {
+        const char *piece = pieces[(i * 7 + i / 5) % 7];
+        size_t len = strlen(piece);
+
+        memcpy(p, piece, len);
+        p += len;
+    }
+    *p = '\0';
+}
+
+
+/** ns per character of repeats calls, measure or draw */
+static double Bench_Run(const char *str, uint32_t chars, uint32_t repeats, bool draw)
+{
+    int16_t w;
+    int16_t h;
+    double start = Bench_Now();
+
+    for (uint32_t i = 0; i < repeats; i++) {
+        if (draw)
+            LCD_ST7735S_DrawString(str, 0, 0, &Font_8x10, ST7735_WHITE, ST7735_BLACK, false);
+        else
+            LCD_ST7735_MeasureString(str, &Font_8x10, &w, &h);
+    }
+    return (Bench_Now() - start) * 1e9 / ((double)chars * repeats);
+}
+
+
+int main(void)
+{
+    static const char log_line[] = "12:04:33.918 [INFO] sensor 3: 21.5\xC2\xB0" "C, fan 1200 rpm, \xE2\x82\xAC" "0.12/kWh";
+    LCD_ST7735_ctx_t ctx = { .spi_write_data = Bench_SpiWrite, .gpio_write_pin = Bench_WritePin };
+
+    LCD_ST7735S_Init(&ctx);
+
+    printf("%-28s %12s %12s\n", "string", "measure ns/ch", "draw ns/ch");
+    for (uint32_t chars = 1024; chars <= BENCH_MAX_CHARS; chars *= 4) {
+        uint32_t repeats = 4 * BENCH_MAX_CHARS / chars;
+
+        Bench_Text(chars);
+        printf("long, %6lu characters       %12.1f %12.1f\n", (unsigned long)chars,
+               Bench_Run(text, chars, repeats, false), Bench_Run(text, chars, repeats, true));
+    }
+
+    /** log view: a screen of short lines, redrawn many times */
+    uint32_t chars = 0;
+    for (const char *p = log_line; *p != '\0'; p++)
+        chars += ((*p & 0xC0) != 0x80);
+    printf("log line, %3lu characters      %12.1f %12.1f\n", (unsigned long)chars,
+           Bench_Run(log_line, chars, 20000, false), Bench_Run(log_line, chars, 20000, true));
+
+    return 0;
+}
@@ -0,0 +1,11 @@
+#ifndef _BENCH_DELAY_H
+#define _BENCH_DELAY_H
+#include <stdint.h>
+
+/** Host stub of the platform delay, the benchmark never waits for the panel */
+static inline void delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+#endif //_BENCH_DELAY_H
@@ -68,7 +68,7 @@ static const uint8_t image_data_Font_10x20_0x20[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x20 = { image_data_Font_10x20_0x20,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -96,7 +96,7 @@ static const uint8_t image_data_Font_10x20_0x21[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x81, 0xe0, 0x78, 0x1e, 0x07, 0x80, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x21 = { image_data_Font_10x20_0x21,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -124,7 +124,7 @@ static const uint8_t image_data_Font_10x20_0x22[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc3, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x22 = { image_data_Font_10x20_0x22,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -152,7 +152,7 @@ static const uint8_t image_data_Font_10x20_0x23[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc3, 0x31, 0xfe, 0x7f, 0x8c, 0xc3, 0x31, 0xfe, 0x7f, 0x8c, 0xc3, 0x30, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x23 = { image_data_Font_10x20_0x23,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -180,7 +180,7 @@ static const uint8_t image_data_Font_10x20_0x24[25] = {
     0x00, 0x00, 0x00, 0xc0, 0x30, 0x1e, 0x0f, 0xc7, 0x39, 0xc0, 0x38, 0x07, 0x00, 0x60, 0x0c, 0x03, 0x9c, 0xe3, 0xf0, 0x78, 0x0c, 0x03, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x24 = { image_data_Font_10x20_0x24,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -208,7 +208,7 @@ static const uint8_t image_data_Font_10x20_0x25[25] = {
     0x00, 0x00, 0x00, 0x01, 0xc0, 0xdb, 0x36, 0xc7, 0x60, 0x18, 0x0c, 0x03, 0x01, 0x80, 0x60, 0x33, 0x8d, 0xb6, 0x6d, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x25 = { image_data_Font_10x20_0x25,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -236,7 +236,7 @@ static const uint8_t image_data_Font_10x20_0x26[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x06, 0xc3, 0x18, 0x6c, 0x0e, 0x06, 0x03, 0x3d, 0x86, 0x61, 0x18, 0xc3, 0xf8, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x26 = { image_data_Font_10x20_0x26,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -264,7 +264,7 @@ static const uint8_t image_data_Font_10x20_0x27[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x27 = { image_data_Font_10x20_0x27,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -292,7 +292,7 @@ static const uint8_t image_data_Font_10x20_0x28[25] = {
     0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x06, 0x01, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0x40, 0x18, 0x03, 0x00, 0x60, 0x00
 };
 static const tImage Font_10x20_0x28 = { image_data_Font_10x20_0x28,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -320,7 +320,7 @@ static const uint8_t image_data_Font_10x20_0x29[25] = {
     0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x40, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x10, 0x0c, 0x06, 0x03, 0x00, 0x00
 };
 static const tImage Font_10x20_0x29 = { image_data_Font_10x20_0x29,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -348,7 +348,7 @@ static const uint8_t image_data_Font_10x20_0x2a[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x33, 0x07, 0x87, 0xf8, 0x78, 0x33, 0x18, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x2a = { image_data_Font_10x20_0x2a,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -376,7 +376,7 @@ static const uint8_t image_data_Font_10x20_0x2b[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x30, 0x7f, 0x9f, 0xe0, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x2b = { image_data_Font_10x20_0x2b,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -404,7 +404,7 @@ static const uint8_t image_data_Font_10x20_0x2c[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x04, 0x02, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x2c = { image_data_Font_10x20_0x2c,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -432,7 +432,7 @@ static const uint8_t image_data_Font_10x20_0x2d[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x2d = { image_data_Font_10x20_0x2d,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -460,7 +460,7 @@ static const uint8_t image_data_Font_10x20_0x2e[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x2e = { image_data_Font_10x20_0x2e,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -488,7 +488,7 @@ static const uint8_t image_data_Font_10x20_0x2f[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x30, 0x0c, 0x06, 0x01, 0x80, 0xc0, 0x30, 0x18, 0x06, 0x03, 0x00, 0xc0, 0x60, 0x18, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x2f = { image_data_Font_10x20_0x2f,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -516,7 +516,7 @@ static const uint8_t image_data_Font_10x20_0x30[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x61, 0x9b, 0x66, 0xd9, 0x86, 0x61, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x30 = { image_data_Font_10x20_0x30,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -544,7 +544,7 @@ static const uint8_t image_data_Font_10x20_0x31[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0f, 0x03, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x31 = { image_data_Font_10x20_0x31,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -572,7 +572,7 @@ static const uint8_t image_data_Font_10x20_0x32[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x38, 0x06, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x32 = { image_data_Font_10x20_0x32,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -600,7 +600,7 @@ static const uint8_t image_data_Font_10x20_0x33[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x38, 0x06, 0x03, 0x03, 0x80, 0xf0, 0x0e, 0x01, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x33 = { image_data_Font_10x20_0x33,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -628,7 +628,7 @@ static const uint8_t image_data_Font_10x20_0x34[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0xc3, 0x30, 0xcc, 0x33, 0x18, 0xc7, 0xf9, 0xfe, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x34 = { image_data_Font_10x20_0x34,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -656,7 +656,7 @@ static const uint8_t image_data_Font_10x20_0x35[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe6, 0x01, 0x80, 0x7e, 0x1f, 0xc0, 0x38, 0x06, 0x01, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x35 = { image_data_Font_10x20_0x35,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -684,7 +684,7 @@ static const uint8_t image_data_Font_10x20_0x36[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x80, 0x60, 0x1b, 0x87, 0xf1, 0xce, 0x61, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x36 = { image_data_Font_10x20_0x36,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -712,7 +712,7 @@ static const uint8_t image_data_Font_10x20_0x37[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x8f, 0xe0, 0x18, 0x0c, 0x06, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x37 = { image_data_Font_10x20_0x37,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -740,7 +740,7 @@ static const uint8_t image_data_Font_10x20_0x38[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x33, 0x07, 0x83, 0xf1, 0xce, 0x61, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x38 = { image_data_Font_10x20_0x38,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -768,7 +768,7 @@ static const uint8_t image_data_Font_10x20_0x39[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x73, 0x8f, 0xe1, 0xd8, 0x06, 0x01, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x39 = { image_data_Font_10x20_0x39,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -796,7 +796,7 @@ static const uint8_t image_data_Font_10x20_0x3a[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x3a = { image_data_Font_10x20_0x3a,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -824,7 +824,7 @@ static const uint8_t image_data_Font_10x20_0x3b[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x04, 0x02, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x3b = { image_data_Font_10x20_0x3b,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -852,7 +852,7 @@ static const uint8_t image_data_Font_10x20_0x3c[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x3c = { image_data_Font_10x20_0x3c,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -880,7 +880,7 @@ static const uint8_t image_data_Font_10x20_0x3d[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x3d = { image_data_Font_10x20_0x3d,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -908,7 +908,7 @@ static const uint8_t image_data_Font_10x20_0x3e[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x3e = { image_data_Font_10x20_0x3e,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -936,7 +936,7 @@ static const uint8_t image_data_Font_10x20_0x3f[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x03, 0x81, 0xc0, 0xe0, 0x30, 0x0c, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x3f = { image_data_Font_10x20_0x3f,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -964,7 +964,7 @@ static const uint8_t image_data_Font_10x20_0x40[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc6, 0x19, 0x86, 0x67, 0x9b, 0xe6, 0x99, 0xa6, 0x6f, 0x99, 0xe6, 0x00, 0xfe, 0x1f, 0x80, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x40 = { image_data_Font_10x20_0x40,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -992,7 +992,7 @@ static const uint8_t image_data_Font_10x20_0x41[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x83, 0x31, 0x86, 0x61, 0x98, 0x66, 0x19, 0xfe, 0x7f, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x41 = { image_data_Font_10x20_0x41,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1020,7 +1020,7 @@ static const uint8_t image_data_Font_10x20_0x42[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1f, 0xc6, 0x19, 0x86, 0x61, 0x9f, 0xc7, 0xf1, 0x86, 0x61, 0x98, 0x67, 0xf1, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x42 = { image_data_Font_10x20_0x42,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1048,7 +1048,7 @@ static const uint8_t image_data_Font_10x20_0x43[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x1c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x43 = { image_data_Font_10x20_0x43,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1076,7 +1076,7 @@ static const uint8_t image_data_Font_10x20_0x44[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1f, 0xc6, 0x39, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0xe7, 0xf1, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x44 = { image_data_Font_10x20_0x44,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1104,7 +1104,7 @@ static const uint8_t image_data_Font_10x20_0x45[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe6, 0x01, 0x80, 0x60, 0x1f, 0x87, 0xe1, 0x80, 0x60, 0x18, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x45 = { image_data_Font_10x20_0x45,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1132,7 +1132,7 @@ static const uint8_t image_data_Font_10x20_0x46[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe6, 0x01, 0x80, 0x60, 0x1f, 0x87, 0xe1, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x46 = { image_data_Font_10x20_0x46,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1160,7 +1160,7 @@ static const uint8_t image_data_Font_10x20_0x47[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x80, 0x60, 0x18, 0x06, 0x79, 0x9e, 0x61, 0x9c, 0xe3, 0xf8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x47 = { image_data_Font_10x20_0x47,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1188,7 +1188,7 @@ static const uint8_t image_data_Font_10x20_0x48[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f, 0xe7, 0xf9, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x48 = { image_data_Font_10x20_0x48,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1216,7 +1216,7 @@ static const uint8_t image_data_Font_10x20_0x49[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0f, 0xc0, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x03, 0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x49 = { image_data_Font_10x20_0x49,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1244,7 +1244,7 @@ static const uint8_t image_data_Font_10x20_0x4a[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x4a = { image_data_Font_10x20_0x4a,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1272,7 +1272,7 @@ static const uint8_t image_data_Font_10x20_0x4b[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x19, 0xc6, 0xe1, 0xf0, 0x78, 0x1c, 0x07, 0x81, 0xf0, 0x6e, 0x19, 0xc6, 0x39, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x4b = { image_data_Font_10x20_0x4b,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1300,7 +1300,7 @@ static const uint8_t image_data_Font_10x20_0x4c[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x4c = { image_data_Font_10x20_0x4c,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1328,7 +1328,7 @@ static const uint8_t image_data_Font_10x20_0x4d[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x67, 0x39, 0xce, 0x7f, 0x9f, 0xe6, 0xd9, 0xb6, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x4d = { image_data_Font_10x20_0x4d,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1356,7 +1356,7 @@ static const uint8_t image_data_Font_10x20_0x4e[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x9c, 0x67, 0x19, 0xe6, 0x79, 0x9b, 0x66, 0xd9, 0x9e, 0x67, 0x98, 0xe6, 0x39, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x4e = { image_data_Font_10x20_0x4e,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1384,7 +1384,7 @@ static const uint8_t image_data_Font_10x20_0x4f[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x4f = { image_data_Font_10x20_0x4f,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1412,7 +1412,7 @@ static const uint8_t image_data_Font_10x20_0x50[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1f, 0xc6, 0x39, 0x86, 0x61, 0x98, 0xe7, 0xf1, 0xf8, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x50 = { image_data_Font_10x20_0x50,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1440,7 +1440,7 @@ static const uint8_t image_data_Font_10x20_0x51[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x67, 0x9d, 0xe3, 0xf8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x51 = { image_data_Font_10x20_0x51,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1468,7 +1468,7 @@ static const uint8_t image_data_Font_10x20_0x52[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1f, 0xc6, 0x39, 0x86, 0x61, 0x98, 0xe7, 0xf1, 0xf8, 0x63, 0x18, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x52 = { image_data_Font_10x20_0x52,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1496,7 +1496,7 @@ static const uint8_t image_data_Font_10x20_0x53[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0xc0, 0x38, 0x07, 0x00, 0x60, 0x0c, 0x03, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x53 = { image_data_Font_10x20_0x53,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1524,7 +1524,7 @@ static const uint8_t image_data_Font_10x20_0x54[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe0, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x54 = { image_data_Font_10x20_0x54,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1552,7 +1552,7 @@ static const uint8_t image_data_Font_10x20_0x55[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x55 = { image_data_Font_10x20_0x55,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1580,7 +1580,7 @@ static const uint8_t image_data_Font_10x20_0x56[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x8c, 0xc1, 0xe0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x56 = { image_data_Font_10x20_0x56,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1608,7 +1608,7 @@ static const uint8_t image_data_Font_10x20_0x57[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x67, 0xf8, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x57 = { image_data_Font_10x20_0x57,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1636,7 +1636,7 @@ static const uint8_t image_data_Font_10x20_0x58[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x63, 0x30, 0xcc, 0x1e, 0x03, 0x00, 0xc0, 0x78, 0x33, 0x0c, 0xc6, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x58 = { image_data_Font_10x20_0x58,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1664,7 +1664,7 @@ static const uint8_t image_data_Font_10x20_0x59[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x8c, 0xc1, 0xe0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x59 = { image_data_Font_10x20_0x59,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1692,7 +1692,7 @@ static const uint8_t image_data_Font_10x20_0x5a[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe0, 0x18, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x18, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x5a = { image_data_Font_10x20_0x5a,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1720,7 +1720,7 @@ static const uint8_t image_data_Font_10x20_0x5b[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x07, 0x81, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x07, 0x81, 0xe0, 0x00
 };
 static const tImage Font_10x20_0x5b = { image_data_Font_10x20_0x5b,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1748,7 +1748,7 @@ static const uint8_t image_data_Font_10x20_0x5c[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x03, 0x00, 0xc0, 0x18, 0x06, 0x00, 0xc0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0c, 0x01, 0x80, 0x60, 0x00, 0x00
 };
 static const tImage Font_10x20_0x5c = { image_data_Font_10x20_0x5c,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1776,7 +1776,7 @@ static const uint8_t image_data_Font_10x20_0x5d[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x07, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x07, 0x81, 0xe0, 0x00
 };
 static const tImage Font_10x20_0x5d = { image_data_Font_10x20_0x5d,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1804,7 +1804,7 @@ static const uint8_t image_data_Font_10x20_0x5e[25] = {
     0x00, 0x03, 0x01, 0xe0, 0xcc, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x5e = { image_data_Font_10x20_0x5e,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1832,7 +1832,7 @@ static const uint8_t image_data_Font_10x20_0x5f[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe7, 0xf8, 0x00
 };
 static const tImage Font_10x20_0x5f = { image_data_Font_10x20_0x5f,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1860,7 +1860,7 @@ static const uint8_t image_data_Font_10x20_0x60[25] = {
     0x00, 0x07, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x60 = { image_data_Font_10x20_0x60,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1888,7 +1888,7 @@ static const uint8_t image_data_Font_10x20_0x61[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3f, 0x00, 0x63, 0xf9, 0xfe, 0x61, 0x98, 0x67, 0xf8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x61 = { image_data_Font_10x20_0x61,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1916,7 +1916,7 @@ static const uint8_t image_data_Font_10x20_0x62[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0xb8, 0x7f, 0x1c, 0xe6, 0x19, 0x86, 0x61, 0x9c, 0xe7, 0xf1, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x62 = { image_data_Font_10x20_0x62,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1944,7 +1944,7 @@ static const uint8_t image_data_Font_10x20_0x63[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x1c, 0xe6, 0x01, 0x80, 0x60, 0x1c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x63 = { image_data_Font_10x20_0x63,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1972,7 +1972,7 @@ static const uint8_t image_data_Font_10x20_0x64[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x18, 0x76, 0x3f, 0x9c, 0xe6, 0x19, 0x86, 0x61, 0x9c, 0xe3, 0xf8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x64 = { image_data_Font_10x20_0x64,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2000,7 +2000,7 @@ static const uint8_t image_data_Font_10x20_0x65[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x1c, 0xe6, 0x19, 0xfe, 0x7f, 0x9c, 0x03, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x65 = { image_data_Font_10x20_0x65,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2028,7 +2028,7 @@ static const uint8_t image_data_Font_10x20_0x66[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x87, 0xe1, 0x80, 0x60, 0x7f, 0x9f, 0xe1, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x66 = { image_data_Font_10x20_0x66,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2056,7 +2056,7 @@ static const uint8_t image_data_Font_10x20_0x67[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x1c, 0xe6, 0x19, 0x86, 0x61, 0x9c, 0xe3, 0xf8, 0x76, 0x01, 0x80, 0xe3, 0xf0, 0xf8
 };
 static const tImage Font_10x20_0x67 = { image_data_Font_10x20_0x67,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2084,7 +2084,7 @@ static const uint8_t image_data_Font_10x20_0x68[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0xb8, 0x7f, 0x1c, 0xe6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x68 = { image_data_Font_10x20_0x68,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2112,7 +2112,7 @@ static const uint8_t image_data_Font_10x20_0x69[25] = {
     0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x03, 0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x69 = { image_data_Font_10x20_0x69,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2140,7 +2140,7 @@ static const uint8_t image_data_Font_10x20_0x6a[25] = {
     0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x03, 0x83, 0xc0, 0xe0
 };
 static const tImage Font_10x20_0x6a = { image_data_Font_10x20_0x6a,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2168,7 +2168,7 @@ static const uint8_t image_data_Font_10x20_0x6b[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0x8c, 0x66, 0x1b, 0x07, 0x81, 0xc0, 0x7c, 0x19, 0x86, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x6b = { image_data_Font_10x20_0x6b,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2196,7 +2196,7 @@ static const uint8_t image_data_Font_10x20_0x6c[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x03, 0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x6c = { image_data_Font_10x20_0x6c,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2224,7 +2224,7 @@ static const uint8_t image_data_Font_10x20_0x6d[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0x7f, 0x9b, 0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x6d = { image_data_Font_10x20_0x6d,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2252,7 +2252,7 @@ static const uint8_t image_data_Font_10x20_0x6e[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x7f, 0x1c, 0xe6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x6e = { image_data_Font_10x20_0x6e,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2280,7 +2280,7 @@ static const uint8_t image_data_Font_10x20_0x6f[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x1c, 0xe6, 0x19, 0x86, 0x61, 0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x6f = { image_data_Font_10x20_0x6f,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2308,7 +2308,7 @@ static const uint8_t image_data_Font_10x20_0x70[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x7f, 0x1c, 0xe6, 0x19, 0x86, 0x61, 0x9c, 0xe7, 0xf1, 0xb8, 0x60, 0x18, 0x06, 0x01, 0x80
 };
 static const tImage Font_10x20_0x70 = { image_data_Font_10x20_0x70,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2336,7 +2336,7 @@ static const uint8_t image_data_Font_10x20_0x71[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x3f, 0x9c, 0xe6, 0x19, 0x86, 0x61, 0x9c, 0xe3, 0xf8, 0x76, 0x01, 0x80, 0x60, 0x18, 0x06
 };
 static const tImage Font_10x20_0x71 = { image_data_Font_10x20_0x71,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2364,7 +2364,7 @@ static const uint8_t image_data_Font_10x20_0x72[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbe, 0x7f, 0x9e, 0x07, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x72 = { image_data_Font_10x20_0x72,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2392,7 +2392,7 @@ static const uint8_t image_data_Font_10x20_0x73[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x18, 0x67, 0x00, 0xfc, 0x03, 0x98, 0x63, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x73 = { image_data_Font_10x20_0x73,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2420,7 +2420,7 @@ static const uint8_t image_data_Font_10x20_0x74[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x01, 0x80, 0xfc, 0x3f, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x74 = { image_data_Font_10x20_0x74,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2448,7 +2448,7 @@ static const uint8_t image_data_Font_10x20_0x75[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9c, 0xe3, 0xf8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x75 = { image_data_Font_10x20_0x75,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2476,7 +2476,7 @@ static const uint8_t image_data_Font_10x20_0x76[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x8c, 0xc1, 0xe0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x76 = { image_data_Font_10x20_0x76,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2504,7 +2504,7 @@ static const uint8_t image_data_Font_10x20_0x77[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0xd9, 0xb6, 0x7f, 0x9f, 0xe7, 0x38, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x77 = { image_data_Font_10x20_0x77,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2532,7 +2532,7 @@ static const uint8_t image_data_Font_10x20_0x78[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x73, 0x8f, 0xc1, 0xe0, 0x30, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x78 = { image_data_Font_10x20_0x78,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2560,7 +2560,7 @@ static const uint8_t image_data_Font_10x20_0x79[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9c, 0xe3, 0xf8, 0x76, 0x01, 0x80, 0x63, 0xf0, 0xf8
 };
 static const tImage Font_10x20_0x79 = { image_data_Font_10x20_0x79,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2588,7 +2588,7 @@ static const uint8_t image_data_Font_10x20_0x7a[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x7a = { image_data_Font_10x20_0x7a,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2616,7 +2616,7 @@ static const uint8_t image_data_Font_10x20_0x7b[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0xc0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x03, 0x00, 0x70, 0x00
 };
 static const tImage Font_10x20_0x7b = { image_data_Font_10x20_0x7b,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2644,7 +2644,7 @@ static const uint8_t image_data_Font_10x20_0x7c[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x7c = { image_data_Font_10x20_0x7c,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2672,7 +2672,7 @@ static const uint8_t image_data_Font_10x20_0x7d[25] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0x00, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x0c, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x03, 0x03, 0x80, 0x00
 };
 static const tImage Font_10x20_0x7d = { image_data_Font_10x20_0x7d,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2700,7 +2700,7 @@ static const uint8_t image_data_Font_10x20_0x7e[25] = {
     0x00, 0x00, 0x00, 0x00, 0xe2, 0x6d, 0x91, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_10x20_0x7e = { image_data_Font_10x20_0x7e,
-    10, 20, 8};
+    10, 20, 8, 0};
 #endif
 
 
@@ -3469,5 +3469,5 @@ static const tChar Font_10x20_array[] = {
 };
 
 
-const tFont Font_10x20 = { 95, Font_10x20_array };
+const tFont Font_10x20 = { 95, Font_10x20_array, .first_code = 0x20, .dense = 95 };
 
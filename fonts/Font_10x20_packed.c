@@ -0,0 +1,308 @@
+/*******************************************************************************
+* name: Font_10x20
+* family: Fixedsys
+* size: 28
+* style: Normal
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* type: monospaced
+* encoding: UTF-8
+*
+* packed: 95 glyphs 10x20, 25 bytes per glyph, first code 0x20
+* glyph bits are continuous across rows like tImage, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_10x20_packed_data[2375] = {
+  // character: ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '!'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x81, 0xe0, 0x78, 0x1e, 0x07, 0x80, 0xc0, 0x30, 0x0c,
+  0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '"'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc3, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '#'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc3, 0x31, 0xfe, 0x7f, 0x8c, 0xc3, 0x31, 0xfe, 0x7f,
+  0x8c, 0xc3, 0x30, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '$'
+  0x00, 0x00, 0x00, 0xc0, 0x30, 0x1e, 0x0f, 0xc7, 0x39, 0xc0, 0x38, 0x07, 0x00, 0x60, 0x0c, 0x03,
+  0x9c, 0xe3, 0xf0, 0x78, 0x0c, 0x03, 0x00, 0x00, 0x00,
+  // character: '%'
+  0x00, 0x00, 0x00, 0x01, 0xc0, 0xdb, 0x36, 0xc7, 0x60, 0x18, 0x0c, 0x03, 0x01, 0x80, 0x60, 0x33,
+  0x8d, 0xb6, 0x6d, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '&'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x06, 0xc3, 0x18, 0x6c, 0x0e, 0x06, 0x03, 0x3d, 0x86, 0x61,
+  0x18, 0xc3, 0xf8, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '''
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '('
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x06, 0x01, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30,
+  0x0c, 0x03, 0x00, 0x40, 0x18, 0x03, 0x00, 0x60, 0x00,
+  // character: ')'
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x40, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x10, 0x0c, 0x06, 0x03, 0x00, 0x00,
+  // character: '*'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x33, 0x07, 0x87, 0xf8, 0x78, 0x33,
+  0x18, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x30, 0x7f, 0x9f, 0xe0, 0xc0, 0x30, 0x0c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc0, 0x30, 0x04, 0x02, 0x00, 0x00, 0x00,
+  // character: '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0f, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '/'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x30, 0x0c, 0x06, 0x01, 0x80, 0xc0, 0x30, 0x18,
+  0x06, 0x03, 0x00, 0xc0, 0x60, 0x18, 0x00, 0x00, 0x00,
+  // character: '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x61, 0x9b, 0x66, 0xd9, 0x86, 0x61,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '1'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0f, 0x03, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
+  0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '2'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x38, 0x06, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38,
+  0x1c, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '3'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x38, 0x06, 0x03, 0x03, 0x80, 0xf0, 0x0e, 0x01,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0xc3, 0x30, 0xcc, 0x33, 0x18, 0xc7, 0xf9, 0xfe, 0x03,
+  0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '5'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe6, 0x01, 0x80, 0x7e, 0x1f, 0xc0, 0x38, 0x06, 0x01,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '6'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x80, 0x60, 0x1b, 0x87, 0xf1, 0xce, 0x61,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '7'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x8f, 0xe0, 0x18, 0x0c, 0x06, 0x03, 0x00, 0xc0, 0x30, 0x0c,
+  0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '8'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x33, 0x07, 0x83, 0xf1, 0xce, 0x61,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x73, 0x8f, 0xe1, 0xd8, 0x06, 0x01,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0xc0, 0x30, 0x04, 0x02, 0x00, 0x00, 0x00,
+  // character: '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x00, 0xc0, 0x18,
+  0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0xf8, 0x3e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x0c, 0x06,
+  0x03, 0x01, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '?'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x03, 0x81, 0xc0, 0xe0, 0x30, 0x0c,
+  0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '@'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc6, 0x19, 0x86, 0x67, 0x9b, 0xe6, 0x99, 0xa6, 0x6f,
+  0x99, 0xe6, 0x00, 0xfe, 0x1f, 0x80, 0x00, 0x00, 0x00,
+  // character: 'A'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x83, 0x31, 0x86, 0x61, 0x98, 0x66, 0x19, 0xfe, 0x7f,
+  0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'B'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1f, 0xc6, 0x19, 0x86, 0x61, 0x9f, 0xc7, 0xf1, 0x86, 0x61,
+  0x98, 0x67, 0xf1, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'C'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x1c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'D'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1f, 0xc6, 0x39, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
+  0x98, 0xe7, 0xf1, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'E'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe6, 0x01, 0x80, 0x60, 0x1f, 0x87, 0xe1, 0x80, 0x60,
+  0x18, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'F'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe6, 0x01, 0x80, 0x60, 0x1f, 0x87, 0xe1, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'G'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x80, 0x60, 0x18, 0x06, 0x79, 0x9e, 0x61,
+  0x9c, 0xe3, 0xf8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'H'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f, 0xe7, 0xf9, 0x86, 0x61,
+  0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'I'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0f, 0xc0, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
+  0x03, 0x03, 0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'J'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'K'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x19, 0xc6, 0xe1, 0xf0, 0x78, 0x1c, 0x07, 0x81, 0xf0, 0x6e,
+  0x19, 0xc6, 0x39, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'L'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x18, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'M'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x67, 0x39, 0xce, 0x7f, 0x9f, 0xe6, 0xd9, 0xb6, 0x61,
+  0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'N'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x9c, 0x67, 0x19, 0xe6, 0x79, 0x9b, 0x66, 0xd9, 0x9e, 0x67,
+  0x98, 0xe6, 0x39, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'O'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'P'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1f, 0xc6, 0x39, 0x86, 0x61, 0x98, 0xe7, 0xf1, 0xf8, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x67,
+  0x9d, 0xe3, 0xf8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'R'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1f, 0xc6, 0x39, 0x86, 0x61, 0x98, 0xe7, 0xf1, 0xf8, 0x63,
+  0x18, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'S'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xc7, 0x39, 0xc0, 0x38, 0x07, 0x00, 0x60, 0x0c, 0x03,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'T'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe0, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
+  0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'U'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'V'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
+  0x8c, 0xc1, 0xe0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'W'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x6d,
+  0x9b, 0x67, 0xf8, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'X'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x63, 0x30, 0xcc, 0x1e, 0x03, 0x00, 0xc0, 0x78, 0x33,
+  0x0c, 0xc6, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x8c, 0xc1, 0xe0, 0x30, 0x0c,
+  0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xe0, 0x18, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70,
+  0x18, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '['
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x07, 0x81, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x07, 0x81, 0xe0, 0x00,
+  // character: '\\'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x03, 0x00, 0xc0, 0x18, 0x06, 0x00, 0xc0, 0x30, 0x06,
+  0x01, 0x80, 0x30, 0x0c, 0x01, 0x80, 0x60, 0x00, 0x00,
+  // character: ']'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x07, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x07, 0x81, 0xe0, 0x00,
+  // character: '^'
+  0x00, 0x03, 0x01, 0xe0, 0xcc, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '_'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe7, 0xf8, 0x00,
+  // character: '`'
+  0x00, 0x07, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'a'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3f, 0x00, 0x63, 0xf9, 0xfe, 0x61,
+  0x98, 0x67, 0xf8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'b'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0xb8, 0x7f, 0x1c, 0xe6, 0x19, 0x86, 0x61,
+  0x9c, 0xe7, 0xf1, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'c'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x1c, 0xe6, 0x01, 0x80, 0x60,
+  0x1c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'd'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x18, 0x76, 0x3f, 0x9c, 0xe6, 0x19, 0x86, 0x61,
+  0x9c, 0xe3, 0xf8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'e'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x1c, 0xe6, 0x19, 0xfe, 0x7f,
+  0x9c, 0x03, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'f'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x87, 0xe1, 0x80, 0x60, 0x7f, 0x9f, 0xe1, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'g'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x1c, 0xe6, 0x19, 0x86, 0x61,
+  0x9c, 0xe3, 0xf8, 0x76, 0x01, 0x80, 0xe3, 0xf0, 0xf8,
+  // character: 'h'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0xb8, 0x7f, 0x1c, 0xe6, 0x19, 0x86, 0x61,
+  0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'i'
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
+  0x03, 0x03, 0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'j'
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x03, 0x83, 0xc0, 0xe0,
+  // character: 'k'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0x8c, 0x66, 0x1b, 0x07, 0x81, 0xc0, 0x7c,
+  0x19, 0x86, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'l'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
+  0x03, 0x03, 0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0x7f, 0x9b, 0x66, 0xd9, 0xb6, 0x6d,
+  0x9b, 0x66, 0xd9, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x7f, 0x1c, 0xe6, 0x19, 0x86, 0x61,
+  0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x1c, 0xe6, 0x19, 0x86, 0x61,
+  0x9c, 0xe3, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x7f, 0x1c, 0xe6, 0x19, 0x86, 0x61,
+  0x9c, 0xe7, 0xf1, 0xb8, 0x60, 0x18, 0x06, 0x01, 0x80,
+  // character: 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x3f, 0x9c, 0xe6, 0x19, 0x86, 0x61,
+  0x9c, 0xe3, 0xf8, 0x76, 0x01, 0x80, 0x60, 0x18, 0x06,
+  // character: 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbe, 0x7f, 0x9e, 0x07, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 's'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x18, 0x67, 0x00, 0xfc, 0x03,
+  0x98, 0x63, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 't'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x01, 0x80, 0xfc, 0x3f, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
+  0x9c, 0xe3, 0xf8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
+  0x8c, 0xc1, 0xe0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0xd9, 0xb6, 0x7f,
+  0x9f, 0xe7, 0x38, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x73, 0x8f, 0xc1, 0xe0, 0x30, 0x1e,
+  0x0f, 0xc7, 0x39, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
+  0x9c, 0xe3, 0xf8, 0x76, 0x01, 0x80, 0x63, 0xf0, 0xf8,
+  // character: 'z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0xc0, 0x60, 0x30, 0x18,
+  0x0c, 0x07, 0xf9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '{'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0xc0, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x03, 0x00, 0x70, 0x00,
+  // character: '|'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
+  0x03, 0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00,
+  // character: '}'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0x00, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x0c, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x03, 0x03, 0x80, 0x00,
+  // character: '~'
+  0x00, 0x00, 0x00, 0x00, 0xe2, 0x6d, 0x91, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const tFontPacked Font_10x20_packed_glyphs = { 10, 20, 25, 0x20, 95, Font_10x20_packed_data };
+
+const tFont Font_10x20_packed = { .packed = &Font_10x20_packed_glyphs };
@@ -70,7 +70,7 @@ static const uint8_t image_data_Font_11x22_0x20[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x20 = { image_data_Font_11x22_0x20,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -100,7 +100,7 @@ static const uint8_t image_data_Font_11x22_0x21[31] = {
     0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x21 = { image_data_Font_11x22_0x21,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -130,7 +130,7 @@ static const uint8_t image_data_Font_11x22_0x22[31] = {
     0x00, 0x06, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x22 = { image_data_Font_11x22_0x22,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -160,7 +160,7 @@ static const uint8_t image_data_Font_11x22_0x23[31] = {
     0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0xcc, 0x19, 0x9f, 0xfb, 0xff, 0x33, 0x06, 0x60, 0xcc, 0x19, 0x8f, 0xfd, 0xff, 0x9b, 0x03, 0x60, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x23 = { image_data_Font_11x22_0x23,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -190,7 +190,7 @@ static const uint8_t image_data_Font_11x22_0x24[31] = {
     0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x7f, 0x9f, 0xf3, 0x60, 0x6c, 0x0d, 0x80, 0xfc, 0x1f, 0x80, 0xcc, 0x19, 0x83, 0x33, 0xf8, 0x7f, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x24 = { image_data_Font_11x22_0x24,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -220,7 +220,7 @@ static const uint8_t image_data_Font_11x22_0x25[31] = {
     0x00, 0x00, 0x00, 0x00, 0x30, 0x66, 0x0d, 0x66, 0x2c, 0xc5, 0x98, 0x6c, 0x0d, 0x80, 0x33, 0x06, 0x63, 0x36, 0x66, 0xcc, 0xdb, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x25 = { image_data_Font_11x22_0x25,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -250,7 +250,7 @@ static const uint8_t image_data_Font_11x22_0x26[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1e, 0x03, 0xc0, 0xc6, 0x18, 0xc3, 0x18, 0x3c, 0x67, 0x8d, 0x8d, 0xb1, 0xb6, 0x0c, 0xc1, 0x98, 0x31, 0xfb, 0x3f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x26 = { image_data_Font_11x22_0x26,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -280,7 +280,7 @@ static const uint8_t image_data_Font_11x22_0x27[31] = {
     0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x27 = { image_data_Font_11x22_0x27,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -310,7 +310,7 @@ static const uint8_t image_data_Font_11x22_0x28[31] = {
     0x00, 0x00, 0x60, 0x0c, 0x06, 0x00, 0xc0, 0x18, 0x0f, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x00, 0x00
 };
 static const tImage Font_11x22_0x28 = { image_data_Font_11x22_0x28,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -340,7 +340,7 @@ static const uint8_t image_data_Font_11x22_0x29[31] = {
     0x00, 0x06, 0x00, 0xc0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x18, 0x03, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x29 = { image_data_Font_11x22_0x29,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -370,7 +370,7 @@ static const uint8_t image_data_Font_11x22_0x2a[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x6c, 0xcd, 0x98, 0xfc, 0x1f, 0x86, 0xcc, 0xd9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x2a = { image_data_Font_11x22_0x2a,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -400,7 +400,7 @@ static const uint8_t image_data_Font_11x22_0x2b[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x81, 0xff, 0x3f, 0xe0, 0xc0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x2b = { image_data_Font_11x22_0x2b,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -430,7 +430,7 @@ static const uint8_t image_data_Font_11x22_0x2c[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x30, 0x06, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x2c = { image_data_Font_11x22_0x2c,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -460,7 +460,7 @@ static const uint8_t image_data_Font_11x22_0x2d[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x2d = { image_data_Font_11x22_0x2d,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -490,7 +490,7 @@ static const uint8_t image_data_Font_11x22_0x2e[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x2e = { image_data_Font_11x22_0x2e,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -520,7 +520,7 @@ static const uint8_t image_data_Font_11x22_0x2f[31] = {
     0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x06, 0x00, 0xc0, 0x18, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x03, 0x00, 0x60, 0x0c, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x2f = { image_data_Font_11x22_0x2f,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -550,7 +550,7 @@ static const uint8_t image_data_Font_11x22_0x30[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0xf3, 0x1e, 0x6c, 0xcd, 0x99, 0xb3, 0x36, 0x67, 0x0c, 0xe1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x30 = { image_data_Font_11x22_0x30,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -580,7 +580,7 @@ static const uint8_t image_data_Font_11x22_0x31[31] = {
     0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x78, 0x1f, 0x03, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x31 = { image_data_Font_11x22_0x31,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -610,7 +610,7 @@ static const uint8_t image_data_Font_11x22_0x32[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x30, 0x06, 0x03, 0x00, 0x60, 0x30, 0x06, 0x03, 0x00, 0xe0, 0x18, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x32 = { image_data_Font_11x22_0x32,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -640,7 +640,7 @@ static const uint8_t image_data_Font_11x22_0x33[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x30, 0x06, 0x0f, 0x01, 0xe0, 0x03, 0x00, 0x60, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x33 = { image_data_Font_11x22_0x33,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -670,7 +670,7 @@ static const uint8_t image_data_Font_11x22_0x34[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0x07, 0x83, 0xf0, 0x66, 0x30, 0xc6, 0x19, 0x83, 0x30, 0x67, 0xfe, 0xff, 0xc0, 0x30, 0x06, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x34 = { image_data_Font_11x22_0x34,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -700,7 +700,7 @@ static const uint8_t image_data_Font_11x22_0x35[31] = {
     0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0xfc, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0x0f, 0xe0, 0x03, 0x00, 0x60, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x35 = { image_data_Font_11x22_0x35,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -730,7 +730,7 @@ static const uint8_t image_data_Font_11x22_0x36[31] = {
     0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xf0, 0x60, 0x1c, 0x03, 0x00, 0x7f, 0x0f, 0xe1, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x36 = { image_data_Font_11x22_0x36,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -760,7 +760,7 @@ static const uint8_t image_data_Font_11x22_0x37[31] = {
     0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0xfc, 0x01, 0x80, 0xf0, 0x18, 0x03, 0x00, 0x60, 0x30, 0x06, 0x00, 0xc0, 0x78, 0x0c, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x37 = { image_data_Font_11x22_0x37,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -790,7 +790,7 @@ static const uint8_t image_data_Font_11x22_0x38[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x3f, 0x07, 0xe1, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x38 = { image_data_Font_11x22_0x38,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -820,7 +820,7 @@ static const uint8_t image_data_Font_11x22_0x39[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xcc, 0x18, 0xff, 0x1f, 0xe0, 0x0c, 0x07, 0x80, 0xc1, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x39 = { image_data_Font_11x22_0x39,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -850,7 +850,7 @@ static const uint8_t image_data_Font_11x22_0x3a[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x3a = { image_data_Font_11x22_0x3a,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -880,7 +880,7 @@ static const uint8_t image_data_Font_11x22_0x3b[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x18, 0x03, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x3b = { image_data_Font_11x22_0x3b,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -910,7 +910,7 @@ static const uint8_t image_data_Font_11x22_0x3c[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1e, 0x3c, 0x07, 0x83, 0x80, 0x70, 0x03, 0xc0, 0x7f, 0x80, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x3c = { image_data_Font_11x22_0x3c,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -940,7 +940,7 @@ static const uint8_t image_data_Font_11x22_0x3d[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0xfc, 0x00, 0x00, 0x07, 0xfe, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x3d = { image_data_Font_11x22_0x3d,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -970,7 +970,7 @@ static const uint8_t image_data_Font_11x22_0x3e[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x80, 0x0f, 0x01, 0xe0, 0x03, 0x80, 0x70, 0xf0, 0xfe, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x3e = { image_data_Font_11x22_0x3e,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1000,7 +1000,7 @@ static const uint8_t image_data_Font_11x22_0x3f[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x30, 0x06, 0x03, 0x00, 0x60, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x3f = { image_data_Font_11x22_0x3f,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1030,7 +1030,7 @@ static const uint8_t image_data_Font_11x22_0x40[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0xbb, 0xfc, 0x7b, 0xb3, 0x76, 0x6e, 0xcd, 0xd9, 0xb8, 0xfd, 0xdf, 0x98, 0x01, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x40 = { image_data_Font_11x22_0x40,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1060,7 +1060,7 @@ static const uint8_t image_data_Font_11x22_0x41[31] = {
     0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xf0, 0x1e, 0x0f, 0xf1, 0x86, 0x30, 0xc6, 0x18, 0xff, 0x1f, 0xe6, 0x06, 0xc0, 0xd8, 0x1b, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x41 = { image_data_Font_11x22_0x41,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1090,7 +1090,7 @@ static const uint8_t image_data_Font_11x22_0x42[31] = {
     0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x7f, 0xcf, 0xf9, 0x81, 0xb0, 0x36, 0x06, 0xc0, 0xd8, 0x1b, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x42 = { image_data_Font_11x22_0x42,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1120,7 +1120,7 @@ static const uint8_t image_data_Font_11x22_0x43[31] = {
     0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0xfc, 0x60, 0xdc, 0x1b, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xe0, 0xcc, 0x18, 0x7e, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x43 = { image_data_Font_11x22_0x43,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1150,7 +1150,7 @@ static const uint8_t image_data_Font_11x22_0x44[31] = {
     0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0xc1, 0x98, 0x3b, 0x03, 0x60, 0x6c, 0x0d, 0x81, 0xb0, 0x36, 0x06, 0xc1, 0xd8, 0x33, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x44 = { image_data_Font_11x22_0x44,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1180,7 +1180,7 @@ static const uint8_t image_data_Font_11x22_0x45[31] = {
     0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0xfc, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0x0f, 0xe1, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x45 = { image_data_Font_11x22_0x45,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1210,7 +1210,7 @@ static const uint8_t image_data_Font_11x22_0x46[31] = {
     0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0xfc, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0x0f, 0xe1, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x46 = { image_data_Font_11x22_0x46,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1240,7 +1240,7 @@ static const uint8_t image_data_Font_11x22_0x47[31] = {
     0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0xfc, 0x60, 0xdc, 0x1b, 0x00, 0x60, 0x0c, 0x01, 0x8f, 0xb1, 0xf6, 0x06, 0xe0, 0xcc, 0x18, 0x7e, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x47 = { image_data_Font_11x22_0x47,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1270,7 +1270,7 @@ static const uint8_t image_data_Font_11x22_0x48[31] = {
     0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x06, 0xc0, 0xd8, 0x1b, 0x03, 0x7f, 0xef, 0xfd, 0x81, 0xb0, 0x36, 0x06, 0xc0, 0xd8, 0x1b, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x48 = { image_data_Font_11x22_0x48,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1300,7 +1300,7 @@ static const uint8_t image_data_Font_11x22_0x49[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x01, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x49 = { image_data_Font_11x22_0x49,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1330,7 +1330,7 @@ static const uint8_t image_data_Font_11x22_0x4a[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc3, 0xe0, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x4a = { image_data_Font_11x22_0x4a,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1360,7 +1360,7 @@ static const uint8_t image_data_Font_11x22_0x4b[31] = {
     0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x06, 0xc1, 0x98, 0xf3, 0x18, 0x6c, 0x0d, 0x81, 0xf0, 0x3e, 0x06, 0x30, 0xc7, 0x98, 0x33, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x4b = { image_data_Font_11x22_0x4b,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1390,7 +1390,7 @@ static const uint8_t image_data_Font_11x22_0x4c[31] = {
     0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x4c = { image_data_Font_11x22_0x4c,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1420,7 +1420,7 @@ static const uint8_t image_data_Font_11x22_0x4d[31] = {
     0x00, 0x00, 0x00, 0x00, 0x70, 0x7e, 0x0f, 0xc1, 0xfc, 0xfd, 0x9b, 0xb3, 0x76, 0x6e, 0x31, 0xc6, 0x38, 0xc7, 0x18, 0xe0, 0x1c, 0x03, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x4d = { image_data_Font_11x22_0x4d,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1450,7 +1450,7 @@ static const uint8_t image_data_Font_11x22_0x4e[31] = {
     0x00, 0x00, 0x00, 0x00, 0x38, 0x37, 0x06, 0xe0, 0xdf, 0x1b, 0x63, 0x6c, 0x6d, 0x8d, 0x8d, 0xb1, 0xb6, 0x36, 0xc7, 0xd8, 0x3b, 0x07, 0x60, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x4e = { image_data_Font_11x22_0x4e,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1480,7 +1480,7 @@ static const uint8_t image_data_Font_11x22_0x4f[31] = {
     0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xf0, 0x61, 0x9c, 0x3b, 0x03, 0x60, 0x6c, 0x0d, 0x81, 0xb0, 0x36, 0x06, 0xe1, 0xcc, 0x30, 0x78, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x4f = { image_data_Font_11x22_0x4f,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1510,7 +1510,7 @@ static const uint8_t image_data_Font_11x22_0x50[31] = {
     0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xcc, 0x19, 0xfc, 0x3f, 0x86, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x50 = { image_data_Font_11x22_0x50,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1540,7 +1540,7 @@ static const uint8_t image_data_Font_11x22_0x51[31] = {
     0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xf0, 0x61, 0x9c, 0x3b, 0x03, 0x60, 0x6c, 0x0d, 0x81, 0xb0, 0x36, 0x06, 0xe1, 0xcc, 0x30, 0x7b, 0x0f, 0x60, 0x0c, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x51 = { image_data_Font_11x22_0x51,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1570,7 +1570,7 @@ static const uint8_t image_data_Font_11x22_0x52[31] = {
     0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xcc, 0x19, 0xfc, 0x3f, 0x86, 0x30, 0xc7, 0x98, 0x33, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x52 = { image_data_Font_11x22_0x52,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1600,7 +1600,7 @@ static const uint8_t image_data_Font_11x22_0x53[31] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0xe3, 0xfc, 0xc0, 0xd8, 0x1b, 0x00, 0x3c, 0x07, 0x80, 0x0f, 0x01, 0xe0, 0x06, 0xc0, 0xd8, 0x19, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x53 = { image_data_Font_11x22_0x53,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1630,7 +1630,7 @@ static const uint8_t image_data_Font_11x22_0x54[31] = {
     0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x54 = { image_data_Font_11x22_0x54,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1660,7 +1660,7 @@ static const uint8_t image_data_Font_11x22_0x55[31] = {
     0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x06, 0xc0, 0xd8, 0x1b, 0x03, 0x60, 0x6c, 0x0d, 0x81, 0xb0, 0x36, 0x06, 0xc0, 0xd8, 0x19, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x55 = { image_data_Font_11x22_0x55,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1690,7 +1690,7 @@ static const uint8_t image_data_Font_11x22_0x56[31] = {
     0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x07, 0x00, 0xf8, 0x3b, 0x06, 0x60, 0xcc, 0x18, 0xcc, 0x19, 0x83, 0x30, 0x7e, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x56 = { image_data_Font_11x22_0x56,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1720,7 +1720,7 @@ static const uint8_t image_data_Font_11x22_0x57[31] = {
     0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x07, 0x18, 0xe3, 0x1c, 0x63, 0xb3, 0x76, 0x6e, 0xcd, 0xd9, 0xb7, 0x3c, 0xe7, 0x98, 0x33, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x57 = { image_data_Font_11x22_0x57,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1750,7 +1750,7 @@ static const uint8_t image_data_Font_11x22_0x58[31] = {
     0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x06, 0xc0, 0xdc, 0x39, 0x86, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x83, 0x0c, 0xe1, 0xd8, 0x1b, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x58 = { image_data_Font_11x22_0x58,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1780,7 +1780,7 @@ static const uint8_t image_data_Font_11x22_0x59[31] = {
     0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x07, 0x00, 0xf8, 0x3b, 0x06, 0x33, 0x06, 0x60, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x59 = { image_data_Font_11x22_0x59,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1810,7 +1810,7 @@ static const uint8_t image_data_Font_11x22_0x5a[31] = {
     0x00, 0x00, 0x00, 0x00, 0x3f, 0xf7, 0xfe, 0x00, 0xc0, 0x38, 0x06, 0x03, 0x00, 0x60, 0x30, 0x06, 0x03, 0x00, 0xe0, 0x18, 0x03, 0xff, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x5a = { image_data_Font_11x22_0x5a,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1840,7 +1840,7 @@ static const uint8_t image_data_Font_11x22_0x5b[31] = {
     0x00, 0x07, 0xe0, 0xfc, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x1f, 0x83, 0xf0, 0x00, 0x00
 };
 static const tImage Font_11x22_0x5b = { image_data_Font_11x22_0x5b,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1870,7 +1870,7 @@ static const uint8_t image_data_Font_11x22_0x5c[31] = {
     0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0xc0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x5c = { image_data_Font_11x22_0x5c,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1900,7 +1900,7 @@ static const uint8_t image_data_Font_11x22_0x5d[31] = {
     0x00, 0x07, 0xe0, 0xfc, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x1f, 0x83, 0xf0, 0x00, 0x00
 };
 static const tImage Font_11x22_0x5d = { image_data_Font_11x22_0x5d,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1930,7 +1930,7 @@ static const uint8_t image_data_Font_11x22_0x5e[31] = {
     0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x66, 0x0c, 0xc1, 0x98, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x5e = { image_data_Font_11x22_0x5e,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1960,7 +1960,7 @@ static const uint8_t image_data_Font_11x22_0x5f[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x5f = { image_data_Font_11x22_0x5f,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1990,7 +1990,7 @@ static const uint8_t image_data_Font_11x22_0x60[31] = {
     0x00, 0x06, 0x00, 0xc0, 0x06, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x60 = { image_data_Font_11x22_0x60,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2020,7 +2020,7 @@ static const uint8_t image_data_Font_11x22_0x61[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0xf8, 0x00, 0xc0, 0x18, 0xff, 0x1f, 0xe6, 0x0c, 0xc1, 0x98, 0x31, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x61 = { image_data_Font_11x22_0x61,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2050,7 +2050,7 @@ static const uint8_t image_data_Font_11x22_0x62[31] = {
     0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x1f, 0xc3, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x33, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x62 = { image_data_Font_11x22_0x62,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2080,7 +2080,7 @@ static const uint8_t image_data_Font_11x22_0x63[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0xf8, 0x60, 0xcc, 0x19, 0x80, 0x30, 0x06, 0x00, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x63 = { image_data_Font_11x22_0x63,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2110,7 +2110,7 @@ static const uint8_t image_data_Font_11x22_0x64[31] = {
     0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x8f, 0xf1, 0xfe, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x31, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x64 = { image_data_Font_11x22_0x64,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2140,7 +2140,7 @@ static const uint8_t image_data_Font_11x22_0x65[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0xf8, 0x60, 0xcc, 0x19, 0xff, 0x3f, 0xe6, 0x00, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x65 = { image_data_Font_11x22_0x65,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2170,7 +2170,7 @@ static const uint8_t image_data_Font_11x22_0x66[31] = {
     0x00, 0x01, 0xf8, 0x3f, 0x18, 0x03, 0x00, 0x60, 0x1f, 0xc3, 0xf8, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x66 = { image_data_Font_11x22_0x66,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2200,7 +2200,7 @@ static const uint8_t image_data_Font_11x22_0x67[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x31, 0xe6, 0x63, 0x0c, 0x61, 0x8c, 0x31, 0x83, 0xc0, 0xf8, 0x18, 0x01, 0xf8, 0x3f, 0x0c, 0x19, 0x83, 0x30, 0x67, 0xfc, 0x7e, 0x00
 };
 static const tImage Font_11x22_0x67 = { image_data_Font_11x22_0x67,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2230,7 +2230,7 @@ static const uint8_t image_data_Font_11x22_0x68[31] = {
     0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x1f, 0xc3, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x68 = { image_data_Font_11x22_0x68,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2260,7 +2260,7 @@ static const uint8_t image_data_Font_11x22_0x69[31] = {
     0x00, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0xe0, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x69 = { image_data_Font_11x22_0x69,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2290,7 +2290,7 @@ static const uint8_t image_data_Font_11x22_0x6a[31] = {
     0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x78, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x3e, 0x07, 0xc0, 0x00, 0x00
 };
 static const tImage Font_11x22_0x6a = { image_data_Font_11x22_0x6a,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2320,7 +2320,7 @@ static const uint8_t image_data_Font_11x22_0x6b[31] = {
     0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x33, 0x06, 0x63, 0x0c, 0x61, 0xb0, 0x36, 0x07, 0xc0, 0xfe, 0x18, 0xc3, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x6b = { image_data_Font_11x22_0x6b,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2350,7 +2350,7 @@ static const uint8_t image_data_Font_11x22_0x6c[31] = {
     0x00, 0x07, 0x80, 0xf0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x6c = { image_data_Font_11x22_0x6c,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2380,7 +2380,7 @@ static const uint8_t image_data_Font_11x22_0x6d[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xc3, 0x98, 0x6c, 0xcd, 0x99, 0xb3, 0x36, 0x66, 0xcc, 0xd9, 0x9b, 0x33, 0x66, 0x6c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x6d = { image_data_Font_11x22_0x6d,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2410,7 +2410,7 @@ static const uint8_t image_data_Font_11x22_0x6e[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc3, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x6e = { image_data_Font_11x22_0x6e,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2440,7 +2440,7 @@ static const uint8_t image_data_Font_11x22_0x6f[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x6f = { image_data_Font_11x22_0x6f,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2470,7 +2470,7 @@ static const uint8_t image_data_Font_11x22_0x70[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc3, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x33, 0xf8, 0x7f, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x00
 };
 static const tImage Font_11x22_0x70 = { image_data_Font_11x22_0x70,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2500,7 +2500,7 @@ static const uint8_t image_data_Font_11x22_0x71[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0xfe, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x31, 0xfe, 0x3f, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80
 };
 static const tImage Font_11x22_0x71 = { image_data_Font_11x22_0x71,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2530,7 +2530,7 @@ static const uint8_t image_data_Font_11x22_0x72[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xc3, 0x78, 0x70, 0xce, 0x19, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x72 = { image_data_Font_11x22_0x72,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2560,7 +2560,7 @@ static const uint8_t image_data_Font_11x22_0x73[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0xfe, 0x60, 0x0c, 0x00, 0xf0, 0x1e, 0x00, 0x30, 0x07, 0x80, 0x33, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x73 = { image_data_Font_11x22_0x73,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2590,7 +2590,7 @@ static const uint8_t image_data_Font_11x22_0x74[31] = {
     0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0f, 0xf1, 0xfe, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x7e, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x74 = { image_data_Font_11x22_0x74,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2620,7 +2620,7 @@ static const uint8_t image_data_Font_11x22_0x75[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x06, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x31, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x75 = { image_data_Font_11x22_0x75,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2650,7 +2650,7 @@ static const uint8_t image_data_Font_11x22_0x76[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x06, 0x60, 0xcc, 0x18, 0xcc, 0x19, 0x83, 0x30, 0x7e, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x76 = { image_data_Font_11x22_0x76,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2680,7 +2680,7 @@ static const uint8_t image_data_Font_11x22_0x77[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1c, 0x03, 0x8c, 0x71, 0x8e, 0x31, 0xc6, 0x3b, 0x37, 0xe7, 0xdc, 0xf3, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x77 = { image_data_Font_11x22_0x77,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2710,7 +2710,7 @@ static const uint8_t image_data_Font_11x22_0x78[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x06, 0x33, 0x06, 0x60, 0x30, 0x06, 0x00, 0xc0, 0x7e, 0x0c, 0xc3, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x78 = { image_data_Font_11x22_0x78,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2740,7 +2740,7 @@ static const uint8_t image_data_Font_11x22_0x79[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x06, 0x60, 0xcc, 0x18, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc0, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x03, 0xc0, 0x60, 0x00
 };
 static const tImage Font_11x22_0x79 = { image_data_Font_11x22_0x79,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2770,7 +2770,7 @@ static const uint8_t image_data_Font_11x22_0x7a[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xfe, 0x00, 0xc0, 0x18, 0x0c, 0x01, 0x80, 0xc0, 0x78, 0x0c, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x7a = { image_data_Font_11x22_0x7a,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2800,7 +2800,7 @@ static const uint8_t image_data_Font_11x22_0x7b[31] = {
     0x00, 0x00, 0x78, 0x0f, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x81, 0xc0, 0x38, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x01, 0xe0, 0x3c, 0x00, 0x00
 };
 static const tImage Font_11x22_0x7b = { image_data_Font_11x22_0x7b,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2830,7 +2830,7 @@ static const uint8_t image_data_Font_11x22_0x7c[31] = {
     0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x00, 0x00
 };
 static const tImage Font_11x22_0x7c = { image_data_Font_11x22_0x7c,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2860,7 +2860,7 @@ static const uint8_t image_data_Font_11x22_0x7d[31] = {
     0x00, 0x0e, 0x01, 0xc0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x0f, 0x01, 0xe0, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x38, 0x07, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x7d = { image_data_Font_11x22_0x7d,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2890,7 +2890,7 @@ static const uint8_t image_data_Font_11x22_0x7e[31] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x6f, 0x8e, 0x3f, 0x47, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_11x22_0x7e = { image_data_Font_11x22_0x7e,
-    11, 22, 8};
+    11, 22, 8, 0};
 #endif
 
 
@@ -3659,5 +3659,5 @@ static const tChar Font_11x22_array[] = {
 };
 
 
-const tFont Font_11x22 = { 95, Font_11x22_array };
+const tFont Font_11x22 = { 95, Font_11x22_array, .first_code = 0x20, .dense = 95 };
 
@@ -0,0 +1,308 @@
+/*******************************************************************************
+* name: Font_11x22
+* family: basis33
+* size: 28
+* style: Regular
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* type: monospaced
+* encoding: UTF-8
+*
+* packed: 95 glyphs 11x22, 31 bytes per glyph, first code 0x20
+* glyph bits are continuous across rows like tImage, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_11x22_packed_data[2945] = {
+  // character: ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '!'
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '"'
+  0x00, 0x06, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '#'
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0xcc, 0x19, 0x9f, 0xfb, 0xff, 0x33, 0x06, 0x60, 0xcc, 0x19,
+  0x8f, 0xfd, 0xff, 0x9b, 0x03, 0x60, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '$'
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x7f, 0x9f, 0xf3, 0x60, 0x6c, 0x0d, 0x80, 0xfc, 0x1f,
+  0x80, 0xcc, 0x19, 0x83, 0x33, 0xf8, 0x7f, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '%'
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x66, 0x0d, 0x66, 0x2c, 0xc5, 0x98, 0x6c, 0x0d, 0x80, 0x33, 0x06,
+  0x63, 0x36, 0x66, 0xcc, 0xdb, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '&'
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x03, 0xc0, 0xc6, 0x18, 0xc3, 0x18, 0x3c, 0x67, 0x8d, 0x8d, 0xb1,
+  0xb6, 0x0c, 0xc1, 0x98, 0x31, 0xfb, 0x3f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '''
+  0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '('
+  0x00, 0x00, 0x60, 0x0c, 0x06, 0x00, 0xc0, 0x18, 0x0f, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18,
+  0x03, 0x00, 0x60, 0x0c, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x00, 0x00,
+  // character: ')'
+  0x00, 0x06, 0x00, 0xc0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xc0, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x18, 0x03, 0x00, 0x00, 0x00,
+  // character: '*'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x6c, 0xcd, 0x98, 0xfc, 0x1f,
+  0x86, 0xcc, 0xd9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x81, 0xff, 0x3f,
+  0xe0, 0xc0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x30, 0x06, 0x00, 0x00, 0x00,
+  // character: '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x3f,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '/'
+  0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x06, 0x00, 0xc0, 0x18, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x03, 0x00, 0x60, 0x0c, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '0'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0xf3, 0x1e, 0x6c, 0xcd, 0x99, 0xb3, 0x36,
+  0x67, 0x0c, 0xe1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '1'
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x78, 0x1f, 0x03, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x03, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '2'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x30, 0x06, 0x03, 0x00, 0x60, 0x30, 0x06,
+  0x03, 0x00, 0xe0, 0x18, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '3'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x30, 0x06, 0x0f, 0x01, 0xe0, 0x03, 0x00,
+  0x60, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0x07, 0x83, 0xf0, 0x66, 0x30, 0xc6, 0x19, 0x83, 0x30,
+  0x67, 0xfe, 0xff, 0xc0, 0x30, 0x06, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '5'
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0xfc, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0x0f, 0xe0, 0x03, 0x00,
+  0x60, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '6'
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xf0, 0x60, 0x1c, 0x03, 0x00, 0x7f, 0x0f, 0xe1, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '7'
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0xfc, 0x01, 0x80, 0xf0, 0x18, 0x03, 0x00, 0x60, 0x30, 0x06,
+  0x00, 0xc0, 0x78, 0x0c, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '8'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x3f, 0x07, 0xe1, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '9'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xcc, 0x18, 0xff, 0x1f,
+  0xe0, 0x0c, 0x07, 0x80, 0xc1, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x18, 0x03, 0x00, 0x00, 0x00,
+  // character: '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1e, 0x3c, 0x07, 0x83, 0x80, 0x70,
+  0x03, 0xc0, 0x7f, 0x80, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0xfc, 0x00, 0x00,
+  0x07, 0xfe, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x80, 0x0f, 0x01, 0xe0, 0x03, 0x80,
+  0x70, 0xf0, 0xfe, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '?'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0x98, 0x30, 0x06, 0x03, 0x00, 0x60, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '@'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0xc1, 0xbb, 0xfc, 0x7b, 0xb3, 0x76, 0x6e, 0xcd, 0xd9,
+  0xb8, 0xfd, 0xdf, 0x98, 0x01, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'A'
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xf0, 0x1e, 0x0f, 0xf1, 0x86, 0x30, 0xc6, 0x18, 0xff, 0x1f,
+  0xe6, 0x06, 0xc0, 0xd8, 0x1b, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'B'
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x7f, 0xcf, 0xf9, 0x81, 0xb0,
+  0x36, 0x06, 0xc0, 0xd8, 0x1b, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'C'
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0xfc, 0x60, 0xdc, 0x1b, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30,
+  0x06, 0x00, 0xe0, 0xcc, 0x18, 0x7e, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'D'
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0xc1, 0x98, 0x3b, 0x03, 0x60, 0x6c, 0x0d, 0x81, 0xb0,
+  0x36, 0x06, 0xc1, 0xd8, 0x33, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'E'
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0xfc, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0x0f, 0xe1, 0x80, 0x30,
+  0x06, 0x00, 0xc0, 0x18, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'F'
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0xfc, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0x0f, 0xe1, 0x80, 0x30,
+  0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'G'
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0xfc, 0x60, 0xdc, 0x1b, 0x00, 0x60, 0x0c, 0x01, 0x8f, 0xb1,
+  0xf6, 0x06, 0xe0, 0xcc, 0x18, 0x7e, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'H'
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x06, 0xc0, 0xd8, 0x1b, 0x03, 0x7f, 0xef, 0xfd, 0x81, 0xb0,
+  0x36, 0x06, 0xc0, 0xd8, 0x1b, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'I'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x03, 0x01, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'J'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xc3, 0xe0, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'K'
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x06, 0xc1, 0x98, 0xf3, 0x18, 0x6c, 0x0d, 0x81, 0xf0, 0x3e,
+  0x06, 0x30, 0xc7, 0x98, 0x33, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'L'
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30,
+  0x06, 0x00, 0xc0, 0x18, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'M'
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x7e, 0x0f, 0xc1, 0xfc, 0xfd, 0x9b, 0xb3, 0x76, 0x6e, 0x31, 0xc6,
+  0x38, 0xc7, 0x18, 0xe0, 0x1c, 0x03, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'N'
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x37, 0x06, 0xe0, 0xdf, 0x1b, 0x63, 0x6c, 0x6d, 0x8d, 0x8d, 0xb1,
+  0xb6, 0x36, 0xc7, 0xd8, 0x3b, 0x07, 0x60, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'O'
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xf0, 0x61, 0x9c, 0x3b, 0x03, 0x60, 0x6c, 0x0d, 0x81, 0xb0,
+  0x36, 0x06, 0xe1, 0xcc, 0x30, 0x78, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'P'
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xcc, 0x19, 0xfc, 0x3f,
+  0x86, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Q'
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xf0, 0x61, 0x9c, 0x3b, 0x03, 0x60, 0x6c, 0x0d, 0x81, 0xb0,
+  0x36, 0x06, 0xe1, 0xcc, 0x30, 0x7b, 0x0f, 0x60, 0x0c, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  // character: 'R'
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xcc, 0x19, 0xfc, 0x3f,
+  0x86, 0x30, 0xc7, 0x98, 0x33, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'S'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xe3, 0xfc, 0xc0, 0xd8, 0x1b, 0x00, 0x3c, 0x07, 0x80, 0x0f, 0x01,
+  0xe0, 0x06, 0xc0, 0xd8, 0x19, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'T'
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'U'
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x06, 0xc0, 0xd8, 0x1b, 0x03, 0x60, 0x6c, 0x0d, 0x81, 0xb0,
+  0x36, 0x06, 0xc0, 0xd8, 0x19, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'V'
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x07, 0x00, 0xf8, 0x3b, 0x06, 0x60, 0xcc, 0x18, 0xcc, 0x19,
+  0x83, 0x30, 0x7e, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'W'
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x07, 0x18, 0xe3, 0x1c, 0x63, 0xb3, 0x76, 0x6e, 0xcd, 0xd9,
+  0xb7, 0x3c, 0xe7, 0x98, 0x33, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'X'
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x06, 0xc0, 0xdc, 0x39, 0x86, 0x0f, 0x01, 0xe0, 0x3c, 0x07,
+  0x83, 0x0c, 0xe1, 0xd8, 0x1b, 0x03, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Y'
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x07, 0x00, 0xf8, 0x3b, 0x06, 0x33, 0x06, 0x60, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Z'
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xf7, 0xfe, 0x00, 0xc0, 0x38, 0x06, 0x03, 0x00, 0x60, 0x30, 0x06,
+  0x03, 0x00, 0xe0, 0x18, 0x03, 0xff, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '['
+  0x00, 0x07, 0xe0, 0xfc, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18,
+  0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x1f, 0x83, 0xf0, 0x00, 0x00,
+  // character: '\\'
+  0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0x30, 0x06, 0x00, 0xc0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ']'
+  0x00, 0x07, 0xe0, 0xfc, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x1f, 0x83, 0xf0, 0x00, 0x00,
+  // character: '^'
+  0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x66, 0x0c, 0xc1, 0x98, 0x60, 0xcc, 0x19, 0x83, 0x30,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '_'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
+  // character: '`'
+  0x00, 0x06, 0x00, 0xc0, 0x06, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'a'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0xf8, 0x00, 0xc0, 0x18, 0xff, 0x1f,
+  0xe6, 0x0c, 0xc1, 0x98, 0x31, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'b'
+  0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x1f, 0xc3, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x33, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'c'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0xf8, 0x60, 0xcc, 0x19, 0x80, 0x30,
+  0x06, 0x00, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'd'
+  0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x8f, 0xf1, 0xfe, 0x60, 0xcc, 0x19, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x31, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'e'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0xf8, 0x60, 0xcc, 0x19, 0xff, 0x3f,
+  0xe6, 0x00, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'f'
+  0x00, 0x01, 0xf8, 0x3f, 0x18, 0x03, 0x00, 0x60, 0x1f, 0xc3, 0xf8, 0x30, 0x06, 0x00, 0xc0, 0x18,
+  0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'g'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x31, 0xe6, 0x63, 0x0c, 0x61, 0x8c, 0x31,
+  0x83, 0xc0, 0xf8, 0x18, 0x01, 0xf8, 0x3f, 0x0c, 0x19, 0x83, 0x30, 0x67, 0xfc, 0x7e, 0x00,
+  // character: 'h'
+  0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x1f, 0xc3, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'i'
+  0x00, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0xe0, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'j'
+  0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x78, 0x03, 0x00, 0x60, 0x0c, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x3e, 0x07, 0xc0, 0x00, 0x00,
+  // character: 'k'
+  0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x33, 0x06, 0x63, 0x0c, 0x61, 0xb0, 0x36,
+  0x07, 0xc0, 0xfe, 0x18, 0xc3, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'l'
+  0x00, 0x07, 0x80, 0xf0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xc3, 0x98, 0x6c, 0xcd, 0x99, 0xb3, 0x36,
+  0x66, 0xcc, 0xd9, 0x9b, 0x33, 0x66, 0x6c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc3, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x31, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc3, 0xf8, 0x60, 0xcc, 0x19, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x33, 0xf8, 0x7f, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x00,
+  // character: 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0xfe, 0x60, 0xcc, 0x19, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x31, 0xfe, 0x3f, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80,
+  // character: 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xc3, 0x78, 0x70, 0xce, 0x19, 0x80, 0x30,
+  0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 's'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0xfe, 0x60, 0x0c, 0x00, 0xf0, 0x1e,
+  0x00, 0x30, 0x07, 0x80, 0x33, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 't'
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x60, 0x0f, 0xf1, 0xfe, 0x30, 0x06, 0x00, 0xc0, 0x18,
+  0x03, 0x00, 0x60, 0x0c, 0x00, 0x7e, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x06, 0x60, 0xcc, 0x19, 0x83, 0x30,
+  0x66, 0x0c, 0xc1, 0x98, 0x31, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x06, 0x60, 0xcc, 0x18, 0xcc, 0x19,
+  0x83, 0x30, 0x7e, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1c, 0x03, 0x8c, 0x71, 0x8e, 0x31, 0xc6,
+  0x3b, 0x37, 0xe7, 0xdc, 0xf3, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x06, 0x33, 0x06, 0x60, 0x30, 0x06,
+  0x00, 0xc0, 0x7e, 0x0c, 0xc3, 0x06, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x06, 0x60, 0xcc, 0x18, 0xcc, 0x19,
+  0x83, 0x30, 0x66, 0x0c, 0xc0, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x03, 0xc0, 0x60, 0x00,
+  // character: 'z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xfe, 0x00, 0xc0, 0x18, 0x0c, 0x01,
+  0x80, 0xc0, 0x78, 0x0c, 0x03, 0xfe, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '{'
+  0x00, 0x00, 0x78, 0x0f, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x81, 0xc0, 0x38,
+  0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x01, 0xe0, 0x3c, 0x00, 0x00,
+  // character: '|'
+  0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x00, 0x00,
+  // character: '}'
+  0x00, 0x0e, 0x01, 0xc0, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x0f, 0x01,
+  0xe0, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x38, 0x07, 0x00, 0x00, 0x00,
+  // character: '~'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x6f, 0x8e, 0x3f, 0x47,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const tFontPacked Font_11x22_packed_glyphs = { 11, 22, 31, 0x20, 95, Font_11x22_packed_data };
+
+const tFont Font_11x22_packed = { .packed = &Font_11x22_packed_glyphs };
@@ -0,0 +1,691 @@
+/*******************************************************************************
+* name: Font_13x14_aa
+* family: Wheaton RS
+* size: 14
+* style: Regular
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* antialiasing: yes
+* type: monospaced
+* encoding: UTF-8
+* bits per pixel: 4
+*
+* Font_25x27 supersampled 2x2, coverage 0 (background) .. 15 (foreground)
+* packed: 95 glyphs 13x14, 91 bytes per glyph, first code 0x20
+* pixels are continuous across rows, high nibble first, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_13x14_aa_data[8645] = {
+  // character: ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '!'
+  0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '"'
+  0x00, 0x04, 0x80, 0x08, 0x40, 0x00, 0x00, 0x00, 0x8f, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x08, 0xf0,
+  0x0f, 0x80, 0x00, 0x00, 0x00, 0x8f, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x0f, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '#'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8,
+  0x0f, 0x80, 0x00, 0x00, 0x04, 0x8f, 0xb8, 0xfb, 0x80, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x00, 0x04, 0x8f,
+  0xb8, 0xfb, 0x80, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x80, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x08, 0x40, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '$'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8f,
+  0xf8, 0xf8, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x8f, 0x80, 0x00, 0x88, 0x00,
+  0x00, 0x08, 0xff, 0xb8, 0x88, 0x40, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0xf0, 0x00, 0x00, 0x8f, 0xb8, 0x8b, 0xff, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x08, 0x8b, 0xf8, 0x84, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '%'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xf4, 0x00, 0x8f, 0x00, 0x00, 0x8f, 0x8f, 0x80,
+  0x0f, 0x80, 0x00, 0x08, 0xf0, 0xf8, 0x04, 0xf0, 0x00, 0x00, 0x8f, 0x0f, 0x80, 0xb8, 0x00, 0x00,
+  0x08, 0xf8, 0xf8, 0x4f, 0x08, 0x88, 0x40, 0x4f, 0xff, 0x4b, 0xb8, 0xff, 0xff, 0x00, 0x00, 0x04,
+  0xf4, 0x8f, 0x08, 0xf0, 0x00, 0x00, 0x8b, 0x08, 0xf0, 0x8f, 0x00, 0x00, 0x0f, 0x40, 0x8f, 0x08,
+  0xf0, 0x00, 0x08, 0xb0, 0x08, 0xff, 0xff, 0x00, 0x00, 0x84, 0x00, 0x08, 0x88, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '&'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x8f, 0xf8,
+  0x88, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xff, 0xb8, 0x88, 0x84, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x8f, 0xf8,
+  0x00, 0xff, 0x80, 0x00, 0x08, 0xff, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0xff, 0x80,
+  0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x04, 0x88, 0x84, 0x48, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '''
+  0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '('
+  0x00, 0x00, 0x00, 0xfb, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00,
+  // character: ')'
+  0x00, 0x04, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00,
+  // character: '*'
+  0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x08, 0x44,
+  0xf0, 0x84, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xff, 0x80, 0x00, 0x00, 0x00, 0x0b, 0xf4, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0xb4, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0xb0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+  0x00, 0x04, 0x88, 0xbf, 0x88, 0x80, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00,
+  // character: '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '/'
+  0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x8f, 0xf8,
+  0x8b, 0xff, 0x00, 0x00, 0x08, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x8f, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x08, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x8f, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0x8f, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x08, 0xff, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '1'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x08, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '2'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfb, 0x40, 0x00, 0x00, 0x48, 0x88,
+  0x8b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00,
+  0x00, 0x00, 0x48, 0x88, 0xff, 0xf0, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x88, 0x88, 0x80,
+  0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '3'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x48, 0x88,
+  0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00,
+  0x00, 0x04, 0x88, 0x8b, 0xff, 0x40, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xff, 0x00,
+  0x00, 0x08, 0xff, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x8f, 0xf8, 0x8f, 0xff, 0x00, 0x00, 0x04, 0xff,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '5'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfb,
+  0x88, 0x88, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x08, 0x88, 0x8b, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '6'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x8f, 0xf8,
+  0x8f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x00, 0x88, 0x40, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xff, 0x88, 0x88, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0x8f, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x08, 0xff, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '7'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xb8,
+  0x88, 0xff, 0x80, 0x00, 0x0f, 0xf8, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x88, 0x40, 0x08, 0xff, 0x80,
+  0x00, 0x00, 0x00, 0x0b, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x08,
+  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '8'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0xff, 0xb8,
+  0x8b, 0xff, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0x80, 0x08, 0xff, 0x00,
+  0x00, 0x0b, 0xfb, 0x88, 0xbf, 0xb0, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x0f, 0xf8,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0x80, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x8f, 0xf8,
+  0x8b, 0xff, 0x00, 0x00, 0x08, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x8f, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x08, 0xff, 0x88, 0xbf, 0xf0, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0x08, 0x80, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00,
+  // character: '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x4b, 0xff, 0x80, 0x00,
+  0x00, 0x04, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b,
+  0xfb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xfb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x48, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x04,
+  0xbf, 0xf8, 0x00, 0x00, 0x00, 0x4b, 0xff, 0x80, 0x00, 0x00, 0x00, 0x08, 0xb4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '?'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0xff, 0xb8,
+  0x8f, 0xf8, 0x00, 0x00, 0x08, 0x84, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x08, 0x8f, 0xf8, 0x00,
+  0x00, 0x00, 0x0f, 0xff, 0xfb, 0x40, 0x00, 0x00, 0x00, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '@'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff,
+  0xff, 0xf4, 0x00, 0x00, 0x0f, 0xf8, 0x88, 0x8b, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x8f, 0x00,
+  0x00, 0x0f, 0x80, 0xbf, 0xff, 0xf0, 0x00, 0x00, 0xf8, 0x0f, 0xb8, 0xbf, 0x00, 0x00, 0x0f, 0x80,
+  0xf8, 0x08, 0xf0, 0x00, 0x00, 0xf8, 0x0f, 0xb8, 0xbf, 0x00, 0x00, 0x0f, 0x80, 0xbf, 0xff, 0xf0,
+  0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x08, 0x40, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0xf8, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 0x40, 0x00,
+  // character: 'A'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x8f, 0xfb,
+  0x8b, 0xf0, 0x00, 0x00, 0x08, 0xff, 0x80, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x08, 0xf0, 0x00,
+  0x00, 0x08, 0xff, 0x80, 0x8f, 0x00, 0x00, 0x00, 0xbf, 0xfb, 0x8b, 0xf4, 0x00, 0x00, 0x8f, 0xff,
+  0xff, 0xff, 0xf8, 0x00, 0x08, 0xff, 0x80, 0x00, 0xff, 0x80, 0x00, 0x8f, 0xf8, 0x00, 0x0f, 0xf8,
+  0x00, 0x08, 0xff, 0x80, 0x00, 0xff, 0x80, 0x00, 0x48, 0x84, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'B'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x8f, 0xf8,
+  0x8b, 0xff, 0x00, 0x00, 0x08, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x8f, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x08, 0xff, 0x88, 0xbf, 0xb0, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0x8f, 0xf8, 0x00, 0x00, 0x8f, 0xf0, 0x08, 0xff, 0x80, 0x00, 0x08, 0xff, 0x00, 0x8f, 0xf8,
+  0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x04, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'C'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x8f, 0xfb,
+  0x8b, 0xff, 0x00, 0x00, 0x08, 0xff, 0x80, 0x48, 0x80, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x04, 0x88, 0x00, 0x00, 0x08, 0xff, 0x80, 0x8f, 0xf0,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'D'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0xff, 0xb8,
+  0x8f, 0xff, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0x80, 0x0f, 0xff, 0x00,
+  0x00, 0x0f, 0xf8, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0x80, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xf8,
+  0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0x80, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xf8, 0x04, 0xff, 0xb0,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x08, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'E'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff,
+  0x88, 0x84, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xf8, 0x88, 0x40, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0xff,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'F'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xfb,
+  0x88, 0x80, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff,
+  0xf8, 0x88, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'G'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x8f, 0xfb,
+  0x8b, 0xfb, 0x00, 0x00, 0x08, 0xff, 0x80, 0x8f, 0xf0, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x0b, 0xfb, 0x00, 0x00, 0x08, 0xff,
+  0x80, 0xff, 0xf0, 0x00, 0x00, 0x8f, 0xf8, 0x08, 0xff, 0x00, 0x00, 0x08, 0xff, 0x80, 0x8f, 0xf0,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'H'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x0f, 0xff, 0x88, 0xbf, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x08, 0x88, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'I'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'J'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xff, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x04, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'K'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0xf0,
+  0x0f, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0xf0, 0x4f, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0x8b, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x08, 0x88, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'L'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'M'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xf8, 0x8f,
+  0xff, 0x88, 0xff, 0x8f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf8, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff,
+  0x8f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf8, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00,
+  0xff, 0xf0, 0x0f, 0xf8, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0xf0, 0x0f,
+  0xf8, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0x88, 0x88, 0x00, 0x88, 0x80, 0x08, 0x84, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'N'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0xff, 0xf8,
+  0x8b, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x08, 0x88, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'O'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0xff, 0xf8,
+  0x8b, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0xbf, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'P'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x8f, 0xfb,
+  0x8b, 0xff, 0x00, 0x00, 0x08, 0xff, 0x80, 0x8f, 0xf0, 0x00, 0x00, 0x8f, 0xf8, 0x08, 0xff, 0x00,
+  0x00, 0x08, 0xff, 0x80, 0x8f, 0xf0, 0x00, 0x00, 0x8f, 0xfb, 0x8b, 0xff, 0x00, 0x00, 0x08, 0xff,
+  0xff, 0xff, 0x40, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0xff, 0xf8,
+  0x8b, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xbf, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xb0,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'R'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0xff, 0xb8,
+  0xbf, 0xf8, 0x00, 0x00, 0x0f, 0xf8, 0x08, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x8f, 0xf8, 0x00,
+  0x00, 0x0f, 0xf8, 0x08, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x0f, 0xfb,
+  0x88, 0xff, 0xf0, 0x00, 0x00, 0xff, 0x80, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0xff, 0xf0,
+  0x00, 0x00, 0xff, 0x80, 0x0f, 0xff, 0x00, 0x00, 0x08, 0x84, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'S'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x8f, 0xf8,
+  0x8b, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x00, 0x8f, 0x80, 0x00, 0x00, 0x8f, 0xf4, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xff, 0xff, 0xfb, 0x40, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x48,
+  0x8f, 0xff, 0xf0, 0x00, 0x00, 0x48, 0x40, 0x0f, 0xff, 0x00, 0x00, 0x08, 0xf8, 0x00, 0xff, 0xf0,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'T'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x8f, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'U'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0xbf, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'V'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0b, 0xff,
+  0x40, 0xbf, 0xb0, 0x00, 0x00, 0x4f, 0xfb, 0x8f, 0xf4, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'W'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x8f, 0xf0, 0x8f, 0xf0, 0x8f, 0xf8, 0x08,
+  0xff, 0x08, 0xff, 0x08, 0xff, 0x80, 0x8f, 0xf0, 0x8f, 0xf0, 0x8f, 0xf8, 0x08, 0xff, 0x08, 0xff,
+  0x08, 0xff, 0x80, 0x8f, 0xf0, 0x8f, 0xf0, 0x8f, 0xf8, 0x08, 0xff, 0x08, 0xff, 0x08, 0xff, 0x80,
+  0x8f, 0xf0, 0x8f, 0xf0, 0x8f, 0xf8, 0x08, 0xff, 0x08, 0xff, 0x08, 0xff, 0x80, 0x8f, 0xf0, 0x8f,
+  0xf0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'X'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00,
+  0x00, 0x0b, 0xff, 0x88, 0xbf, 0xb0, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0xff, 0xf0, 0x08, 0xff, 0x00, 0x00, 0x08, 0x88, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0xff, 0x80,
+  0x08, 0xff, 0x80, 0x00, 0x0f, 0xf8, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0xff, 0x80, 0x08, 0xff, 0x80,
+  0x00, 0x0f, 0xf8, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x04, 0x88,
+  0xff, 0xb8, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x48, 0x88,
+  0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0x80, 0x00, 0x00, 0x00, 0x04, 0xff, 0xf8, 0x00,
+  0x00, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x08, 0xff,
+  0xb0, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '['
+  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00,
+  // character: '\\'
+  0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ']'
+  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8b, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00,
+  // character: '^'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf8, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x4f, 0x80, 0x00,
+  0x00, 0x00, 0x8f, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x0f, 0xb0, 0x04, 0xf4, 0x00, 0x00, 0x08, 0xf4,
+  0x00, 0x0f, 0xb0, 0x00, 0x00, 0x48, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '_'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88,
+  0x88, 0x88, 0x88, 0x40, 0x00, 0x48, 0x88, 0x88, 0x88, 0x84, 0x00,
+  // character: '`'
+  0x00, 0x00, 0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'a'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf4, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0xff, 0x80, 0x00, 0x00, 0x04, 0x88, 0x8f, 0xf8, 0x00, 0x00, 0x04, 0xff,
+  0xff, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x80,
+  0x00, 0x00, 0x8f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'b'
+  0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x88, 0x84, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf4, 0x00,
+  0x00, 0x08, 0xff, 0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x80,
+  0x00, 0x00, 0x8f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x04, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'c'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x84, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x00, 0xff, 0x80, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x00, 0x00, 0x0b, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x08, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'd'
+  0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xf8, 0x00, 0x00, 0x00, 0x08, 0x88, 0xff, 0x80, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf8, 0x00,
+  0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff,
+  0x80, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80,
+  0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'e'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x00, 0xff, 0x80, 0x8f, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x08, 0xf0, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xfb, 0x88, 0x80, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x00, 0x00, 0x0b, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x08, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'f'
+  0x00, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 0x88, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'g'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf8, 0x00,
+  0x00, 0x08, 0xff, 0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x88, 0xff, 0x80,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x8f,
+  0x00, 0x8f, 0xf8, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 0x40, 0x00,
+  // character: 'h'
+  0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x88, 0x88, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf4, 0x00,
+  0x00, 0x08, 0xff, 0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x80,
+  0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x04, 0x88, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'i'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'j'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0xfb,
+  0x8f, 0xf8, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x40, 0x00, 0x00,
+  // character: 'k'
+  0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x88, 0x40, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00,
+  0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xfb, 0xbf, 0xb0, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xfb, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80,
+  0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x88, 0x40, 0x88, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'l'
+  0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+  0x00, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0xff, 0x80,
+  0xff, 0x80, 0xff, 0x80, 0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0xff, 0x80, 0xff, 0x80, 0xff,
+  0x80, 0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x88, 0x40, 0x88, 0x40, 0x88, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf4, 0x00,
+  0x00, 0x08, 0xff, 0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x80,
+  0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x04, 0x88, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xf4, 0x00,
+  0x00, 0x08, 0xff, 0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x80,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf4, 0x00,
+  0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff,
+  0x80, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0xff, 0xb8, 0x84, 0x00, 0x00, 0x00, 0x0f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00,
+  // character: 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x40, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xf8, 0x00,
+  0x00, 0x08, 0xff, 0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff,
+  0x00, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf0, 0x0f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x80,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x48, 0x88, 0xff, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00,
+  // character: 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 's'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf4, 0x00,
+  0x00, 0x00, 0xff, 0x80, 0x48, 0x00, 0x00, 0x00, 0x0f, 0xfb, 0x88, 0x40, 0x00, 0x00, 0x00, 0xbf,
+  0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x48, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 't'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x84, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x88, 0x40, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00,
+  0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff,
+  0x80, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x08, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x08, 0x40, 0x00, 0x00, 0x0f, 0xff, 0x00, 0xf8, 0x00,
+  0x00, 0x00, 0xff, 0xf0, 0x0f, 0x80, 0x00, 0x00, 0x0f, 0xff, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff,
+  0xf0, 0x0f, 0x80, 0x00, 0x00, 0x0f, 0xff, 0x44, 0xf8, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x88, 0x40, 0x88, 0x40, 0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8,
+  0x00, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0xff, 0x80,
+  0xff, 0x80, 0xff, 0x80, 0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0xff, 0x80, 0xff, 0x80, 0xff,
+  0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x40, 0x48, 0x80, 0x00, 0x00, 0x8f, 0xf8, 0x08, 0xff, 0x00,
+  0x00, 0x08, 0xff, 0x80, 0x8f, 0xf0, 0x00, 0x00, 0x4f, 0xf8, 0x08, 0xfb, 0x00, 0x00, 0x00, 0xbf,
+  0xff, 0xff, 0x40, 0x00, 0x00, 0x4f, 0xfb, 0x8b, 0xfb, 0x00, 0x00, 0x08, 0xff, 0x80, 0x8f, 0xf0,
+  0x00, 0x00, 0x8f, 0xf8, 0x08, 0xff, 0x00, 0x00, 0x04, 0x88, 0x40, 0x48, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x88, 0x40, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00,
+  0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff,
+  0x80, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xb8, 0xff, 0x80,
+  0x00, 0x00, 0x0b, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x0f,
+  0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x40, 0x00,
+  // character: 'z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x4f,
+  0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '{'
+  0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xf8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00,
+  // character: '|'
+  0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  // character: '}'
+  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x8f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8b, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00,
+  // character: '~'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xff, 0xb4, 0x04, 0xf0, 0x00, 0x00, 0x8f, 0x8b, 0xff, 0xfb, 0x00, 0x00, 0x04, 0x40,
+  0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const tFontPacked Font_13x14_aa_glyphs = { 13, 14, 91, 0x20, 95, Font_13x14_aa_data };
+
+const tFont Font_13x14_aa = { .packed = &Font_13x14_aa_glyphs, .bpp = 4 };
@@ -64,7 +64,7 @@ static const uint8_t image_data_Font_13x16_0x20[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x20 = { image_data_Font_13x16_0x20,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -88,7 +88,7 @@ static const uint8_t image_data_Font_13x16_0x21[26] = {
     0x00, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x21 = { image_data_Font_13x16_0x21,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -112,7 +112,7 @@ static const uint8_t image_data_Font_13x16_0x22[26] = {
     0x09, 0x00, 0x48, 0x02, 0x40, 0x12, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x22 = { image_data_Font_13x16_0x22,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -136,7 +136,7 @@ static const uint8_t image_data_Font_13x16_0x23[26] = {
     0x00, 0x00, 0x42, 0x02, 0x10, 0x21, 0x07, 0xfe, 0x08, 0x40, 0x42, 0x04, 0x20, 0x21, 0x07, 0xfe, 0x08, 0x40, 0x84, 0x04, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x23 = { image_data_Font_13x16_0x23,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -160,7 +160,7 @@ static const uint8_t image_data_Font_13x16_0x24[26] = {
     0x00, 0x00, 0x10, 0x00, 0x80, 0x1f, 0x01, 0x24, 0x09, 0x00, 0x48, 0x01, 0xc0, 0x03, 0x80, 0x12, 0x00, 0x90, 0x24, 0x80, 0xf8, 0x01, 0x00, 0x08, 0x00, 0x40
 };
 static const tImage Font_13x16_0x24 = { image_data_Font_13x16_0x24,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -184,7 +184,7 @@ static const uint8_t image_data_Font_13x16_0x25[26] = {
     0x00, 0x07, 0x82, 0x02, 0x20, 0x11, 0x00, 0x90, 0x05, 0x00, 0x2b, 0xde, 0xa1, 0x05, 0x08, 0x48, 0x44, 0x42, 0x22, 0x12, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x25 = { image_data_Font_13x16_0x25,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -208,7 +208,7 @@ static const uint8_t image_data_Font_13x16_0x26[26] = {
     0x00, 0x00, 0xf0, 0x08, 0x40, 0x42, 0x02, 0x10, 0x09, 0x00, 0x71, 0x04, 0x88, 0x42, 0x42, 0x0c, 0x10, 0x20, 0x42, 0x81, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x26 = { image_data_Font_13x16_0x26,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -232,7 +232,7 @@ static const uint8_t image_data_Font_13x16_0x27[26] = {
     0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x27 = { image_data_Font_13x16_0x27,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -256,7 +256,7 @@ static const uint8_t image_data_Font_13x16_0x28[26] = {
     0x01, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x40, 0x02, 0x00, 0x08, 0x00, 0x20
 };
 static const tImage Font_13x16_0x28 = { image_data_Font_13x16_0x28,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -280,7 +280,7 @@ static const uint8_t image_data_Font_13x16_0x29[26] = {
     0x08, 0x00, 0x20, 0x00, 0x80, 0x04, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x20, 0x01, 0x00, 0x10, 0x01, 0x00
 };
 static const tImage Font_13x16_0x29 = { image_data_Font_13x16_0x29,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -304,7 +304,7 @@ static const uint8_t image_data_Font_13x16_0x2a[26] = {
     0x02, 0x00, 0x92, 0x02, 0xa0, 0x0e, 0x00, 0xa8, 0x09, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x2a = { image_data_Font_13x16_0x2a,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -328,7 +328,7 @@ static const uint8_t image_data_Font_13x16_0x2b[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x0f, 0xf8, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x2b = { image_data_Font_13x16_0x2b,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -352,7 +352,7 @@ static const uint8_t image_data_Font_13x16_0x2c[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x01, 0x00, 0x10, 0x00, 0x80
 };
 static const tImage Font_13x16_0x2c = { image_data_Font_13x16_0x2c,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -376,7 +376,7 @@ static const uint8_t image_data_Font_13x16_0x2d[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x2d = { image_data_Font_13x16_0x2d,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -400,7 +400,7 @@ static const uint8_t image_data_Font_13x16_0x2e[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x2e = { image_data_Font_13x16_0x2e,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -424,7 +424,7 @@ static const uint8_t image_data_Font_13x16_0x2f[26] = {
     0x00, 0x80, 0x04, 0x00, 0x40, 0x02, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x40, 0x04, 0x00, 0x20, 0x01, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x40, 0x02, 0x00
 };
 static const tImage Font_13x16_0x2f = { image_data_Font_13x16_0x2f,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -448,7 +448,7 @@ static const uint8_t image_data_Font_13x16_0x30[26] = {
     0x00, 0x00, 0x78, 0x04, 0x20, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x30 = { image_data_Font_13x16_0x30,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -472,7 +472,7 @@ static const uint8_t image_data_Font_13x16_0x31[26] = {
     0x00, 0x00, 0x10, 0x00, 0x80, 0x1c, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x31 = { image_data_Font_13x16_0x31,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -496,7 +496,7 @@ static const uint8_t image_data_Font_13x16_0x32[26] = {
     0x00, 0x00, 0x78, 0x04, 0x20, 0x00, 0x80, 0x04, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x32 = { image_data_Font_13x16_0x32,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -520,7 +520,7 @@ static const uint8_t image_data_Font_13x16_0x33[26] = {
     0x00, 0x00, 0x78, 0x04, 0x20, 0x00, 0x80, 0x04, 0x00, 0x40, 0x1c, 0x00, 0x10, 0x00, 0x40, 0x02, 0x00, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x33 = { image_data_Font_13x16_0x33,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -544,7 +544,7 @@ static const uint8_t image_data_Font_13x16_0x34[26] = {
     0x00, 0x00, 0x04, 0x00, 0x60, 0x05, 0x00, 0x48, 0x04, 0x40, 0x42, 0x04, 0x10, 0x3f, 0xc0, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x34 = { image_data_Font_13x16_0x34,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -568,7 +568,7 @@ static const uint8_t image_data_Font_13x16_0x35[26] = {
     0x00, 0x00, 0xfe, 0x04, 0x00, 0x20, 0x01, 0x00, 0x0f, 0x80, 0x02, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x35 = { image_data_Font_13x16_0x35,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -592,7 +592,7 @@ static const uint8_t image_data_Font_13x16_0x36[26] = {
     0x00, 0x00, 0x3c, 0x02, 0x00, 0x20, 0x02, 0x00, 0x17, 0x80, 0xc2, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x36 = { image_data_Font_13x16_0x36,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -616,7 +616,7 @@ static const uint8_t image_data_Font_13x16_0x37[26] = {
     0x00, 0x00, 0xfe, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x40, 0x02, 0x00, 0x20, 0x01, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x37 = { image_data_Font_13x16_0x37,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -640,7 +640,7 @@ static const uint8_t image_data_Font_13x16_0x38[26] = {
     0x00, 0x00, 0x78, 0x04, 0x20, 0x40, 0x82, 0x04, 0x08, 0x40, 0x3c, 0x02, 0x10, 0x20, 0x41, 0x02, 0x08, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x38 = { image_data_Font_13x16_0x38,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -664,7 +664,7 @@ static const uint8_t image_data_Font_13x16_0x39[26] = {
     0x00, 0x00, 0x78, 0x04, 0x20, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x02, 0x18, 0x0f, 0x40, 0x02, 0x00, 0x20, 0x02, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x39 = { image_data_Font_13x16_0x39,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -688,7 +688,7 @@ static const uint8_t image_data_Font_13x16_0x3a[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x3a = { image_data_Font_13x16_0x3a,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -712,7 +712,7 @@ static const uint8_t image_data_Font_13x16_0x3b[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x20, 0x01, 0x00
 };
 static const tImage Font_13x16_0x3b = { image_data_Font_13x16_0x3b,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -736,7 +736,7 @@ static const uint8_t image_data_Font_13x16_0x3c[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x18, 0x03, 0x00, 0x60, 0x04, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x3c = { image_data_Font_13x16_0x3c,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -760,7 +760,7 @@ static const uint8_t image_data_Font_13x16_0x3d[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x3d = { image_data_Font_13x16_0x3d,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -784,7 +784,7 @@ static const uint8_t image_data_Font_13x16_0x3e[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x08, 0x01, 0x80, 0x30, 0x06, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x3e = { image_data_Font_13x16_0x3e,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -808,7 +808,7 @@ static const uint8_t image_data_Font_13x16_0x3f[26] = {
     0x00, 0x00, 0x70, 0x04, 0x40, 0x01, 0x00, 0x08, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x3f = { image_data_Font_13x16_0x3f,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -832,7 +832,7 @@ static const uint8_t image_data_Font_13x16_0x40[26] = {
     0x00, 0x00, 0x7c, 0x0c, 0x18, 0x80, 0x24, 0x7d, 0x44, 0x26, 0x41, 0x32, 0x09, 0x90, 0x4c, 0x82, 0x62, 0x32, 0x8e, 0xe4, 0x00, 0x18, 0x00, 0x3e, 0x00, 0x00
 };
 static const tImage Font_13x16_0x40 = { image_data_Font_13x16_0x40,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -856,7 +856,7 @@ static const uint8_t image_data_Font_13x16_0x41[26] = {
     0x00, 0x00, 0x30, 0x02, 0x40, 0x12, 0x00, 0x90, 0x08, 0x40, 0x42, 0x02, 0x10, 0x3f, 0xc1, 0x02, 0x08, 0x10, 0x80, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x41 = { image_data_Font_13x16_0x41,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -880,7 +880,7 @@ static const uint8_t image_data_Font_13x16_0x42[26] = {
     0x00, 0x01, 0xf8, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x80, 0xfc, 0x04, 0x10, 0x20, 0x41, 0x02, 0x08, 0x10, 0x41, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x42 = { image_data_Font_13x16_0x42,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -904,7 +904,7 @@ static const uint8_t image_data_Font_13x16_0x43[26] = {
     0x00, 0x00, 0x7c, 0x0c, 0x10, 0x40, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x08, 0x00, 0x60, 0x80, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x43 = { image_data_Font_13x16_0x43,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -928,7 +928,7 @@ static const uint8_t image_data_Font_13x16_0x44[26] = {
     0x00, 0x03, 0xf0, 0x10, 0x60, 0x80, 0x84, 0x04, 0x20, 0x11, 0x00, 0x88, 0x04, 0x40, 0x22, 0x02, 0x10, 0x10, 0x83, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x44 = { image_data_Font_13x16_0x44,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -952,7 +952,7 @@ static const uint8_t image_data_Font_13x16_0x45[26] = {
     0x00, 0x01, 0xfe, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0xff, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x45 = { image_data_Font_13x16_0x45,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -976,7 +976,7 @@ static const uint8_t image_data_Font_13x16_0x46[26] = {
     0x00, 0x01, 0xfc, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0xfe, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x46 = { image_data_Font_13x16_0x46,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1000,7 +1000,7 @@ static const uint8_t image_data_Font_13x16_0x47[26] = {
     0x00, 0x00, 0x7e, 0x0c, 0x08, 0x40, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x7c, 0x40, 0x22, 0x01, 0x08, 0x08, 0x60, 0x40, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x47 = { image_data_Font_13x16_0x47,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1024,7 +1024,7 @@ static const uint8_t image_data_Font_13x16_0x48[26] = {
     0x00, 0x02, 0x01, 0x10, 0x08, 0x80, 0x44, 0x02, 0x20, 0x11, 0xff, 0x88, 0x04, 0x40, 0x22, 0x01, 0x10, 0x08, 0x80, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x48 = { image_data_Font_13x16_0x48,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1048,7 +1048,7 @@ static const uint8_t image_data_Font_13x16_0x49[26] = {
     0x00, 0x00, 0x70, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x49 = { image_data_Font_13x16_0x49,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1072,7 +1072,7 @@ static const uint8_t image_data_Font_13x16_0x4a[26] = {
     0x00, 0x00, 0x3c, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x4a = { image_data_Font_13x16_0x4a,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1096,7 +1096,7 @@ static const uint8_t image_data_Font_13x16_0x4b[26] = {
     0x00, 0x01, 0x02, 0x08, 0x20, 0x42, 0x02, 0x20, 0x12, 0x00, 0xa0, 0x07, 0x00, 0x24, 0x01, 0x10, 0x08, 0x40, 0x41, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x4b = { image_data_Font_13x16_0x4b,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1120,7 +1120,7 @@ static const uint8_t image_data_Font_13x16_0x4c[26] = {
     0x00, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x4c = { image_data_Font_13x16_0x4c,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1144,7 +1144,7 @@ static const uint8_t image_data_Font_13x16_0x4d[26] = {
     0x00, 0x06, 0x03, 0x30, 0x19, 0x41, 0x4a, 0x0a, 0x48, 0x92, 0x44, 0x91, 0x44, 0x8a, 0x24, 0x21, 0x20, 0x09, 0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x4d = { image_data_Font_13x16_0x4d,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1168,7 +1168,7 @@ static const uint8_t image_data_Font_13x16_0x4e[26] = {
     0x00, 0x02, 0x01, 0x18, 0x08, 0xa0, 0x44, 0x82, 0x24, 0x11, 0x10, 0x88, 0x44, 0x41, 0x22, 0x09, 0x10, 0x28, 0x80, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x4e = { image_data_Font_13x16_0x4e,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1192,7 +1192,7 @@ static const uint8_t image_data_Font_13x16_0x4f[26] = {
     0x00, 0x00, 0xf8, 0x18, 0x30, 0x80, 0x88, 0x02, 0x40, 0x12, 0x00, 0x90, 0x04, 0x80, 0x24, 0x01, 0x10, 0x10, 0xc1, 0x81, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x4f = { image_data_Font_13x16_0x4f,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1216,7 +1216,7 @@ static const uint8_t image_data_Font_13x16_0x50[26] = {
     0x00, 0x01, 0xf8, 0x08, 0x20, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x04, 0x10, 0x3f, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x50 = { image_data_Font_13x16_0x50,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1240,7 +1240,7 @@ static const uint8_t image_data_Font_13x16_0x51[26] = {
     0x00, 0x00, 0xf8, 0x18, 0x30, 0x80, 0x88, 0x02, 0x40, 0x12, 0x00, 0x90, 0x04, 0x80, 0x24, 0x01, 0x10, 0x10, 0xc1, 0x81, 0xf0, 0x01, 0x00, 0x08, 0x00, 0x3c
 };
 static const tImage Font_13x16_0x51 = { image_data_Font_13x16_0x51,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1264,7 +1264,7 @@ static const uint8_t image_data_Font_13x16_0x52[26] = {
     0x00, 0x03, 0xf0, 0x10, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x08, 0x0f, 0x80, 0x44, 0x02, 0x10, 0x10, 0x40, 0x81, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x52 = { image_data_Font_13x16_0x52,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1288,7 +1288,7 @@ static const uint8_t image_data_Font_13x16_0x53[26] = {
     0x00, 0x00, 0x7c, 0x04, 0x10, 0x40, 0x02, 0x00, 0x10, 0x00, 0x70, 0x00, 0x70, 0x00, 0x40, 0x02, 0x00, 0x10, 0x41, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x53 = { image_data_Font_13x16_0x53,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1312,7 +1312,7 @@ static const uint8_t image_data_Font_13x16_0x54[26] = {
     0x00, 0x03, 0xfe, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x54 = { image_data_Font_13x16_0x54,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1336,7 +1336,7 @@ static const uint8_t image_data_Font_13x16_0x55[26] = {
     0x00, 0x02, 0x01, 0x10, 0x08, 0x80, 0x44, 0x02, 0x20, 0x11, 0x00, 0x88, 0x04, 0x40, 0x22, 0x01, 0x10, 0x08, 0x40, 0x81, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x55 = { image_data_Font_13x16_0x55,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1360,7 +1360,7 @@ static const uint8_t image_data_Font_13x16_0x56[26] = {
     0x00, 0x02, 0x02, 0x10, 0x10, 0x41, 0x02, 0x08, 0x10, 0x40, 0x44, 0x02, 0x20, 0x11, 0x00, 0x50, 0x02, 0x80, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x56 = { image_data_Font_13x16_0x56,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1384,7 +1384,7 @@ static const uint8_t image_data_Font_13x16_0x57[26] = {
     0x00, 0x00, 0x20, 0x82, 0x85, 0x14, 0x48, 0xa2, 0x45, 0x12, 0x28, 0x92, 0x24, 0x51, 0x42, 0x8a, 0x14, 0x50, 0xc1, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x57 = { image_data_Font_13x16_0x57,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1408,7 +1408,7 @@ static const uint8_t image_data_Font_13x16_0x58[26] = {
     0x00, 0x01, 0x02, 0x04, 0x20, 0x21, 0x00, 0x90, 0x03, 0x00, 0x18, 0x00, 0xc0, 0x06, 0x00, 0x48, 0x04, 0x20, 0x21, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x58 = { image_data_Font_13x16_0x58,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1432,7 +1432,7 @@ static const uint8_t image_data_Font_13x16_0x59[26] = {
     0x00, 0x02, 0x02, 0x08, 0x20, 0x41, 0x01, 0x10, 0x05, 0x00, 0x28, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x59 = { image_data_Font_13x16_0x59,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1456,7 +1456,7 @@ static const uint8_t image_data_Font_13x16_0x5a[26] = {
     0x00, 0x01, 0xfe, 0x00, 0x10, 0x01, 0x00, 0x10, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00, 0x40, 0x04, 0x00, 0x40, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x5a = { image_data_Font_13x16_0x5a,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1480,7 +1480,7 @@ static const uint8_t image_data_Font_13x16_0x5b[26] = {
     0x0f, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0xe0
 };
 static const tImage Font_13x16_0x5b = { image_data_Font_13x16_0x5b,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1504,7 +1504,7 @@ static const uint8_t image_data_Font_13x16_0x5c[26] = {
     0x10, 0x00, 0x80, 0x02, 0x00, 0x10, 0x00, 0x80, 0x02, 0x00, 0x10, 0x00, 0x80, 0x02, 0x00, 0x10, 0x00, 0x80, 0x02, 0x00, 0x10, 0x00, 0x80, 0x02, 0x00, 0x10
 };
 static const tImage Font_13x16_0x5c = { image_data_Font_13x16_0x5c,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1528,7 +1528,7 @@ static const uint8_t image_data_Font_13x16_0x5d[26] = {
     0x0f, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x01, 0xe0
 };
 static const tImage Font_13x16_0x5d = { image_data_Font_13x16_0x5d,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1552,7 +1552,7 @@ static const uint8_t image_data_Font_13x16_0x5e[26] = {
     0x00, 0x00, 0x30, 0x02, 0x40, 0x12, 0x01, 0x08, 0x10, 0x21, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x5e = { image_data_Font_13x16_0x5e,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1576,7 +1576,7 @@ static const uint8_t image_data_Font_13x16_0x5f[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00
 };
 static const tImage Font_13x16_0x5f = { image_data_Font_13x16_0x5f,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1600,7 +1600,7 @@ static const uint8_t image_data_Font_13x16_0x60[26] = {
     0x04, 0x00, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x60 = { image_data_Font_13x16_0x60,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1624,7 +1624,7 @@ static const uint8_t image_data_Font_13x16_0x61[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x40, 0x02, 0x01, 0xf0, 0x10, 0x81, 0x04, 0x08, 0x20, 0x43, 0x01, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x61 = { image_data_Font_13x16_0x61,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1648,7 +1648,7 @@ static const uint8_t image_data_Font_13x16_0x62[26] = {
     0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0xf0, 0x18, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x41, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x62 = { image_data_Font_13x16_0x62,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1672,7 +1672,7 @@ static const uint8_t image_data_Font_13x16_0x63[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x04, 0x40, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x11, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x63 = { image_data_Font_13x16_0x63,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1696,7 +1696,7 @@ static const uint8_t image_data_Font_13x16_0x64[26] = {
     0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0xfc, 0x08, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x21, 0x80, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x64 = { image_data_Font_13x16_0x64,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1720,7 +1720,7 @@ static const uint8_t image_data_Font_13x16_0x65[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x08, 0x80, 0x82, 0x04, 0x10, 0x3f, 0x81, 0x00, 0x08, 0x00, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x65 = { image_data_Font_13x16_0x65,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1744,7 +1744,7 @@ static const uint8_t image_data_Font_13x16_0x66[26] = {
     0x03, 0x80, 0x20, 0x01, 0x00, 0x08, 0x00, 0xf0, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x66 = { image_data_Font_13x16_0x66,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1768,7 +1768,7 @@ static const uint8_t image_data_Font_13x16_0x67[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x08, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x21, 0x80, 0xf4, 0x00, 0x20, 0x42, 0x01, 0xe0
 };
 static const tImage Font_13x16_0x67 = { image_data_Font_13x16_0x67,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1792,7 +1792,7 @@ static const uint8_t image_data_Font_13x16_0x68[26] = {
     0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0xf0, 0x18, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x40, 0x82, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x68 = { image_data_Font_13x16_0x68,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1816,7 +1816,7 @@ static const uint8_t image_data_Font_13x16_0x69[26] = {
     0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x69 = { image_data_Font_13x16_0x69,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1840,7 +1840,7 @@ static const uint8_t image_data_Font_13x16_0x6a[26] = {
     0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x70, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x01, 0xc0
 };
 static const tImage Font_13x16_0x6a = { image_data_Font_13x16_0x6a,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1864,7 +1864,7 @@ static const uint8_t image_data_Font_13x16_0x6b[26] = {
     0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x10, 0x11, 0x00, 0x90, 0x05, 0x00, 0x38, 0x01, 0x20, 0x08, 0x80, 0x42, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x6b = { image_data_Font_13x16_0x6b,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1888,7 +1888,7 @@ static const uint8_t image_data_Font_13x16_0x6c[26] = {
     0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x6c = { image_data_Font_13x16_0x6c,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1912,7 +1912,7 @@ static const uint8_t image_data_Font_13x16_0x6d[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x9c, 0x63, 0x12, 0x10, 0x90, 0x84, 0x84, 0x24, 0x21, 0x21, 0x09, 0x08, 0x48, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x6d = { image_data_Font_13x16_0x6d,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1936,7 +1936,7 @@ static const uint8_t image_data_Font_13x16_0x6e[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x18, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x40, 0x82, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x6e = { image_data_Font_13x16_0x6e,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1960,7 +1960,7 @@ static const uint8_t image_data_Font_13x16_0x6f[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x6f = { image_data_Font_13x16_0x6f,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1984,7 +1984,7 @@ static const uint8_t image_data_Font_13x16_0x70[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x18, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x41, 0x03, 0xf0, 0x10, 0x00, 0x80, 0x04, 0x00
 };
 static const tImage Font_13x16_0x70 = { image_data_Font_13x16_0x70,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2008,7 +2008,7 @@ static const uint8_t image_data_Font_13x16_0x71[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x08, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x21, 0x80, 0xf4, 0x00, 0x20, 0x01, 0x00, 0x08
 };
 static const tImage Font_13x16_0x71 = { image_data_Font_13x16_0x71,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2032,7 +2032,7 @@ static const uint8_t image_data_Font_13x16_0x72[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x70, 0x0c, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x72 = { image_data_Font_13x16_0x72,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2056,7 +2056,7 @@ static const uint8_t image_data_Font_13x16_0x73[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x40, 0x40, 0x02, 0x00, 0x0f, 0x00, 0x04, 0x00, 0x20, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x73 = { image_data_Font_13x16_0x73,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2080,7 +2080,7 @@ static const uint8_t image_data_Font_13x16_0x74[26] = {
     0x00, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0xf8, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x74 = { image_data_Font_13x16_0x74,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2104,7 +2104,7 @@ static const uint8_t image_data_Font_13x16_0x75[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x10, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x21, 0x80, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x75 = { image_data_Font_13x16_0x75,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2128,7 +2128,7 @@ static const uint8_t image_data_Font_13x16_0x76[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x10, 0x40, 0x44, 0x02, 0x20, 0x11, 0x00, 0x50, 0x02, 0x80, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x76 = { image_data_Font_13x16_0x76,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2152,7 +2152,7 @@ static const uint8_t image_data_Font_13x16_0x77[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x42, 0x11, 0x29, 0x09, 0x48, 0x4a, 0x42, 0x8a, 0x0c, 0x60, 0x41, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x77 = { image_data_Font_13x16_0x77,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2176,7 +2176,7 @@ static const uint8_t image_data_Font_13x16_0x78[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x08, 0x80, 0x28, 0x01, 0x40, 0x04, 0x00, 0x50, 0x02, 0x80, 0x22, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x78 = { image_data_Font_13x16_0x78,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2200,7 +2200,7 @@ static const uint8_t image_data_Font_13x16_0x79[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x10, 0x40, 0x44, 0x02, 0x20, 0x11, 0x00, 0x50, 0x02, 0x80, 0x08, 0x00, 0x40, 0x04, 0x00, 0x20, 0x01, 0x00
 };
 static const tImage Font_13x16_0x79 = { image_data_Font_13x16_0x79,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2224,7 +2224,7 @@ static const uint8_t image_data_Font_13x16_0x7a[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x20, 0x02, 0x00, 0x20, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x7a = { image_data_Font_13x16_0x7a,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2248,7 +2248,7 @@ static const uint8_t image_data_Font_13x16_0x7b[26] = {
     0x03, 0x80, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x20, 0x06, 0x00, 0x08, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x70
 };
 static const tImage Font_13x16_0x7b = { image_data_Font_13x16_0x7b,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2272,7 +2272,7 @@ static const uint8_t image_data_Font_13x16_0x7c[26] = {
     0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80
 };
 static const tImage Font_13x16_0x7c = { image_data_Font_13x16_0x7c,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2296,7 +2296,7 @@ static const uint8_t image_data_Font_13x16_0x7d[26] = {
     0x38, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x08, 0x00, 0x30, 0x02, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x07, 0x00
 };
 static const tImage Font_13x16_0x7d = { image_data_Font_13x16_0x7d,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2320,7 +2320,7 @@ static const uint8_t image_data_Font_13x16_0x7e[26] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x84, 0x84, 0x42, 0x42, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_13x16_0x7e = { image_data_Font_13x16_0x7e,
-    13, 16, 8};
+    13, 16, 8, 0};
 #endif
 
 
@@ -3089,5 +3089,5 @@ static const tChar Font_13x16_array[] = {
 };
 
 
-const tFont Font_13x16 = { 95, Font_13x16_array };
+const tFont Font_13x16 = { 95, Font_13x16_array, .first_code = 0x20, .dense = 95 };
 
@@ -0,0 +1,308 @@
+/*******************************************************************************
+* name: Font_13x16
+* family: ISOCPEUR
+* size: 16
+* style: Regular
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* type: monospaced
+* encoding: UTF-8
+*
+* packed: 95 glyphs 13x16, 26 bytes per glyph, first code 0x20
+* glyph bits are continuous across rows like tImage, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_13x16_packed_data[2470] = {
+  // character: ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '!'
+  0x00, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20,
+  0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '"'
+  0x09, 0x00, 0x48, 0x02, 0x40, 0x12, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '#'
+  0x00, 0x00, 0x42, 0x02, 0x10, 0x21, 0x07, 0xfe, 0x08, 0x40, 0x42, 0x04, 0x20, 0x21, 0x07, 0xfe,
+  0x08, 0x40, 0x84, 0x04, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '$'
+  0x00, 0x00, 0x10, 0x00, 0x80, 0x1f, 0x01, 0x24, 0x09, 0x00, 0x48, 0x01, 0xc0, 0x03, 0x80, 0x12,
+  0x00, 0x90, 0x24, 0x80, 0xf8, 0x01, 0x00, 0x08, 0x00, 0x40,
+  // character: '%'
+  0x00, 0x07, 0x82, 0x02, 0x20, 0x11, 0x00, 0x90, 0x05, 0x00, 0x2b, 0xde, 0xa1, 0x05, 0x08, 0x48,
+  0x44, 0x42, 0x22, 0x12, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '&'
+  0x00, 0x00, 0xf0, 0x08, 0x40, 0x42, 0x02, 0x10, 0x09, 0x00, 0x71, 0x04, 0x88, 0x42, 0x42, 0x0c,
+  0x10, 0x20, 0x42, 0x81, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '''
+  0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '('
+  0x01, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40,
+  0x02, 0x00, 0x10, 0x00, 0x40, 0x02, 0x00, 0x08, 0x00, 0x20,
+  // character: ')'
+  0x08, 0x00, 0x20, 0x00, 0x80, 0x04, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08,
+  0x00, 0x40, 0x02, 0x00, 0x20, 0x01, 0x00, 0x10, 0x01, 0x00,
+  // character: '*'
+  0x02, 0x00, 0x92, 0x02, 0xa0, 0x0e, 0x00, 0xa8, 0x09, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x0f, 0xf8, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x20, 0x01, 0x00, 0x10, 0x00, 0x80,
+  // character: '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '/'
+  0x00, 0x80, 0x04, 0x00, 0x40, 0x02, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x40, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x40, 0x02, 0x00,
+  // character: '0'
+  0x00, 0x00, 0x78, 0x04, 0x20, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '1'
+  0x00, 0x00, 0x10, 0x00, 0x80, 0x1c, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10,
+  0x00, 0x80, 0x04, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '2'
+  0x00, 0x00, 0x78, 0x04, 0x20, 0x00, 0x80, 0x04, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20,
+  0x02, 0x00, 0x20, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '3'
+  0x00, 0x00, 0x78, 0x04, 0x20, 0x00, 0x80, 0x04, 0x00, 0x40, 0x1c, 0x00, 0x10, 0x00, 0x40, 0x02,
+  0x00, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '4'
+  0x00, 0x00, 0x04, 0x00, 0x60, 0x05, 0x00, 0x48, 0x04, 0x40, 0x42, 0x04, 0x10, 0x3f, 0xc0, 0x04,
+  0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '5'
+  0x00, 0x00, 0xfe, 0x04, 0x00, 0x20, 0x01, 0x00, 0x0f, 0x80, 0x02, 0x00, 0x08, 0x00, 0x40, 0x02,
+  0x00, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '6'
+  0x00, 0x00, 0x3c, 0x02, 0x00, 0x20, 0x02, 0x00, 0x17, 0x80, 0xc2, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '7'
+  0x00, 0x00, 0xfe, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x40, 0x02, 0x00, 0x20,
+  0x01, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '8'
+  0x00, 0x00, 0x78, 0x04, 0x20, 0x40, 0x82, 0x04, 0x08, 0x40, 0x3c, 0x02, 0x10, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '9'
+  0x00, 0x00, 0x78, 0x04, 0x20, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x02, 0x18, 0x0f, 0x40, 0x02,
+  0x00, 0x20, 0x02, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x20, 0x01, 0x00,
+  // character: '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x18, 0x03, 0x00, 0x60, 0x04, 0x00, 0x18, 0x00, 0x30,
+  0x00, 0x60, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x08, 0x01, 0x80, 0x30,
+  0x06, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '?'
+  0x00, 0x00, 0x70, 0x04, 0x40, 0x01, 0x00, 0x08, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x20,
+  0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '@'
+  0x00, 0x00, 0x7c, 0x0c, 0x18, 0x80, 0x24, 0x7d, 0x44, 0x26, 0x41, 0x32, 0x09, 0x90, 0x4c, 0x82,
+  0x62, 0x32, 0x8e, 0xe4, 0x00, 0x18, 0x00, 0x3e, 0x00, 0x00,
+  // character: 'A'
+  0x00, 0x00, 0x30, 0x02, 0x40, 0x12, 0x00, 0x90, 0x08, 0x40, 0x42, 0x02, 0x10, 0x3f, 0xc1, 0x02,
+  0x08, 0x10, 0x80, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'B'
+  0x00, 0x01, 0xf8, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x80, 0xfc, 0x04, 0x10, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x41, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'C'
+  0x00, 0x00, 0x7c, 0x0c, 0x10, 0x40, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00,
+  0x08, 0x00, 0x60, 0x80, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'D'
+  0x00, 0x03, 0xf0, 0x10, 0x60, 0x80, 0x84, 0x04, 0x20, 0x11, 0x00, 0x88, 0x04, 0x40, 0x22, 0x02,
+  0x10, 0x10, 0x83, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'E'
+  0x00, 0x01, 0xfe, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0xff, 0x04, 0x00, 0x20, 0x01, 0x00,
+  0x08, 0x00, 0x40, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'F'
+  0x00, 0x01, 0xfc, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0xfe, 0x04, 0x00, 0x20, 0x01, 0x00,
+  0x08, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'G'
+  0x00, 0x00, 0x7e, 0x0c, 0x08, 0x40, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x7c, 0x40, 0x22, 0x01,
+  0x08, 0x08, 0x60, 0x40, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'H'
+  0x00, 0x02, 0x01, 0x10, 0x08, 0x80, 0x44, 0x02, 0x20, 0x11, 0xff, 0x88, 0x04, 0x40, 0x22, 0x01,
+  0x10, 0x08, 0x80, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'I'
+  0x00, 0x00, 0x70, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'J'
+  0x00, 0x00, 0x3c, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04,
+  0x00, 0x20, 0x01, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'K'
+  0x00, 0x01, 0x02, 0x08, 0x20, 0x42, 0x02, 0x20, 0x12, 0x00, 0xa0, 0x07, 0x00, 0x24, 0x01, 0x10,
+  0x08, 0x40, 0x41, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'L'
+  0x00, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00,
+  0x08, 0x00, 0x40, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'M'
+  0x00, 0x06, 0x03, 0x30, 0x19, 0x41, 0x4a, 0x0a, 0x48, 0x92, 0x44, 0x91, 0x44, 0x8a, 0x24, 0x21,
+  0x20, 0x09, 0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'N'
+  0x00, 0x02, 0x01, 0x18, 0x08, 0xa0, 0x44, 0x82, 0x24, 0x11, 0x10, 0x88, 0x44, 0x41, 0x22, 0x09,
+  0x10, 0x28, 0x80, 0xc4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'O'
+  0x00, 0x00, 0xf8, 0x18, 0x30, 0x80, 0x88, 0x02, 0x40, 0x12, 0x00, 0x90, 0x04, 0x80, 0x24, 0x01,
+  0x10, 0x10, 0xc1, 0x81, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'P'
+  0x00, 0x01, 0xf8, 0x08, 0x20, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x04, 0x10, 0x3f, 0x01, 0x00,
+  0x08, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Q'
+  0x00, 0x00, 0xf8, 0x18, 0x30, 0x80, 0x88, 0x02, 0x40, 0x12, 0x00, 0x90, 0x04, 0x80, 0x24, 0x01,
+  0x10, 0x10, 0xc1, 0x81, 0xf0, 0x01, 0x00, 0x08, 0x00, 0x3c,
+  // character: 'R'
+  0x00, 0x03, 0xf0, 0x10, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x08, 0x0f, 0x80, 0x44, 0x02, 0x10,
+  0x10, 0x40, 0x81, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'S'
+  0x00, 0x00, 0x7c, 0x04, 0x10, 0x40, 0x02, 0x00, 0x10, 0x00, 0x70, 0x00, 0x70, 0x00, 0x40, 0x02,
+  0x00, 0x10, 0x41, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'T'
+  0x00, 0x03, 0xfe, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'U'
+  0x00, 0x02, 0x01, 0x10, 0x08, 0x80, 0x44, 0x02, 0x20, 0x11, 0x00, 0x88, 0x04, 0x40, 0x22, 0x01,
+  0x10, 0x08, 0x40, 0x81, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'V'
+  0x00, 0x02, 0x02, 0x10, 0x10, 0x41, 0x02, 0x08, 0x10, 0x40, 0x44, 0x02, 0x20, 0x11, 0x00, 0x50,
+  0x02, 0x80, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'W'
+  0x00, 0x00, 0x20, 0x82, 0x85, 0x14, 0x48, 0xa2, 0x45, 0x12, 0x28, 0x92, 0x24, 0x51, 0x42, 0x8a,
+  0x14, 0x50, 0xc1, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'X'
+  0x00, 0x01, 0x02, 0x04, 0x20, 0x21, 0x00, 0x90, 0x03, 0x00, 0x18, 0x00, 0xc0, 0x06, 0x00, 0x48,
+  0x04, 0x20, 0x21, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Y'
+  0x00, 0x02, 0x02, 0x08, 0x20, 0x41, 0x01, 0x10, 0x05, 0x00, 0x28, 0x00, 0x80, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Z'
+  0x00, 0x01, 0xfe, 0x00, 0x10, 0x01, 0x00, 0x10, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00, 0x40,
+  0x04, 0x00, 0x40, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '['
+  0x0f, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40,
+  0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0xe0,
+  // character: '\\'
+  0x10, 0x00, 0x80, 0x02, 0x00, 0x10, 0x00, 0x80, 0x02, 0x00, 0x10, 0x00, 0x80, 0x02, 0x00, 0x10,
+  0x00, 0x80, 0x02, 0x00, 0x10, 0x00, 0x80, 0x02, 0x00, 0x10,
+  // character: ']'
+  0x0f, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08,
+  0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x01, 0xe0,
+  // character: '^'
+  0x00, 0x00, 0x30, 0x02, 0x40, 0x12, 0x01, 0x08, 0x10, 0x21, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '_'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
+  // character: '`'
+  0x04, 0x00, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'a'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x40, 0x02, 0x01, 0xf0, 0x10, 0x81, 0x04,
+  0x08, 0x20, 0x43, 0x01, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'b'
+  0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0xf0, 0x18, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x41, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'c'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x04, 0x40, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80,
+  0x04, 0x00, 0x11, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'd'
+  0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0xfc, 0x08, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x21, 0x80, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'e'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x08, 0x80, 0x82, 0x04, 0x10, 0x3f, 0x81, 0x00,
+  0x08, 0x00, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'f'
+  0x03, 0x80, 0x20, 0x01, 0x00, 0x08, 0x00, 0xf0, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'g'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x08, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x21, 0x80, 0xf4, 0x00, 0x20, 0x42, 0x01, 0xe0,
+  // character: 'h'
+  0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0xf0, 0x18, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x40, 0x82, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'i'
+  0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'j'
+  0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x70, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08,
+  0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x01, 0xc0,
+  // character: 'k'
+  0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x10, 0x11, 0x00, 0x90, 0x05, 0x00, 0x38, 0x01, 0x20,
+  0x08, 0x80, 0x42, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'l'
+  0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x9c, 0x63, 0x12, 0x10, 0x90, 0x84, 0x84, 0x24, 0x21,
+  0x21, 0x09, 0x08, 0x48, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x18, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x40, 0x82, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x18, 0x40, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x41, 0x03, 0xf0, 0x10, 0x00, 0x80, 0x04, 0x00,
+  // character: 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x08, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x21, 0x80, 0xf4, 0x00, 0x20, 0x01, 0x00, 0x08,
+  // character: 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x70, 0x0c, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80,
+  0x04, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 's'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x40, 0x40, 0x02, 0x00, 0x0f, 0x00, 0x04,
+  0x00, 0x20, 0x21, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 't'
+  0x00, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0xf8, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x10, 0x20, 0x81, 0x04, 0x08, 0x20, 0x41, 0x02,
+  0x08, 0x10, 0x21, 0x80, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x10, 0x40, 0x44, 0x02, 0x20, 0x11, 0x00, 0x50,
+  0x02, 0x80, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x42, 0x11, 0x29, 0x09, 0x48, 0x4a, 0x42, 0x8a,
+  0x0c, 0x60, 0x41, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x08, 0x80, 0x28, 0x01, 0x40, 0x04, 0x00, 0x50,
+  0x02, 0x80, 0x22, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x10, 0x40, 0x44, 0x02, 0x20, 0x11, 0x00, 0x50,
+  0x02, 0x80, 0x08, 0x00, 0x40, 0x04, 0x00, 0x20, 0x01, 0x00,
+  // character: 'z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x20,
+  0x02, 0x00, 0x20, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '{'
+  0x03, 0x80, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x20, 0x06, 0x00, 0x08, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x70,
+  // character: '|'
+  0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x80,
+  // character: '}'
+  0x38, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x08, 0x00, 0x30, 0x02, 0x00, 0x20,
+  0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x07, 0x00,
+  // character: '~'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x84, 0x84, 0x42, 0x42, 0x0c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const tFontPacked Font_13x16_packed_glyphs = { 13, 16, 26, 0x20, 95, Font_13x16_packed_data };
+
+const tFont Font_13x16_packed = { .packed = &Font_13x16_packed_glyphs };
@@ -0,0 +1,2368 @@
+/*******************************************************************************
+* name: Font_13x16_prop
+* family: ISOCPEUR
+* size: 16
+* style: Regular
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* antialiasing: no
+* type: proportional
+* encoding: UTF-8
+*
+* converted from Font_13x16: glyph bitmaps are cropped to their ink columns,
+* placed 1 pixel right of the pen (bearing) with 1 pixel after (advance = width + 2),
+* space advances 5 pixels. Kerning pairs tighten pairs whose facing outlines
+* (letters, period and comma) leave a gap of 5 pixels or more, down to 2 pixels.
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t image_data_Font_13x16_prop_0x20[2] = {
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x20 = { image_data_Font_13x16_prop_0x20,
+    1, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x21[2] = {
+    // ∙
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // ∙
+    // █
+    // █
+    // ∙
+    // ∙
+    // ∙
+    0x7f, 0xd8
+};
+static const tImage Font_13x16_prop_0x21 = { image_data_Font_13x16_prop_0x21,
+    1, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x22[8] = {
+    // █∙∙█
+    // █∙∙█
+    // █∙∙█
+    // █∙∙█
+    // █∙∙█
+    // ∙∙∙∙
+    // ∙∙∙∙
+    // ∙∙∙∙
+    // ∙∙∙∙
+    // ∙∙∙∙
+    // ∙∙∙∙
+    // ∙∙∙∙
+    // ∙∙∙∙
+    // ∙∙∙∙
+    // ∙∙∙∙
+    // ∙∙∙∙
+    0x99, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x22 = { image_data_Font_13x16_prop_0x22,
+    4, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x23[22] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙█∙
+    // ∙∙∙∙█∙∙∙∙█∙
+    // ∙∙∙█∙∙∙∙█∙∙
+    // ∙██████████
+    // ∙∙∙█∙∙∙∙█∙∙
+    // ∙∙∙█∙∙∙∙█∙∙
+    // ∙∙█∙∙∙∙█∙∙∙
+    // ∙∙█∙∙∙∙█∙∙∙
+    // ██████████∙
+    // ∙∙█∙∙∙∙█∙∙∙
+    // ∙█∙∙∙∙█∙∙∙∙
+    // ∙█∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x01, 0x08, 0x21, 0x08, 0x47, 0xfe, 0x21, 0x04, 0x21, 0x08, 0x21, 0x1f, 0xf8, 0x84, 0x21,
+    0x04, 0x20, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x23 = { image_data_Font_13x16_prop_0x23,
+    11, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x24[14] = {
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙█████∙
+    // █∙∙█∙∙█
+    // █∙∙█∙∙∙
+    // █∙∙█∙∙∙
+    // ∙███∙∙∙
+    // ∙∙∙███∙
+    // ∙∙∙█∙∙█
+    // ∙∙∙█∙∙█
+    // █∙∙█∙∙█
+    // ∙█████∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    0x00, 0x20, 0x43, 0xe9, 0x32, 0x24, 0x38, 0x1c, 0x24, 0x4c, 0x97, 0xc2, 0x04, 0x08
+};
+static const tImage Font_13x16_prop_0x24 = { image_data_Font_13x16_prop_0x24,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x25[26] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ████∙∙∙∙∙█∙∙∙
+    // ∙∙∙∙█∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙█∙∙∙∙∙
+    // ∙∙∙∙█∙█∙∙∙∙∙∙
+    // ∙∙∙∙█∙█∙████∙
+    // ████∙█∙█∙∙∙∙█
+    // ∙∙∙∙∙█∙█∙∙∙∙█
+    // ∙∙∙∙█∙∙█∙∙∙∙█
+    // ∙∙∙█∙∙∙█∙∙∙∙█
+    // ∙∙∙█∙∙∙█∙∙∙∙█
+    // ∙∙█∙∙∙∙∙████∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x07, 0x82, 0x02, 0x20, 0x11, 0x00, 0x90, 0x05, 0x00, 0x2b, 0xde, 0xa1, 0x05, 0x08, 0x48,
+    0x44, 0x42, 0x22, 0x12, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x25 = { image_data_Font_13x16_prop_0x25,
+    13, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x26[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙████∙∙∙∙
+    // ∙█∙∙∙∙█∙∙∙
+    // ∙█∙∙∙∙█∙∙∙
+    // ∙█∙∙∙∙█∙∙∙
+    // ∙∙█∙∙█∙∙∙∙
+    // ∙∙███∙∙∙█∙
+    // ∙█∙∙█∙∙∙█∙
+    // █∙∙∙∙█∙∙█∙
+    // █∙∙∙∙∙██∙∙
+    // █∙∙∙∙∙∙█∙∙
+    // ∙█∙∙∙∙█∙█∙
+    // ∙∙████∙∙∙█
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x0f, 0x04, 0x21, 0x08, 0x42, 0x09, 0x03, 0x89, 0x22, 0x84, 0xa0, 0xc8, 0x11, 0x0a, 0x3c,
+    0x40, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x26 = { image_data_Font_13x16_prop_0x26,
+    10, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x27[2] = {
+    // █
+    // █
+    // █
+    // █
+    // █
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    0xf8, 0x00
+};
+static const tImage Font_13x16_prop_0x27 = { image_data_Font_13x16_prop_0x27,
+    1, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x28[8] = {
+    // ∙∙∙█
+    // ∙∙█∙
+    // ∙█∙∙
+    // ∙█∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // ∙█∙∙
+    // ∙█∙∙
+    // ∙∙█∙
+    // ∙∙∙█
+    0x12, 0x44, 0x88, 0x88, 0x88, 0x88, 0x44, 0x21
+};
+static const tImage Font_13x16_prop_0x28 = { image_data_Font_13x16_prop_0x28,
+    4, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x29[8] = {
+    // █∙∙∙
+    // ∙█∙∙
+    // ∙∙█∙
+    // ∙∙█∙
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙█∙
+    // ∙∙█∙
+    // ∙█∙∙
+    // █∙∙∙
+    0x84, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x48
+};
+static const tImage Font_13x16_prop_0x29 = { image_data_Font_13x16_prop_0x29,
+    4, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x2a[14] = {
+    // ∙∙∙█∙∙∙
+    // █∙∙█∙∙█
+    // ∙█∙█∙█∙
+    // ∙∙███∙∙
+    // ∙█∙█∙█∙
+    // █∙∙█∙∙█
+    // ∙∙∙█∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x11, 0x25, 0x51, 0xc5, 0x52, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x2a = { image_data_Font_13x16_prop_0x2a,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x2b[18] = {
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // █████████
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x40, 0x21, 0xff, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x2b = { image_data_Font_13x16_prop_0x2b,
+    9, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x2c[4] = {
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙█
+    // ∙█
+    // ∙█
+    // █∙
+    // █∙
+    0x00, 0x00, 0x01, 0x5a
+};
+static const tImage Font_13x16_prop_0x2c = { image_data_Font_13x16_prop_0x2c,
+    2, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x2d[10] = {
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // █████
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x2d = { image_data_Font_13x16_prop_0x2d,
+    5, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x2e[2] = {
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // █
+    // █
+    // ∙
+    // ∙
+    // ∙
+    0x00, 0x18
+};
+static const tImage Font_13x16_prop_0x2e = { image_data_Font_13x16_prop_0x2e,
+    1, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x2f[12] = {
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙█∙
+    // ∙∙∙∙█∙
+    // ∙∙∙∙█∙
+    // ∙∙∙█∙∙
+    // ∙∙∙█∙∙
+    // ∙∙∙█∙∙
+    // ∙∙█∙∙∙
+    // ∙∙█∙∙∙
+    // ∙∙█∙∙∙
+    // ∙█∙∙∙∙
+    // ∙█∙∙∙∙
+    // ∙█∙∙∙∙
+    // █∙∙∙∙∙
+    // █∙∙∙∙∙
+    0x04, 0x10, 0x82, 0x08, 0x41, 0x04, 0x20, 0x82, 0x10, 0x41, 0x08, 0x20
+};
+static const tImage Font_13x16_prop_0x2f = { image_data_Font_13x16_prop_0x2f,
+    6, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x30[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙████∙∙
+    // ∙█∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙█∙
+    // ∙∙████∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x30 = { image_data_Font_13x16_prop_0x30,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x31[10] = {
+    // ∙∙∙∙∙
+    // ∙∙█∙∙
+    // ∙∙█∙∙
+    // ███∙∙
+    // ∙∙█∙∙
+    // ∙∙█∙∙
+    // ∙∙█∙∙
+    // ∙∙█∙∙
+    // ∙∙█∙∙
+    // ∙∙█∙∙
+    // ∙∙█∙∙
+    // ∙∙█∙∙
+    // █████
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    0x01, 0x09, 0xc2, 0x10, 0x84, 0x21, 0x08, 0x4f, 0x80, 0x00
+};
+static const tImage Font_13x16_prop_0x31 = { image_data_Font_13x16_prop_0x31,
+    5, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x32[14] = {
+    // ∙∙∙∙∙∙∙
+    // ∙████∙∙
+    // █∙∙∙∙█∙
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙█∙
+    // ∙∙∙∙█∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙█∙∙∙∙
+    // ∙█∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // ███████
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x00, 0xf2, 0x10, 0x10, 0x20, 0x41, 0x04, 0x10, 0x41, 0x04, 0x0f, 0xe0, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x32 = { image_data_Font_13x16_prop_0x32,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x33[14] = {
+    // ∙∙∙∙∙∙∙
+    // ∙████∙∙
+    // █∙∙∙∙█∙
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙█∙
+    // ∙∙███∙∙
+    // ∙∙∙∙∙█∙
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█
+    // █∙∙∙∙█∙
+    // ∙████∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x00, 0xf2, 0x10, 0x10, 0x20, 0x8e, 0x02, 0x02, 0x04, 0x0c, 0x27, 0x80, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x33 = { image_data_Font_13x16_prop_0x33,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x34[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█∙
+    // ∙∙∙∙∙██∙
+    // ∙∙∙∙█∙█∙
+    // ∙∙∙█∙∙█∙
+    // ∙∙█∙∙∙█∙
+    // ∙█∙∙∙∙█∙
+    // █∙∙∙∙∙█∙
+    // ████████
+    // ∙∙∙∙∙∙█∙
+    // ∙∙∙∙∙∙█∙
+    // ∙∙∙∙∙∙█∙
+    // ∙∙∙∙∙∙█∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x02, 0x06, 0x0a, 0x12, 0x22, 0x42, 0x82, 0xff, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x34 = { image_data_Font_13x16_prop_0x34,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x35[14] = {
+    // ∙∙∙∙∙∙∙
+    // ███████
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █████∙∙
+    // ∙∙∙∙∙█∙
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█
+    // █∙∙∙∙█∙
+    // ∙████∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x01, 0xfe, 0x04, 0x08, 0x1f, 0x01, 0x01, 0x02, 0x04, 0x0c, 0x27, 0x80, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x35 = { image_data_Font_13x16_prop_0x35,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x36[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙████∙
+    // ∙∙█∙∙∙∙∙
+    // ∙█∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙████∙∙
+    // ██∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙█∙
+    // ∙∙████∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x1e, 0x20, 0x40, 0x80, 0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x36 = { image_data_Font_13x16_prop_0x36,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x37[14] = {
+    // ∙∙∙∙∙∙∙
+    // ███████
+    // ∙∙∙∙∙∙█
+    // ∙∙∙∙∙█∙
+    // ∙∙∙∙∙█∙
+    // ∙∙∙∙█∙∙
+    // ∙∙∙∙█∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙█∙∙∙∙
+    // ∙∙█∙∙∙∙
+    // ∙█∙∙∙∙∙
+    // ∙█∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x01, 0xfc, 0x08, 0x20, 0x41, 0x02, 0x08, 0x10, 0x40, 0x82, 0x04, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x37 = { image_data_Font_13x16_prop_0x37,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x38[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙████∙∙
+    // ∙█∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙█∙
+    // ∙∙████∙∙
+    // ∙█∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙█∙
+    // ∙∙████∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x3c, 0x42, 0x81, 0x81, 0x42, 0x3c, 0x42, 0x81, 0x81, 0x81, 0x42, 0x3c, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x38 = { image_data_Font_13x16_prop_0x38,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x39[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙████∙∙
+    // ∙█∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙██
+    // ∙∙████∙█
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█∙
+    // ∙∙∙∙∙█∙∙
+    // ∙████∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3d, 0x01, 0x02, 0x04, 0x78, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x39 = { image_data_Font_13x16_prop_0x39,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x3a[2] = {
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // █
+    // █
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // ∙
+    // █
+    // █
+    // ∙
+    // ∙
+    // ∙
+    0x0c, 0x18
+};
+static const tImage Font_13x16_prop_0x3a = { image_data_Font_13x16_prop_0x3a,
+    1, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x3b[4] = {
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙█
+    // ∙█
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙█
+    // ∙█
+    // ∙█
+    // █∙
+    // █∙
+    0x00, 0x50, 0x01, 0x5a
+};
+static const tImage Font_13x16_prop_0x3b = { image_data_Font_13x16_prop_0x3b,
+    2, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x3c[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙██∙
+    // ∙∙∙██∙∙∙
+    // ∙██∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // ∙██∙∙∙∙∙
+    // ∙∙∙██∙∙∙
+    // ∙∙∙∙∙██∙
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x01, 0x06, 0x18, 0x60, 0x80, 0x60, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x3c = { image_data_Font_13x16_prop_0x3c,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x3d[18] = {
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // █████████
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // █████████
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x3d = { image_data_Font_13x16_prop_0x3d,
+    9, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x3e[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // ∙██∙∙∙∙∙
+    // ∙∙∙██∙∙∙
+    // ∙∙∙∙∙██∙
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙██∙
+    // ∙∙∙██∙∙∙
+    // ∙██∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x80, 0x60, 0x18, 0x06, 0x01, 0x06, 0x18, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x3e = { image_data_Font_13x16_prop_0x3e,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x3f[12] = {
+    // ∙∙∙∙∙∙
+    // ∙███∙∙
+    // █∙∙∙█∙
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙█∙
+    // ∙∙∙█∙∙
+    // ∙∙█∙∙∙
+    // ∙∙█∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙█∙∙∙
+    // ∙∙█∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    0x01, 0xc8, 0x81, 0x04, 0x10, 0x84, 0x20, 0x80, 0x08, 0x20, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x3f = { image_data_Font_13x16_prop_0x3f,
+    6, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x40[26] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙
+    // ∙∙██∙∙∙∙∙██∙∙
+    // ∙█∙∙∙∙∙∙∙∙∙█∙
+    // ∙█∙∙∙█████∙█∙
+    // █∙∙∙█∙∙∙∙█∙∙█
+    // █∙∙█∙∙∙∙∙█∙∙█
+    // █∙∙█∙∙∙∙∙█∙∙█
+    // █∙∙█∙∙∙∙∙█∙∙█
+    // █∙∙█∙∙∙∙∙█∙∙█
+    // █∙∙∙█∙∙∙██∙∙█
+    // ∙█∙∙∙███∙███∙
+    // ∙█∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙██∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x7c, 0x0c, 0x18, 0x80, 0x24, 0x7d, 0x44, 0x26, 0x41, 0x32, 0x09, 0x90, 0x4c, 0x82,
+    0x62, 0x32, 0x8e, 0xe4, 0x00, 0x18, 0x00, 0x3e, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x40 = { image_data_Font_13x16_prop_0x40,
+    13, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x41[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██∙∙∙∙
+    // ∙∙∙█∙∙█∙∙∙
+    // ∙∙∙█∙∙█∙∙∙
+    // ∙∙∙█∙∙█∙∙∙
+    // ∙∙█∙∙∙∙█∙∙
+    // ∙∙█∙∙∙∙█∙∙
+    // ∙∙█∙∙∙∙█∙∙
+    // ∙████████∙
+    // ∙█∙∙∙∙∙∙█∙
+    // ∙█∙∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x03, 0x01, 0x20, 0x48, 0x12, 0x08, 0x42, 0x10, 0x84, 0x7f, 0x90, 0x24, 0x0a, 0x01, 0x80,
+    0x40, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x41 = { image_data_Font_13x16_prop_0x41,
+    10, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x42[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ██████∙∙
+    // █∙∙∙∙∙█∙
+    // █∙∙∙∙∙█∙
+    // █∙∙∙∙∙█∙
+    // █∙∙∙∙█∙∙
+    // ██████∙∙
+    // █∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙█∙
+    // ██████∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0xfc, 0x82, 0x82, 0x82, 0x84, 0xfc, 0x82, 0x81, 0x81, 0x81, 0x82, 0xfc, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x42 = { image_data_Font_13x16_prop_0x42,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x43[18] = {
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙█████∙
+    // ∙██∙∙∙∙∙█
+    // ∙█∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙
+    // ∙█∙∙∙∙∙∙∙
+    // ∙██∙∙∙∙∙█
+    // ∙∙∙█████∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    0x00, 0x0f, 0x98, 0x28, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x40, 0x10, 0x0c, 0x11, 0xf0, 0x00,
+    0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x43 = { image_data_Font_13x16_prop_0x43,
+    9, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x44[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ██████∙∙∙∙
+    // █∙∙∙∙∙██∙∙
+    // █∙∙∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙∙█∙
+    // █∙∙∙∙∙██∙∙
+    // ██████∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x3f, 0x08, 0x32, 0x02, 0x80, 0xa0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x28, 0x0a, 0x0c, 0xfc,
+    0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x44 = { image_data_Font_13x16_prop_0x44,
+    10, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x45[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ████████
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // ████████
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // ████████
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0xff, 0x80, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x45 = { image_data_Font_13x16_prop_0x45,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x46[14] = {
+    // ∙∙∙∙∙∙∙
+    // ███████
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // ███████
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x01, 0xfe, 0x04, 0x08, 0x10, 0x3f, 0xc0, 0x81, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x46 = { image_data_Font_13x16_prop_0x46,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x47[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙██████∙
+    // ∙██∙∙∙∙∙∙█
+    // ∙█∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙∙
+    // █∙∙∙∙█████
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // ∙█∙∙∙∙∙∙∙█
+    // ∙██∙∙∙∙∙∙█
+    // ∙∙∙██████∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x07, 0xe6, 0x05, 0x00, 0x80, 0x20, 0x08, 0x02, 0x1f, 0x80, 0x60, 0x14, 0x05, 0x81, 0x1f,
+    0x80, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x47 = { image_data_Font_13x16_prop_0x47,
+    10, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x48[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // ██████████
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x20, 0x18, 0x06, 0x01, 0x80, 0x60, 0x1f, 0xfe, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+    0x40, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x48 = { image_data_Font_13x16_prop_0x48,
+    10, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x49[6] = {
+    // ∙∙∙
+    // ███
+    // ∙█∙
+    // ∙█∙
+    // ∙█∙
+    // ∙█∙
+    // ∙█∙
+    // ∙█∙
+    // ∙█∙
+    // ∙█∙
+    // ∙█∙
+    // ∙█∙
+    // ███
+    // ∙∙∙
+    // ∙∙∙
+    // ∙∙∙
+    0x1d, 0x24, 0x92, 0x49, 0x2e, 0x00
+};
+static const tImage Font_13x16_prop_0x49 = { image_data_Font_13x16_prop_0x49,
+    3, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x4a[12] = {
+    // ∙∙∙∙∙∙
+    // ∙∙████
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // █████∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    0x00, 0xf0, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0xf8, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x4a = { image_data_Font_13x16_prop_0x4a,
+    6, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x4b[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙█∙
+    // █∙∙∙∙█∙∙
+    // █∙∙∙█∙∙∙
+    // █∙∙█∙∙∙∙
+    // █∙█∙∙∙∙∙
+    // ███∙∙∙∙∙
+    // █∙∙█∙∙∙∙
+    // █∙∙∙█∙∙∙
+    // █∙∙∙∙█∙∙
+    // █∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x81, 0x82, 0x84, 0x88, 0x90, 0xa0, 0xe0, 0x90, 0x88, 0x84, 0x82, 0x81, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x4b = { image_data_Font_13x16_prop_0x4b,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x4c[14] = {
+    // ∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // ███████
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x0f, 0xe0, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x4c = { image_data_Font_13x16_prop_0x4c,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x4d[22] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ██∙∙∙∙∙∙∙██
+    // ██∙∙∙∙∙∙∙██
+    // █∙█∙∙∙∙∙█∙█
+    // █∙█∙∙∙∙∙█∙█
+    // █∙∙█∙∙∙█∙∙█
+    // █∙∙█∙∙∙█∙∙█
+    // █∙∙∙█∙█∙∙∙█
+    // █∙∙∙█∙█∙∙∙█
+    // █∙∙∙∙█∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x18, 0x0f, 0x01, 0xd0, 0x5a, 0x0b, 0x22, 0x64, 0x4c, 0x51, 0x8a, 0x30, 0x86, 0x00, 0xc0,
+    0x18, 0x02, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x4d = { image_data_Font_13x16_prop_0x4d,
+    11, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x4e[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙█
+    // ██∙∙∙∙∙∙∙█
+    // █∙█∙∙∙∙∙∙█
+    // █∙∙█∙∙∙∙∙█
+    // █∙∙█∙∙∙∙∙█
+    // █∙∙∙█∙∙∙∙█
+    // █∙∙∙∙█∙∙∙█
+    // █∙∙∙∙∙█∙∙█
+    // █∙∙∙∙∙█∙∙█
+    // █∙∙∙∙∙∙█∙█
+    // █∙∙∙∙∙∙∙██
+    // █∙∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x20, 0x1c, 0x06, 0x81, 0x90, 0x64, 0x18, 0x86, 0x11, 0x82, 0x60, 0x98, 0x16, 0x03, 0x80,
+    0x40, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x4e = { image_data_Font_13x16_prop_0x4e,
+    10, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x4f[22] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙█████∙∙∙
+    // ∙██∙∙∙∙∙██∙
+    // ∙█∙∙∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // ∙█∙∙∙∙∙∙∙█∙
+    // ∙██∙∙∙∙∙██∙
+    // ∙∙∙█████∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x03, 0xe1, 0x83, 0x20, 0x28, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x05, 0x01, 0x30,
+    0x61, 0xf0, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x4f = { image_data_Font_13x16_prop_0x4f,
+    11, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x50[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ██████∙∙
+    // █∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙█∙
+    // ██████∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0xfc, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x50 = { image_data_Font_13x16_prop_0x50,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x51[22] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙█████∙∙∙
+    // ∙██∙∙∙∙∙██∙
+    // ∙█∙∙∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙∙█
+    // ∙█∙∙∙∙∙∙∙█∙
+    // ∙██∙∙∙∙∙██∙
+    // ∙∙∙█████∙∙∙
+    // ∙∙∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙∙∙∙████
+    0x00, 0x03, 0xe1, 0x83, 0x20, 0x28, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x05, 0x01, 0x30,
+    0x61, 0xf0, 0x04, 0x00, 0x80, 0x0f
+};
+static const tImage Font_13x16_prop_0x51 = { image_data_Font_13x16_prop_0x51,
+    11, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x52[18] = {
+    // ∙∙∙∙∙∙∙∙∙
+    // ██████∙∙∙
+    // █∙∙∙∙∙█∙∙
+    // █∙∙∙∙∙█∙∙
+    // █∙∙∙∙∙█∙∙
+    // █∙∙∙∙∙█∙∙
+    // █∙∙∙∙█∙∙∙
+    // █████∙∙∙∙
+    // █∙∙∙█∙∙∙∙
+    // █∙∙∙∙█∙∙∙
+    // █∙∙∙∙∙█∙∙
+    // █∙∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    0x00, 0x7e, 0x20, 0x90, 0x48, 0x24, 0x12, 0x11, 0xf0, 0x88, 0x42, 0x20, 0x90, 0x28, 0x08, 0x00,
+    0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x52 = { image_data_Font_13x16_prop_0x52,
+    9, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x53[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙█████∙
+    // ∙█∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // ∙███∙∙∙∙
+    // ∙∙∙∙███∙
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙█∙
+    // ∙█████∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x3e, 0x41, 0x80, 0x80, 0x80, 0x70, 0x0e, 0x01, 0x01, 0x01, 0x82, 0x7c, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x53 = { image_data_Font_13x16_prop_0x53,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x54[18] = {
+    // ∙∙∙∙∙∙∙∙∙
+    // █████████
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    0x00, 0x7f, 0xc2, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x00,
+    0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x54 = { image_data_Font_13x16_prop_0x54,
+    9, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x55[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙∙█
+    // ∙█∙∙∙∙∙∙█∙
+    // ∙∙██████∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x20, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x05, 0x02, 0x3f,
+    0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x55 = { image_data_Font_13x16_prop_0x55,
+    10, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x56[18] = {
+    // ∙∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙∙█
+    // ∙█∙∙∙∙∙█∙
+    // ∙█∙∙∙∙∙█∙
+    // ∙█∙∙∙∙∙█∙
+    // ∙∙█∙∙∙█∙∙
+    // ∙∙█∙∙∙█∙∙
+    // ∙∙█∙∙∙█∙∙
+    // ∙∙∙█∙█∙∙∙
+    // ∙∙∙█∙█∙∙∙
+    // ∙∙∙█∙█∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    0x00, 0x40, 0x60, 0x28, 0x24, 0x12, 0x08, 0x88, 0x44, 0x22, 0x0a, 0x05, 0x02, 0x80, 0x80, 0x00,
+    0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x56 = { image_data_Font_13x16_prop_0x56,
+    9, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x57[24] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█∙∙∙∙∙█
+    // ∙∙∙∙█∙█∙∙∙∙█
+    // █∙∙∙█∙█∙∙∙█∙
+    // █∙∙∙█∙█∙∙∙█∙
+    // █∙∙∙█∙█∙∙∙█∙
+    // █∙∙∙█∙█∙∙∙█∙
+    // █∙∙█∙∙∙█∙∙█∙
+    // ∙█∙█∙∙∙█∙█∙∙
+    // ∙█∙█∙∙∙█∙█∙∙
+    // ∙█∙█∙∙∙█∙█∙∙
+    // ∙██∙∙∙∙∙██∙∙
+    // ∙∙█∙∙∙∙∙█∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x41, 0x0a, 0x18, 0xa2, 0x8a, 0x28, 0xa2, 0x8a, 0x29, 0x12, 0x51, 0x45, 0x14, 0x51,
+    0x46, 0x0c, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x57 = { image_data_Font_13x16_prop_0x57,
+    12, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x58[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙█∙
+    // ∙█∙∙∙∙█∙
+    // ∙∙█∙∙█∙∙
+    // ∙∙∙██∙∙∙
+    // ∙∙∙██∙∙∙
+    // ∙∙∙██∙∙∙
+    // ∙∙∙██∙∙∙
+    // ∙∙█∙∙█∙∙
+    // ∙█∙∙∙∙█∙
+    // ∙█∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x81, 0x42, 0x42, 0x24, 0x18, 0x18, 0x18, 0x18, 0x24, 0x42, 0x42, 0x81, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x58 = { image_data_Font_13x16_prop_0x58,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x59[18] = {
+    // ∙∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙█
+    // ∙█∙∙∙∙∙█∙
+    // ∙█∙∙∙∙∙█∙
+    // ∙∙█∙∙∙█∙∙
+    // ∙∙∙█∙█∙∙∙
+    // ∙∙∙█∙█∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙█∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    0x00, 0x40, 0x50, 0x48, 0x22, 0x20, 0xa0, 0x50, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x00,
+    0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x59 = { image_data_Font_13x16_prop_0x59,
+    9, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x5a[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ████████
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙█∙
+    // ∙∙∙∙∙█∙∙
+    // ∙∙∙∙∙█∙∙
+    // ∙∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙∙
+    // ∙∙█∙∙∙∙∙
+    // ∙∙█∙∙∙∙∙
+    // ∙█∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // ████████
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0xff, 0x01, 0x02, 0x04, 0x04, 0x08, 0x10, 0x20, 0x20, 0x40, 0x80, 0xff, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x5a = { image_data_Font_13x16_prop_0x5a,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x5b[8] = {
+    // ████
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // █∙∙∙
+    // ████
+    0xf8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8f
+};
+static const tImage Font_13x16_prop_0x5b = { image_data_Font_13x16_prop_0x5b,
+    4, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x5c[12] = {
+    // █∙∙∙∙∙
+    // █∙∙∙∙∙
+    // ∙█∙∙∙∙
+    // ∙█∙∙∙∙
+    // ∙█∙∙∙∙
+    // ∙∙█∙∙∙
+    // ∙∙█∙∙∙
+    // ∙∙█∙∙∙
+    // ∙∙∙█∙∙
+    // ∙∙∙█∙∙
+    // ∙∙∙█∙∙
+    // ∙∙∙∙█∙
+    // ∙∙∙∙█∙
+    // ∙∙∙∙█∙
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    0x82, 0x04, 0x10, 0x40, 0x82, 0x08, 0x10, 0x41, 0x02, 0x08, 0x20, 0x41
+};
+static const tImage Font_13x16_prop_0x5c = { image_data_Font_13x16_prop_0x5c,
+    6, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x5d[8] = {
+    // ████
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ████
+    0xf1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f
+};
+static const tImage Font_13x16_prop_0x5d = { image_data_Font_13x16_prop_0x5d,
+    4, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x5e[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██∙∙∙∙
+    // ∙∙∙█∙∙█∙∙∙
+    // ∙∙∙█∙∙█∙∙∙
+    // ∙∙█∙∙∙∙█∙∙
+    // ∙█∙∙∙∙∙∙█∙
+    // █∙∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x03, 0x01, 0x20, 0x48, 0x21, 0x10, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x5e = { image_data_Font_13x16_prop_0x5e,
+    10, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x5f[18] = {
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙
+    // █████████
+    // ∙∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xfe, 0x00
+};
+static const tImage Font_13x16_prop_0x5f = { image_data_Font_13x16_prop_0x5f,
+    9, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x60[4] = {
+    // █∙
+    // █∙
+    // ∙█
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    // ∙∙
+    0xa4, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x60 = { image_data_Font_13x16_prop_0x60,
+    2, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x61[14] = {
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙████∙
+    // ∙█∙∙∙∙█
+    // ∙∙∙∙∙∙█
+    // ∙∙█████
+    // ∙█∙∙∙∙█
+    // █∙∙∙∙∙█
+    // █∙∙∙∙∙█
+    // █∙∙∙∙██
+    // ∙████∙█
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x03, 0xc8, 0x40, 0x9f, 0x43, 0x06, 0x0c, 0x37, 0xa0, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x61 = { image_data_Font_13x16_prop_0x61,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x62[16] = {
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙████∙∙
+    // ██∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙█∙
+    // ██████∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x80, 0x80, 0x80, 0x80, 0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0xfc, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x62 = { image_data_Font_13x16_prop_0x62,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x63[12] = {
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙███∙
+    // ∙█∙∙∙█
+    // █∙∙∙∙∙
+    // █∙∙∙∙∙
+    // █∙∙∙∙∙
+    // █∙∙∙∙∙
+    // █∙∙∙∙∙
+    // ∙█∙∙∙█
+    // ∙∙███∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x39, 0x18, 0x20, 0x82, 0x08, 0x11, 0x38, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x63 = { image_data_Font_13x16_prop_0x63,
+    6, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x64[16] = {
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙█
+    // ∙∙██████
+    // ∙█∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙██
+    // ∙∙████∙█
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x01, 0x01, 0x01, 0x01, 0x3f, 0x41, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3d, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x64 = { image_data_Font_13x16_prop_0x64,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x65[14] = {
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙███∙∙
+    // ∙█∙∙∙█∙
+    // █∙∙∙∙∙█
+    // █∙∙∙∙∙█
+    // ███████
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // ∙█∙∙∙∙█
+    // ∙∙████∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x03, 0x88, 0xa0, 0xc1, 0xff, 0x02, 0x02, 0x13, 0xc0, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x65 = { image_data_Font_13x16_prop_0x65,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x66[10] = {
+    // ∙∙███
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ████∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    0x3a, 0x10, 0x8f, 0x21, 0x08, 0x42, 0x10, 0x84, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x66 = { image_data_Font_13x16_prop_0x66,
+    5, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x67[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙██████
+    // ∙█∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙██
+    // ∙∙████∙█
+    // ∙∙∙∙∙∙∙█
+    // ∙█∙∙∙∙█∙
+    // ∙∙████∙∙
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0x41, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3d, 0x01, 0x42, 0x3c
+};
+static const tImage Font_13x16_prop_0x67 = { image_data_Font_13x16_prop_0x67,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x68[16] = {
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙████∙∙
+    // ██∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x80, 0x80, 0x80, 0x80, 0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x68 = { image_data_Font_13x16_prop_0x68,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x69[2] = {
+    // ∙
+    // █
+    // █
+    // ∙
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // ∙
+    // ∙
+    // ∙
+    0x6f, 0xf8
+};
+static const tImage Font_13x16_prop_0x69 = { image_data_Font_13x16_prop_0x69,
+    1, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x6a[8] = {
+    // ∙∙∙∙
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙∙
+    // ∙███
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ∙∙∙█
+    // ███∙
+    0x01, 0x10, 0x71, 0x11, 0x11, 0x11, 0x11, 0x1e
+};
+static const tImage Font_13x16_prop_0x6a = { image_data_Font_13x16_prop_0x6a,
+    4, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x6b[14] = {
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙∙∙
+    // █∙∙∙∙█∙
+    // █∙∙∙█∙∙
+    // █∙∙█∙∙∙
+    // █∙█∙∙∙∙
+    // ███∙∙∙∙
+    // █∙∙█∙∙∙
+    // █∙∙∙█∙∙
+    // █∙∙∙∙█∙
+    // █∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x81, 0x02, 0x04, 0x08, 0x51, 0x24, 0x50, 0xe1, 0x22, 0x24, 0x28, 0x20, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x6b = { image_data_Font_13x16_prop_0x6b,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x6c[2] = {
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // ∙
+    // ∙
+    // ∙
+    0xff, 0xf8
+};
+static const tImage Font_13x16_prop_0x6c = { image_data_Font_13x16_prop_0x6c,
+    1, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x6d[22] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // █∙███∙∙███∙
+    // ██∙∙∙██∙∙∙█
+    // █∙∙∙∙█∙∙∙∙█
+    // █∙∙∙∙█∙∙∙∙█
+    // █∙∙∙∙█∙∙∙∙█
+    // █∙∙∙∙█∙∙∙∙█
+    // █∙∙∙∙█∙∙∙∙█
+    // █∙∙∙∙█∙∙∙∙█
+    // █∙∙∙∙█∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x9d, 0x8c, 0x61, 0x0c, 0x21, 0x84, 0x30, 0x86, 0x10, 0xc2,
+    0x18, 0x42, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x6d = { image_data_Font_13x16_prop_0x6d,
+    11, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x6e[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // █∙████∙∙
+    // ██∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x6e = { image_data_Font_13x16_prop_0x6e,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x6f[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙████∙∙
+    // ∙█∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙█∙
+    // ∙∙████∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3c, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x6f = { image_data_Font_13x16_prop_0x6f,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x70[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // █∙████∙∙
+    // ██∙∙∙∙█∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙█∙
+    // ██████∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0xfc, 0x80, 0x80, 0x80
+};
+static const tImage Font_13x16_prop_0x70 = { image_data_Font_13x16_prop_0x70,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x71[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙██████
+    // ∙█∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙██
+    // ∙∙████∙█
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙█
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0x41, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3d, 0x01, 0x01, 0x01
+};
+static const tImage Font_13x16_prop_0x71 = { image_data_Font_13x16_prop_0x71,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x72[10] = {
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // █∙███
+    // ██∙∙∙
+    // █∙∙∙∙
+    // █∙∙∙∙
+    // █∙∙∙∙
+    // █∙∙∙∙
+    // █∙∙∙∙
+    // █∙∙∙∙
+    // █∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    0x00, 0x00, 0x0b, 0xe2, 0x10, 0x84, 0x21, 0x08, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x72 = { image_data_Font_13x16_prop_0x72,
+    5, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x73[12] = {
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙████∙
+    // █∙∙∙∙█
+    // █∙∙∙∙∙
+    // █∙∙∙∙∙
+    // ∙████∙
+    // ∙∙∙∙∙█
+    // ∙∙∙∙∙█
+    // █∙∙∙∙█
+    // ∙████∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x7a, 0x18, 0x20, 0x78, 0x10, 0x61, 0x78, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x73 = { image_data_Font_13x16_prop_0x73,
+    6, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x74[10] = {
+    // ∙∙∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // █████
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙█∙∙∙
+    // ∙∙███
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    // ∙∙∙∙∙
+    0x02, 0x10, 0x8f, 0xa1, 0x08, 0x42, 0x10, 0x83, 0x80, 0x00
+};
+static const tImage Font_13x16_prop_0x74 = { image_data_Font_13x16_prop_0x74,
+    5, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x75[16] = {
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // █∙∙∙∙∙∙█
+    // ∙█∙∙∙∙██
+    // ∙∙████∙█
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3d, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x75 = { image_data_Font_13x16_prop_0x75,
+    8, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x76[14] = {
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // █∙∙∙∙∙█
+    // █∙∙∙∙∙█
+    // ∙█∙∙∙█∙
+    // ∙█∙∙∙█∙
+    // ∙█∙∙∙█∙
+    // ∙∙█∙█∙∙
+    // ∙∙█∙█∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x08, 0x30, 0x51, 0x22, 0x44, 0x50, 0xa0, 0x81, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x76 = { image_data_Font_13x16_prop_0x76,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x77[22] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // █∙∙∙∙█∙∙∙∙█
+    // █∙∙∙∙█∙∙∙∙█
+    // ∙█∙∙█∙█∙∙█∙
+    // ∙█∙∙█∙█∙∙█∙
+    // ∙█∙∙█∙█∙∙█∙
+    // ∙█∙█∙∙∙█∙█∙
+    // ∙∙██∙∙∙██∙∙
+    // ∙∙█∙∙∙∙∙█∙∙
+    // ∙∙█∙∙∙∙∙█∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x43, 0x08, 0x52, 0x92, 0x52, 0x4a, 0x4a, 0x28, 0xc6, 0x10,
+    0x42, 0x08, 0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x77 = { image_data_Font_13x16_prop_0x77,
+    11, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x78[14] = {
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // █∙∙∙∙∙█
+    // ∙█∙∙∙█∙
+    // ∙∙█∙█∙∙
+    // ∙∙█∙█∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙█∙█∙∙
+    // ∙∙█∙█∙∙
+    // ∙█∙∙∙█∙
+    // █∙∙∙∙∙█
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x08, 0x28, 0x8a, 0x14, 0x10, 0x50, 0xa2, 0x28, 0x20, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x78 = { image_data_Font_13x16_prop_0x78,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x79[14] = {
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙
+    // █∙∙∙∙∙█
+    // █∙∙∙∙∙█
+    // ∙█∙∙∙█∙
+    // ∙█∙∙∙█∙
+    // ∙█∙∙∙█∙
+    // ∙∙█∙█∙∙
+    // ∙∙█∙█∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙█∙∙∙∙
+    // ∙∙█∙∙∙∙
+    // ∙∙█∙∙∙∙
+    0x00, 0x00, 0x00, 0x08, 0x30, 0x51, 0x22, 0x44, 0x50, 0xa0, 0x81, 0x04, 0x08, 0x10
+};
+static const tImage Font_13x16_prop_0x79 = { image_data_Font_13x16_prop_0x79,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x7a[12] = {
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ██████
+    // ∙∙∙∙∙█
+    // ∙∙∙∙█∙
+    // ∙∙∙█∙∙
+    // ∙∙█∙∙∙
+    // ∙∙█∙∙∙
+    // ∙█∙∙∙∙
+    // █∙∙∙∙∙
+    // ██████
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    // ∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0xfc, 0x10, 0x84, 0x20, 0x84, 0x20, 0xfc, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x7a = { image_data_Font_13x16_prop_0x7a,
+    6, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x7b[14] = {
+    // ∙∙∙∙███
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙█∙∙∙∙
+    // ██∙∙∙∙∙
+    // ∙∙█∙∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙∙███
+    0x0e, 0x20, 0x40, 0x81, 0x02, 0x08, 0x60, 0x20, 0x20, 0x40, 0x81, 0x02, 0x04, 0x07
+};
+static const tImage Font_13x16_prop_0x7b = { image_data_Font_13x16_prop_0x7b,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x7c[2] = {
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    // █
+    0xff, 0xff
+};
+static const tImage Font_13x16_prop_0x7c = { image_data_Font_13x16_prop_0x7c,
+    1, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x7d[14] = {
+    // ███∙∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙∙█∙∙
+    // ∙∙∙∙∙██
+    // ∙∙∙∙█∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ∙∙∙█∙∙∙
+    // ███∙∙∙∙
+    0xe0, 0x20, 0x40, 0x81, 0x02, 0x02, 0x03, 0x08, 0x20, 0x40, 0x81, 0x02, 0x04, 0x70
+};
+static const tImage Font_13x16_prop_0x7d = { image_data_Font_13x16_prop_0x7d,
+    7, 16, 8, 0};
+
+static const uint8_t image_data_Font_13x16_prop_0x7e[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙██∙∙∙∙∙█
+    // ∙█∙∙█∙∙∙∙█
+    // █∙∙∙∙█∙∙█∙
+    // █∙∙∙∙∙██∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x21, 0x84, 0xa0, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+};
+static const tImage Font_13x16_prop_0x7e = { image_data_Font_13x16_prop_0x7e,
+    10, 16, 8, 0};
+
+
+static const tChar Font_13x16_prop_array[] = {
+  // character: ' '
+  {0x20, &Font_13x16_prop_0x20},
+  // character: '!'
+  {0x21, &Font_13x16_prop_0x21},
+  // character: '"'
+  {0x22, &Font_13x16_prop_0x22},
+  // character: '#'
+  {0x23, &Font_13x16_prop_0x23},
+  // character: '$'
+  {0x24, &Font_13x16_prop_0x24},
+  // character: '%'
+  {0x25, &Font_13x16_prop_0x25},
+  // character: '&'
+  {0x26, &Font_13x16_prop_0x26},
+  // character: '''
+  {0x27, &Font_13x16_prop_0x27},
+  // character: '('
+  {0x28, &Font_13x16_prop_0x28},
+  // character: ')'
+  {0x29, &Font_13x16_prop_0x29},
+  // character: '*'
+  {0x2a, &Font_13x16_prop_0x2a},
+  // character: '+'
+  {0x2b, &Font_13x16_prop_0x2b},
+  // character: ','
+  {0x2c, &Font_13x16_prop_0x2c},
+  // character: '-'
+  {0x2d, &Font_13x16_prop_0x2d},
+  // character: '.'
+  {0x2e, &Font_13x16_prop_0x2e},
+  // character: '/'
+  {0x2f, &Font_13x16_prop_0x2f},
+  // character: '0'
+  {0x30, &Font_13x16_prop_0x30},
+  // character: '1'
+  {0x31, &Font_13x16_prop_0x31},
+  // character: '2'
+  {0x32, &Font_13x16_prop_0x32},
+  // character: '3'
+  {0x33, &Font_13x16_prop_0x33},
+  // character: '4'
+  {0x34, &Font_13x16_prop_0x34},
+  // character: '5'
+  {0x35, &Font_13x16_prop_0x35},
+  // character: '6'
+  {0x36, &Font_13x16_prop_0x36},
+  // character: '7'
+  {0x37, &Font_13x16_prop_0x37},
+  // character: '8'
+  {0x38, &Font_13x16_prop_0x38},
+  // character: '9'
+  {0x39, &Font_13x16_prop_0x39},
+  // character: ':'
+  {0x3a, &Font_13x16_prop_0x3a},
+  // character: ';'
+  {0x3b, &Font_13x16_prop_0x3b},
+  // character: '<'
+  {0x3c, &Font_13x16_prop_0x3c},
+  // character: '='
+  {0x3d, &Font_13x16_prop_0x3d},
+  // character: '>'
+  {0x3e, &Font_13x16_prop_0x3e},
+  // character: '?'
+  {0x3f, &Font_13x16_prop_0x3f},
+  // character: '@'
+  {0x40, &Font_13x16_prop_0x40},
+  // character: 'A'
+  {0x41, &Font_13x16_prop_0x41},
+  // character: 'B'
+  {0x42, &Font_13x16_prop_0x42},
+  // character: 'C'
+  {0x43, &Font_13x16_prop_0x43},
+  // character: 'D'
+  {0x44, &Font_13x16_prop_0x44},
+  // character: 'E'
+  {0x45, &Font_13x16_prop_0x45},
+  // character: 'F'
+  {0x46, &Font_13x16_prop_0x46},
+  // character: 'G'
+  {0x47, &Font_13x16_prop_0x47},
+  // character: 'H'
+  {0x48, &Font_13x16_prop_0x48},
+  // character: 'I'
+  {0x49, &Font_13x16_prop_0x49},
+  // character: 'J'
+  {0x4a, &Font_13x16_prop_0x4a},
+  // character: 'K'
+  {0x4b, &Font_13x16_prop_0x4b},
+  // character: 'L'
+  {0x4c, &Font_13x16_prop_0x4c},
+  // character: 'M'
+  {0x4d, &Font_13x16_prop_0x4d},
+  // character: 'N'
+  {0x4e, &Font_13x16_prop_0x4e},
+  // character: 'O'
+  {0x4f, &Font_13x16_prop_0x4f},
+  // character: 'P'
+  {0x50, &Font_13x16_prop_0x50},
+  // character: 'Q'
+  {0x51, &Font_13x16_prop_0x51},
+  // character: 'R'
+  {0x52, &Font_13x16_prop_0x52},
+  // character: 'S'
+  {0x53, &Font_13x16_prop_0x53},
+  // character: 'T'
+  {0x54, &Font_13x16_prop_0x54},
+  // character: 'U'
+  {0x55, &Font_13x16_prop_0x55},
+  // character: 'V'
+  {0x56, &Font_13x16_prop_0x56},
+  // character: 'W'
+  {0x57, &Font_13x16_prop_0x57},
+  // character: 'X'
+  {0x58, &Font_13x16_prop_0x58},
+  // character: 'Y'
+  {0x59, &Font_13x16_prop_0x59},
+  // character: 'Z'
+  {0x5a, &Font_13x16_prop_0x5a},
+  // character: '['
+  {0x5b, &Font_13x16_prop_0x5b},
+  // character: '\\'
+  {0x5c, &Font_13x16_prop_0x5c},
+  // character: ']'
+  {0x5d, &Font_13x16_prop_0x5d},
+  // character: '^'
+  {0x5e, &Font_13x16_prop_0x5e},
+  // character: '_'
+  {0x5f, &Font_13x16_prop_0x5f},
+  // character: '`'
+  {0x60, &Font_13x16_prop_0x60},
+  // character: 'a'
+  {0x61, &Font_13x16_prop_0x61},
+  // character: 'b'
+  {0x62, &Font_13x16_prop_0x62},
+  // character: 'c'
+  {0x63, &Font_13x16_prop_0x63},
+  // character: 'd'
+  {0x64, &Font_13x16_prop_0x64},
+  // character: 'e'
+  {0x65, &Font_13x16_prop_0x65},
+  // character: 'f'
+  {0x66, &Font_13x16_prop_0x66},
+  // character: 'g'
+  {0x67, &Font_13x16_prop_0x67},
+  // character: 'h'
+  {0x68, &Font_13x16_prop_0x68},
+  // character: 'i'
+  {0x69, &Font_13x16_prop_0x69},
+  // character: 'j'
+  {0x6a, &Font_13x16_prop_0x6a},
+  // character: 'k'
+  {0x6b, &Font_13x16_prop_0x6b},
+  // character: 'l'
+  {0x6c, &Font_13x16_prop_0x6c},
+  // character: 'm'
+  {0x6d, &Font_13x16_prop_0x6d},
+  // character: 'n'
+  {0x6e, &Font_13x16_prop_0x6e},
+  // character: 'o'
+  {0x6f, &Font_13x16_prop_0x6f},
+  // character: 'p'
+  {0x70, &Font_13x16_prop_0x70},
+  // character: 'q'
+  {0x71, &Font_13x16_prop_0x71},
+  // character: 'r'
+  {0x72, &Font_13x16_prop_0x72},
+  // character: 's'
+  {0x73, &Font_13x16_prop_0x73},
+  // character: 't'
+  {0x74, &Font_13x16_prop_0x74},
+  // character: 'u'
+  {0x75, &Font_13x16_prop_0x75},
+  // character: 'v'
+  {0x76, &Font_13x16_prop_0x76},
+  // character: 'w'
+  {0x77, &Font_13x16_prop_0x77},
+  // character: 'x'
+  {0x78, &Font_13x16_prop_0x78},
+  // character: 'y'
+  {0x79, &Font_13x16_prop_0x79},
+  // character: 'z'
+  {0x7a, &Font_13x16_prop_0x7a},
+  // character: '{'
+  {0x7b, &Font_13x16_prop_0x7b},
+  // character: '|'
+  {0x7c, &Font_13x16_prop_0x7c},
+  // character: '}'
+  {0x7d, &Font_13x16_prop_0x7d},
+  // character: '~'
+  {0x7e, &Font_13x16_prop_0x7e}
+};
+
+static const tGlyphMetrics Font_13x16_prop_metrics[] = {
+    { 0, 5 }, { 1, 3 }, { 1, 6 }, { 1, 13 }, { 1, 9 }, { 1, 15 }, { 1, 12 }, { 1, 3 },    //   ! " # $ % & '
+    { 1, 6 }, { 1, 6 }, { 1, 9 }, { 1, 11 }, { 1, 4 }, { 1, 7 }, { 1, 3 }, { 1, 8 },    // ( ) * + , - . /
+    { 1, 10 }, { 1, 7 }, { 1, 9 }, { 1, 9 }, { 1, 10 }, { 1, 9 }, { 1, 10 }, { 1, 9 },    // 0 1 2 3 4 5 6 7
+    { 1, 10 }, { 1, 10 }, { 1, 3 }, { 1, 4 }, { 1, 10 }, { 1, 11 }, { 1, 10 }, { 1, 8 },    // 8 9 : ; < = > ?
+    { 1, 15 }, { 1, 12 }, { 1, 10 }, { 1, 11 }, { 1, 12 }, { 1, 10 }, { 1, 9 }, { 1, 12 },    // @ A B C D E F G
+    { 1, 12 }, { 1, 5 }, { 1, 8 }, { 1, 10 }, { 1, 9 }, { 1, 13 }, { 1, 12 }, { 1, 13 },    // H I J K L M N O
+    { 1, 10 }, { 1, 13 }, { 1, 11 }, { 1, 10 }, { 1, 11 }, { 1, 12 }, { 1, 11 }, { 1, 14 },    // P Q R S T U V W
+    { 1, 10 }, { 1, 11 }, { 1, 10 }, { 1, 6 }, { 1, 8 }, { 1, 6 }, { 1, 12 }, { 1, 11 },    // X Y Z [ \ ] ^ _
+    { 1, 4 }, { 1, 9 }, { 1, 10 }, { 1, 8 }, { 1, 10 }, { 1, 9 }, { 1, 7 }, { 1, 10 },    // ` a b c d e f g
+    { 1, 10 }, { 1, 3 }, { 1, 6 }, { 1, 9 }, { 1, 3 }, { 1, 13 }, { 1, 10 }, { 1, 10 },    // h i j k l m n o
+    { 1, 10 }, { 1, 10 }, { 1, 7 }, { 1, 8 }, { 1, 7 }, { 1, 10 }, { 1, 9 }, { 1, 13 },    // p q r s t u v w
+    { 1, 9 }, { 1, 9 }, { 1, 8 }, { 1, 9 }, { 1, 3 }, { 1, 9 }, { 1, 12 }    // x y z { | } ~
+};
+
+static const tKernPair Font_13x16_prop_kerning[] = {
+    { ',', 'T', -4 }, { ',', 'V', -3 }, { ',', 'Y', -4 }, { '.', 'T', -4 }, { '.', 'V', -3 }, { '.', 'Y', -4 },
+    { '.', 'j', -3 }, { 'A', 'T', -3 }, { 'A', 'V', -3 }, { 'A', 'Y', -3 }, { 'A', 'j', -3 }, { 'C', 'j', -3 },
+    { 'E', 'j', -3 }, { 'F', ',', -4 }, { 'F', '.', -4 }, { 'F', 'j', -3 }, { 'F', 'z', -3 }, { 'G', 'j', -3 },
+    { 'K', 'j', -3 }, { 'L', 'T', -4 }, { 'L', 'V', -3 }, { 'L', 'Y', -4 }, { 'L', 'j', -3 }, { 'L', 'v', -3 },
+    { 'P', ',', -4 }, { 'P', '.', -4 }, { 'P', 'J', -3 }, { 'R', 'j', -3 }, { 'S', 'j', -3 }, { 'T', ',', -4 },
+    { 'T', '.', -4 }, { 'T', 'A', -3 }, { 'T', 'W', -4 }, { 'T', 'a', -4 }, { 'T', 'c', -4 }, { 'T', 'd', -4 },
+    { 'T', 'e', -4 }, { 'T', 'g', -4 }, { 'T', 'j', -3 }, { 'T', 'm', -4 }, { 'T', 'n', -4 }, { 'T', 'o', -4 },
+    { 'T', 'p', -4 }, { 'T', 'q', -4 }, { 'T', 'r', -4 }, { 'T', 's', -4 }, { 'T', 'u', -4 }, { 'T', 'v', -4 },
+    { 'T', 'w', -4 }, { 'T', 'x', -4 }, { 'T', 'y', -4 }, { 'T', 'z', -4 }, { 'V', ',', -4 }, { 'V', '.', -3 },
+    { 'V', 'A', -3 }, { 'W', ',', -3 }, { 'Y', ',', -4 }, { 'Y', '.', -4 }, { 'Y', 'A', -3 }, { 'Y', 'a', -3 },
+    { 'Y', 'c', -3 }, { 'Y', 'd', -3 }, { 'Y', 'e', -3 }, { 'Y', 'g', -3 }, { 'Y', 'o', -3 }, { 'Y', 'q', -3 },
+    { 'a', 'T', -4 }, { 'b', 'T', -4 }, { 'b', 'Y', -3 }, { 'c', 'T', -4 }, { 'e', 'T', -4 }, { 'e', 'Y', -3 },
+    { 'f', ',', -4 }, { 'f', '.', -3 }, { 'f', 'A', -3 }, { 'g', 'T', -4 }, { 'h', 'T', -4 }, { 'h', 'Y', -3 },
+    { 'k', 'T', -4 }, { 'm', 'T', -4 }, { 'n', 'T', -4 }, { 'n', 'Y', -3 }, { 'o', 'T', -4 }, { 'o', 'Y', -3 },
+    { 'p', 'T', -4 }, { 'p', 'Y', -3 }, { 'q', 'T', -4 }, { 'r', ',', -4 }, { 'r', '.', -4 }, { 'r', 'J', -4 },
+    { 'r', 'T', -4 }, { 'r', 'Z', -4 }, { 's', 'T', -4 }, { 't', 'T', -3 }, { 'u', 'T', -4 }, { 'v', ',', -3 },
+    { 'v', 'J', -3 }, { 'v', 'T', -4 }, { 'w', ',', -3 }, { 'w', 'T', -4 }, { 'x', 'T', -4 }, { 'y', ',', -3 },
+    { 'y', 'J', -3 }, { 'y', 'T', -4 }, { 'z', 'T', -4 }
+};
+
+const tFont Font_13x16_prop = { 95, Font_13x16_prop_array, .first_code = 0x20, .dense = 95,
+                                .metrics = Font_13x16_prop_metrics, .kerning = Font_13x16_prop_kerning,
+                                .kerning_count = sizeof(Font_13x16_prop_kerning) / sizeof(Font_13x16_prop_kerning[0]) };
@@ -72,7 +72,7 @@ static const uint8_t image_data_Font_16x24_0x20[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x20 = { image_data_Font_16x24_0x20,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -104,7 +104,7 @@ static const uint8_t image_data_Font_16x24_0x21[48] = {
     0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x21 = { image_data_Font_16x24_0x21,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -136,7 +136,7 @@ static const uint8_t image_data_Font_16x24_0x22[48] = {
     0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x22 = { image_data_Font_16x24_0x22,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -168,7 +168,7 @@ static const uint8_t image_data_Font_16x24_0x23[48] = {
     0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x3f, 0xf8, 0x3f, 0xf8, 0x3f, 0xf8, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x3f, 0xf8, 0x3f, 0xf8, 0x3f, 0xf8, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x23 = { image_data_Font_16x24_0x23,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -200,7 +200,7 @@ static const uint8_t image_data_Font_16x24_0x24[48] = {
     0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x39, 0x80, 0x39, 0x80, 0x39, 0x80, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x01, 0x9c, 0x01, 0x9c, 0x01, 0x9c, 0x01, 0x9c, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x24 = { image_data_Font_16x24_0x24,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -232,7 +232,7 @@ static const uint8_t image_data_Font_16x24_0x25[48] = {
     0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x25 = { image_data_Font_16x24_0x25,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -264,7 +264,7 @@ static const uint8_t image_data_Font_16x24_0x26[48] = {
     0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x39, 0xc8, 0x39, 0xc8, 0x39, 0xc8, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x0f, 0xb8, 0x0f, 0xb8, 0x0f, 0xb8, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x26 = { image_data_Font_16x24_0x26,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -296,7 +296,7 @@ static const uint8_t image_data_Font_16x24_0x27[48] = {
     0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x27 = { image_data_Font_16x24_0x27,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -328,7 +328,7 @@ static const uint8_t image_data_Font_16x24_0x28[48] = {
     0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x28 = { image_data_Font_16x24_0x28,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -360,7 +360,7 @@ static const uint8_t image_data_Font_16x24_0x29[48] = {
     0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x29 = { image_data_Font_16x24_0x29,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -392,7 +392,7 @@ static const uint8_t image_data_Font_16x24_0x2a[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x2a = { image_data_Font_16x24_0x2a,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -424,7 +424,7 @@ static const uint8_t image_data_Font_16x24_0x2b[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x2b = { image_data_Font_16x24_0x2b,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -456,7 +456,7 @@ static const uint8_t image_data_Font_16x24_0x2c[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0x80, 0x03, 0x80
 };
 static const tImage Font_16x24_0x2c = { image_data_Font_16x24_0x2c,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -488,7 +488,7 @@ static const uint8_t image_data_Font_16x24_0x2d[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x2d = { image_data_Font_16x24_0x2d,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -520,7 +520,7 @@ static const uint8_t image_data_Font_16x24_0x2e[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x2e = { image_data_Font_16x24_0x2e,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -552,7 +552,7 @@ static const uint8_t image_data_Font_16x24_0x2f[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xf8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x2f = { image_data_Font_16x24_0x2f,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -584,7 +584,7 @@ static const uint8_t image_data_Font_16x24_0x30[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0x38, 0x1f, 0x38, 0x1f, 0x38, 0x1f, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x30 = { image_data_Font_16x24_0x30,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -616,7 +616,7 @@ static const uint8_t image_data_Font_16x24_0x31[48] = {
     0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x31 = { image_data_Font_16x24_0x31,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -648,7 +648,7 @@ static const uint8_t image_data_Font_16x24_0x32[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x32 = { image_data_Font_16x24_0x32,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -680,7 +680,7 @@ static const uint8_t image_data_Font_16x24_0x33[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x33 = { image_data_Font_16x24_0x33,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -712,7 +712,7 @@ static const uint8_t image_data_Font_16x24_0x34[48] = {
     0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x34 = { image_data_Font_16x24_0x34,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -744,7 +744,7 @@ static const uint8_t image_data_Font_16x24_0x35[48] = {
     0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x35 = { image_data_Font_16x24_0x35,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -776,7 +776,7 @@ static const uint8_t image_data_Font_16x24_0x36[48] = {
     0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x36 = { image_data_Font_16x24_0x36,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -808,7 +808,7 @@ static const uint8_t image_data_Font_16x24_0x37[48] = {
     0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x37 = { image_data_Font_16x24_0x37,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -840,7 +840,7 @@ static const uint8_t image_data_Font_16x24_0x38[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x38 = { image_data_Font_16x24_0x38,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -872,7 +872,7 @@ static const uint8_t image_data_Font_16x24_0x39[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x39 = { image_data_Font_16x24_0x39,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -904,7 +904,7 @@ static const uint8_t image_data_Font_16x24_0x3a[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x3a = { image_data_Font_16x24_0x3a,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -936,7 +936,7 @@ static const uint8_t image_data_Font_16x24_0x3b[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0x80, 0x03, 0x80
 };
 static const tImage Font_16x24_0x3b = { image_data_Font_16x24_0x3b,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -968,7 +968,7 @@ static const uint8_t image_data_Font_16x24_0x3c[48] = {
     0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x3c = { image_data_Font_16x24_0x3c,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1000,7 +1000,7 @@ static const uint8_t image_data_Font_16x24_0x3d[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x3d = { image_data_Font_16x24_0x3d,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1032,7 +1032,7 @@ static const uint8_t image_data_Font_16x24_0x3e[48] = {
     0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x3e = { image_data_Font_16x24_0x3e,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1064,7 +1064,7 @@ static const uint8_t image_data_Font_16x24_0x3f[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x3f = { image_data_Font_16x24_0x3f,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1096,7 +1096,7 @@ static const uint8_t image_data_Font_16x24_0x40[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x40 = { image_data_Font_16x24_0x40,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1128,7 +1128,7 @@ static const uint8_t image_data_Font_16x24_0x41[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x41 = { image_data_Font_16x24_0x41,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1160,7 +1160,7 @@ static const uint8_t image_data_Font_16x24_0x42[48] = {
     0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x42 = { image_data_Font_16x24_0x42,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1192,7 +1192,7 @@ static const uint8_t image_data_Font_16x24_0x43[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x43 = { image_data_Font_16x24_0x43,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1224,7 +1224,7 @@ static const uint8_t image_data_Font_16x24_0x44[48] = {
     0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x44 = { image_data_Font_16x24_0x44,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1256,7 +1256,7 @@ static const uint8_t image_data_Font_16x24_0x45[48] = {
     0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x45 = { image_data_Font_16x24_0x45,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1288,7 +1288,7 @@ static const uint8_t image_data_Font_16x24_0x46[48] = {
     0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x46 = { image_data_Font_16x24_0x46,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1320,7 +1320,7 @@ static const uint8_t image_data_Font_16x24_0x47[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x47 = { image_data_Font_16x24_0x47,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1352,7 +1352,7 @@ static const uint8_t image_data_Font_16x24_0x48[48] = {
     0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x48 = { image_data_Font_16x24_0x48,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1384,7 +1384,7 @@ static const uint8_t image_data_Font_16x24_0x49[48] = {
     0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x49 = { image_data_Font_16x24_0x49,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1416,7 +1416,7 @@ static const uint8_t image_data_Font_16x24_0x4a[48] = {
     0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x4a = { image_data_Font_16x24_0x4a,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1448,7 +1448,7 @@ static const uint8_t image_data_Font_16x24_0x4b[48] = {
     0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x4b = { image_data_Font_16x24_0x4b,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1480,7 +1480,7 @@ static const uint8_t image_data_Font_16x24_0x4c[48] = {
     0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x4c = { image_data_Font_16x24_0x4c,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1512,7 +1512,7 @@ static const uint8_t image_data_Font_16x24_0x4d[48] = {
     0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x3e, 0x7c, 0x3e, 0x7c, 0x3e, 0x7c, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x4d = { image_data_Font_16x24_0x4d,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1544,7 +1544,7 @@ static const uint8_t image_data_Font_16x24_0x4e[48] = {
     0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0x38, 0x1f, 0x38, 0x1f, 0x38, 0x1f, 0x38, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x4e = { image_data_Font_16x24_0x4e,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1576,7 +1576,7 @@ static const uint8_t image_data_Font_16x24_0x4f[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x4f = { image_data_Font_16x24_0x4f,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1608,7 +1608,7 @@ static const uint8_t image_data_Font_16x24_0x50[48] = {
     0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x50 = { image_data_Font_16x24_0x50,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1640,7 +1640,7 @@ static const uint8_t image_data_Font_16x24_0x51[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x51 = { image_data_Font_16x24_0x51,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1672,7 +1672,7 @@ static const uint8_t image_data_Font_16x24_0x52[48] = {
     0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x52 = { image_data_Font_16x24_0x52,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1704,7 +1704,7 @@ static const uint8_t image_data_Font_16x24_0x53[48] = {
     0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x53 = { image_data_Font_16x24_0x53,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1736,7 +1736,7 @@ static const uint8_t image_data_Font_16x24_0x54[48] = {
     0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x54 = { image_data_Font_16x24_0x54,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1768,7 +1768,7 @@ static const uint8_t image_data_Font_16x24_0x55[48] = {
     0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x55 = { image_data_Font_16x24_0x55,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1800,7 +1800,7 @@ static const uint8_t image_data_Font_16x24_0x56[48] = {
     0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x56 = { image_data_Font_16x24_0x56,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1832,7 +1832,7 @@ static const uint8_t image_data_Font_16x24_0x57[48] = {
     0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3e, 0x7c, 0x3e, 0x7c, 0x3e, 0x7c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x57 = { image_data_Font_16x24_0x57,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1864,7 +1864,7 @@ static const uint8_t image_data_Font_16x24_0x58[48] = {
     0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x58 = { image_data_Font_16x24_0x58,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1896,7 +1896,7 @@ static const uint8_t image_data_Font_16x24_0x59[48] = {
     0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x59 = { image_data_Font_16x24_0x59,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1928,7 +1928,7 @@ static const uint8_t image_data_Font_16x24_0x5a[48] = {
     0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x5a = { image_data_Font_16x24_0x5a,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1960,7 +1960,7 @@ static const uint8_t image_data_Font_16x24_0x5b[48] = {
     0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x5b = { image_data_Font_16x24_0x5b,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1992,7 +1992,7 @@ static const uint8_t image_data_Font_16x24_0x5c[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x5c = { image_data_Font_16x24_0x5c,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2024,7 +2024,7 @@ static const uint8_t image_data_Font_16x24_0x5d[48] = {
     0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x5d = { image_data_Font_16x24_0x5d,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2056,7 +2056,7 @@ static const uint8_t image_data_Font_16x24_0x5e[48] = {
     0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x5e = { image_data_Font_16x24_0x5e,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2088,7 +2088,7 @@ static const uint8_t image_data_Font_16x24_0x5f[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x3f, 0xf8
 };
 static const tImage Font_16x24_0x5f = { image_data_Font_16x24_0x5f,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x020 == 0x0)
@@ -2120,7 +2120,7 @@ static const uint8_t image_data_Font_16x24_0x60[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x60 = { image_data_Font_16x24_0x60,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2152,7 +2152,7 @@ static const uint8_t image_data_Font_16x24_0x61[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x61 = { image_data_Font_16x24_0x61,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2184,7 +2184,7 @@ static const uint8_t image_data_Font_16x24_0x62[48] = {
     0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x62 = { image_data_Font_16x24_0x62,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2216,7 +2216,7 @@ static const uint8_t image_data_Font_16x24_0x63[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x63 = { image_data_Font_16x24_0x63,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2248,7 +2248,7 @@ static const uint8_t image_data_Font_16x24_0x64[48] = {
     0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x64 = { image_data_Font_16x24_0x64,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2280,7 +2280,7 @@ static const uint8_t image_data_Font_16x24_0x65[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x65 = { image_data_Font_16x24_0x65,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2312,7 +2312,7 @@ static const uint8_t image_data_Font_16x24_0x66[48] = {
     0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x66 = { image_data_Font_16x24_0x66,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2344,7 +2344,7 @@ static const uint8_t image_data_Font_16x24_0x67[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x07, 0xe0, 0x07, 0xe0
 };
 static const tImage Font_16x24_0x67 = { image_data_Font_16x24_0x67,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2376,7 +2376,7 @@ static const uint8_t image_data_Font_16x24_0x68[48] = {
     0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x68 = { image_data_Font_16x24_0x68,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2408,7 +2408,7 @@ static const uint8_t image_data_Font_16x24_0x69[48] = {
     0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0xf0, 0x07, 0xf0, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x69 = { image_data_Font_16x24_0x69,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2440,7 +2440,7 @@ static const uint8_t image_data_Font_16x24_0x6a[48] = {
     0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x07, 0xc0, 0x07, 0xc0
 };
 static const tImage Font_16x24_0x6a = { image_data_Font_16x24_0x6a,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2472,7 +2472,7 @@ static const uint8_t image_data_Font_16x24_0x6b[48] = {
     0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x6b = { image_data_Font_16x24_0x6b,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2504,7 +2504,7 @@ static const uint8_t image_data_Font_16x24_0x6c[48] = {
     0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0xf0, 0x07, 0xf0, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x6c = { image_data_Font_16x24_0x6c,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2536,7 +2536,7 @@ static const uint8_t image_data_Font_16x24_0x6d[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x3f, 0xf8, 0x3f, 0xf8, 0x3f, 0xf8, 0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x6d = { image_data_Font_16x24_0x6d,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2568,7 +2568,7 @@ static const uint8_t image_data_Font_16x24_0x6e[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x6e = { image_data_Font_16x24_0x6e,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2600,7 +2600,7 @@ static const uint8_t image_data_Font_16x24_0x6f[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x6f = { image_data_Font_16x24_0x6f,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2632,7 +2632,7 @@ static const uint8_t image_data_Font_16x24_0x70[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00
 };
 static const tImage Font_16x24_0x70 = { image_data_Font_16x24_0x70,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2664,7 +2664,7 @@ static const uint8_t image_data_Font_16x24_0x71[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x7c
 };
 static const tImage Font_16x24_0x71 = { image_data_Font_16x24_0x71,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2696,7 +2696,7 @@ static const uint8_t image_data_Font_16x24_0x72[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1f, 0x38, 0x1f, 0x38, 0x1f, 0x38, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x72 = { image_data_Font_16x24_0x72,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2728,7 +2728,7 @@ static const uint8_t image_data_Font_16x24_0x73[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x73 = { image_data_Font_16x24_0x73,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2760,7 +2760,7 @@ static const uint8_t image_data_Font_16x24_0x74[48] = {
     0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x74 = { image_data_Font_16x24_0x74,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2792,7 +2792,7 @@ static const uint8_t image_data_Font_16x24_0x75[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x75 = { image_data_Font_16x24_0x75,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2824,7 +2824,7 @@ static const uint8_t image_data_Font_16x24_0x76[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x76 = { image_data_Font_16x24_0x76,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2856,7 +2856,7 @@ static const uint8_t image_data_Font_16x24_0x77[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x77 = { image_data_Font_16x24_0x77,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2888,7 +2888,7 @@ static const uint8_t image_data_Font_16x24_0x78[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x78 = { image_data_Font_16x24_0x78,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2920,7 +2920,7 @@ static const uint8_t image_data_Font_16x24_0x79[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x07, 0xe0, 0x07, 0xe0
 };
 static const tImage Font_16x24_0x79 = { image_data_Font_16x24_0x79,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2952,7 +2952,7 @@ static const uint8_t image_data_Font_16x24_0x7a[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x7a = { image_data_Font_16x24_0x7a,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2984,7 +2984,7 @@ static const uint8_t image_data_Font_16x24_0x7b[48] = {
     0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x7b = { image_data_Font_16x24_0x7b,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x020 == 0x0)
@@ -3016,7 +3016,7 @@ static const uint8_t image_data_Font_16x24_0x7c[48] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x7c = { image_data_Font_16x24_0x7c,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3048,7 +3048,7 @@ static const uint8_t image_data_Font_16x24_0x7d[48] = {
     0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x7d = { image_data_Font_16x24_0x7d,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3080,7 +3080,7 @@ static const uint8_t image_data_Font_16x24_0x7e[48] = {
     0x0e, 0x08, 0x0e, 0x08, 0x0e, 0x08, 0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8, 0x30, 0x70, 0x30, 0x70, 0x30, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_16x24_0x7e = { image_data_Font_16x24_0x7e,
-    16, 24, 8};
+    16, 24, 8, 0};
 #endif
 
 
@@ -3849,5 +3849,5 @@ static const tChar Font_16x24_array[] = {
 };
 
 
-const tFont Font_16x24 = { 95, Font_16x24_array };
+const tFont Font_16x24 = { 95, Font_16x24_array, .first_code = 0x20, .dense = 95 };
 
@@ -0,0 +1,403 @@
+/*******************************************************************************
+* name: Font_16x24
+* family: JI-Dowses CYRILLIC
+* size: 28
+* style: Regular
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* type: monospaced
+* encoding: UTF-8
+*
+* packed: 95 glyphs 16x24, 48 bytes per glyph, first code 0x20
+* glyph bits are continuous across rows like tImage, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_16x24_packed_data[4560] = {
+  // character: ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '!'
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: '"'
+  0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '#'
+  0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x3f, 0xf8, 0x3f, 0xf8,
+  0x3f, 0xf8, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x3f, 0xf8, 0x3f, 0xf8, 0x3f, 0xf8,
+  0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x00, 0x00, 0x00, 0x00,
+  // character: '$'
+  0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x39, 0x80, 0x39, 0x80,
+  0x39, 0x80, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x01, 0x9c, 0x01, 0x9c, 0x01, 0x9c, 0x01, 0x9c,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+  // character: '%'
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+  // character: '&'
+  0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0,
+  0x39, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x39, 0xc8, 0x39, 0xc8, 0x39, 0xc8,
+  0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x0f, 0xb8, 0x0f, 0xb8, 0x0f, 0xb8, 0x00, 0x00, 0x00, 0x00,
+  // character: '''
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '('
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: ')'
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '*'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x1f, 0xf0,
+  0x1f, 0xf0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0x80, 0x03, 0x80,
+  // character: '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: '/'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xf8, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '0'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xf8, 0x1c, 0xf8,
+  0x1c, 0xf8, 0x1c, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0x38, 0x1f, 0x38, 0x1f, 0x38, 0x1f, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: '1'
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  // character: '2'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x38,
+  0x00, 0x38, 0x00, 0x38, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  // character: '3'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x38, 0x00, 0x38,
+  0x00, 0x38, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: '4'
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xe0,
+  0x07, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: '5'
+  0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0,
+  0x1f, 0xe0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: '6'
+  0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: '7'
+  0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '8'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: '9'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x01, 0xc0,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0x80, 0x03, 0x80,
+  // character: '<'
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+  // character: '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x1f, 0xf8,
+  0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '>'
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x01, 0xc0, 0x01, 0xc0,
+  0x01, 0xc0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '?'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: '@'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xf8, 0x1c, 0xf8,
+  0x1c, 0xf8, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'A'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'B'
+  0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'C'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'D'
+  0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'E'
+  0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  // character: 'F'
+  0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'G'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'H'
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'I'
+  0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'J'
+  0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'K'
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1f, 0xc0, 0x1f, 0xc0,
+  0x1f, 0xc0, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0,
+  0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'L'
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  // character: 'M'
+  0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x3e, 0x7c, 0x3e, 0x7c, 0x3e, 0x7c, 0x3f, 0xfc, 0x3f, 0xfc,
+  0x3f, 0xfc, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c,
+  0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00,
+  // character: 'N'
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0x38, 0x1f, 0x38,
+  0x1f, 0x38, 0x1f, 0x38, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8, 0x1c, 0xf8,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'O'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'P'
+  0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Q'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xd8,
+  0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'R'
+  0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'S'
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'T'
+  0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+  // character: 'U'
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'V'
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'W'
+  0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x39, 0x9c, 0x39, 0x9c,
+  0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc,
+  0x3e, 0x7c, 0x3e, 0x7c, 0x3e, 0x7c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00,
+  // character: 'X'
+  0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x07, 0xe0, 0x07, 0xe0,
+  0x07, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0,
+  0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Y'
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+  0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Z'
+  0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  // character: '['
+  0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  // character: '\\'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ']'
+  0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  // character: '^'
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x1c, 0x70, 0x1c, 0x70,
+  0x1c, 0x70, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '_'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x3f, 0xf8,
+  // character: '`'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'a'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x07, 0xe0,
+  0x07, 0xe0, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  // character: 'b'
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0,
+  0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'c'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x07, 0xe0,
+  0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'd'
+  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x07, 0xf8, 0x07, 0xf8,
+  0x07, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  // character: 'e'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x07, 0xe0,
+  0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'f'
+  0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+  // character: 'g'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x07, 0xf8,
+  0x07, 0xf8, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8,
+  0x07, 0xf8, 0x07, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x07, 0xe0, 0x07, 0xe0,
+  // character: 'h'
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xe0, 0x1f, 0xe0,
+  0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'i'
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x07, 0xc0,
+  0x07, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0xf0, 0x07, 0xf0, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'j'
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x03, 0xe0,
+  0x03, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x07, 0xc0, 0x07, 0xc0,
+  // character: 'k'
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0,
+  0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'l'
+  0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0xf0, 0x07, 0xf0, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x0e, 0x70,
+  0x0e, 0x70, 0x3f, 0xf8, 0x3f, 0xf8, 0x3f, 0xf8, 0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8,
+  0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x1f, 0xe0,
+  0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00,
+  // character: 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x07, 0xe0,
+  0x07, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x1f, 0xe0,
+  0x1f, 0xe0, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1f, 0xe0,
+  0x1f, 0xe0, 0x1f, 0xe0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  // character: 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
+  0x0f, 0xf0, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x0f, 0xf0,
+  0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x7c,
+  // character: 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe0, 0x1c, 0xe0,
+  0x1c, 0xe0, 0x1f, 0x38, 0x1f, 0x38, 0x1f, 0x38, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 's'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x07, 0xf8,
+  0x07, 0xf8, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x00, 0x38,
+  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x1f, 0xe0, 0x1f, 0xe0, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  // character: 't'
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0xf0, 0x0f, 0xf0,
+  0x0f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  // character: 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x38, 0x1c,
+  0x38, 0x1c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c,
+  0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x00, 0x00, 0x00, 0x00,
+  // character: 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70,
+  0x1c, 0x70, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00,
+  // character: 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x1c, 0x38,
+  0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+  0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x07, 0xe0, 0x07, 0xe0,
+  // character: 'z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xf0,
+  0x1f, 0xf0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  // character: '{'
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0x01, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+  // character: '|'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '}'
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '~'
+  0x0e, 0x08, 0x0e, 0x08, 0x0e, 0x08, 0x39, 0xb8, 0x39, 0xb8, 0x39, 0xb8, 0x30, 0x70, 0x30, 0x70,
+  0x30, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const tFontPacked Font_16x24_packed_glyphs = { 16, 24, 48, 0x20, 95, Font_16x24_packed_data };
+
+const tFont Font_16x24_packed = { .packed = &Font_16x24_packed_glyphs };
@@ -58,7 +58,7 @@ static const uint8_t image_data_Font_18x26_0x30[59] = {
     0x00, 0x00, 0x0f, 0xff, 0xc5, 0xff, 0xe9, 0xbf, 0xf6, 0x77, 0xfb, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0x80, 0x0e, 0x40, 0x00, 0x90, 0x00, 0x26, 0x00, 0x39, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9d, 0xfe, 0xe6, 0xff, 0xd9, 0x7f, 0xfa, 0x3f, 0xff, 0x00, 0x00, 0x00
 };
 static const tImage Font_18x26_0x30 = { image_data_Font_18x26_0x30,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -92,7 +92,7 @@ static const uint8_t image_data_Font_18x26_0x31[59] = {
     0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x18, 0x00, 0x0e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x00, 0x80, 0x00, 0x00
 };
 static const tImage Font_18x26_0x31 = { image_data_Font_18x26_0x31,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -126,7 +126,7 @@ static const uint8_t image_data_Font_18x26_0x32[59] = {
     0x00, 0x00, 0x1f, 0xff, 0xc7, 0xff, 0xe8, 0xff, 0xf6, 0x1f, 0xfb, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x3f, 0xee, 0x1f, 0xfc, 0x0b, 0xff, 0x07, 0x7f, 0x81, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1d, 0xff, 0x06, 0xff, 0xe1, 0x7f, 0xfc, 0x3f, 0xff, 0x80, 0x00, 0x00
 };
 static const tImage Font_18x26_0x32 = { image_data_Font_18x26_0x32,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -160,7 +160,7 @@ static const uint8_t image_data_Font_18x26_0x33[59] = {
     0x00, 0x00, 0x1f, 0xff, 0xc7, 0xff, 0xe8, 0xff, 0xf6, 0x1f, 0xfb, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x1f, 0xee, 0x1f, 0xfc, 0x87, 0xff, 0x20, 0x7f, 0xb8, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x87, 0xfe, 0xe3, 0xff, 0xd9, 0xff, 0xfa, 0x7f, 0xff, 0x00, 0x00, 0x00
 };
 static const tImage Font_18x26_0x33 = { image_data_Font_18x26_0x33,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -194,7 +194,7 @@ static const uint8_t image_data_Font_18x26_0x34[59] = {
     0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x19, 0xc0, 0x0e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xdf, 0xee, 0x2f, 0xfc, 0x87, 0xff, 0x20, 0xff, 0xb8, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x38, 0x00, 0x06, 0x00, 0x00, 0x80, 0x00, 0x00
 };
 static const tImage Font_18x26_0x34 = { image_data_Font_18x26_0x34,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -228,7 +228,7 @@ static const uint8_t image_data_Font_18x26_0x35[59] = {
     0x00, 0x00, 0x0f, 0xff, 0xe5, 0xff, 0xf9, 0xbf, 0xfc, 0x77, 0xfe, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xdf, 0xf0, 0x2f, 0xfe, 0x07, 0xff, 0x40, 0xff, 0xb8, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x87, 0xfe, 0xe3, 0xff, 0xd9, 0xff, 0xfa, 0x7f, 0xff, 0x00, 0x00, 0x00
 };
 static const tImage Font_18x26_0x35 = { image_data_Font_18x26_0x35,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -262,7 +262,7 @@ static const uint8_t image_data_Font_18x26_0x36[59] = {
     0x00, 0x00, 0x0f, 0xff, 0xe5, 0xff, 0xf1, 0xbf, 0xf8, 0x77, 0xfc, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xdf, 0xf0, 0x4f, 0xfe, 0x13, 0xff, 0x47, 0x7f, 0xb9, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9d, 0xfe, 0xe6, 0xff, 0xd9, 0x7f, 0xfa, 0x3f, 0xff, 0x00, 0x00, 0x00
 };
 static const tImage Font_18x26_0x36 = { image_data_Font_18x26_0x36,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -296,7 +296,7 @@ static const uint8_t image_data_Font_18x26_0x37[59] = {
     0x00, 0x00, 0x0f, 0xff, 0xc5, 0xff, 0xe9, 0xbf, 0xf6, 0x77, 0xfb, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x78, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x00
 };
 static const tImage Font_18x26_0x37 = { image_data_Font_18x26_0x37,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -330,7 +330,7 @@ static const uint8_t image_data_Font_18x26_0x38[59] = {
     0x00, 0x00, 0x0f, 0xff, 0xc5, 0xff, 0xe9, 0xbf, 0xf6, 0x77, 0xfb, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xdf, 0xee, 0x4f, 0xfc, 0x93, 0xff, 0x27, 0x7f, 0xb9, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9d, 0xfe, 0xe6, 0xff, 0xd9, 0x7f, 0xfa, 0x3f, 0xff, 0x00, 0x00, 0x00
 };
 static const tImage Font_18x26_0x38 = { image_data_Font_18x26_0x38,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -364,7 +364,7 @@ static const uint8_t image_data_Font_18x26_0x39[59] = {
     0x00, 0x00, 0x0f, 0xff, 0xc5, 0xff, 0xe9, 0xbf, 0xf6, 0x77, 0xfb, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xdf, 0xee, 0x2f, 0xfc, 0x87, 0xff, 0x20, 0xff, 0xb8, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x83, 0xfe, 0xe1, 0xff, 0xd8, 0xff, 0xfa, 0x7f, 0xff, 0x00, 0x00, 0x00
 };
 static const tImage Font_18x26_0x39 = { image_data_Font_18x26_0x39,
-    18, 26, 8};
+    18, 26, 8, 0};
 #endif
 
 
@@ -456,5 +456,5 @@ static const tChar Font_18x26_array[] = {
 };
 
 
-const tFont Font_LET_18x26 = { 10, Font_18x26_array };
+const tFont Font_LET_18x26 = { 10, Font_18x26_array, .first_code = 0x30, .dense = 10 };
 
@@ -0,0 +1,73 @@
+/*******************************************************************************
+* name: Font_18x26
+* family: Pixel LCD7
+* size: 28
+* style: Regular
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* type: monospaced
+* encoding: UTF-8
+*
+* packed: 10 glyphs 18x26, 59 bytes per glyph, first code 0x30
+* glyph bits are continuous across rows like tImage, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_LET_18x26_packed_data[590] = {
+  // character: '0'
+  0x00, 0x00, 0x0f, 0xff, 0xc5, 0xff, 0xe9, 0xbf, 0xf6, 0x77, 0xfb, 0x9e, 0x01, 0xe7, 0x80, 0x79,
+  0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0x80, 0x0e, 0x40, 0x00, 0x90, 0x00, 0x26,
+  0x00, 0x39, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9d,
+  0xfe, 0xe6, 0xff, 0xd9, 0x7f, 0xfa, 0x3f, 0xff, 0x00, 0x00, 0x00,
+  // character: '1'
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x18, 0x00, 0x0e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78,
+  0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x38, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80,
+  0x01, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x00, 0x80, 0x00, 0x00,
+  // character: '2'
+  0x00, 0x00, 0x1f, 0xff, 0xc7, 0xff, 0xe8, 0xff, 0xf6, 0x1f, 0xfb, 0x80, 0x01, 0xe0, 0x00, 0x78,
+  0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x3f, 0xee, 0x1f, 0xfc, 0x0b, 0xff, 0x07,
+  0x7f, 0x81, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1d,
+  0xff, 0x06, 0xff, 0xe1, 0x7f, 0xfc, 0x3f, 0xff, 0x80, 0x00, 0x00,
+  // character: '3'
+  0x00, 0x00, 0x1f, 0xff, 0xc7, 0xff, 0xe8, 0xff, 0xf6, 0x1f, 0xfb, 0x80, 0x01, 0xe0, 0x00, 0x78,
+  0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x1f, 0xee, 0x1f, 0xfc, 0x87, 0xff, 0x20,
+  0x7f, 0xb8, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x87,
+  0xfe, 0xe3, 0xff, 0xd9, 0xff, 0xfa, 0x7f, 0xff, 0x00, 0x00, 0x00,
+  // character: '4'
+  0x00, 0x00, 0x10, 0x00, 0x26, 0x00, 0x19, 0xc0, 0x0e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79,
+  0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xdf, 0xee, 0x2f, 0xfc, 0x87, 0xff, 0x20,
+  0xff, 0xb8, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80,
+  0x01, 0xe0, 0x00, 0x38, 0x00, 0x06, 0x00, 0x00, 0x80, 0x00, 0x00,
+  // character: '5'
+  0x00, 0x00, 0x0f, 0xff, 0xe5, 0xff, 0xf9, 0xbf, 0xfc, 0x77, 0xfe, 0x1e, 0x00, 0x07, 0x80, 0x01,
+  0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xdf, 0xf0, 0x2f, 0xfe, 0x07, 0xff, 0x40,
+  0xff, 0xb8, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x87,
+  0xfe, 0xe3, 0xff, 0xd9, 0xff, 0xfa, 0x7f, 0xff, 0x00, 0x00, 0x00,
+  // character: '6'
+  0x00, 0x00, 0x0f, 0xff, 0xe5, 0xff, 0xf1, 0xbf, 0xf8, 0x77, 0xfc, 0x1e, 0x00, 0x07, 0x80, 0x01,
+  0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xdf, 0xf0, 0x4f, 0xfe, 0x13, 0xff, 0x47,
+  0x7f, 0xb9, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9d,
+  0xfe, 0xe6, 0xff, 0xd9, 0x7f, 0xfa, 0x3f, 0xff, 0x00, 0x00, 0x00,
+  // character: '7'
+  0x00, 0x00, 0x0f, 0xff, 0xc5, 0xff, 0xe9, 0xbf, 0xf6, 0x77, 0xfb, 0x9e, 0x01, 0xe7, 0x80, 0x79,
+  0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x78, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x30, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80,
+  0x01, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x00,
+  // character: '8'
+  0x00, 0x00, 0x0f, 0xff, 0xc5, 0xff, 0xe9, 0xbf, 0xf6, 0x77, 0xfb, 0x9e, 0x01, 0xe7, 0x80, 0x79,
+  0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xdf, 0xee, 0x4f, 0xfc, 0x93, 0xff, 0x27,
+  0x7f, 0xb9, 0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xe0, 0x1e, 0x78, 0x07, 0x9d,
+  0xfe, 0xe6, 0xff, 0xd9, 0x7f, 0xfa, 0x3f, 0xff, 0x00, 0x00, 0x00,
+  // character: '9'
+  0x00, 0x00, 0x0f, 0xff, 0xc5, 0xff, 0xe9, 0xbf, 0xf6, 0x77, 0xfb, 0x9e, 0x01, 0xe7, 0x80, 0x79,
+  0xe0, 0x1e, 0x78, 0x07, 0x9e, 0x01, 0xe7, 0x80, 0x79, 0xdf, 0xee, 0x2f, 0xfc, 0x87, 0xff, 0x20,
+  0xff, 0xb8, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x83,
+  0xfe, 0xe1, 0xff, 0xd8, 0xff, 0xfa, 0x7f, 0xff, 0x00, 0x00, 0x00
+};
+
+static const tFontPacked Font_LET_18x26_packed_glyphs = { 18, 26, 59, 0x30, 10, Font_LET_18x26_packed_data };
+
+const tFont Font_LET_18x26_packed = { .packed = &Font_LET_18x26_packed_glyphs };
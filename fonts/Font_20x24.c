@@ -55,7 +55,7 @@ static const uint8_t image_data_Font_20x24_0x20[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x20 = { image_data_Font_20x24_0x20,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -87,7 +87,7 @@ static const uint8_t image_data_Font_20x24_0x21[60] = {
     0x00, 0xf0, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x0f, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0xf8, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x21 = { image_data_Font_20x24_0x21,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -119,7 +119,7 @@ static const uint8_t image_data_Font_20x24_0x22[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xc0, 0x07, 0xfe, 0x00, 0x7f, 0xe0, 0x07, 0xbe, 0x00, 0x38, 0xc0, 0x01, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x22 = { image_data_Font_20x24_0x22,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -151,7 +151,7 @@ static const uint8_t image_data_Font_20x24_0x23[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x00, 0x79, 0xe0, 0x07, 0x9f, 0x00, 0x79, 0xf0, 0x07, 0x9f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xe0, 0x79, 0xf0, 0x07, 0x9f, 0x03, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0x07, 0x9f, 0x00, 0x79, 0xf0, 0x07, 0x9f, 0x00, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x23 = { image_data_Font_20x24_0x23,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -183,7 +183,7 @@ static const uint8_t image_data_Font_20x24_0x24[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x06, 0x00, 0x00, 0xf0, 0x00, 0x7f, 0xe0, 0x0f, 0xff, 0x00, 0xff, 0xf8, 0x1f, 0xef, 0x80, 0xfe, 0x00, 0x0f, 0xf8, 0x00, 0x3f, 0xe0, 0x00, 0xff, 0x80, 0xff, 0xf8, 0x0f, 0xef, 0x80, 0xff, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xe0, 0x00, 0x60, 0x00, 0x06, 0x00
 };
 static const tImage Font_20x24_0x24 = { image_data_Font_20x24_0x24,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -215,7 +215,7 @@ static const uint8_t image_data_Font_20x24_0x25[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x01, 0xf0, 0x78, 0x3f, 0x8f, 0x83, 0x38, 0xf8, 0x71, 0x9f, 0x03, 0xbb, 0xf0, 0x3f, 0x3e, 0x00, 0xe7, 0xc0, 0x00, 0x7c, 0x00, 0x0f, 0x80, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x03, 0xe3, 0x00, 0x7e, 0xfc, 0x07, 0xcf, 0xe0, 0xf9, 0xce, 0x0f, 0x9c, 0xe1, 0xf0, 0xee, 0x1e, 0x0f, 0xc0, 0xe0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x25 = { image_data_Font_20x24_0x25,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -247,7 +247,7 @@ static const uint8_t image_data_Font_20x24_0x26[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x3f, 0x80, 0x0f, 0xfc, 0x00, 0xf1, 0xc0, 0x1e, 0x0c, 0x01, 0xe0, 0xc0, 0x1f, 0x1c, 0x00, 0xfb, 0xc0, 0x0f, 0xf8, 0x00, 0x3f, 0x38, 0x07, 0xff, 0x80, 0xff, 0xf8, 0x0f, 0x3f, 0x00, 0xe1, 0xe0, 0x1e, 0x0f, 0x01, 0xe0, 0xf0, 0x1f, 0x1f, 0x80, 0xff, 0xfc, 0x07, 0xff, 0xc0, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x26 = { image_data_Font_20x24_0x26,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -279,7 +279,7 @@ static const uint8_t image_data_Font_20x24_0x27[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf8, 0x00, 0x0f, 0x80, 0x00, 0xf0, 0x00, 0x07, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x27 = { image_data_Font_20x24_0x27,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -311,7 +311,7 @@ static const uint8_t image_data_Font_20x24_0x28[60] = {
     0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x20, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0xe0, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x28 = { image_data_Font_20x24_0x28,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -343,7 +343,7 @@ static const uint8_t image_data_Font_20x24_0x29[60] = {
     0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x06, 0x00, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x29 = { image_data_Font_20x24_0x29,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -375,7 +375,7 @@ static const uint8_t image_data_Font_20x24_0x2a[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x01, 0xcf, 0x38, 0x3e, 0xf7, 0xc3, 0xff, 0xfc, 0x1f, 0xff, 0x80, 0xff, 0xf0, 0x7f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0x0f, 0xff, 0x01, 0xff, 0xf8, 0x3f, 0xff, 0xc3, 0xef, 0x7c, 0x1c, 0xf3, 0x80, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x2a = { image_data_Font_20x24_0x2a,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -407,7 +407,7 @@ static const uint8_t image_data_Font_20x24_0x2b[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0x03, 0xff, 0xf8, 0x3f, 0xff, 0x81, 0xff, 0xf8, 0x0f, 0xff, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0xf0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x2b = { image_data_Font_20x24_0x2b,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -439,7 +439,7 @@ static const uint8_t image_data_Font_20x24_0x2c[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x80, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x2c = { image_data_Font_20x24_0x2c,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -471,7 +471,7 @@ static const uint8_t image_data_Font_20x24_0x2d[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x03, 0xff, 0xf8, 0x3f, 0xff, 0x81, 0xff, 0xf8, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x2d = { image_data_Font_20x24_0x2d,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -503,7 +503,7 @@ static const uint8_t image_data_Font_20x24_0x2e[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x2e = { image_data_Font_20x24_0x2e,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -535,7 +535,7 @@ static const uint8_t image_data_Font_20x24_0x2f[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3c, 0x00, 0x07, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0x80, 0x01, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xe0, 0x00, 0x7c, 0x00, 0x0f, 0xc0, 0x00, 0xf8, 0x00, 0x1f, 0x00, 0x03, 0xf0, 0x00, 0x7e, 0x00, 0x07, 0xc0, 0x00, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf0, 0x00, 0x1e, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x2f = { image_data_Font_20x24_0x2f,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -567,7 +567,7 @@ static const uint8_t image_data_Font_20x24_0x30[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x3f, 0xe0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x1f, 0xff, 0x81, 0xf3, 0xf8, 0x1f, 0x3f, 0x83, 0xf3, 0xfc, 0x3f, 0x7f, 0xc3, 0xf6, 0xfc, 0x3f, 0x6f, 0xc3, 0xfe, 0xfc, 0x3f, 0xcf, 0xc1, 0xfc, 0xfc, 0x1f, 0xcf, 0x81, 0xf9, 0xf8, 0x1f, 0xff, 0x80, 0xff, 0xf0, 0x07, 0xfe, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x30 = { image_data_Font_20x24_0x30,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -599,7 +599,7 @@ static const uint8_t image_data_Font_20x24_0x31[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x3f, 0xe0, 0x07, 0xfe, 0x00, 0x7f, 0xe0, 0x03, 0xfe, 0x00, 0x3f, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x31 = { image_data_Font_20x24_0x31,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -631,7 +631,7 @@ static const uint8_t image_data_Font_20x24_0x32[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0x81, 0xff, 0xfc, 0x1f, 0xdf, 0xc3, 0xf0, 0xfe, 0x1f, 0x07, 0xe1, 0xe0, 0x7e, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x7f, 0x80, 0x0f, 0xf0, 0x03, 0xfc, 0x00, 0x7f, 0x00, 0x0f, 0xe0, 0x01, 0xff, 0xfc, 0x3f, 0xff, 0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xe1, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x32 = { image_data_Font_20x24_0x32,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -663,7 +663,7 @@ static const uint8_t image_data_Font_20x24_0x33[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x83, 0xff, 0xfc, 0x3f, 0xff, 0xc3, 0xff, 0xfc, 0x1f, 0xff, 0x80, 0x07, 0xf0, 0x00, 0xfe, 0x00, 0x1f, 0x80, 0x03, 0xfe, 0x00, 0x3f, 0xf8, 0x01, 0xff, 0x80, 0x01, 0xfc, 0x3c, 0x0f, 0xc7, 0xc0, 0xfc, 0x7e, 0x0f, 0xc7, 0xe1, 0xfc, 0x7f, 0xff, 0xc3, 0xff, 0xf8, 0x1f, 0xff, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x33 = { image_data_Font_20x24_0x33,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -695,7 +695,7 @@ static const uint8_t image_data_Font_20x24_0x34[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8f, 0x00, 0x7c, 0xf8, 0x0f, 0xdf, 0x80, 0xfd, 0xf8, 0x0f, 0xdf, 0x81, 0xf9, 0xf8, 0x1f, 0x9f, 0x81, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xff, 0xf8, 0x7f, 0xff, 0x87, 0xff, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x34 = { image_data_Font_20x24_0x34,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -727,7 +727,7 @@ static const uint8_t image_data_Font_20x24_0x35[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x01, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xef, 0xc0, 0x3f, 0xff, 0x03, 0xff, 0xf8, 0x1f, 0x1f, 0x80, 0xc0, 0xfc, 0x00, 0x0f, 0xc1, 0xe0, 0xfc, 0x3e, 0x0f, 0xc3, 0xf1, 0xfc, 0x3f, 0xff, 0x81, 0xff, 0xf0, 0x1f, 0xff, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x35 = { image_data_Font_20x24_0x35,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -759,7 +759,7 @@ static const uint8_t image_data_Font_20x24_0x36[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x1f, 0xe0, 0x03, 0xfe, 0x00, 0x7f, 0xc0, 0x0f, 0xe0, 0x00, 0xfc, 0x00, 0x1f, 0x80, 0x01, 0xf1, 0x80, 0x1f, 0x7f, 0x01, 0xff, 0xf8, 0x1f, 0xff, 0xc1, 0xf8, 0xfc, 0x1f, 0x87, 0xc1, 0xf0, 0x7c, 0x1f, 0x07, 0xc1, 0xf0, 0x7c, 0x0f, 0x8f, 0xc0, 0x7f, 0xf8, 0x07, 0xff, 0x80, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x36 = { image_data_Font_20x24_0x36,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -791,7 +791,7 @@ static const uint8_t image_data_Font_20x24_0x37[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x01, 0xff, 0xfc, 0x3f, 0xff, 0xc3, 0xff, 0xfc, 0x1f, 0xff, 0xc0, 0x00, 0xf8, 0x00, 0x1f, 0x80, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x0f, 0xc0, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x07, 0xe0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x37 = { image_data_Font_20x24_0x37,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -823,7 +823,7 @@ static const uint8_t image_data_Font_20x24_0x38[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x7f, 0xe0, 0x0f, 0xff, 0x80, 0xf8, 0xf8, 0x0f, 0x0f, 0x81, 0xf0, 0x7c, 0x0f, 0x0f, 0x80, 0xf8, 0xf8, 0x0f, 0xff, 0x80, 0x7f, 0xe0, 0x0f, 0xff, 0x00, 0xf8, 0xf8, 0x1f, 0x8f, 0xc1, 0xf0, 0x7c, 0x1f, 0x07, 0xc1, 0xf0, 0x7c, 0x1f, 0x8f, 0xc0, 0xfd, 0xf8, 0x07, 0xff, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x38 = { image_data_Font_20x24_0x38,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -855,7 +855,7 @@ static const uint8_t image_data_Font_20x24_0x39[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3f, 0xc0, 0x0f, 0xfe, 0x00, 0xff, 0xf0, 0x1f, 0x0f, 0x81, 0xf0, 0xf8, 0x1f, 0x0f, 0x81, 0xf0, 0xfc, 0x1f, 0x0f, 0xc1, 0xf0, 0xfc, 0x1f, 0xff, 0xc0, 0xff, 0xfc, 0x07, 0xff, 0xc0, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x07, 0xe0, 0x00, 0xfe, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x39 = { image_data_Font_20x24_0x39,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -887,7 +887,7 @@ static const uint8_t image_data_Font_20x24_0x3a[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x01, 0xf8, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x1f, 0x80, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x3a = { image_data_Font_20x24_0x3a,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -919,7 +919,7 @@ static const uint8_t image_data_Font_20x24_0x3b[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x0f, 0x80, 0x00, 0xf8, 0x00, 0x0f, 0x80, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xf8, 0x00, 0x0f, 0x80, 0x00, 0xf8, 0x00, 0x07, 0x80, 0x00, 0x30, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x3b = { image_data_Font_20x24_0x3b,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -951,7 +951,7 @@ static const uint8_t image_data_Font_20x24_0x3c[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x1e, 0x00, 0x03, 0xe0, 0x00, 0x7e, 0x00, 0x0f, 0xc0, 0x01, 0xf8, 0x00, 0x3f, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x00, 0x01, 0xf8, 0x00, 0x0f, 0xc0, 0x00, 0x7e, 0x00, 0x03, 0xe0, 0x00, 0x1e, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x3c = { image_data_Font_20x24_0x3c,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -983,7 +983,7 @@ static const uint8_t image_data_Font_20x24_0x3d[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x1f, 0xff, 0x01, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x1f, 0xff, 0x01, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x3d = { image_data_Font_20x24_0x3d,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1015,7 +1015,7 @@ static const uint8_t image_data_Font_20x24_0x3e[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x03, 0xc0, 0x00, 0x3e, 0x00, 0x03, 0xf0, 0x00, 0x1f, 0x80, 0x00, 0xfe, 0x00, 0x07, 0xe0, 0x00, 0x3f, 0x00, 0x07, 0xe0, 0x00, 0xfc, 0x00, 0x1f, 0x80, 0x03, 0xf0, 0x00, 0x3e, 0x00, 0x03, 0xc0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x3e = { image_data_Font_20x24_0x3e,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1047,7 +1047,7 @@ static const uint8_t image_data_Font_20x24_0x3f[60] = {
     0x00, 0xf8, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0x81, 0xff, 0xfc, 0x1f, 0xff, 0xc3, 0xf0, 0xfc, 0x3f, 0x07, 0xe1, 0xe0, 0x7e, 0x0c, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x3f, 0x80, 0x07, 0xf0, 0x00, 0xfe, 0x00, 0x0f, 0xc0, 0x00, 0x78, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xf8, 0x00, 0x0f, 0x80, 0x00, 0xf8, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x3f = { image_data_Font_20x24_0x3f,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1079,7 +1079,7 @@ static const uint8_t image_data_Font_20x24_0x40[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x03, 0xcf, 0x00, 0x70, 0x30, 0x0e, 0xf9, 0x80, 0xcf, 0xd8, 0x0d, 0xdd, 0xc0, 0xdc, 0xcc, 0x0d, 0xdd, 0x80, 0xcf, 0xf8, 0x06, 0x7f, 0x00, 0x70, 0x00, 0x03, 0xf8, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x40 = { image_data_Font_20x24_0x40,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1111,7 +1111,7 @@ static const uint8_t image_data_Font_20x24_0x41[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0xc0, 0x7f, 0xfc, 0x07, 0xfe, 0xc0, 0x1f, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x41 = { image_data_Font_20x24_0x41,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1143,7 +1143,7 @@ static const uint8_t image_data_Font_20x24_0x42[60] = {
     0x0f, 0x00, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0xf8, 0x01, 0xff, 0xe0, 0x1f, 0xff, 0x01, 0xff, 0xf8, 0x1f, 0xdf, 0x81, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x42 = { image_data_Font_20x24_0x42,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1175,7 +1175,7 @@ static const uint8_t image_data_Font_20x24_0x43[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0x00, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x43 = { image_data_Font_20x24_0x43,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1207,7 +1207,7 @@ static const uint8_t image_data_Font_20x24_0x44[60] = {
     0x00, 0x07, 0x80, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x7f, 0xc0, 0x3f, 0xfc, 0x07, 0xff, 0xc0, 0xff, 0xfc, 0x0f, 0xdf, 0xc0, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x44 = { image_data_Font_20x24_0x44,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1239,7 +1239,7 @@ static const uint8_t image_data_Font_20x24_0x45[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0xff, 0xc1, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x45 = { image_data_Font_20x24_0x45,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1271,7 +1271,7 @@ static const uint8_t image_data_Font_20x24_0x46[60] = {
     0x01, 0xf8, 0x00, 0x7f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xdf, 0x00, 0xfd, 0xe0, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xf8, 0x00, 0xff, 0xc0, 0x0f, 0xfe, 0x00, 0xff, 0xe0, 0x0f, 0xfc, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x46 = { image_data_Font_20x24_0x46,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1303,7 +1303,7 @@ static const uint8_t image_data_Font_20x24_0x47[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x03, 0xfe, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0x80, 0xfd, 0xf8, 0x0f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x0f, 0x8f, 0xc0, 0xff, 0xfc, 0x07, 0xff, 0xc0, 0x7f, 0xfc, 0x01, 0xff, 0xc0, 0x00, 0x7c, 0x00, 0xf7, 0xc0, 0x1f, 0x3c, 0x01, 0xf3, 0xc0, 0x1f, 0xbc, 0x01, 0xff, 0x80, 0x0f, 0xf8
 };
 static const tImage Font_20x24_0x47 = { image_data_Font_20x24_0x47,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1335,7 +1335,7 @@ static const uint8_t image_data_Font_20x24_0x48[60] = {
     0x1e, 0x00, 0x01, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0xf0, 0x03, 0xff, 0xc0, 0x3f, 0xfe, 0x03, 0xff, 0xf0, 0x3f, 0xff, 0x83, 0xf9, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x48 = { image_data_Font_20x24_0x48,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1367,7 +1367,7 @@ static const uint8_t image_data_Font_20x24_0x49[60] = {
     0x00, 0x78, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0x80, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x30, 0x00, 0x07, 0x80, 0x00, 0xf8, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x49 = { image_data_Font_20x24_0x49,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1399,7 +1399,7 @@ static const uint8_t image_data_Font_20x24_0x4a[60] = {
     0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xe0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x07, 0x3f, 0x00, 0xfb, 0xf0, 0x0f, 0xbf, 0x00, 0xff, 0xf0, 0x07, 0xfe, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x4a = { image_data_Font_20x24_0x4a,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1431,7 +1431,7 @@ static const uint8_t image_data_Font_20x24_0x4b[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0xf8, 0xf8, 0x1f, 0x9f, 0x81, 0xf9, 0xf8, 0x1f, 0xbf, 0x81, 0xff, 0xf0, 0x1f, 0xff, 0x01, 0xff, 0xe0, 0x1f, 0xfe, 0x01, 0xff, 0xf0, 0x1f, 0xbf, 0x81, 0xf9, 0xf8, 0x1f, 0x9f, 0xc1, 0xf8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x4b = { image_data_Font_20x24_0x4b,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1463,7 +1463,7 @@ static const uint8_t image_data_Font_20x24_0x4c[60] = {
     0x00, 0xf0, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x4c = { image_data_Font_20x24_0x4c,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1495,7 +1495,7 @@ static const uint8_t image_data_Font_20x24_0x4d[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x87, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x4d = { image_data_Font_20x24_0x4d,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1527,7 +1527,7 @@ static const uint8_t image_data_Font_20x24_0x4e[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xff, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x4e = { image_data_Font_20x24_0x4e,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1559,7 +1559,7 @@ static const uint8_t image_data_Font_20x24_0x4f[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x4f = { image_data_Font_20x24_0x4f,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1591,7 +1591,7 @@ static const uint8_t image_data_Font_20x24_0x50[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0xfe, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0x80, 0xfd, 0xf8, 0x0f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xff, 0xf0, 0x1f, 0xfe, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf0, 0x00, 0x1e, 0x00, 0x01, 0xe0, 0x00, 0x1e, 0x00, 0x01, 0xe0, 0x00
 };
 static const tImage Font_20x24_0x50 = { image_data_Font_20x24_0x50,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1623,7 +1623,7 @@ static const uint8_t image_data_Font_20x24_0x51[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x03, 0xfe, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0x80, 0xfd, 0xf8, 0x0f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x0f, 0x8f, 0xc0, 0xff, 0xfc, 0x07, 0xff, 0xc0, 0x7f, 0xfc, 0x01, 0xff, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x07, 0xc0, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78
 };
 static const tImage Font_20x24_0x51 = { image_data_Font_20x24_0x51,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1655,7 +1655,7 @@ static const uint8_t image_data_Font_20x24_0x52[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x00, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x52 = { image_data_Font_20x24_0x52,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1687,7 +1687,7 @@ static const uint8_t image_data_Font_20x24_0x53[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x3f, 0xc0, 0x07, 0xfe, 0x00, 0x7f, 0xf0, 0x0f, 0x8f, 0x00, 0x7e, 0x00, 0x07, 0xf8, 0x00, 0x3f, 0xe0, 0x00, 0xff, 0x00, 0x79, 0xf0, 0x07, 0x8f, 0x00, 0x7f, 0xf0, 0x03, 0xfe, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x53 = { image_data_Font_20x24_0x53,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1719,7 +1719,7 @@ static const uint8_t image_data_Font_20x24_0x54[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf8, 0x1f, 0xff, 0x80, 0xff, 0xe0, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x54 = { image_data_Font_20x24_0x54,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1751,7 +1751,7 @@ static const uint8_t image_data_Font_20x24_0x55[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x01, 0xf0, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf9, 0xf8, 0x3f, 0xbf, 0x81, 0xff, 0xf8, 0x1f, 0xff, 0x80, 0xfd, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x55 = { image_data_Font_20x24_0x55,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1783,7 +1783,7 @@ static const uint8_t image_data_Font_20x24_0x56[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0xf8, 0x78, 0x1f, 0x8f, 0xc1, 0xfd, 0xfc, 0x0f, 0xdf, 0xc0, 0xff, 0xf8, 0x07, 0xff, 0x80, 0x7f, 0xf0, 0x03, 0xfe, 0x00, 0x3f, 0xe0, 0x01, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xf8, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x56 = { image_data_Font_20x24_0x56,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1815,7 +1815,7 @@ static const uint8_t image_data_Font_20x24_0x57[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x3f, 0x0f, 0x87, 0xf1, 0xf8, 0xff, 0xbf, 0xdf, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x3f, 0x9f, 0xc1, 0xf9, 0xfc, 0x1f, 0x0f, 0x80, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x57 = { image_data_Font_20x24_0x57,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1847,7 +1847,7 @@ static const uint8_t image_data_Font_20x24_0x58[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0xf8, 0x78, 0x1f, 0xcf, 0xc1, 0xfd, 0xfc, 0x0f, 0xff, 0xc0, 0xff, 0xf8, 0x07, 0xff, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x1f, 0xff, 0xc1, 0xfd, 0xfc, 0x1f, 0x8f, 0xc0, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x58 = { image_data_Font_20x24_0x58,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1879,7 +1879,7 @@ static const uint8_t image_data_Font_20x24_0x59[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0f, 0x07, 0x81, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x0f, 0xdf, 0xc0, 0xff, 0xfc, 0x0f, 0xff, 0xc0, 0x7f, 0xfc, 0x03, 0xff, 0xc0, 0x01, 0xfc, 0x07, 0x8f, 0xc0, 0x7c, 0xfc, 0x03, 0xef, 0xc0, 0x1e, 0xfc, 0x00, 0xff, 0x80, 0x07, 0xf0
 };
 static const tImage Font_20x24_0x59 = { image_data_Font_20x24_0x59,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1911,7 +1911,7 @@ static const uint8_t image_data_Font_20x24_0x5a[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x1f, 0xff, 0xc1, 0xff, 0xfc, 0x0f, 0xff, 0x80, 0x03, 0xf0, 0x00, 0xfe, 0x00, 0x1f, 0xc0, 0x03, 0xf8, 0x00, 0xff, 0xf8, 0x0f, 0xff, 0xc1, 0xff, 0xfc, 0x1f, 0xff, 0xc0, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x5a = { image_data_Font_20x24_0x5a,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1943,7 +1943,7 @@ static const uint8_t image_data_Font_20x24_0x5b[60] = {
     0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0xfe, 0x00, 0x3f, 0xc0, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x80, 0x03, 0xfc, 0x00, 0x3f, 0xc0
 };
 static const tImage Font_20x24_0x5b = { image_data_Font_20x24_0x5b,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1975,7 +1975,7 @@ static const uint8_t image_data_Font_20x24_0x5c[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x01, 0xe0, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x80, 0x00, 0xfc, 0x00, 0x07, 0xc0, 0x00, 0x3e, 0x00, 0x03, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0xf8, 0x00, 0x0f, 0xc0, 0x00, 0x7e, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0x01, 0xf8, 0x00, 0x0f, 0x80, 0x00, 0x7c, 0x00, 0x07, 0xc0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x5c = { image_data_Font_20x24_0x5c,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2007,7 +2007,7 @@ static const uint8_t image_data_Font_20x24_0x5d[60] = {
     0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x3f, 0xc0
 };
 static const tImage Font_20x24_0x5d = { image_data_Font_20x24_0x5d,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2039,7 +2039,7 @@ static const uint8_t image_data_Font_20x24_0x5e[60] = {
     0x00, 0x78, 0x00, 0x0f, 0x80, 0x01, 0xfc, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xfd, 0xf8, 0x1f, 0x8f, 0xc1, 0xf0, 0x7c, 0x0e, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x5e = { image_data_Font_20x24_0x5e,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2071,7 +2071,7 @@ static const uint8_t image_data_Font_20x24_0x5f[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x7f, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xe7, 0xff, 0xfe
 };
 static const tImage Font_20x24_0x5f = { image_data_Font_20x24_0x5f,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2103,7 +2103,7 @@ static const uint8_t image_data_Font_20x24_0x60[60] = {
     0x00, 0x00, 0x00, 0x38, 0x00, 0x07, 0xc0, 0x00, 0x7f, 0x00, 0x03, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x60 = { image_data_Font_20x24_0x60,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2135,7 +2135,7 @@ static const uint8_t image_data_Font_20x24_0x61[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0xc0, 0x7f, 0xfc, 0x07, 0xff, 0xc0, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x61 = { image_data_Font_20x24_0x61,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x042 == 0x0)
@@ -2167,7 +2167,7 @@ static const uint8_t image_data_Font_20x24_0x62[60] = {
     0x0f, 0x00, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0xf8, 0x01, 0xff, 0xe0, 0x1f, 0xff, 0x01, 0xff, 0xf8, 0x1f, 0xdf, 0x81, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x62 = { image_data_Font_20x24_0x62,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x043 == 0x0)
@@ -2199,7 +2199,7 @@ static const uint8_t image_data_Font_20x24_0x63[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0x00, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x63 = { image_data_Font_20x24_0x63,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x044 == 0x0)
@@ -2231,7 +2231,7 @@ static const uint8_t image_data_Font_20x24_0x64[60] = {
     0x00, 0x07, 0x80, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x7f, 0xc0, 0x3f, 0xfc, 0x07, 0xff, 0xc0, 0xff, 0xfc, 0x0f, 0xdf, 0xc0, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x64 = { image_data_Font_20x24_0x64,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x045 == 0x0)
@@ -2263,7 +2263,7 @@ static const uint8_t image_data_Font_20x24_0x65[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0xff, 0xc1, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x65 = { image_data_Font_20x24_0x65,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x046 == 0x0)
@@ -2295,7 +2295,7 @@ static const uint8_t image_data_Font_20x24_0x66[60] = {
     0x01, 0xf8, 0x00, 0x7f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xdf, 0x00, 0xfd, 0xe0, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xf8, 0x00, 0xff, 0xc0, 0x0f, 0xfe, 0x00, 0xff, 0xe0, 0x0f, 0xfc, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x66 = { image_data_Font_20x24_0x66,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2327,7 +2327,7 @@ static const uint8_t image_data_Font_20x24_0x67[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0xc0, 0x7f, 0xfc, 0x07, 0xff, 0xc0, 0x1f, 0xfc, 0x00, 0x07, 0xc0, 0x0f, 0x7c
 };
 static const tImage Font_20x24_0x67 = { image_data_Font_20x24_0x67,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x048 == 0x0)
@@ -2359,7 +2359,7 @@ static const uint8_t image_data_Font_20x24_0x68[60] = {
     0x1e, 0x00, 0x01, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0xf0, 0x03, 0xff, 0xc0, 0x3f, 0xfe, 0x03, 0xff, 0xf0, 0x3f, 0xff, 0x83, 0xf9, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x68 = { image_data_Font_20x24_0x68,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x049 == 0x0)
@@ -2391,7 +2391,7 @@ static const uint8_t image_data_Font_20x24_0x69[60] = {
     0x00, 0x78, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0x80, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x30, 0x00, 0x07, 0x80, 0x00, 0xf8, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x69 = { image_data_Font_20x24_0x69,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x04a == 0x0)
@@ -2423,7 +2423,7 @@ static const uint8_t image_data_Font_20x24_0x6a[60] = {
     0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xe0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x07, 0x3f, 0x00, 0xfb, 0xf0, 0x0f, 0xbf, 0x00, 0xff, 0xf0, 0x07, 0xfe, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x6a = { image_data_Font_20x24_0x6a,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x04b == 0x0)
@@ -2455,7 +2455,7 @@ static const uint8_t image_data_Font_20x24_0x6b[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0xf8, 0xf8, 0x1f, 0x9f, 0x81, 0xf9, 0xf8, 0x1f, 0xbf, 0x81, 0xff, 0xf0, 0x1f, 0xff, 0x01, 0xff, 0xe0, 0x1f, 0xfe, 0x01, 0xff, 0xf0, 0x1f, 0xbf, 0x81, 0xf9, 0xf8, 0x1f, 0x9f, 0xc1, 0xf8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x6b = { image_data_Font_20x24_0x6b,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x04c == 0x0)
@@ -2487,7 +2487,7 @@ static const uint8_t image_data_Font_20x24_0x6c[60] = {
     0x00, 0xf0, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x6c = { image_data_Font_20x24_0x6c,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x04d == 0x0)
@@ -2519,7 +2519,7 @@ static const uint8_t image_data_Font_20x24_0x6d[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x87, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x6d = { image_data_Font_20x24_0x6d,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x04e == 0x0)
@@ -2551,7 +2551,7 @@ static const uint8_t image_data_Font_20x24_0x6e[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xff, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x6e = { image_data_Font_20x24_0x6e,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x04f == 0x0)
@@ -2583,7 +2583,7 @@ static const uint8_t image_data_Font_20x24_0x6f[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80, 0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x6f = { image_data_Font_20x24_0x6f,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2615,7 +2615,7 @@ static const uint8_t image_data_Font_20x24_0x70[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0xff, 0x81, 0xff, 0xf8, 0x1f, 0xff, 0x01, 0xff, 0xe0, 0x1f, 0x80, 0x01, 0xf8, 0x00
 };
 static const tImage Font_20x24_0x70 = { image_data_Font_20x24_0x70,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2647,7 +2647,7 @@ static const uint8_t image_data_Font_20x24_0x71[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf, 0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0xc0, 0x7f, 0xfc, 0x07, 0xff, 0xc0, 0x1f, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc
 };
 static const tImage Font_20x24_0x71 = { image_data_Font_20x24_0x71,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x052 == 0x0)
@@ -2679,7 +2679,7 @@ static const uint8_t image_data_Font_20x24_0x72[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x00, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x72 = { image_data_Font_20x24_0x72,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x053 == 0x0)
@@ -2711,7 +2711,7 @@ static const uint8_t image_data_Font_20x24_0x73[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x3f, 0xc0, 0x07, 0xfe, 0x00, 0x7f, 0xf0, 0x0f, 0x8f, 0x00, 0x7e, 0x00, 0x07, 0xf8, 0x00, 0x3f, 0xe0, 0x00, 0xff, 0x00, 0x79, 0xf0, 0x07, 0x8f, 0x00, 0x7f, 0xf0, 0x03, 0xfe, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x73 = { image_data_Font_20x24_0x73,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x054 == 0x0)
@@ -2743,7 +2743,7 @@ static const uint8_t image_data_Font_20x24_0x74[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf8, 0x1f, 0xff, 0x80, 0xff, 0xe0, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x74 = { image_data_Font_20x24_0x74,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x055 == 0x0)
@@ -2775,7 +2775,7 @@ static const uint8_t image_data_Font_20x24_0x75[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x01, 0xf0, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf9, 0xf8, 0x3f, 0xbf, 0x81, 0xff, 0xf8, 0x1f, 0xff, 0x80, 0xfd, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x75 = { image_data_Font_20x24_0x75,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x056 == 0x0)
@@ -2807,7 +2807,7 @@ static const uint8_t image_data_Font_20x24_0x76[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0xf8, 0x78, 0x1f, 0x8f, 0xc1, 0xfd, 0xfc, 0x0f, 0xdf, 0xc0, 0xff, 0xf8, 0x07, 0xff, 0x80, 0x7f, 0xf0, 0x03, 0xfe, 0x00, 0x3f, 0xe0, 0x01, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xf8, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x76 = { image_data_Font_20x24_0x76,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x057 == 0x0)
@@ -2839,7 +2839,7 @@ static const uint8_t image_data_Font_20x24_0x77[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x3f, 0x0f, 0x87, 0xf1, 0xf8, 0xff, 0xbf, 0xdf, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x3f, 0x9f, 0xc1, 0xf9, 0xfc, 0x1f, 0x0f, 0x80, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x77 = { image_data_Font_20x24_0x77,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x058 == 0x0)
@@ -2871,7 +2871,7 @@ static const uint8_t image_data_Font_20x24_0x78[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0xf8, 0x78, 0x1f, 0xcf, 0xc1, 0xfd, 0xfc, 0x0f, 0xff, 0xc0, 0xff, 0xf8, 0x07, 0xff, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x1f, 0xff, 0xc1, 0xfd, 0xfc, 0x1f, 0x8f, 0xc0, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x78 = { image_data_Font_20x24_0x78,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2903,7 +2903,7 @@ static const uint8_t image_data_Font_20x24_0x79[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0xf0, 0x78, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xfd, 0xfc, 0x0f, 0xff, 0xc0, 0xff, 0xfc, 0x07, 0xff, 0xc0, 0x3f, 0xfc, 0x00, 0x0f, 0xc0, 0x0e, 0xfc
 };
 static const tImage Font_20x24_0x79 = { image_data_Font_20x24_0x79,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x05a == 0x0)
@@ -2935,7 +2935,7 @@ static const uint8_t image_data_Font_20x24_0x7a[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x1f, 0xff, 0xc1, 0xff, 0xfc, 0x0f, 0xff, 0x80, 0x03, 0xf0, 0x00, 0xfe, 0x00, 0x1f, 0xc0, 0x03, 0xf8, 0x00, 0xff, 0xf8, 0x0f, 0xff, 0xc1, 0xff, 0xfc, 0x1f, 0xff, 0xc0, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x7a = { image_data_Font_20x24_0x7a,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x05b == 0x0)
@@ -2967,7 +2967,7 @@ static const uint8_t image_data_Font_20x24_0x7b[60] = {
     0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0xfe, 0x00, 0x3f, 0xc0, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x80, 0x03, 0xfc, 0x00, 0x3f, 0xc0
 };
 static const tImage Font_20x24_0x7b = { image_data_Font_20x24_0x7b,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2999,7 +2999,7 @@ static const uint8_t image_data_Font_20x24_0x7c[60] = {
     0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00
 };
 static const tImage Font_20x24_0x7c = { image_data_Font_20x24_0x7c,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x05d == 0x0)
@@ -3031,7 +3031,7 @@ static const uint8_t image_data_Font_20x24_0x7d[60] = {
     0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x3f, 0xc0
 };
 static const tImage Font_20x24_0x7d = { image_data_Font_20x24_0x7d,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3063,7 +3063,7 @@ static const uint8_t image_data_Font_20x24_0x7e[60] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x60, 0x0f, 0xff, 0x00, 0xf7, 0xe0, 0x0e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_20x24_0x7e = { image_data_Font_20x24_0x7e,
-    20, 24, 8};
+    20, 24, 8, 0};
 #endif
 
 
@@ -3832,5 +3832,5 @@ static const tChar Font_20x24_array[] = {
 };
 
 
-const tFont Font_20x24 = { 95, Font_20x24_array };
+const tFont Font_20x24 = { 95, Font_20x24_array, .first_code = 0x20, .dense = 95 };
 
@@ -0,0 +1,498 @@
+/*******************************************************************************
+* name: Font_20x24
+* family: New LiteBulb
+* size: 28
+* style: Обычный
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* type: monospaced
+* encoding: UTF-8
+*
+* packed: 95 glyphs 20x24, 60 bytes per glyph, first code 0x20
+* glyph bits are continuous across rows like tImage, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_20x24_packed_data[5700] = {
+  // character: ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '!'
+  0x00, 0xf0, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01,
+  0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8,
+  0x00, 0x0f, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00,
+  0x1f, 0x80, 0x00, 0xf8, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '"'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xc0, 0x07, 0xfe, 0x00, 0x7f, 0xe0, 0x07,
+  0xbe, 0x00, 0x38, 0xc0, 0x01, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '#'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x00, 0x79, 0xe0, 0x07, 0x9f, 0x00, 0x79, 0xf0, 0x07,
+  0x9f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xe0, 0x79, 0xf0, 0x07, 0x9f,
+  0x03, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0x07, 0x9f, 0x00,
+  0x79, 0xf0, 0x07, 0x9f, 0x00, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '$'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x06, 0x00, 0x00, 0xf0, 0x00, 0x7f, 0xe0, 0x0f, 0xff, 0x00, 0xff, 0xf8, 0x1f, 0xef,
+  0x80, 0xfe, 0x00, 0x0f, 0xf8, 0x00, 0x3f, 0xe0, 0x00, 0xff, 0x80, 0xff, 0xf8, 0x0f, 0xef, 0x80,
+  0xff, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xe0, 0x00, 0x60, 0x00, 0x06, 0x00,
+  // character: '%'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x01, 0xf0, 0x78, 0x3f, 0x8f, 0x83, 0x38, 0xf8, 0x71,
+  0x9f, 0x03, 0xbb, 0xf0, 0x3f, 0x3e, 0x00, 0xe7, 0xc0, 0x00, 0x7c, 0x00, 0x0f, 0x80, 0x01, 0xf0,
+  0x00, 0x1f, 0x00, 0x03, 0xe3, 0x00, 0x7e, 0xfc, 0x07, 0xcf, 0xe0, 0xf9, 0xce, 0x0f, 0x9c, 0xe1,
+  0xf0, 0xee, 0x1e, 0x0f, 0xc0, 0xe0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '&'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x3f, 0x80, 0x0f, 0xfc, 0x00, 0xf1, 0xc0, 0x1e,
+  0x0c, 0x01, 0xe0, 0xc0, 0x1f, 0x1c, 0x00, 0xfb, 0xc0, 0x0f, 0xf8, 0x00, 0x3f, 0x38, 0x07, 0xff,
+  0x80, 0xff, 0xf8, 0x0f, 0x3f, 0x00, 0xe1, 0xe0, 0x1e, 0x0f, 0x01, 0xe0, 0xf0, 0x1f, 0x1f, 0x80,
+  0xff, 0xfc, 0x07, 0xff, 0xc0, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '''
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf8, 0x00, 0x0f, 0x80, 0x00,
+  0xf0, 0x00, 0x07, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '('
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x20, 0x00, 0x06, 0x00, 0x00,
+  0x60, 0x00, 0x06, 0x00, 0x00, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0xc0,
+  0x00, 0x0c, 0x00, 0x00, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0xe0, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
+  0x06, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  // character: ')'
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x06, 0x00, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00,
+  0x30, 0x00, 0x03, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38,
+  0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00,
+  0x03, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  // character: '*'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x01, 0xcf, 0x38, 0x3e,
+  0xf7, 0xc3, 0xff, 0xfc, 0x1f, 0xff, 0x80, 0xff, 0xf0, 0x7f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+  0xf7, 0xff, 0xfe, 0x0f, 0xff, 0x01, 0xff, 0xf8, 0x3f, 0xff, 0xc3, 0xef, 0x7c, 0x1c, 0xf3, 0x80,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x01,
+  0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0x03, 0xff, 0xf8, 0x3f, 0xff,
+  0x81, 0xff, 0xf8, 0x0f, 0xff, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0xf0, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xf0, 0x00,
+  0x0f, 0x80, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  // character: '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x03, 0xff, 0xf8, 0x3f, 0xff,
+  0x81, 0xff, 0xf8, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00,
+  0x1f, 0x80, 0x01, 0xf8, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '/'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3c, 0x00, 0x07, 0xc0, 0x00, 0xfc, 0x00,
+  0x0f, 0x80, 0x01, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xe0, 0x00, 0x7c, 0x00, 0x0f, 0xc0, 0x00, 0xf8,
+  0x00, 0x1f, 0x00, 0x03, 0xf0, 0x00, 0x7e, 0x00, 0x07, 0xc0, 0x00, 0xf8, 0x00, 0x1f, 0x80, 0x01,
+  0xf0, 0x00, 0x1e, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x3f, 0xe0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x1f,
+  0xff, 0x81, 0xf3, 0xf8, 0x1f, 0x3f, 0x83, 0xf3, 0xfc, 0x3f, 0x7f, 0xc3, 0xf6, 0xfc, 0x3f, 0x6f,
+  0xc3, 0xfe, 0xfc, 0x3f, 0xcf, 0xc1, 0xfc, 0xfc, 0x1f, 0xcf, 0x81, 0xf9, 0xf8, 0x1f, 0xff, 0x80,
+  0xff, 0xf0, 0x07, 0xfe, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '1'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x3f, 0xe0, 0x07, 0xfe, 0x00, 0x7f, 0xe0, 0x03,
+  0xfe, 0x00, 0x3f, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e,
+  0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00,
+  0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '2'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0x81, 0xff, 0xfc, 0x1f,
+  0xdf, 0xc3, 0xf0, 0xfe, 0x1f, 0x07, 0xe1, 0xe0, 0x7e, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x7f,
+  0x80, 0x0f, 0xf0, 0x03, 0xfc, 0x00, 0x7f, 0x00, 0x0f, 0xe0, 0x01, 0xff, 0xfc, 0x3f, 0xff, 0xe3,
+  0xff, 0xfe, 0x3f, 0xff, 0xe1, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '3'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x83, 0xff, 0xfc, 0x3f, 0xff, 0xc3, 0xff, 0xfc, 0x1f,
+  0xff, 0x80, 0x07, 0xf0, 0x00, 0xfe, 0x00, 0x1f, 0x80, 0x03, 0xfe, 0x00, 0x3f, 0xf8, 0x01, 0xff,
+  0x80, 0x01, 0xfc, 0x3c, 0x0f, 0xc7, 0xc0, 0xfc, 0x7e, 0x0f, 0xc7, 0xe1, 0xfc, 0x7f, 0xff, 0xc3,
+  0xff, 0xf8, 0x1f, 0xff, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8f, 0x00, 0x7c, 0xf8, 0x0f, 0xdf, 0x80, 0xfd, 0xf8, 0x0f,
+  0xdf, 0x81, 0xf9, 0xf8, 0x1f, 0x9f, 0x81, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xff, 0xf8, 0x7f, 0xff,
+  0x87, 0xff, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80,
+  0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '5'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x01, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xff, 0xf8, 0x1f,
+  0xff, 0x81, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xef, 0xc0, 0x3f, 0xff, 0x03, 0xff, 0xf8, 0x1f, 0x1f,
+  0x80, 0xc0, 0xfc, 0x00, 0x0f, 0xc1, 0xe0, 0xfc, 0x3e, 0x0f, 0xc3, 0xf1, 0xfc, 0x3f, 0xff, 0x81,
+  0xff, 0xf0, 0x1f, 0xff, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '6'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x1f, 0xe0, 0x03, 0xfe, 0x00, 0x7f, 0xc0, 0x0f,
+  0xe0, 0x00, 0xfc, 0x00, 0x1f, 0x80, 0x01, 0xf1, 0x80, 0x1f, 0x7f, 0x01, 0xff, 0xf8, 0x1f, 0xff,
+  0xc1, 0xf8, 0xfc, 0x1f, 0x87, 0xc1, 0xf0, 0x7c, 0x1f, 0x07, 0xc1, 0xf0, 0x7c, 0x0f, 0x8f, 0xc0,
+  0x7f, 0xf8, 0x07, 0xff, 0x80, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '7'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x01, 0xff, 0xfc, 0x3f, 0xff, 0xc3, 0xff, 0xfc, 0x1f,
+  0xff, 0xc0, 0x00, 0xf8, 0x00, 0x1f, 0x80, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x07, 0xe0, 0x00, 0x7e,
+  0x00, 0x0f, 0xc0, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x07, 0xe0, 0x00,
+  0xfc, 0x00, 0x0f, 0xc0, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '8'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x7f, 0xe0, 0x0f, 0xff, 0x80, 0xf8, 0xf8, 0x0f,
+  0x0f, 0x81, 0xf0, 0x7c, 0x0f, 0x0f, 0x80, 0xf8, 0xf8, 0x0f, 0xff, 0x80, 0x7f, 0xe0, 0x0f, 0xff,
+  0x00, 0xf8, 0xf8, 0x1f, 0x8f, 0xc1, 0xf0, 0x7c, 0x1f, 0x07, 0xc1, 0xf0, 0x7c, 0x1f, 0x8f, 0xc0,
+  0xfd, 0xf8, 0x07, 0xff, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3f, 0xc0, 0x0f, 0xfe, 0x00, 0xff, 0xf0, 0x1f,
+  0x0f, 0x81, 0xf0, 0xf8, 0x1f, 0x0f, 0x81, 0xf0, 0xfc, 0x1f, 0x0f, 0xc1, 0xf0, 0xfc, 0x1f, 0xff,
+  0xc0, 0xff, 0xfc, 0x07, 0xff, 0xc0, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x03, 0xf0, 0x00, 0x3f, 0x00,
+  0x07, 0xe0, 0x00, 0xfe, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x01, 0xf8, 0x00, 0x0f, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x1f, 0x80, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x0f, 0x80, 0x00, 0xf8, 0x00, 0x0f, 0x80, 0x00, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xf8, 0x00,
+  0x0f, 0x80, 0x00, 0xf8, 0x00, 0x07, 0x80, 0x00, 0x30, 0x00, 0x00, 0x00,
+  // character: '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+  0x1e, 0x00, 0x03, 0xe0, 0x00, 0x7e, 0x00, 0x0f, 0xc0, 0x01, 0xf8, 0x00, 0x3f, 0x00, 0x03, 0xe0,
+  0x00, 0x3f, 0x00, 0x01, 0xf8, 0x00, 0x0f, 0xc0, 0x00, 0x7e, 0x00, 0x03, 0xe0, 0x00, 0x1e, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xe0, 0x1f, 0xff, 0x01, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xe0, 0x1f, 0xff, 0x01, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x03,
+  0xc0, 0x00, 0x3e, 0x00, 0x03, 0xf0, 0x00, 0x1f, 0x80, 0x00, 0xfe, 0x00, 0x07, 0xe0, 0x00, 0x3f,
+  0x00, 0x07, 0xe0, 0x00, 0xfc, 0x00, 0x1f, 0x80, 0x03, 0xf0, 0x00, 0x3e, 0x00, 0x03, 0xc0, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '?'
+  0x00, 0xf8, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0x81, 0xff, 0xfc, 0x1f, 0xff, 0xc3, 0xf0, 0xfc, 0x3f,
+  0x07, 0xe1, 0xe0, 0x7e, 0x0c, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x3f, 0x80, 0x07, 0xf0, 0x00, 0xfe,
+  0x00, 0x0f, 0xc0, 0x00, 0x78, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xf8, 0x00,
+  0x0f, 0x80, 0x00, 0xf8, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '@'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x03, 0xcf, 0x00, 0x70, 0x30, 0x0e, 0xf9,
+  0x80, 0xcf, 0xd8, 0x0d, 0xdd, 0xc0, 0xdc, 0xcc, 0x0d, 0xdd, 0x80, 0xcf, 0xf8, 0x06, 0x7f, 0x00,
+  0x70, 0x00, 0x03, 0xf8, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'A'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0xc0,
+  0x7f, 0xfc, 0x07, 0xfe, 0xc0, 0x1f, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'B'
+  0x0f, 0x00, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f,
+  0x80, 0x01, 0xf8, 0x00, 0x1f, 0xf8, 0x01, 0xff, 0xe0, 0x1f, 0xff, 0x01, 0xff, 0xf8, 0x1f, 0xdf,
+  0x81, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'C'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0x00, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'D'
+  0x00, 0x07, 0x80, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00,
+  0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x7f, 0xc0, 0x3f, 0xfc, 0x07, 0xff, 0xc0, 0xff, 0xfc, 0x0f, 0xdf,
+  0xc0, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'E'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0xff, 0xc1, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'F'
+  0x01, 0xf8, 0x00, 0x7f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xdf, 0x00, 0xfd, 0xe0, 0x0f,
+  0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xf8, 0x00, 0xff, 0xc0, 0x0f, 0xfe, 0x00, 0xff, 0xe0, 0x0f, 0xfc,
+  0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00,
+  0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'G'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x03, 0xfe, 0x00, 0x7f, 0xf0, 0x0f,
+  0xff, 0x80, 0xfd, 0xf8, 0x0f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x0f, 0x8f,
+  0xc0, 0xff, 0xfc, 0x07, 0xff, 0xc0, 0x7f, 0xfc, 0x01, 0xff, 0xc0, 0x00, 0x7c, 0x00, 0xf7, 0xc0,
+  0x1f, 0x3c, 0x01, 0xf3, 0xc0, 0x1f, 0xbc, 0x01, 0xff, 0x80, 0x0f, 0xf8,
+  // character: 'H'
+  0x1e, 0x00, 0x01, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f,
+  0x00, 0x03, 0xf0, 0x00, 0x3f, 0xf0, 0x03, 0xff, 0xc0, 0x3f, 0xfe, 0x03, 0xff, 0xf0, 0x3f, 0xff,
+  0x83, 0xf9, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83,
+  0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'I'
+  0x00, 0x78, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0x80, 0x00,
+  0x70, 0x00, 0x02, 0x00, 0x00, 0x30, 0x00, 0x07, 0x80, 0x00, 0xf8, 0x00, 0x0f, 0xc0, 0x00, 0xfc,
+  0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00,
+  0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'J'
+  0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xe0, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f,
+  0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x07, 0x3f, 0x00, 0xfb, 0xf0, 0x0f, 0xbf, 0x00,
+  0xff, 0xf0, 0x07, 0xfe, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'K'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0xf8, 0xf8, 0x1f, 0x9f, 0x81, 0xf9, 0xf8, 0x1f, 0xbf,
+  0x81, 0xff, 0xf0, 0x1f, 0xff, 0x01, 0xff, 0xe0, 0x1f, 0xfe, 0x01, 0xff, 0xf0, 0x1f, 0xbf, 0x81,
+  0xf9, 0xf8, 0x1f, 0x9f, 0xc1, 0xf8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'L'
+  0x00, 0xf0, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01,
+  0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8,
+  0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00,
+  0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'M'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x87, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff,
+  0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'N'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xff,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1,
+  0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'O'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'P'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0xfe, 0x00, 0x7f, 0xf0, 0x0f,
+  0xff, 0x80, 0xfd, 0xf8, 0x0f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f,
+  0xc1, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xff, 0xf0, 0x1f, 0xfe, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01,
+  0xf0, 0x00, 0x1e, 0x00, 0x01, 0xe0, 0x00, 0x1e, 0x00, 0x01, 0xe0, 0x00,
+  // character: 'Q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x03, 0xfe, 0x00, 0x7f, 0xf0, 0x0f,
+  0xff, 0x80, 0xfd, 0xf8, 0x0f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x0f, 0x8f,
+  0xc0, 0xff, 0xfc, 0x07, 0xff, 0xc0, 0x7f, 0xfc, 0x01, 0xff, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0,
+  0x00, 0xfc, 0x00, 0x07, 0xc0, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78,
+  // character: 'R'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x00, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xff, 0xf8, 0x1f, 0xff,
+  0x81, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01,
+  0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'S'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x3f, 0xc0, 0x07, 0xfe, 0x00, 0x7f, 0xf0, 0x0f, 0x8f,
+  0x00, 0x7e, 0x00, 0x07, 0xf8, 0x00, 0x3f, 0xe0, 0x00, 0xff, 0x00, 0x79, 0xf0, 0x07, 0x8f, 0x00,
+  0x7f, 0xf0, 0x03, 0xfe, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'T'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf8, 0x1f, 0xff,
+  0x80, 0xff, 0xe0, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00,
+  0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'U'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x01, 0xf0, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f,
+  0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf9, 0xf8, 0x3f, 0xbf, 0x81,
+  0xff, 0xf8, 0x1f, 0xff, 0x80, 0xfd, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'V'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0xf8, 0x78, 0x1f, 0x8f, 0xc1, 0xfd, 0xfc, 0x0f, 0xdf,
+  0xc0, 0xff, 0xf8, 0x07, 0xff, 0x80, 0x7f, 0xf0, 0x03, 0xfe, 0x00, 0x3f, 0xe0, 0x01, 0xfc, 0x00,
+  0x0f, 0xc0, 0x00, 0xf8, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'W'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x3f, 0x0f, 0x87, 0xf1, 0xf8, 0xff, 0xbf, 0xdf, 0xfb, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x3f, 0x9f, 0xc1,
+  0xf9, 0xfc, 0x1f, 0x0f, 0x80, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'X'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0xf8, 0x78, 0x1f, 0xcf, 0xc1, 0xfd, 0xfc, 0x0f, 0xff,
+  0xc0, 0xff, 0xf8, 0x07, 0xff, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x1f, 0xff, 0xc1,
+  0xfd, 0xfc, 0x1f, 0x8f, 0xc0, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0f, 0x07, 0x81, 0xf8, 0xfc, 0x1f,
+  0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x0f, 0xdf,
+  0xc0, 0xff, 0xfc, 0x0f, 0xff, 0xc0, 0x7f, 0xfc, 0x03, 0xff, 0xc0, 0x01, 0xfc, 0x07, 0x8f, 0xc0,
+  0x7c, 0xfc, 0x03, 0xef, 0xc0, 0x1e, 0xfc, 0x00, 0xff, 0x80, 0x07, 0xf0,
+  // character: 'Z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x1f, 0xff, 0xc1, 0xff, 0xfc, 0x0f, 0xff,
+  0x80, 0x03, 0xf0, 0x00, 0xfe, 0x00, 0x1f, 0xc0, 0x03, 0xf8, 0x00, 0xff, 0xf8, 0x0f, 0xff, 0xc1,
+  0xff, 0xfc, 0x1f, 0xff, 0xc0, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '['
+  0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0xfe, 0x00, 0x3f, 0xc0, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03,
+  0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0,
+  0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00,
+  0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x80, 0x03, 0xfc, 0x00, 0x3f, 0xc0,
+  // character: '\\'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x01, 0xe0, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f,
+  0x80, 0x00, 0xfc, 0x00, 0x07, 0xc0, 0x00, 0x3e, 0x00, 0x03, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0xf8,
+  0x00, 0x0f, 0xc0, 0x00, 0x7e, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0x01, 0xf8, 0x00, 0x0f, 0x80,
+  0x00, 0x7c, 0x00, 0x07, 0xc0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ']'
+  0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00,
+  0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c,
+  0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00,
+  0x03, 0xc0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x3f, 0xc0,
+  // character: '^'
+  0x00, 0x78, 0x00, 0x0f, 0x80, 0x01, 0xfc, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xfd, 0xf8, 0x1f,
+  0x8f, 0xc1, 0xf0, 0x7c, 0x0e, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '_'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xff, 0xfc, 0x7f, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xe7, 0xff, 0xfe,
+  // character: '`'
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x07, 0xc0, 0x00, 0x7f, 0x00, 0x03, 0xf8, 0x00, 0x1f, 0x80, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'a'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0xc0,
+  0x7f, 0xfc, 0x07, 0xff, 0xc0, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'b'
+  0x0f, 0x00, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f,
+  0x80, 0x01, 0xf8, 0x00, 0x1f, 0xf8, 0x01, 0xff, 0xe0, 0x1f, 0xff, 0x01, 0xff, 0xf8, 0x1f, 0xdf,
+  0x81, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'c'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0x00, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'd'
+  0x00, 0x07, 0x80, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00,
+  0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x7f, 0xc0, 0x3f, 0xfc, 0x07, 0xff, 0xc0, 0xff, 0xfc, 0x0f, 0xdf,
+  0xc0, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x07, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'e'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0xff, 0xc1, 0xff, 0xfc, 0x1f, 0x80, 0x00, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'f'
+  0x01, 0xf8, 0x00, 0x7f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xdf, 0x00, 0xfd, 0xe0, 0x0f,
+  0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xf8, 0x00, 0xff, 0xc0, 0x0f, 0xfe, 0x00, 0xff, 0xe0, 0x0f, 0xfc,
+  0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00,
+  0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'g'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0xc0,
+  0x7f, 0xfc, 0x07, 0xff, 0xc0, 0x1f, 0xfc, 0x00, 0x07, 0xc0, 0x0f, 0x7c,
+  // character: 'h'
+  0x1e, 0x00, 0x01, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f,
+  0x00, 0x03, 0xf0, 0x00, 0x3f, 0xf0, 0x03, 0xff, 0xc0, 0x3f, 0xfe, 0x03, 0xff, 0xf0, 0x3f, 0xff,
+  0x83, 0xf9, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x3f, 0x0f, 0x83,
+  0xf0, 0xf8, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'i'
+  0x00, 0x78, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0x80, 0x00,
+  0x70, 0x00, 0x02, 0x00, 0x00, 0x30, 0x00, 0x07, 0x80, 0x00, 0xf8, 0x00, 0x0f, 0xc0, 0x00, 0xfc,
+  0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc, 0x00,
+  0x0f, 0xc0, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'j'
+  0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xe0, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x3f,
+  0x00, 0x03, 0xf0, 0x00, 0x3f, 0x00, 0x03, 0xf0, 0x07, 0x3f, 0x00, 0xfb, 0xf0, 0x0f, 0xbf, 0x00,
+  0xff, 0xf0, 0x07, 0xfe, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'k'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0xf8, 0xf8, 0x1f, 0x9f, 0x81, 0xf9, 0xf8, 0x1f, 0xbf,
+  0x81, 0xff, 0xf0, 0x1f, 0xff, 0x01, 0xff, 0xe0, 0x1f, 0xfe, 0x01, 0xff, 0xf0, 0x1f, 0xbf, 0x81,
+  0xf9, 0xf8, 0x1f, 0x9f, 0xc1, 0xf8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'l'
+  0x00, 0xf0, 0x00, 0x0f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01,
+  0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8,
+  0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00,
+  0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x87, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0xf1, 0xf8, 0xff,
+  0x1f, 0x8f, 0xf1, 0xf8, 0xff, 0x1f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xff,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1,
+  0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0x80,
+  0x7f, 0xf8, 0x03, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0xff, 0x81,
+  0xff, 0xf8, 0x1f, 0xff, 0x01, 0xff, 0xe0, 0x1f, 0x80, 0x01, 0xf8, 0x00,
+  // character: 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x0f, 0xdf,
+  0x80, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xf8, 0xfc, 0x0f, 0xff, 0xc0,
+  0x7f, 0xfc, 0x07, 0xff, 0xc0, 0x1f, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0xfc,
+  // character: 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x00, 0xff, 0xf8, 0x1f, 0xff, 0x81, 0xff, 0xf8, 0x1f, 0xff,
+  0x81, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01,
+  0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 's'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x3f, 0xc0, 0x07, 0xfe, 0x00, 0x7f, 0xf0, 0x0f, 0x8f,
+  0x00, 0x7e, 0x00, 0x07, 0xf8, 0x00, 0x3f, 0xe0, 0x00, 0xff, 0x00, 0x79, 0xf0, 0x07, 0x8f, 0x00,
+  0x7f, 0xf0, 0x03, 0xfe, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 't'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x3f, 0xff, 0x83, 0xff, 0xf8, 0x1f, 0xff,
+  0x80, 0xff, 0xe0, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x01, 0xf8, 0x00,
+  0x1f, 0x80, 0x01, 0xf8, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x01, 0xf0, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f,
+  0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf1, 0xf8, 0x3f, 0x1f, 0x83, 0xf9, 0xf8, 0x3f, 0xbf, 0x81,
+  0xff, 0xf8, 0x1f, 0xff, 0x80, 0xfd, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0xf8, 0x78, 0x1f, 0x8f, 0xc1, 0xfd, 0xfc, 0x0f, 0xdf,
+  0xc0, 0xff, 0xf8, 0x07, 0xff, 0x80, 0x7f, 0xf0, 0x03, 0xfe, 0x00, 0x3f, 0xe0, 0x01, 0xfc, 0x00,
+  0x0f, 0xc0, 0x00, 0xf8, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x3f, 0x0f, 0x87, 0xf1, 0xf8, 0xff, 0xbf, 0xdf, 0xfb, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x3f, 0x9f, 0xc1,
+  0xf9, 0xfc, 0x1f, 0x0f, 0x80, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0xf8, 0x78, 0x1f, 0xcf, 0xc1, 0xfd, 0xfc, 0x0f, 0xff,
+  0xc0, 0xff, 0xf8, 0x07, 0xff, 0x00, 0x3f, 0xe0, 0x07, 0xff, 0x00, 0xff, 0xf8, 0x1f, 0xff, 0xc1,
+  0xfd, 0xfc, 0x1f, 0x8f, 0xc0, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0xf0, 0x78, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f,
+  0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc1, 0xf8, 0xfc, 0x1f, 0x8f, 0xc0, 0xfd, 0xfc, 0x0f, 0xff, 0xc0,
+  0xff, 0xfc, 0x07, 0xff, 0xc0, 0x3f, 0xfc, 0x00, 0x0f, 0xc0, 0x0e, 0xfc,
+  // character: 'z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x1f, 0xff, 0xc1, 0xff, 0xfc, 0x0f, 0xff,
+  0x80, 0x03, 0xf0, 0x00, 0xfe, 0x00, 0x1f, 0xc0, 0x03, 0xf8, 0x00, 0xff, 0xf8, 0x0f, 0xff, 0xc1,
+  0xff, 0xfc, 0x1f, 0xff, 0xc0, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '{'
+  0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0xfe, 0x00, 0x3f, 0xc0, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03,
+  0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0,
+  0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0xe0, 0x00,
+  0x3e, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x80, 0x03, 0xfc, 0x00, 0x3f, 0xc0,
+  // character: '|'
+  0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00,
+  0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+  // character: '}'
+  0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00,
+  0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c,
+  0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00, 0x03, 0xc0, 0x00, 0x3c, 0x00,
+  0x03, 0xc0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x01, 0xfc, 0x00, 0x3f, 0xc0,
+  // character: '~'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x60, 0x0f, 0xff, 0x00, 0xf7, 0xe0, 0x0e,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const tFontPacked Font_20x24_packed_glyphs = { 20, 24, 60, 0x20, 95, Font_20x24_packed_data };
+
+const tFont Font_20x24_packed = { .packed = &Font_20x24_packed_glyphs };
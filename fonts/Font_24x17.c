@@ -48,7 +48,7 @@ static const uint8_t image_data_Font_24x17_0x20[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x20 = { image_data_Font_24x17_0x20,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -73,7 +73,7 @@ static const uint8_t image_data_Font_24x17_0x21[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x21 = { image_data_Font_24x17_0x21,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -98,7 +98,7 @@ static const uint8_t image_data_Font_24x17_0x22[51] = {
     0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x22 = { image_data_Font_24x17_0x22,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -123,7 +123,7 @@ static const uint8_t image_data_Font_24x17_0x23[51] = {
     0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc
 };
 static const tImage Font_24x17_0x23 = { image_data_Font_24x17_0x23,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -148,7 +148,7 @@ static const uint8_t image_data_Font_24x17_0x24[51] = {
     0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x7f, 0x80, 0x00, 0xc8, 0x80, 0x00, 0xc8, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x09, 0x80, 0x00, 0x09, 0x80, 0x00, 0x8b, 0x80, 0x00, 0xff, 0x00, 0x00, 0x7e, 0x00
 };
 static const tImage Font_24x17_0x24 = { image_data_Font_24x17_0x24,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -173,7 +173,7 @@ static const uint8_t image_data_Font_24x17_0x25[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x80, 0x0c, 0x83, 0x00, 0x18, 0xc3, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xcc, 0x00, 0x18, 0xcc, 0xe0, 0x08, 0x99, 0x90, 0x07, 0x33, 0x18, 0x00, 0x33, 0x18, 0x00, 0x63, 0x18, 0x00, 0x63, 0x18, 0x00, 0xc3, 0x18, 0x00, 0xc1, 0x10, 0x01, 0x80, 0xe0
 };
 static const tImage Font_24x17_0x25 = { image_data_Font_24x17_0x25,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -198,7 +198,7 @@ static const uint8_t image_data_Font_24x17_0x26[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xfc, 0x00, 0x01, 0x8c, 0x00, 0x01, 0x8c, 0x00, 0x01, 0x8c, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x71, 0x80, 0x00, 0xf1, 0x80, 0x01, 0x99, 0x80, 0x03, 0x0d, 0x80, 0x03, 0x07, 0x00, 0x03, 0x07, 0x00, 0x03, 0x87, 0x80, 0x01, 0xfd, 0xc0, 0x00, 0xf8, 0xe0
 };
 static const tImage Font_24x17_0x26 = { image_data_Font_24x17_0x26,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -223,7 +223,7 @@ static const uint8_t image_data_Font_24x17_0x27[51] = {
     0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x27 = { image_data_Font_24x17_0x27,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -248,7 +248,7 @@ static const uint8_t image_data_Font_24x17_0x28[51] = {
     0x00, 0x7f, 0x80, 0x00, 0x7f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xff, 0x80, 0x00, 0x7f, 0x80, 0x00, 0x7f, 0x80
 };
 static const tImage Font_24x17_0x28 = { image_data_Font_24x17_0x28,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -273,7 +273,7 @@ static const uint8_t image_data_Font_24x17_0x29[51] = {
     0x01, 0xfe, 0x00, 0x01, 0xfe, 0x00, 0x01, 0xff, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xfe, 0x00, 0x01, 0xfe, 0x00
 };
 static const tImage Font_24x17_0x29 = { image_data_Font_24x17_0x29,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -298,7 +298,7 @@ static const uint8_t image_data_Font_24x17_0x2a[51] = {
     0x10, 0x00, 0xc0, 0x38, 0x01, 0xe0, 0x38, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x07, 0x8e, 0x00, 0x07, 0x8e, 0x00, 0x03, 0x0e, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x03, 0x06, 0x00, 0x07, 0x8e, 0x00, 0x07, 0x8e, 0x00, 0x03, 0x06, 0x00, 0x38, 0x00, 0xc0, 0x38, 0x01, 0xe0, 0x18, 0x00, 0xc0
 };
 static const tImage Font_24x17_0x2a = { image_data_Font_24x17_0x2a,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -323,7 +323,7 @@ static const uint8_t image_data_Font_24x17_0x2b[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xc0, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x2b = { image_data_Font_24x17_0x2b,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -348,7 +348,7 @@ static const uint8_t image_data_Font_24x17_0x2c[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x2c = { image_data_Font_24x17_0x2c,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -373,7 +373,7 @@ static const uint8_t image_data_Font_24x17_0x2d[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x2d = { image_data_Font_24x17_0x2d,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -398,7 +398,7 @@ static const uint8_t image_data_Font_24x17_0x2e[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x2e = { image_data_Font_24x17_0x2e,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -423,7 +423,7 @@ static const uint8_t image_data_Font_24x17_0x2f[51] = {
     0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00
 };
 static const tImage Font_24x17_0x2f = { image_data_Font_24x17_0x2f,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -448,7 +448,7 @@ static const uint8_t image_data_Font_24x17_0x30[51] = {
     0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x30 = { image_data_Font_24x17_0x30,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -473,7 +473,7 @@ static const uint8_t image_data_Font_24x17_0x31[51] = {
     0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00
 };
 static const tImage Font_24x17_0x31 = { image_data_Font_24x17_0x31,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -498,7 +498,7 @@ static const uint8_t image_data_Font_24x17_0x32[51] = {
     0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0
 };
 static const tImage Font_24x17_0x32 = { image_data_Font_24x17_0x32,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -523,7 +523,7 @@ static const uint8_t image_data_Font_24x17_0x33[51] = {
     0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0xff, 0xc0, 0x00, 0xff, 0xc0, 0x00, 0xff, 0xc0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x33 = { image_data_Font_24x17_0x33,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -548,7 +548,7 @@ static const uint8_t image_data_Font_24x17_0x34[51] = {
     0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0
 };
 static const tImage Font_24x17_0x34 = { image_data_Font_24x17_0x34,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -573,7 +573,7 @@ static const uint8_t image_data_Font_24x17_0x35[51] = {
     0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x07, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x35 = { image_data_Font_24x17_0x35,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -598,7 +598,7 @@ static const uint8_t image_data_Font_24x17_0x36[51] = {
     0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x36 = { image_data_Font_24x17_0x36,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -623,7 +623,7 @@ static const uint8_t image_data_Font_24x17_0x37[51] = {
     0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0
 };
 static const tImage Font_24x17_0x37 = { image_data_Font_24x17_0x37,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -648,7 +648,7 @@ static const uint8_t image_data_Font_24x17_0x38[51] = {
     0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x38 = { image_data_Font_24x17_0x38,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -673,7 +673,7 @@ static const uint8_t image_data_Font_24x17_0x39[51] = {
     0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x39 = { image_data_Font_24x17_0x39,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -698,7 +698,7 @@ static const uint8_t image_data_Font_24x17_0x3a[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x3a = { image_data_Font_24x17_0x3a,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -723,7 +723,7 @@ static const uint8_t image_data_Font_24x17_0x3b[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x3b = { image_data_Font_24x17_0x3b,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -748,7 +748,7 @@ static const uint8_t image_data_Font_24x17_0x3c[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x7c, 0x00, 0x01, 0xe0, 0x00, 0x01, 0x80, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x3c = { image_data_Font_24x17_0x3c,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -773,7 +773,7 @@ static const uint8_t image_data_Font_24x17_0x3d[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x3d = { image_data_Font_24x17_0x3d,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -798,7 +798,7 @@ static const uint8_t image_data_Font_24x17_0x3e[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x1f, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xe0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x3e = { image_data_Font_24x17_0x3e,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -823,7 +823,7 @@ static const uint8_t image_data_Font_24x17_0x3f[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x43, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x3f = { image_data_Font_24x17_0x3f,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -848,7 +848,7 @@ static const uint8_t image_data_Font_24x17_0x40[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x01, 0x81, 0x80, 0x03, 0x00, 0x40, 0x02, 0x00, 0x20, 0x04, 0x3f, 0x20, 0x0c, 0x63, 0x10, 0x08, 0xc3, 0x10, 0x08, 0xc3, 0x10, 0x08, 0xc3, 0x10, 0x08, 0xc3, 0x10, 0x08, 0xc3, 0x10, 0x08, 0x67, 0x20, 0x04, 0x3b, 0xe0, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00
 };
 static const tImage Font_24x17_0x40 = { image_data_Font_24x17_0x40,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -873,7 +873,7 @@ static const uint8_t image_data_Font_24x17_0x41[51] = {
     0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0
 };
 static const tImage Font_24x17_0x41 = { image_data_Font_24x17_0x41,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -898,7 +898,7 @@ static const uint8_t image_data_Font_24x17_0x42[51] = {
     0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x42 = { image_data_Font_24x17_0x42,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -923,7 +923,7 @@ static const uint8_t image_data_Font_24x17_0x43[51] = {
     0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0
 };
 static const tImage Font_24x17_0x43 = { image_data_Font_24x17_0x43,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -948,7 +948,7 @@ static const uint8_t image_data_Font_24x17_0x44[51] = {
     0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x44 = { image_data_Font_24x17_0x44,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -973,7 +973,7 @@ static const uint8_t image_data_Font_24x17_0x45[51] = {
     0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0
 };
 static const tImage Font_24x17_0x45 = { image_data_Font_24x17_0x45,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -998,7 +998,7 @@ static const uint8_t image_data_Font_24x17_0x46[51] = {
     0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00
 };
 static const tImage Font_24x17_0x46 = { image_data_Font_24x17_0x46,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1023,7 +1023,7 @@ static const uint8_t image_data_Font_24x17_0x47[51] = {
     0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xdf, 0xf0, 0x1f, 0xdf, 0xf0, 0x1f, 0xdf, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0
 };
 static const tImage Font_24x17_0x47 = { image_data_Font_24x17_0x47,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1048,7 +1048,7 @@ static const uint8_t image_data_Font_24x17_0x48[51] = {
     0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0
 };
 static const tImage Font_24x17_0x48 = { image_data_Font_24x17_0x48,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1073,7 +1073,7 @@ static const uint8_t image_data_Font_24x17_0x49[51] = {
     0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00
 };
 static const tImage Font_24x17_0x49 = { image_data_Font_24x17_0x49,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1098,7 +1098,7 @@ static const uint8_t image_data_Font_24x17_0x4a[51] = {
     0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x4a = { image_data_Font_24x17_0x4a,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1123,7 +1123,7 @@ static const uint8_t image_data_Font_24x17_0x4b[51] = {
     0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0
 };
 static const tImage Font_24x17_0x4b = { image_data_Font_24x17_0x4b,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1148,7 +1148,7 @@ static const uint8_t image_data_Font_24x17_0x4c[51] = {
     0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0
 };
 static const tImage Font_24x17_0x4c = { image_data_Font_24x17_0x4c,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1173,7 +1173,7 @@ static const uint8_t image_data_Font_24x17_0x4d[51] = {
     0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f
 };
 static const tImage Font_24x17_0x4d = { image_data_Font_24x17_0x4d,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1198,7 +1198,7 @@ static const uint8_t image_data_Font_24x17_0x4e[51] = {
     0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0
 };
 static const tImage Font_24x17_0x4e = { image_data_Font_24x17_0x4e,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1223,7 +1223,7 @@ static const uint8_t image_data_Font_24x17_0x4f[51] = {
     0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x4f = { image_data_Font_24x17_0x4f,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1248,7 +1248,7 @@ static const uint8_t image_data_Font_24x17_0x50[51] = {
     0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00
 };
 static const tImage Font_24x17_0x50 = { image_data_Font_24x17_0x50,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x04f == 0x0)
@@ -1273,7 +1273,7 @@ static const uint8_t image_data_Font_24x17_0x51[51] = {
     0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x51 = { image_data_Font_24x17_0x51,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1298,7 +1298,7 @@ static const uint8_t image_data_Font_24x17_0x52[51] = {
     0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0
 };
 static const tImage Font_24x17_0x52 = { image_data_Font_24x17_0x52,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1323,7 +1323,7 @@ static const uint8_t image_data_Font_24x17_0x53[51] = {
     0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x07, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x53 = { image_data_Font_24x17_0x53,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1348,7 +1348,7 @@ static const uint8_t image_data_Font_24x17_0x54[51] = {
     0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00
 };
 static const tImage Font_24x17_0x54 = { image_data_Font_24x17_0x54,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1373,7 +1373,7 @@ static const uint8_t image_data_Font_24x17_0x55[51] = {
     0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x55 = { image_data_Font_24x17_0x55,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1398,7 +1398,7 @@ static const uint8_t image_data_Font_24x17_0x56[51] = {
     0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0
 };
 static const tImage Font_24x17_0x56 = { image_data_Font_24x17_0x56,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1423,7 +1423,7 @@ static const uint8_t image_data_Font_24x17_0x57[51] = {
     0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc
 };
 static const tImage Font_24x17_0x57 = { image_data_Font_24x17_0x57,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1448,7 +1448,7 @@ static const uint8_t image_data_Font_24x17_0x58[51] = {
     0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0
 };
 static const tImage Font_24x17_0x58 = { image_data_Font_24x17_0x58,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1473,7 +1473,7 @@ static const uint8_t image_data_Font_24x17_0x59[51] = {
     0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00
 };
 static const tImage Font_24x17_0x59 = { image_data_Font_24x17_0x59,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1498,7 +1498,7 @@ static const uint8_t image_data_Font_24x17_0x5a[51] = {
     0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0
 };
 static const tImage Font_24x17_0x5a = { image_data_Font_24x17_0x5a,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1523,7 +1523,7 @@ static const uint8_t image_data_Font_24x17_0x5b[51] = {
     0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80
 };
 static const tImage Font_24x17_0x5b = { image_data_Font_24x17_0x5b,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1548,7 +1548,7 @@ static const uint8_t image_data_Font_24x17_0x5c[51] = {
     0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00
 };
 static const tImage Font_24x17_0x5c = { image_data_Font_24x17_0x5c,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1573,7 +1573,7 @@ static const uint8_t image_data_Font_24x17_0x5d[51] = {
     0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80
 };
 static const tImage Font_24x17_0x5d = { image_data_Font_24x17_0x5d,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1598,7 +1598,7 @@ static const uint8_t image_data_Font_24x17_0x5e[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x66, 0x00, 0x00, 0xc3, 0x00, 0x00, 0xc3, 0x00, 0x01, 0x81, 0x80, 0x03, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x5e = { image_data_Font_24x17_0x5e,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x020 == 0x0)
@@ -1623,7 +1623,7 @@ static const uint8_t image_data_Font_24x17_0x5f[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x5f = { image_data_Font_24x17_0x5f,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1648,7 +1648,7 @@ static const uint8_t image_data_Font_24x17_0x60[51] = {
     0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x60 = { image_data_Font_24x17_0x60,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x041 == 0x0)
@@ -1673,7 +1673,7 @@ static const uint8_t image_data_Font_24x17_0x61[51] = {
     0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0
 };
 static const tImage Font_24x17_0x61 = { image_data_Font_24x17_0x61,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1698,7 +1698,7 @@ static const uint8_t image_data_Font_24x17_0x62[51] = {
     0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80
 };
 static const tImage Font_24x17_0x62 = { image_data_Font_24x17_0x62,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1723,7 +1723,7 @@ static const uint8_t image_data_Font_24x17_0x63[51] = {
     0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0
 };
 static const tImage Font_24x17_0x63 = { image_data_Font_24x17_0x63,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1748,7 +1748,7 @@ static const uint8_t image_data_Font_24x17_0x64[51] = {
     0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80
 };
 static const tImage Font_24x17_0x64 = { image_data_Font_24x17_0x64,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1773,7 +1773,7 @@ static const uint8_t image_data_Font_24x17_0x65[51] = {
     0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0
 };
 static const tImage Font_24x17_0x65 = { image_data_Font_24x17_0x65,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1798,7 +1798,7 @@ static const uint8_t image_data_Font_24x17_0x66[51] = {
     0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00
 };
 static const tImage Font_24x17_0x66 = { image_data_Font_24x17_0x66,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1823,7 +1823,7 @@ static const uint8_t image_data_Font_24x17_0x67[51] = {
     0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xbf, 0xe0, 0x3f, 0xbf, 0xe0, 0x3f, 0xbf, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0
 };
 static const tImage Font_24x17_0x67 = { image_data_Font_24x17_0x67,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1848,7 +1848,7 @@ static const uint8_t image_data_Font_24x17_0x68[51] = {
     0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0
 };
 static const tImage Font_24x17_0x68 = { image_data_Font_24x17_0x68,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1873,7 +1873,7 @@ static const uint8_t image_data_Font_24x17_0x69[51] = {
     0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00
 };
 static const tImage Font_24x17_0x69 = { image_data_Font_24x17_0x69,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1898,7 +1898,7 @@ static const uint8_t image_data_Font_24x17_0x6a[51] = {
     0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80
 };
 static const tImage Font_24x17_0x6a = { image_data_Font_24x17_0x6a,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1923,7 +1923,7 @@ static const uint8_t image_data_Font_24x17_0x6b[51] = {
     0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0
 };
 static const tImage Font_24x17_0x6b = { image_data_Font_24x17_0x6b,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1948,7 +1948,7 @@ static const uint8_t image_data_Font_24x17_0x6c[51] = {
     0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0
 };
 static const tImage Font_24x17_0x6c = { image_data_Font_24x17_0x6c,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1973,7 +1973,7 @@ static const uint8_t image_data_Font_24x17_0x6d[51] = {
     0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f
 };
 static const tImage Font_24x17_0x6d = { image_data_Font_24x17_0x6d,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1998,7 +1998,7 @@ static const uint8_t image_data_Font_24x17_0x6e[51] = {
     0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0
 };
 static const tImage Font_24x17_0x6e = { image_data_Font_24x17_0x6e,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2023,7 +2023,7 @@ static const uint8_t image_data_Font_24x17_0x6f[51] = {
     0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80
 };
 static const tImage Font_24x17_0x6f = { image_data_Font_24x17_0x6f,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2048,7 +2048,7 @@ static const uint8_t image_data_Font_24x17_0x70[51] = {
     0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00
 };
 static const tImage Font_24x17_0x70 = { image_data_Font_24x17_0x70,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x06f == 0x0)
@@ -2073,7 +2073,7 @@ static const uint8_t image_data_Font_24x17_0x71[51] = {
     0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80
 };
 static const tImage Font_24x17_0x71 = { image_data_Font_24x17_0x71,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2098,7 +2098,7 @@ static const uint8_t image_data_Font_24x17_0x72[51] = {
     0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0
 };
 static const tImage Font_24x17_0x72 = { image_data_Font_24x17_0x72,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2123,7 +2123,7 @@ static const uint8_t image_data_Font_24x17_0x73[51] = {
     0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80
 };
 static const tImage Font_24x17_0x73 = { image_data_Font_24x17_0x73,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2148,7 +2148,7 @@ static const uint8_t image_data_Font_24x17_0x74[51] = {
     0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00
 };
 static const tImage Font_24x17_0x74 = { image_data_Font_24x17_0x74,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2173,7 +2173,7 @@ static const uint8_t image_data_Font_24x17_0x75[51] = {
     0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80
 };
 static const tImage Font_24x17_0x75 = { image_data_Font_24x17_0x75,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2198,7 +2198,7 @@ static const uint8_t image_data_Font_24x17_0x76[51] = {
     0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80
 };
 static const tImage Font_24x17_0x76 = { image_data_Font_24x17_0x76,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2223,7 +2223,7 @@ static const uint8_t image_data_Font_24x17_0x77[51] = {
     0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc
 };
 static const tImage Font_24x17_0x77 = { image_data_Font_24x17_0x77,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2248,7 +2248,7 @@ static const uint8_t image_data_Font_24x17_0x78[51] = {
     0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0
 };
 static const tImage Font_24x17_0x78 = { image_data_Font_24x17_0x78,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2273,7 +2273,7 @@ static const uint8_t image_data_Font_24x17_0x79[51] = {
     0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0x80, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00
 };
 static const tImage Font_24x17_0x79 = { image_data_Font_24x17_0x79,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2298,7 +2298,7 @@ static const uint8_t image_data_Font_24x17_0x7a[51] = {
     0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0
 };
 static const tImage Font_24x17_0x7a = { image_data_Font_24x17_0x7a,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2323,7 +2323,7 @@ static const uint8_t image_data_Font_24x17_0x7b[51] = {
     0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x7b = { image_data_Font_24x17_0x7b,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2348,7 +2348,7 @@ static const uint8_t image_data_Font_24x17_0x7c[51] = {
     0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x7c = { image_data_Font_24x17_0x7c,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2373,7 +2373,7 @@ static const uint8_t image_data_Font_24x17_0x7d[51] = {
     0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00
 };
 static const tImage Font_24x17_0x7d = { image_data_Font_24x17_0x7d,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2398,7 +2398,7 @@ static const uint8_t image_data_Font_24x17_0x7e[51] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x60, 0x01, 0xf8, 0x60, 0x03, 0x9c, 0xe0, 0x03, 0x0f, 0xc0, 0x03, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_24x17_0x7e = { image_data_Font_24x17_0x7e,
-    24, 17, 8};
+    24, 17, 8, 0};
 #endif
 
 
@@ -3167,5 +3167,5 @@ static const tChar Font_24x17_array[] = {
 };
 
 
-const tFont Font_24x17 = { 95, Font_24x17_array };
+const tFont Font_24x17 = { 95, Font_24x17_array, .first_code = 0x20, .dense = 95 };
 
@@ -0,0 +1,498 @@
+/*******************************************************************************
+* name: Font_24x17
+* family: 8BIT WONDER(RUS BY LYAJKA)
+* size: 20
+* style: Nominal
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* type: monospaced
+* encoding: UTF-8
+*
+* packed: 95 glyphs 24x17, 51 bytes per glyph, first code 0x20
+* glyph bits are continuous across rows like tImage, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_24x17_packed_data[4845] = {
+  // character: ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  // character: '!'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: '"'
+  0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  // character: '#'
+  0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38,
+  0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00,
+  0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc,
+  0x3f, 0xff, 0xfc,
+  // character: '$'
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x3f, 0x00, 0x00,
+  0x7f, 0x80, 0x00, 0xc8, 0x80, 0x00, 0xc8, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x0b, 0x80, 0x00, 0x09, 0x80, 0x00, 0x09, 0x80, 0x00, 0x8b, 0x80, 0x00, 0xff, 0x00,
+  0x00, 0x7e, 0x00,
+  // character: '%'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x80, 0x0c, 0x83, 0x00, 0x18, 0xc3, 0x00, 0x18,
+  0xc6, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xcc, 0x00, 0x18, 0xcc, 0xe0, 0x08, 0x99, 0x90, 0x07, 0x33,
+  0x18, 0x00, 0x33, 0x18, 0x00, 0x63, 0x18, 0x00, 0x63, 0x18, 0x00, 0xc3, 0x18, 0x00, 0xc1, 0x10,
+  0x01, 0x80, 0xe0,
+  // character: '&'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xfc, 0x00, 0x01, 0x8c, 0x00, 0x01,
+  0x8c, 0x00, 0x01, 0x8c, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x71, 0x80, 0x00, 0xf1, 0x80, 0x01, 0x99,
+  0x80, 0x03, 0x0d, 0x80, 0x03, 0x07, 0x00, 0x03, 0x07, 0x00, 0x03, 0x87, 0x80, 0x01, 0xfd, 0xc0,
+  0x00, 0xf8, 0xe0,
+  // character: '''
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  // character: '('
+  0x00, 0x7f, 0x80, 0x00, 0x7f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01,
+  0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc,
+  0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xff, 0x80, 0x00, 0x7f, 0x80,
+  0x00, 0x7f, 0x80,
+  // character: ')'
+  0x01, 0xfe, 0x00, 0x01, 0xfe, 0x00, 0x01, 0xff, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00,
+  0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f,
+  0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xfe, 0x00,
+  0x01, 0xfe, 0x00,
+  // character: '*'
+  0x10, 0x00, 0xc0, 0x38, 0x01, 0xe0, 0x38, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x07, 0x8e, 0x00, 0x07,
+  0x8e, 0x00, 0x03, 0x0e, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x03, 0x06,
+  0x00, 0x07, 0x8e, 0x00, 0x07, 0x8e, 0x00, 0x03, 0x06, 0x00, 0x38, 0x00, 0xc0, 0x38, 0x01, 0xe0,
+  0x18, 0x00, 0xc0,
+  // character: '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x03, 0xff,
+  0xc0, 0x03, 0xff, 0xc0, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  // character: '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: '/'
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x60, 0x00,
+  // character: '0'
+  0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0,
+  0x07, 0xff, 0xc0,
+  // character: '1'
+  0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e,
+  0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00,
+  0x00, 0x7e, 0x00,
+  // character: '2'
+  0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00,
+  0x07, 0xf0, 0x00, 0x07, 0xf0, 0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xc0,
+  0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0,
+  0x1f, 0xff, 0xf0,
+  // character: '3'
+  0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00,
+  0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0xff, 0xc0, 0x00, 0xff, 0xc0, 0x00, 0xff, 0xc0, 0x00, 0x07,
+  0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0,
+  0x1f, 0xff, 0xc0,
+  // character: '4'
+  0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x00, 0x07,
+  0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0,
+  0x00, 0x07, 0xf0,
+  // character: '5'
+  0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f,
+  0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x07, 0xff, 0xf0, 0x00, 0x07,
+  0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0,
+  0x1f, 0xff, 0xc0,
+  // character: '6'
+  0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f,
+  0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0,
+  0x07, 0xff, 0xc0,
+  // character: '7'
+  0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00,
+  0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07,
+  0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0,
+  0x00, 0x07, 0xf0,
+  // character: '8'
+  0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0,
+  0x07, 0xff, 0xc0,
+  // character: '9'
+  0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x00, 0x07,
+  0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0,
+  0x1f, 0xff, 0xc0,
+  // character: ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x03, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x7c, 0x00, 0x01, 0xe0, 0x00, 0x01, 0x80,
+  0x00, 0x01, 0xe0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x80,
+  0x00, 0x00, 0x00,
+  // character: '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  // character: '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00,
+  0xc0, 0x00, 0x07, 0xc0, 0x00, 0x1f, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xe0, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  // character: '?'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x43, 0x80, 0x00,
+  0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: '@'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x01, 0x81, 0x80, 0x03, 0x00, 0x40, 0x02,
+  0x00, 0x20, 0x04, 0x3f, 0x20, 0x0c, 0x63, 0x10, 0x08, 0xc3, 0x10, 0x08, 0xc3, 0x10, 0x08, 0xc3,
+  0x10, 0x08, 0xc3, 0x10, 0x08, 0xc3, 0x10, 0x08, 0x67, 0x20, 0x04, 0x3b, 0xe0, 0x06, 0x00, 0x00,
+  0x03, 0x00, 0x00,
+  // character: 'A'
+  0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0,
+  0x3f, 0x8f, 0xe0,
+  // character: 'B'
+  0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0,
+  0x1f, 0xff, 0xc0,
+  // character: 'C'
+  0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f,
+  0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0,
+  0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0,
+  0x07, 0xff, 0xf0,
+  // character: 'D'
+  0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0,
+  0x1f, 0xff, 0xc0,
+  // character: 'E'
+  0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f,
+  0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xc0,
+  0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0,
+  0x07, 0xff, 0xf0,
+  // character: 'F'
+  0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f,
+  0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x1f, 0xc0,
+  0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00,
+  0x1f, 0xc0, 0x00,
+  // character: 'G'
+  0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f,
+  0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xdf, 0xf0, 0x1f, 0xdf, 0xf0, 0x1f, 0xdf, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xf0,
+  0x07, 0xff, 0xf0,
+  // character: 'H'
+  0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0,
+  0x1f, 0xc7, 0xf0,
+  // character: 'I'
+  0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0xfe, 0x00,
+  // character: 'J'
+  0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00,
+  0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07,
+  0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0,
+  0x1f, 0xff, 0xc0,
+  // character: 'K'
+  0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0,
+  0x1f, 0xc7, 0xf0,
+  // character: 'L'
+  0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f,
+  0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0,
+  0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0,
+  0x1f, 0xff, 0xf0,
+  // character: 'M'
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8,
+  0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe,
+  0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f, 0xf8, 0xfe, 0x3f,
+  0xf8, 0xfe, 0x3f,
+  // character: 'N'
+  0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0,
+  0x1f, 0xc7, 0xf0,
+  // character: 'O'
+  0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0,
+  0x07, 0xff, 0xc0,
+  // character: 'P'
+  0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xc0,
+  0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00,
+  0x1f, 0xc0, 0x00,
+  // character: 'Q'
+  0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0,
+  0x07, 0xff, 0xc0,
+  // character: 'R'
+  0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0,
+  0x1f, 0xc7, 0xf0,
+  // character: 'S'
+  0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f,
+  0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x07, 0xff, 0xf0, 0x00, 0x07,
+  0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0,
+  0x1f, 0xff, 0xc0,
+  // character: 'T'
+  0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0xfe, 0x00,
+  // character: 'U'
+  0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0,
+  0x07, 0xff, 0xc0,
+  // character: 'V'
+  0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xc0,
+  0x1f, 0xff, 0xc0,
+  // character: 'W'
+  0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1,
+  0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc,
+  0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+  0xff, 0xff, 0xfc,
+  // character: 'X'
+  0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x1f, 0xc7,
+  0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0,
+  0x1f, 0xc7, 0xf0,
+  // character: 'Y'
+  0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f,
+  0xc7, 0xf0, 0x1f, 0xc7, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xc0, 0x00, 0xfe,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0xfe, 0x00,
+  // character: 'Z'
+  0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00,
+  0x07, 0xf0, 0x00, 0x07, 0xf0, 0x07, 0xff, 0xf0, 0x07, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x1f, 0xc0,
+  0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0,
+  0x1f, 0xff, 0xf0,
+  // character: '['
+  0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01,
+  0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc,
+  0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80,
+  0x01, 0xff, 0x80,
+  // character: '\\'
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1c,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x06, 0x00,
+  // character: ']'
+  0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00,
+  0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f,
+  0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80,
+  0x01, 0xff, 0x80,
+  // character: '^'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0xc3, 0x00, 0x00, 0xc3, 0x00, 0x01, 0x81, 0x80, 0x03, 0x00, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  // character: '_'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  // character: '`'
+  0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  // character: 'a'
+  0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0,
+  0x3f, 0x8f, 0xe0,
+  // character: 'b'
+  0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80,
+  0x3f, 0xff, 0x80,
+  // character: 'c'
+  0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f,
+  0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80,
+  0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0xe0,
+  0x0f, 0xff, 0xe0,
+  // character: 'd'
+  0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80,
+  0x3f, 0xff, 0x80,
+  // character: 'e'
+  0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f,
+  0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0x80,
+  0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0xe0,
+  0x0f, 0xff, 0xe0,
+  // character: 'f'
+  0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f,
+  0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0x80,
+  0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00,
+  0x3f, 0x80, 0x00,
+  // character: 'g'
+  0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f,
+  0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xbf, 0xe0, 0x3f, 0xbf, 0xe0, 0x3f, 0xbf, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0xe0,
+  0x0f, 0xff, 0xe0,
+  // character: 'h'
+  0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0,
+  0x3f, 0x8f, 0xe0,
+  // character: 'i'
+  0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01,
+  0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc,
+  0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00,
+  0x01, 0xfc, 0x00,
+  // character: 'j'
+  0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00,
+  0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f,
+  0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80,
+  0x3f, 0xff, 0x80,
+  // character: 'k'
+  0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0,
+  0x3f, 0x8f, 0xe0,
+  // character: 'l'
+  0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f,
+  0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80,
+  0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0,
+  0x3f, 0xff, 0xe0,
+  // character: 'm'
+  0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xfc, 0x7f, 0xf1,
+  0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc,
+  0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f,
+  0xf1, 0xfc, 0x7f,
+  // character: 'n'
+  0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0,
+  0x3f, 0x8f, 0xe0,
+  // character: 'o'
+  0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0x80,
+  0x0f, 0xff, 0x80,
+  // character: 'p'
+  0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0x80,
+  0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00,
+  0x3f, 0x80, 0x00,
+  // character: 'q'
+  0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0x80,
+  0x0f, 0xff, 0x80,
+  // character: 'r'
+  0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0,
+  0x3f, 0x8f, 0xe0,
+  // character: 's'
+  0x0f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f,
+  0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0xe0, 0x00, 0x0f,
+  0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80,
+  0x3f, 0xff, 0x80,
+  // character: 't'
+  0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01,
+  0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc,
+  0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00,
+  0x01, 0xfc, 0x00,
+  // character: 'u'
+  0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0x80,
+  0x0f, 0xff, 0x80,
+  // character: 'v'
+  0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80,
+  0x3f, 0xff, 0x80,
+  // character: 'w'
+  0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1,
+  0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc,
+  0x7f, 0xf1, 0xfc, 0x7f, 0xf1, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+  0xff, 0xff, 0xfc,
+  // character: 'x'
+  0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0x8f,
+  0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0,
+  0x3f, 0x8f, 0xe0,
+  // character: 'y'
+  0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f,
+  0x8f, 0xe0, 0x3f, 0x8f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xff, 0x80, 0x01, 0xfc,
+  0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00,
+  0x01, 0xfc, 0x00,
+  // character: 'z'
+  0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00,
+  0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x0f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0x3f, 0x80,
+  0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0,
+  0x3f, 0xff, 0xe0,
+  // character: '{'
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0xc0,
+  0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: '|'
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: '}'
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  // character: '~'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x60, 0x01, 0xf8, 0x60, 0x03, 0x9c,
+  0xe0, 0x03, 0x0f, 0xc0, 0x03, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+static const tFontPacked Font_24x17_packed_glyphs = { 24, 17, 51, 0x20, 95, Font_24x17_packed_data };
+
+const tFont Font_24x17_packed = { .packed = &Font_24x17_packed_glyphs };
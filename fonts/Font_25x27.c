@@ -58,7 +58,7 @@ static const uint8_t image_data_Font_25x27_0x20[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x20 = { image_data_Font_25x27_0x20,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -93,7 +93,7 @@ static const uint8_t image_data_Font_25x27_0x21[85] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x21 = { image_data_Font_25x27_0x21,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -128,7 +128,7 @@ static const uint8_t image_data_Font_25x27_0x22[85] = {
     0x00, 0x00, 0x00, 0x00, 0xe1, 0xc0, 0x00, 0x70, 0xe0, 0x00, 0x38, 0x70, 0x00, 0x1c, 0x38, 0x00, 0x0e, 0x1c, 0x00, 0x07, 0x0e, 0x00, 0x03, 0x87, 0x00, 0x01, 0xc3, 0x80, 0x00, 0xe1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x22 = { image_data_Font_25x27_0x22,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -163,7 +163,7 @@ static const uint8_t image_data_Font_25x27_0x23[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xe0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x38, 0x00, 0x07, 0x1c, 0x00, 0x03, 0x8e, 0x00, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00, 0x38, 0xe0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x38, 0x00, 0x07, 0x1c, 0x00, 0x03, 0x8e, 0x00, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00, 0x38, 0xe0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x38, 0x00, 0x07, 0x1c, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x23 = { image_data_Font_25x27_0x23,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -198,7 +198,7 @@ static const uint8_t image_data_Font_25x27_0x24[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xce, 0x00, 0x1f, 0xff, 0x00, 0x1f, 0xff, 0xc0, 0x0f, 0xff, 0xe0, 0x07, 0x80, 0xf0, 0x03, 0xc0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x03, 0xe0, 0x07, 0x81, 0xf0, 0x03, 0xff, 0xf8, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x24 = { image_data_Font_25x27_0x24,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -233,7 +233,7 @@ static const uint8_t image_data_Font_25x27_0x25[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x70, 0x0f, 0xf0, 0x38, 0x07, 0xf8, 0x38, 0x03, 0x9c, 0x1c, 0x01, 0xce, 0x0c, 0x00, 0xe7, 0x0e, 0x00, 0x73, 0x86, 0x00, 0x39, 0xc7, 0x00, 0x1c, 0xe3, 0x00, 0x0f, 0xf3, 0x9f, 0xc7, 0xf9, 0xdf, 0xf1, 0xf9, 0xcf, 0xf8, 0x00, 0xe7, 0x1c, 0x00, 0xe3, 0x8e, 0x00, 0x71, 0xc7, 0x00, 0x30, 0xe3, 0x80, 0x38, 0x71, 0xc0, 0x18, 0x38, 0xe0, 0x1c, 0x1f, 0xf0, 0x0c, 0x0f, 0xf8, 0x0e, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x25 = { image_data_Font_25x27_0x25,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -268,7 +268,7 @@ static const uint8_t image_data_Font_25x27_0x26[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x00, 0xff, 0xe0, 0x00, 0x7f, 0xf0, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0x1f, 0xe7, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x26 = { image_data_Font_25x27_0x26,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -303,7 +303,7 @@ static const uint8_t image_data_Font_25x27_0x27[85] = {
     0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x27 = { image_data_Font_25x27_0x27,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -338,7 +338,7 @@ static const uint8_t image_data_Font_25x27_0x28[85] = {
     0x00, 0x0f, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xe0, 0x00
 };
 static const tImage Font_25x27_0x28 = { image_data_Font_25x27_0x28,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -373,7 +373,7 @@ static const uint8_t image_data_Font_25x27_0x29[85] = {
     0x01, 0xf0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7c, 0x00, 0x00
 };
 static const tImage Font_25x27_0x29 = { image_data_Font_25x27_0x29,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -408,7 +408,7 @@ static const uint8_t image_data_Font_25x27_0x2a[85] = {
     0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x1c, 0x67, 0x00, 0x0f, 0xbf, 0xc0, 0x03, 0xff, 0x80, 0x00, 0x1c, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1d, 0xc0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x3c, 0x00, 0x06, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x2a = { image_data_Font_25x27_0x2a,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -443,7 +443,7 @@ static const uint8_t image_data_Font_25x27_0x2b[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x2b = { image_data_Font_25x27_0x2b,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -478,7 +478,7 @@ static const uint8_t image_data_Font_25x27_0x2c[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00
 };
 static const tImage Font_25x27_0x2c = { image_data_Font_25x27_0x2c,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -513,7 +513,7 @@ static const uint8_t image_data_Font_25x27_0x2d[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x2d = { image_data_Font_25x27_0x2d,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -548,7 +548,7 @@ static const uint8_t image_data_Font_25x27_0x2e[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x2e = { image_data_Font_25x27_0x2e,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -583,7 +583,7 @@ static const uint8_t image_data_Font_25x27_0x2f[85] = {
     0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x2f = { image_data_Font_25x27_0x2f,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -618,7 +618,7 @@ static const uint8_t image_data_Font_25x27_0x30[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3e, 0x0f, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xf8, 0x3e, 0x00, 0x7c, 0x1f, 0x00, 0x3e, 0x0f, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xf8, 0x3e, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x30 = { image_data_Font_25x27_0x30,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -653,7 +653,7 @@ static const uint8_t image_data_Font_25x27_0x31[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x3f, 0xf8, 0x00, 0x1f, 0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x31 = { image_data_Font_25x27_0x31,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -688,7 +688,7 @@ static const uint8_t image_data_Font_25x27_0x32[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x32 = { image_data_Font_25x27_0x32,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -723,7 +723,7 @@ static const uint8_t image_data_Font_25x27_0x33[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0xff, 0xff, 0x00, 0x7f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x33 = { image_data_Font_25x27_0x33,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -758,7 +758,7 @@ static const uint8_t image_data_Font_25x27_0x34[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc3, 0xf0, 0x03, 0xe1, 0xf8, 0x01, 0xf0, 0xfc, 0x00, 0xf8, 0x7e, 0x00, 0x7c, 0x3f, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x07, 0xff, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x34 = { image_data_Font_25x27_0x34,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -793,7 +793,7 @@ static const uint8_t image_data_Font_25x27_0x35[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x3f, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x35 = { image_data_Font_25x27_0x35,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -828,7 +828,7 @@ static const uint8_t image_data_Font_25x27_0x36[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x7f, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xf8, 0x3e, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x36 = { image_data_Font_25x27_0x36,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -863,7 +863,7 @@ static const uint8_t image_data_Font_25x27_0x37[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x01, 0xff, 0xff, 0x00, 0xff, 0xff, 0x80, 0x7c, 0x07, 0xc0, 0x3e, 0x03, 0xe0, 0x1f, 0x01, 0xf0, 0x0f, 0x80, 0xf8, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x01, 0xfe, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x37 = { image_data_Font_25x27_0x37,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -898,7 +898,7 @@ static const uint8_t image_data_Font_25x27_0x38[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0x7c, 0x0f, 0x80, 0x3e, 0x07, 0xc0, 0x1f, 0x03, 0xe0, 0x0f, 0x81, 0xf0, 0x07, 0xc0, 0xf8, 0x03, 0xe0, 0x7c, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xff, 0x80, 0x3e, 0x07, 0xc0, 0x1f, 0x03, 0xe0, 0x0f, 0x81, 0xf0, 0x07, 0xc0, 0xf8, 0x03, 0xe0, 0x7c, 0x01, 0xf0, 0x3e, 0x00, 0xff, 0xff, 0x00, 0x7f, 0xff, 0x80, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x38 = { image_data_Font_25x27_0x38,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -933,7 +933,7 @@ static const uint8_t image_data_Font_25x27_0x39[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3e, 0x0f, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x01, 0xe0, 0xf8, 0x00, 0xf0, 0x7c, 0x00, 0x78, 0x3e, 0x00, 0x3f, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x39 = { image_data_Font_25x27_0x39,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -968,7 +968,7 @@ static const uint8_t image_data_Font_25x27_0x3a[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x3a = { image_data_Font_25x27_0x3a,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1003,7 +1003,7 @@ static const uint8_t image_data_Font_25x27_0x3b[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00
 };
 static const tImage Font_25x27_0x3b = { image_data_Font_25x27_0x3b,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1038,7 +1038,7 @@ static const uint8_t image_data_Font_25x27_0x3c[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0x80, 0x00, 0xfe, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x3c = { image_data_Font_25x27_0x3c,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1073,7 +1073,7 @@ static const uint8_t image_data_Font_25x27_0x3d[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x3d = { image_data_Font_25x27_0x3d,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1108,7 +1108,7 @@ static const uint8_t image_data_Font_25x27_0x3e[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x7f, 0x00, 0x00, 0xfe, 0x00, 0x01, 0xfc, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xe0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x3e = { image_data_Font_25x27_0x3e,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1143,7 +1143,7 @@ static const uint8_t image_data_Font_25x27_0x3f[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7c, 0x1f, 0x00, 0x3e, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0xf0, 0x00, 0x3f, 0xf8, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x3f = { image_data_Font_25x27_0x3f,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1178,7 +1178,7 @@ static const uint8_t image_data_Font_25x27_0x40[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0xc0, 0x1e, 0x00, 0xe0, 0x0e, 0x00, 0x70, 0x07, 0x00, 0x38, 0x03, 0x87, 0xfc, 0x01, 0xc7, 0xfe, 0x00, 0xe3, 0xff, 0x00, 0x71, 0xc3, 0x80, 0x38, 0xe1, 0xc0, 0x1c, 0x70, 0xe0, 0x0e, 0x38, 0x70, 0x07, 0x1f, 0xf8, 0x03, 0x8f, 0xfc, 0x01, 0xc3, 0xfe, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x01, 0xc0, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x01, 0xff, 0xf8, 0x00
 };
 static const tImage Font_25x27_0x40 = { image_data_Font_25x27_0x40,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1213,7 +1213,7 @@ static const uint8_t image_data_Font_25x27_0x41[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0x0e, 0x00, 0x1f, 0x87, 0x00, 0x0f, 0xc3, 0x80, 0x07, 0xe1, 0xc0, 0x03, 0xf0, 0xe0, 0x01, 0xf8, 0x70, 0x00, 0xfc, 0x38, 0x00, 0x7e, 0x1c, 0x00, 0x7f, 0xff, 0x00, 0x7f, 0xff, 0xe0, 0x3f, 0xff, 0xf0, 0x1f, 0x80, 0xf8, 0x0f, 0xc0, 0x7c, 0x07, 0xe0, 0x3e, 0x03, 0xf0, 0x1f, 0x01, 0xf8, 0x0f, 0x80, 0xfc, 0x07, 0xc0, 0x7e, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x41 = { image_data_Font_25x27_0x41,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1248,7 +1248,7 @@ static const uint8_t image_data_Font_25x27_0x42[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3e, 0x0f, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0x07, 0xe0, 0x0f, 0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0x7e, 0x00, 0xf8, 0x3f, 0x00, 0x7f, 0xff, 0x80, 0x3f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x42 = { image_data_Font_25x27_0x42,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1283,7 +1283,7 @@ static const uint8_t image_data_Font_25x27_0x43[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x43 = { image_data_Font_25x27_0x43,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1318,7 +1318,7 @@ static const uint8_t image_data_Font_25x27_0x44[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00, 0x7c, 0x1f, 0x80, 0x3e, 0x0f, 0xc0, 0x1f, 0x07, 0xe0, 0x0f, 0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0x7e, 0x00, 0xf8, 0x3f, 0x00, 0x7c, 0x1f, 0x80, 0x3e, 0x0f, 0xc0, 0x1f, 0x07, 0xe0, 0x0f, 0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x44 = { image_data_Font_25x27_0x44,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1353,7 +1353,7 @@ static const uint8_t image_data_Font_25x27_0x45[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x45 = { image_data_Font_25x27_0x45,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1388,7 +1388,7 @@ static const uint8_t image_data_Font_25x27_0x46[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x7f, 0xf8, 0x00, 0x3f, 0xfc, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x1f, 0xfe, 0x00, 0x0f, 0xff, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x46 = { image_data_Font_25x27_0x46,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1423,7 +1423,7 @@ static const uint8_t image_data_Font_25x27_0x47[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0f, 0xc3, 0xe0, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x1e, 0x00, 0x3f, 0x1f, 0x80, 0x1f, 0x8f, 0xc0, 0x0f, 0xc7, 0xe0, 0x07, 0xe1, 0xf0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x47 = { image_data_Font_25x27_0x47,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1458,7 +1458,7 @@ static const uint8_t image_data_Font_25x27_0x48[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0x7f, 0xff, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x48 = { image_data_Font_25x27_0x48,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1493,7 +1493,7 @@ static const uint8_t image_data_Font_25x27_0x49[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x49 = { image_data_Font_25x27_0x49,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1528,7 +1528,7 @@ static const uint8_t image_data_Font_25x27_0x4a[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x03, 0xc3, 0xf0, 0x01, 0xe1, 0xf8, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfc, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x4a = { image_data_Font_25x27_0x4a,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1563,7 +1563,7 @@ static const uint8_t image_data_Font_25x27_0x4b[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00, 0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0f, 0xc3, 0xc0, 0x07, 0xe3, 0xe0, 0x03, 0xf1, 0xe0, 0x01, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0x0f, 0xc0, 0x1f, 0x87, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x4b = { image_data_Font_25x27_0x4b,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1598,7 +1598,7 @@ static const uint8_t image_data_Font_25x27_0x4c[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x4c = { image_data_Font_25x27_0x4c,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1633,7 +1633,7 @@ static const uint8_t image_data_Font_25x27_0x4d[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xe1, 0xf8, 0x7f, 0xf0, 0xfc, 0x3f, 0xf8, 0x7e, 0x1f, 0xfc, 0x3f, 0x0f, 0xfe, 0x1f, 0x87, 0xff, 0x0f, 0xc3, 0xff, 0x87, 0xe1, 0xff, 0xc3, 0xf0, 0xff, 0xe1, 0xf8, 0x7f, 0xf0, 0xfc, 0x3f, 0xf8, 0x7e, 0x1f, 0xfc, 0x3f, 0x0f, 0xfe, 0x1f, 0x87, 0xff, 0x0f, 0xc3, 0xff, 0x87, 0xe1, 0xff, 0xc3, 0xf0, 0xff, 0xe1, 0xf8, 0x7f, 0xf0, 0xfc, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x4d = { image_data_Font_25x27_0x4d,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1668,7 +1668,7 @@ static const uint8_t image_data_Font_25x27_0x4e[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x4e = { image_data_Font_25x27_0x4e,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1703,7 +1703,7 @@ static const uint8_t image_data_Font_25x27_0x4f[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xff, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x4f = { image_data_Font_25x27_0x4f,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1738,7 +1738,7 @@ static const uint8_t image_data_Font_25x27_0x50[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0f, 0xc3, 0xe0, 0x07, 0xe1, 0xf0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x50 = { image_data_Font_25x27_0x50,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1773,7 +1773,7 @@ static const uint8_t image_data_Font_25x27_0x51[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc7, 0xf0, 0x07, 0xe7, 0xf8, 0x03, 0xff, 0xfc, 0x01, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x51 = { image_data_Font_25x27_0x51,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1808,7 +1808,7 @@ static const uint8_t image_data_Font_25x27_0x52[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7c, 0x3f, 0x00, 0x3e, 0x1f, 0x80, 0x1f, 0x0f, 0xc0, 0x0f, 0x87, 0xe0, 0x07, 0xc3, 0xf0, 0x03, 0xe1, 0xf8, 0x01, 0xf0, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0xc0, 0x1f, 0x07, 0xe0, 0x0f, 0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0x7e, 0x00, 0xf8, 0x3f, 0x00, 0x7c, 0x1f, 0x80, 0x3e, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x52 = { image_data_Font_25x27_0x52,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1843,7 +1843,7 @@ static const uint8_t image_data_Font_25x27_0x53[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3e, 0x0f, 0x00, 0x1f, 0x07, 0x80, 0x0f, 0x83, 0xc0, 0x07, 0xc0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xff, 0xe0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x00, 0x1f, 0xe0, 0x00, 0x03, 0xf0, 0x03, 0xc1, 0xf8, 0x01, 0xe0, 0xfc, 0x00, 0xf0, 0x7e, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x53 = { image_data_Font_25x27_0x53,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1878,7 +1878,7 @@ static const uint8_t image_data_Font_25x27_0x54[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x54 = { image_data_Font_25x27_0x54,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1913,7 +1913,7 @@ static const uint8_t image_data_Font_25x27_0x55[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xff, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x55 = { image_data_Font_25x27_0x55,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1948,7 +1948,7 @@ static const uint8_t image_data_Font_25x27_0x56[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x0f, 0xc7, 0xc0, 0x07, 0xe3, 0xe0, 0x01, 0xff, 0xe0, 0x00, 0x7f, 0xf0, 0x00, 0x3f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x56 = { image_data_Font_25x27_0x56,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1983,7 +1983,7 @@ static const uint8_t image_data_Font_25x27_0x57[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xc7, 0xcf, 0xc3, 0xe3, 0xe7, 0xe1, 0xf1, 0xf3, 0xf0, 0xf8, 0xf9, 0xf8, 0x7c, 0x7c, 0xfc, 0x3e, 0x3e, 0x7e, 0x1f, 0x1f, 0x3f, 0x0f, 0x8f, 0x9f, 0x87, 0xc7, 0xcf, 0xc3, 0xe3, 0xe7, 0xe1, 0xf1, 0xf3, 0xf0, 0xf8, 0xf9, 0xf8, 0x7c, 0x7c, 0xfc, 0x3e, 0x3e, 0x7e, 0x1f, 0x1f, 0x3f, 0x0f, 0x8f, 0x9f, 0x87, 0xc7, 0xcf, 0xc3, 0xe3, 0xe7, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x57 = { image_data_Font_25x27_0x57,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2018,7 +2018,7 @@ static const uint8_t image_data_Font_25x27_0x58[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x00, 0xff, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x58 = { image_data_Font_25x27_0x58,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2053,7 +2053,7 @@ static const uint8_t image_data_Font_25x27_0x59[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x7e, 0x01, 0xf0, 0x3f, 0x00, 0xf8, 0x1f, 0x80, 0x7c, 0x0f, 0xc0, 0x3e, 0x07, 0xe0, 0x1f, 0x03, 0xf0, 0x0f, 0x81, 0xf8, 0x07, 0xc0, 0xfc, 0x03, 0xe0, 0x7e, 0x01, 0xf0, 0x3f, 0x00, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x59 = { image_data_Font_25x27_0x59,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2088,7 +2088,7 @@ static const uint8_t image_data_Font_25x27_0x5a[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x5a = { image_data_Font_25x27_0x5a,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2123,7 +2123,7 @@ static const uint8_t image_data_Font_25x27_0x5b[85] = {
     0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00
 };
 static const tImage Font_25x27_0x5b = { image_data_Font_25x27_0x5b,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2158,7 +2158,7 @@ static const uint8_t image_data_Font_25x27_0x5c[85] = {
     0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x5c = { image_data_Font_25x27_0x5c,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2193,7 +2193,7 @@ static const uint8_t image_data_Font_25x27_0x5d[85] = {
     0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00
 };
 static const tImage Font_25x27_0x5d = { image_data_Font_25x27_0x5d,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2228,7 +2228,7 @@ static const uint8_t image_data_Font_25x27_0x5e[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xdc, 0x00, 0x01, 0xee, 0x00, 0x00, 0xe7, 0x80, 0x00, 0x71, 0xc0, 0x00, 0x70, 0xe0, 0x00, 0x38, 0x38, 0x00, 0x3c, 0x1c, 0x00, 0x1c, 0x07, 0x00, 0x1e, 0x03, 0x80, 0x0e, 0x01, 0xe0, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x5e = { image_data_Font_25x27_0x5e,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2263,7 +2263,7 @@ static const uint8_t image_data_Font_25x27_0x5f[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x07, 0xff, 0xfe, 0x00
 };
 static const tImage Font_25x27_0x5f = { image_data_Font_25x27_0x5f,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2298,7 +2298,7 @@ static const uint8_t image_data_Font_25x27_0x60[85] = {
     0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x60 = { image_data_Font_25x27_0x60,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2333,7 +2333,7 @@ static const uint8_t image_data_Font_25x27_0x61[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x00, 0xf0, 0xf8, 0x00, 0x78, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x61 = { image_data_Font_25x27_0x61,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2368,7 +2368,7 @@ static const uint8_t image_data_Font_25x27_0x62[85] = {
     0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x62 = { image_data_Font_25x27_0x62,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2403,7 +2403,7 @@ static const uint8_t image_data_Font_25x27_0x63[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x00, 0xf8, 0xf0, 0x00, 0x7c, 0x78, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0xf0, 0x00, 0x7c, 0x78, 0x00, 0x3f, 0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x63 = { image_data_Font_25x27_0x63,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2438,7 +2438,7 @@ static const uint8_t image_data_Font_25x27_0x64[85] = {
     0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x01, 0xff, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x64 = { image_data_Font_25x27_0x64,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2473,7 +2473,7 @@ static const uint8_t image_data_Font_25x27_0x65[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x00, 0xf8, 0x70, 0x00, 0x7c, 0x38, 0x00, 0x3e, 0x1c, 0x00, 0x1f, 0x0e, 0x00, 0x0f, 0xff, 0x00, 0x07, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0xf0, 0x00, 0x7c, 0x78, 0x00, 0x3f, 0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x65 = { image_data_Font_25x27_0x65,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2508,7 +2508,7 @@ static const uint8_t image_data_Font_25x27_0x66[85] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf8, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x03, 0xff, 0x80, 0x01, 0xff, 0xc0, 0x00, 0xff, 0xe0, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x66 = { image_data_Font_25x27_0x66,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2543,7 +2543,7 @@ static const uint8_t image_data_Font_25x27_0x67[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xe0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x07, 0x07, 0xe0, 0x03, 0x83, 0xf0, 0x01, 0xff, 0xf8, 0x00
 };
 static const tImage Font_25x27_0x67 = { image_data_Font_25x27_0x67,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2578,7 +2578,7 @@ static const uint8_t image_data_Font_25x27_0x68[85] = {
     0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x68 = { image_data_Font_25x27_0x68,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2613,7 +2613,7 @@ static const uint8_t image_data_Font_25x27_0x69[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x69 = { image_data_Font_25x27_0x69,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2648,7 +2648,7 @@ static const uint8_t image_data_Font_25x27_0x6a[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x0e, 0x3e, 0x00, 0x07, 0xff, 0x00, 0x03, 0xff, 0x80, 0x00
 };
 static const tImage Font_25x27_0x6a = { image_data_Font_25x27_0x6a,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2683,7 +2683,7 @@ static const uint8_t image_data_Font_25x27_0x6b[85] = {
     0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x7c, 0x00, 0x1f, 0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x07, 0xff, 0x80, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x6b = { image_data_Font_25x27_0x6b,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2718,7 +2718,7 @@ static const uint8_t image_data_Font_25x27_0x6c[85] = {
     0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x6c = { image_data_Font_25x27_0x6c,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2753,7 +2753,7 @@ static const uint8_t image_data_Font_25x27_0x6d[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x3f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x0f, 0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0xe3, 0xe3, 0xe1, 0xf1, 0xf1, 0xf0, 0xf8, 0xf8, 0xf8, 0x7c, 0x7c, 0x7c, 0x3e, 0x3e, 0x3e, 0x1f, 0x1f, 0x1f, 0x0f, 0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0xe3, 0xe3, 0xe1, 0xf1, 0xf1, 0xf0, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x6d = { image_data_Font_25x27_0x6d,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2788,7 +2788,7 @@ static const uint8_t image_data_Font_25x27_0x6e[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x6e = { image_data_Font_25x27_0x6e,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2823,7 +2823,7 @@ static const uint8_t image_data_Font_25x27_0x6f[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x6f = { image_data_Font_25x27_0x6f,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2858,7 +2858,7 @@ static const uint8_t image_data_Font_25x27_0x70[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x0f, 0xfe, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00
 };
 static const tImage Font_25x27_0x70 = { image_data_Font_25x27_0x70,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2893,7 +2893,7 @@ static const uint8_t image_data_Font_25x27_0x71[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xe0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f, 0xfe, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xff, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00
 };
 static const tImage Font_25x27_0x71 = { image_data_Font_25x27_0x71,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2928,7 +2928,7 @@ static const uint8_t image_data_Font_25x27_0x72[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x00, 0xff, 0xc0, 0x00, 0x7f, 0xe0, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x72 = { image_data_Font_25x27_0x72,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2963,7 +2963,7 @@ static const uint8_t image_data_Font_25x27_0x73[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x00, 0xf8, 0x70, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x0f, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x7f, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0xf0, 0xf8, 0x00, 0x78, 0x7c, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x73 = { image_data_Font_25x27_0x73,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -2998,7 +2998,7 @@ static const uint8_t image_data_Font_25x27_0x74[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x80, 0x00, 0xff, 0xc0, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x74 = { image_data_Font_25x27_0x74,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3033,7 +3033,7 @@ static const uint8_t image_data_Font_25x27_0x75[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x75 = { image_data_Font_25x27_0x75,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3068,7 +3068,7 @@ static const uint8_t image_data_Font_25x27_0x76[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe1, 0xc0, 0x03, 0xf0, 0xe0, 0x01, 0xf8, 0x70, 0x00, 0xfc, 0x38, 0x00, 0x7e, 0x1c, 0x00, 0x3f, 0x0e, 0x00, 0x1f, 0x87, 0x00, 0x0f, 0xc3, 0x80, 0x07, 0xe1, 0xc0, 0x03, 0xf0, 0xe0, 0x01, 0xfc, 0xf0, 0x00, 0x7f, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x03, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x76 = { image_data_Font_25x27_0x76,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3103,7 +3103,7 @@ static const uint8_t image_data_Font_25x27_0x77[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x3e, 0x3e, 0x3e, 0x1f, 0x1f, 0x1f, 0x0f, 0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0xe3, 0xe3, 0xe1, 0xf1, 0xf1, 0xf0, 0xf8, 0xf8, 0xf8, 0x7c, 0x7c, 0x7c, 0x3e, 0x3e, 0x3e, 0x1f, 0x1f, 0x1f, 0x0f, 0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x77 = { image_data_Font_25x27_0x77,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3138,7 +3138,7 @@ static const uint8_t image_data_Font_25x27_0x78[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3, 0xe0, 0x07, 0xe1, 0xf0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00, 0x1f, 0x0f, 0x00, 0x0f, 0xff, 0x80, 0x03, 0xff, 0x80, 0x03, 0xff, 0xe0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00, 0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x78 = { image_data_Font_25x27_0x78,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3173,7 +3173,7 @@ static const uint8_t image_data_Font_25x27_0x79[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x03, 0x83, 0xe0, 0x01, 0xc1, 0xf0, 0x00, 0xff, 0xf8, 0x00
 };
 static const tImage Font_25x27_0x79 = { image_data_Font_25x27_0x79,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3208,7 +3208,7 @@ static const uint8_t image_data_Font_25x27_0x7a[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x03, 0xfc, 0x00, 0x03, 0xfc, 0x00, 0x03, 0xfc, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x1f, 0xfe, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x7a = { image_data_Font_25x27_0x7a,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3243,7 +3243,7 @@ static const uint8_t image_data_Font_25x27_0x7b[85] = {
     0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00
 };
 static const tImage Font_25x27_0x7b = { image_data_Font_25x27_0x7b,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3278,7 +3278,7 @@ static const uint8_t image_data_Font_25x27_0x7c[85] = {
     0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00
 };
 static const tImage Font_25x27_0x7c = { image_data_Font_25x27_0x7c,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3313,7 +3313,7 @@ static const uint8_t image_data_Font_25x27_0x7d[85] = {
     0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00
 };
 static const tImage Font_25x27_0x7d = { image_data_Font_25x27_0x7d,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -3348,7 +3348,7 @@ static const uint8_t image_data_Font_25x27_0x7e[85] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0c, 0x00, 0xff, 0x0e, 0x00, 0x7f, 0xff, 0x00, 0x38, 0xff, 0x00, 0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_25x27_0x7e = { image_data_Font_25x27_0x7e,
-    25, 27, 8};
+    25, 27, 8, 0};
 #endif
 
 
@@ -4117,5 +4117,5 @@ static const tChar Font_25x27_array[] = {
 };
 
 
-const tFont Font_25x27 = { 95, Font_25x27_array };
+const tFont Font_25x27 = { 95, Font_25x27_array, .first_code = 0x20, .dense = 95 };
 
@@ -0,0 +1,688 @@
+/*******************************************************************************
+* name: Font_25x27
+* family: Wheaton RS
+* size: 28
+* style: Regular
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* type: monospaced
+* encoding: UTF-8
+*
+* packed: 95 glyphs 25x27, 85 bytes per glyph, first code 0x20
+* glyph bits are continuous across rows like tImage, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_25x27_packed_data[8075] = {
+  // character: ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '!'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00,
+  0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '"'
+  0x00, 0x00, 0x00, 0x00, 0xe1, 0xc0, 0x00, 0x70, 0xe0, 0x00, 0x38, 0x70, 0x00, 0x1c, 0x38, 0x00,
+  0x0e, 0x1c, 0x00, 0x07, 0x0e, 0x00, 0x03, 0x87, 0x00, 0x01, 0xc3, 0x80, 0x00, 0xe1, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '#'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xe0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x38, 0x00,
+  0x07, 0x1c, 0x00, 0x03, 0x8e, 0x00, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00,
+  0x38, 0xe0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x38, 0x00, 0x07, 0x1c, 0x00, 0x03, 0x8e, 0x00, 0x0f,
+  0xff, 0xe0, 0x07, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00, 0x38, 0xe0, 0x00, 0x1c, 0x70, 0x00, 0x0e,
+  0x38, 0x00, 0x07, 0x1c, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '$'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xce, 0x00,
+  0x1f, 0xff, 0x00, 0x1f, 0xff, 0xc0, 0x0f, 0xff, 0xe0, 0x07, 0x80, 0xf0, 0x03, 0xc0, 0x00, 0x01,
+  0xf8, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x0f, 0xc0, 0x00,
+  0x03, 0xe0, 0x07, 0x81, 0xf0, 0x03, 0xff, 0xf8, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x3f,
+  0xfe, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '%'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x70, 0x0f, 0xf0, 0x38, 0x07, 0xf8, 0x38, 0x03,
+  0x9c, 0x1c, 0x01, 0xce, 0x0c, 0x00, 0xe7, 0x0e, 0x00, 0x73, 0x86, 0x00, 0x39, 0xc7, 0x00, 0x1c,
+  0xe3, 0x00, 0x0f, 0xf3, 0x9f, 0xc7, 0xf9, 0xdf, 0xf1, 0xf9, 0xcf, 0xf8, 0x00, 0xe7, 0x1c, 0x00,
+  0xe3, 0x8e, 0x00, 0x71, 0xc7, 0x00, 0x30, 0xe3, 0x80, 0x38, 0x71, 0xc0, 0x18, 0x38, 0xe0, 0x1c,
+  0x1f, 0xf0, 0x0c, 0x0f, 0xf8, 0x0e, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '&'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x00, 0xff, 0xe0, 0x00, 0x7f, 0xf0, 0x00,
+  0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0x7e, 0x0f, 0x80, 0x3f,
+  0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xff,
+  0xff, 0x80, 0xff, 0xff, 0xc0, 0x1f, 0xe7, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '''
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '('
+  0x00, 0x0f, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0x80, 0x00,
+  0x00, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x03, 0xe0, 0x00,
+  // character: ')'
+  0x01, 0xf0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x80, 0x00,
+  0x00, 0xc0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
+  0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x7c, 0x00, 0x00,
+  // character: '*'
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00,
+  0x1c, 0x67, 0x00, 0x0f, 0xbf, 0xc0, 0x03, 0xff, 0x80, 0x00, 0x1c, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x1d, 0xc0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x3c, 0x00, 0x06, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x70, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x03, 0x80, 0x00,
+  // character: '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xfc, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '/'
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xff, 0x00,
+  0x3e, 0x0f, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01,
+  0xf0, 0x7c, 0x00, 0xf8, 0x3e, 0x00, 0x7c, 0x1f, 0x00, 0x3e, 0x0f, 0x80, 0x1f, 0x07, 0xc0, 0x0f,
+  0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xf8, 0x3e, 0x00, 0x7f,
+  0xff, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '1'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00,
+  0x03, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x3f, 0xf8, 0x00, 0x1f,
+  0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '2'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00,
+  0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00,
+  0x00, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0x00, 0x00, 0x0f,
+  0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x7f,
+  0xff, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '3'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00,
+  0x01, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x0f, 0xc0, 0x00,
+  0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0xff,
+  0xff, 0x00, 0x7f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc3, 0xf0, 0x03, 0xe1, 0xf8, 0x01,
+  0xf0, 0xfc, 0x00, 0xf8, 0x7e, 0x00, 0x7c, 0x3f, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x07,
+  0xff, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '5'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x00,
+  0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0xff, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00,
+  0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x3f,
+  0xff, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '6'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x7f, 0xf8, 0x00, 0x7f, 0xfe, 0x00,
+  0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0x07, 0xc0, 0x0f,
+  0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xf8, 0x3e, 0x00, 0x7f,
+  0xff, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '7'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x01, 0xff, 0xff, 0x00, 0xff, 0xff, 0x80,
+  0x7c, 0x07, 0xc0, 0x3e, 0x03, 0xe0, 0x1f, 0x01, 0xf0, 0x0f, 0x80, 0xf8, 0x00, 0x01, 0xfc, 0x00,
+  0x01, 0xfe, 0x00, 0x01, 0xfe, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07,
+  0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '8'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00,
+  0x7c, 0x0f, 0x80, 0x3e, 0x07, 0xc0, 0x1f, 0x03, 0xe0, 0x0f, 0x81, 0xf0, 0x07, 0xc0, 0xf8, 0x03,
+  0xe0, 0x7c, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xff, 0x80, 0x3e, 0x07, 0xc0, 0x1f,
+  0x03, 0xe0, 0x0f, 0x81, 0xf0, 0x07, 0xc0, 0xf8, 0x03, 0xe0, 0x7c, 0x01, 0xf0, 0x3e, 0x00, 0xff,
+  0xff, 0x00, 0x7f, 0xff, 0x80, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xff, 0x00,
+  0x3e, 0x0f, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01,
+  0xf0, 0x7c, 0x00, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x07, 0xc0, 0x00,
+  0x03, 0xe0, 0x00, 0x01, 0xf0, 0x01, 0xe0, 0xf8, 0x00, 0xf0, 0x7c, 0x00, 0x78, 0x3e, 0x00, 0x3f,
+  0xff, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x03, 0x80, 0x00,
+  // character: '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0x80, 0x00,
+  0xfe, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x0f,
+  0xff, 0xe0, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x3f, 0x80, 0x00,
+  0x07, 0xf0, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x7f, 0x00, 0x00,
+  0xfe, 0x00, 0x01, 0xfc, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xe0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '?'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00,
+  0x7c, 0x1f, 0x00, 0x3e, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0xf0, 0x00,
+  0x3f, 0xf8, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f,
+  0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '@'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x00,
+  0x3f, 0xff, 0x00, 0x3f, 0xff, 0xc0, 0x1e, 0x00, 0xe0, 0x0e, 0x00, 0x70, 0x07, 0x00, 0x38, 0x03,
+  0x87, 0xfc, 0x01, 0xc7, 0xfe, 0x00, 0xe3, 0xff, 0x00, 0x71, 0xc3, 0x80, 0x38, 0xe1, 0xc0, 0x1c,
+  0x70, 0xe0, 0x0e, 0x38, 0x70, 0x07, 0x1f, 0xf8, 0x03, 0x8f, 0xfc, 0x01, 0xc3, 0xfe, 0x00, 0xe0,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x01, 0xc0, 0x0f, 0xff, 0xe0, 0x07, 0xff,
+  0xf0, 0x01, 0xff, 0xf8, 0x00,
+  // character: 'A'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfc, 0x00,
+  0x3f, 0x0e, 0x00, 0x1f, 0x87, 0x00, 0x0f, 0xc3, 0x80, 0x07, 0xe1, 0xc0, 0x03, 0xf0, 0xe0, 0x01,
+  0xf8, 0x70, 0x00, 0xfc, 0x38, 0x00, 0x7e, 0x1c, 0x00, 0x7f, 0xff, 0x00, 0x7f, 0xff, 0xe0, 0x3f,
+  0xff, 0xf0, 0x1f, 0x80, 0xf8, 0x0f, 0xc0, 0x7c, 0x07, 0xe0, 0x3e, 0x03, 0xf0, 0x1f, 0x01, 0xf8,
+  0x0f, 0x80, 0xfc, 0x07, 0xc0, 0x7e, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'B'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00,
+  0x3e, 0x0f, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01,
+  0xf0, 0x7c, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0x07, 0xe0, 0x0f,
+  0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0x7e, 0x00, 0xf8, 0x3f, 0x00, 0x7f,
+  0xff, 0x80, 0x3f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'C'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xff, 0x00,
+  0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01,
+  0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f,
+  0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7f,
+  0xff, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'D'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00,
+  0x7c, 0x1f, 0x80, 0x3e, 0x0f, 0xc0, 0x1f, 0x07, 0xe0, 0x0f, 0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03,
+  0xe0, 0xfc, 0x01, 0xf0, 0x7e, 0x00, 0xf8, 0x3f, 0x00, 0x7c, 0x1f, 0x80, 0x3e, 0x0f, 0xc0, 0x1f,
+  0x07, 0xe0, 0x0f, 0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0xfc, 0x00, 0xff,
+  0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'E'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfe, 0x00,
+  0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xc0, 0x00, 0x07,
+  0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f,
+  0xff, 0x00, 0x1f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'F'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x7f, 0xf8, 0x00, 0x3f, 0xfc, 0x00,
+  0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x1f, 0xfe, 0x00, 0x0f, 0xff, 0x00, 0x07,
+  0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'G'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xfe, 0x00,
+  0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0f, 0xc3, 0xe0, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01,
+  0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x1e, 0x00, 0x3f, 0x1f, 0x80, 0x1f, 0x8f, 0xc0, 0x0f,
+  0xc7, 0xe0, 0x07, 0xe1, 0xf0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7f,
+  0xff, 0x00, 0x1f, 0xff, 0x80, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'H'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00,
+  0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03,
+  0xf0, 0x7c, 0x01, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0x7f, 0xff, 0x80, 0x3f, 0x07, 0xc0, 0x1f,
+  0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc,
+  0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'I'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00,
+  0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00,
+  0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07,
+  0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'J'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00,
+  0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00,
+  0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x03, 0xc3, 0xf0, 0x01, 0xe1, 0xf8, 0x00, 0xff,
+  0xfc, 0x00, 0x7f, 0xfc, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'K'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00,
+  0x7e, 0x1f, 0x00, 0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0f, 0xc3, 0xc0, 0x07, 0xe3, 0xe0, 0x03,
+  0xf1, 0xe0, 0x01, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0x0f, 0xc0, 0x1f,
+  0x87, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc,
+  0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'L'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00,
+  0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03,
+  0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f,
+  0xff, 0x00, 0x0f, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'M'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
+  0xe1, 0xf8, 0x7f, 0xf0, 0xfc, 0x3f, 0xf8, 0x7e, 0x1f, 0xfc, 0x3f, 0x0f, 0xfe, 0x1f, 0x87, 0xff,
+  0x0f, 0xc3, 0xff, 0x87, 0xe1, 0xff, 0xc3, 0xf0, 0xff, 0xe1, 0xf8, 0x7f, 0xf0, 0xfc, 0x3f, 0xf8,
+  0x7e, 0x1f, 0xfc, 0x3f, 0x0f, 0xfe, 0x1f, 0x87, 0xff, 0x0f, 0xc3, 0xff, 0x87, 0xe1, 0xff, 0xc3,
+  0xf0, 0xff, 0xe1, 0xf8, 0x7f, 0xf0, 0xfc, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'N'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00,
+  0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03,
+  0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f,
+  0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc,
+  0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'O'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00,
+  0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03,
+  0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f,
+  0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xff,
+  0xff, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'P'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00,
+  0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0f, 0xc3, 0xe0, 0x07, 0xe1, 0xf0, 0x03, 0xf0, 0xf8, 0x01,
+  0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0x80, 0x0f,
+  0xff, 0x80, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x7e,
+  0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00,
+  0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03,
+  0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f,
+  0x83, 0xe0, 0x0f, 0xc7, 0xf0, 0x07, 0xe7, 0xf8, 0x03, 0xff, 0xfc, 0x01, 0xff, 0xfc, 0x00, 0x7f,
+  0xfe, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'R'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00,
+  0x7c, 0x3f, 0x00, 0x3e, 0x1f, 0x80, 0x1f, 0x0f, 0xc0, 0x0f, 0x87, 0xe0, 0x07, 0xc3, 0xf0, 0x03,
+  0xe1, 0xf8, 0x01, 0xf0, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0xc0, 0x1f,
+  0x07, 0xe0, 0x0f, 0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0x7e, 0x00, 0xf8,
+  0x3f, 0x00, 0x7c, 0x1f, 0x80, 0x3e, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'S'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xfe, 0x00,
+  0x3e, 0x0f, 0x00, 0x1f, 0x07, 0x80, 0x0f, 0x83, 0xc0, 0x07, 0xc0, 0x00, 0x03, 0xf0, 0x00, 0x01,
+  0xff, 0xe0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x00,
+  0x1f, 0xe0, 0x00, 0x03, 0xf0, 0x03, 0xc1, 0xf8, 0x01, 0xe0, 0xfc, 0x00, 0xf0, 0x7e, 0x00, 0x7f,
+  0xff, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'T'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00,
+  0x3f, 0xff, 0x80, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'U'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00,
+  0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03,
+  0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f,
+  0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xff,
+  0xff, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'V'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00,
+  0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03,
+  0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x0f,
+  0xc7, 0xc0, 0x07, 0xe3, 0xe0, 0x01, 0xff, 0xe0, 0x00, 0x7f, 0xf0, 0x00, 0x3f, 0xf0, 0x00, 0x0f,
+  0xf0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'W'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xc7, 0xcf, 0xc3, 0xe3, 0xe7, 0xe1, 0xf1, 0xf3,
+  0xf0, 0xf8, 0xf9, 0xf8, 0x7c, 0x7c, 0xfc, 0x3e, 0x3e, 0x7e, 0x1f, 0x1f, 0x3f, 0x0f, 0x8f, 0x9f,
+  0x87, 0xc7, 0xcf, 0xc3, 0xe3, 0xe7, 0xe1, 0xf1, 0xf3, 0xf0, 0xf8, 0xf9, 0xf8, 0x7c, 0x7c, 0xfc,
+  0x3e, 0x3e, 0x7e, 0x1f, 0x1f, 0x3f, 0x0f, 0x8f, 0x9f, 0x87, 0xc7, 0xcf, 0xc3, 0xe3, 0xe7, 0xff,
+  0xff, 0xf1, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'X'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00,
+  0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03,
+  0xf0, 0x7c, 0x00, 0xff, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x3f, 0x07, 0xc0, 0x1f,
+  0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc,
+  0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x7e, 0x01, 0xf0, 0x3f, 0x00, 0xf8, 0x1f, 0x80,
+  0x7c, 0x0f, 0xc0, 0x3e, 0x07, 0xe0, 0x1f, 0x03, 0xf0, 0x0f, 0x81, 0xf8, 0x07, 0xc0, 0xfc, 0x03,
+  0xe0, 0x7e, 0x01, 0xf0, 0x3f, 0x00, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x00,
+  0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'Z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xf0, 0x00,
+  0x1f, 0xf0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x0f,
+  0xc0, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7f,
+  0xff, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '['
+  0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+  0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1f,
+  0x80, 0x00, 0x0f, 0xc0, 0x00,
+  // character: '\\'
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
+  0xc0, 0x00, 0x00, 0x00, 0x00,
+  // character: ']'
+  0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
+  0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x7e,
+  0x00, 0x00, 0x3f, 0x00, 0x00,
+  // character: '^'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xe0, 0x00,
+  0x03, 0xf0, 0x00, 0x01, 0xdc, 0x00, 0x01, 0xee, 0x00, 0x00, 0xe7, 0x80, 0x00, 0x71, 0xc0, 0x00,
+  0x70, 0xe0, 0x00, 0x38, 0x38, 0x00, 0x3c, 0x1c, 0x00, 0x1c, 0x07, 0x00, 0x1e, 0x03, 0x80, 0x0e,
+  0x01, 0xe0, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '_'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
+  0xfc, 0x07, 0xff, 0xfe, 0x00,
+  // character: '`'
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xe0, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'a'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x00,
+  0xf0, 0xf8, 0x00, 0x78, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x0f,
+  0xff, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f,
+  0xfe, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'b'
+  0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01,
+  0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f,
+  0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f,
+  0xfe, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'c'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x00,
+  0xf8, 0xf0, 0x00, 0x7c, 0x78, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07,
+  0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0xf0, 0x00, 0x7c, 0x78, 0x00, 0x3f,
+  0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'd'
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x01, 0xff, 0xf0, 0x00,
+  0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07,
+  0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3f,
+  0xff, 0x00, 0x0f, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'e'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x00,
+  0xf8, 0x70, 0x00, 0x7c, 0x38, 0x00, 0x3e, 0x1c, 0x00, 0x1f, 0x0e, 0x00, 0x0f, 0xff, 0x00, 0x07,
+  0xff, 0x80, 0x03, 0xff, 0xc0, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0xf0, 0x00, 0x7c, 0x78, 0x00, 0x3f,
+  0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'f'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf8, 0x00, 0x07, 0xc0, 0x00,
+  0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x03, 0xff, 0x80, 0x01, 0xff, 0xc0, 0x00, 0xff, 0xe0, 0x00,
+  0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07,
+  0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'g'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xe0, 0x03, 0xff, 0xf0, 0x01,
+  0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f,
+  0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xff, 0xfc, 0x00, 0x7f,
+  0xfe, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x07, 0x07, 0xe0, 0x03, 0x83,
+  0xf0, 0x01, 0xff, 0xf8, 0x00,
+  // character: 'h'
+  0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01,
+  0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f,
+  0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c,
+  0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'i'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'j'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x0e, 0x3e, 0x00, 0x07, 0xff,
+  0x00, 0x03, 0xff, 0x80, 0x00,
+  // character: 'k'
+  0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00,
+  0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x7c, 0x00, 0x1f, 0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x07,
+  0xff, 0x80, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e,
+  0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'l'
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00,
+  0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+  0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x3f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x0f,
+  0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0xe3, 0xe3, 0xe1, 0xf1, 0xf1, 0xf0, 0xf8, 0xf8, 0xf8, 0x7c,
+  0x7c, 0x7c, 0x3e, 0x3e, 0x3e, 0x1f, 0x1f, 0x1f, 0x0f, 0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0xe3,
+  0xe3, 0xe1, 0xf1, 0xf1, 0xf0, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01,
+  0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f,
+  0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c,
+  0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01,
+  0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f,
+  0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f,
+  0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x00,
+  0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07,
+  0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3f,
+  0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x0f, 0xfe, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0,
+  0x00, 0x00, 0xf8, 0x00, 0x00,
+  // character: 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xe0, 0x03, 0xff, 0xf0, 0x01,
+  0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f,
+  0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f,
+  0xfe, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xff, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0xf8, 0x00,
+  // character: 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x00, 0xff, 0xc0, 0x00, 0x7f, 0xe0, 0x00,
+  0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f,
+  0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 's'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x00,
+  0xf8, 0x70, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x0f, 0xff, 0x00, 0x03,
+  0xff, 0xc0, 0x00, 0x7f, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0xf0, 0xf8, 0x00, 0x78, 0x7c, 0x00, 0x3f,
+  0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 't'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00,
+  0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x80, 0x00, 0xff, 0xc0, 0x00,
+  0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07,
+  0xe0, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00,
+  0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07,
+  0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3f,
+  0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe1, 0xc0, 0x03, 0xf0, 0xe0, 0x01, 0xf8, 0x70, 0x00,
+  0xfc, 0x38, 0x00, 0x7e, 0x1c, 0x00, 0x3f, 0x0e, 0x00, 0x1f, 0x87, 0x00, 0x0f, 0xc3, 0x80, 0x07,
+  0xe1, 0xc0, 0x03, 0xf0, 0xe0, 0x01, 0xfc, 0xf0, 0x00, 0x7f, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x07,
+  0xf0, 0x00, 0x03, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x3e, 0x3e, 0x3e, 0x1f, 0x1f, 0x1f, 0x0f,
+  0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0xe3, 0xe3, 0xe1, 0xf1, 0xf1, 0xf0, 0xf8, 0xf8, 0xf8, 0x7c,
+  0x7c, 0x7c, 0x3e, 0x3e, 0x3e, 0x1f, 0x1f, 0x1f, 0x0f, 0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0xff,
+  0xff, 0xe1, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3, 0xe0, 0x07, 0xe1, 0xf0, 0x03, 0xf0, 0xf8, 0x01,
+  0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00, 0x1f, 0x0f, 0x00, 0x0f, 0xff, 0x80, 0x03,
+  0xff, 0x80, 0x03, 0xff, 0xe0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7e,
+  0x1f, 0x00, 0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00,
+  0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07,
+  0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0x3f,
+  0xfe, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x03, 0x83, 0xe0, 0x01, 0xc1,
+  0xf0, 0x00, 0xff, 0xf8, 0x00,
+  // character: 'z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x00,
+  0x00, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x03, 0xfc, 0x00, 0x03,
+  0xfc, 0x00, 0x03, 0xfc, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3f,
+  0xfc, 0x00, 0x1f, 0xfe, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '{'
+  0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xf0, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
+  0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x07, 0xe0, 0x00,
+  // character: '|'
+  0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
+  0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e,
+  0x00, 0x00, 0x07, 0x00, 0x00,
+  // character: '}'
+  0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7e, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
+  0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x7e,
+  0x00, 0x00, 0x3f, 0x00, 0x00,
+  // character: '~'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0x0c, 0x00, 0xff, 0x0e, 0x00, 0x7f, 0xff, 0x00, 0x38, 0xff, 0x00, 0x18, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const tFontPacked Font_25x27_packed_glyphs = { 25, 27, 85, 0x20, 95, Font_25x27_packed_data };
+
+const tFont Font_25x27_packed = { .packed = &Font_25x27_packed_glyphs };
@@ -0,0 +1,3696 @@
+/*******************************************************************************
+* name: Font_25x27_rle
+* family: Wheaton RS
+* size: 28
+* style: Regular
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* antialiasing: no
+* type: monospaced
+* encoding: UTF-8
+* RLE compression enabled: yes
+*
+* Font_25x27 with IMAGE_RLE glyph data: signed count byte, count > 0 repeats
+* the next byte count times, count < 0 is followed by -count bytes
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t image_data_Font_25x27_rle_0x20[2] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x55, 0x00
+};
+static const tImage Font_25x27_rle_0x20 = { image_data_Font_25x27_rle_0x20,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x21[76] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00,
+    0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00,
+    0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0,
+    0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x08, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0,
+    0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x21 = { image_data_Font_25x27_rle_0x21,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x22[32] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xe5, 0xe1, 0xc0, 0x00, 0x70, 0xe0, 0x00, 0x38, 0x70, 0x00, 0x1c, 0x38, 0x00, 0x0e,
+    0x1c, 0x00, 0x07, 0x0e, 0x00, 0x03, 0x87, 0x00, 0x01, 0xc3, 0x80, 0x00, 0xe1, 0xc0, 0x36, 0x00
+};
+static const tImage Font_25x27_rle_0x22 = { image_data_Font_25x27_rle_0x22,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x23[69] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xc0, 0x38, 0xe0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x38, 0x00, 0x07, 0x1c, 0x00, 0x03,
+    0x8e, 0x00, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00, 0x38, 0xe0, 0x00, 0x1c,
+    0x70, 0x00, 0x0e, 0x38, 0x00, 0x07, 0x1c, 0x00, 0x03, 0x8e, 0x00, 0x0f, 0xff, 0xe0, 0x07, 0xff,
+    0xf0, 0x03, 0xff, 0xf8, 0x00, 0x38, 0xe0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x38, 0x00, 0x07, 0x1c,
+    0x00, 0x03, 0x8e, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x23 = { image_data_Font_25x27_rle_0x23,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x24[77] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙████∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙∙∙████∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xff, 0x07, 0x02, 0x00, 0xe9, 0x03, 0x80, 0x00, 0x03, 0xce, 0x00, 0x1f, 0xff, 0x00,
+    0x1f, 0xff, 0xc0, 0x0f, 0xff, 0xe0, 0x07, 0x80, 0xf0, 0x03, 0xc0, 0x00, 0x01, 0xf8, 0x02, 0x00,
+    0xe2, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x03, 0xe0,
+    0x07, 0x81, 0xf0, 0x03, 0xff, 0xf8, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x3f, 0xfe, 0x02,
+    0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x0b, 0x00
+};
+static const tImage Font_25x27_rle_0x24 = { image_data_Font_25x27_rle_0x24,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x25[71] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙██████∙∙∙∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙████████∙∙∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙████████∙∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙███∙∙███∙∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙███∙∙███∙∙∙∙∙██∙∙∙∙∙∙∙∙∙
+    // ∙███∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙∙
+    // ∙███∙∙███∙∙∙∙██∙∙∙∙∙∙∙∙∙∙
+    // ∙███∙∙███∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙███∙∙███∙∙∙██∙∙∙∙∙∙∙∙∙∙∙
+    // ∙████████∙∙███∙∙███████∙∙
+    // ∙████████∙∙███∙█████████∙
+    // ∙∙██████∙∙███∙∙█████████∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙███∙∙∙███∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙███∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙███∙
+    // ∙∙∙∙∙∙∙∙∙██∙∙∙∙███∙∙∙███∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙███∙
+    // ∙∙∙∙∙∙∙∙██∙∙∙∙∙███∙∙∙███∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙∙█████████∙
+    // ∙∙∙∙∙∙∙██∙∙∙∙∙∙█████████∙
+    // ∙∙∙∙∙∙███∙∙∙∙∙∙∙███████∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xbe, 0x0f, 0xc0, 0x70, 0x0f, 0xf0, 0x38, 0x07, 0xf8, 0x38, 0x03, 0x9c, 0x1c, 0x01,
+    0xce, 0x0c, 0x00, 0xe7, 0x0e, 0x00, 0x73, 0x86, 0x00, 0x39, 0xc7, 0x00, 0x1c, 0xe3, 0x00, 0x0f,
+    0xf3, 0x9f, 0xc7, 0xf9, 0xdf, 0xf1, 0xf9, 0xcf, 0xf8, 0x00, 0xe7, 0x1c, 0x00, 0xe3, 0x8e, 0x00,
+    0x71, 0xc7, 0x00, 0x30, 0xe3, 0x80, 0x38, 0x71, 0xc0, 0x18, 0x38, 0xe0, 0x1c, 0x1f, 0xf0, 0x0c,
+    0x0f, 0xf8, 0x0e, 0x03, 0xf8, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x25 = { image_data_Font_25x27_rle_0x25,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x26[79] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙████████████████∙∙∙∙
+    // ∙∙∙∙█████████████████∙∙∙∙
+    // ∙∙∙██████████████████∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙██████████████████∙∙∙∙
+    // ∙∙∙██████████████████∙∙∙∙
+    // ∙∙∙∙∙████████∙∙██████∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xf5, 0x01, 0xff, 0xc0, 0x00, 0xff, 0xe0, 0x00, 0x7f, 0xf0, 0x00, 0x3e, 0x02, 0x00,
+    0xff, 0x1f, 0x02, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x02, 0x00, 0xff,
+    0xf8, 0x02, 0x00, 0x02, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x80, 0x02, 0xff, 0xec, 0xc0, 0x7e,
+    0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0,
+    0x7c, 0x01, 0x02, 0xff, 0xff, 0x80, 0x02, 0xff, 0xfc, 0xc0, 0x1f, 0xe7, 0xe0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x26 = { image_data_Font_25x27_rle_0x26,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x27[38] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80, 0x00, 0x01, 0xc0,
+    0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x1c,
+    0x02, 0x00, 0xff, 0x0e, 0x37, 0x00
+};
+static const tImage Font_25x27_rle_0x27 = { image_data_Font_25x27_rle_0x27,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x28[109] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙
+    0xfb, 0x00, 0x0f, 0x80, 0x00, 0x07, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80, 0x00,
+    0x01, 0x80, 0x02, 0x00, 0xff, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00,
+    0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00,
+    0xfb, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00,
+    0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00,
+    0xfe, 0x03, 0x80, 0x02, 0x00, 0xff, 0xc0, 0x02, 0x00, 0xff, 0x60, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfd, 0x03, 0xe0, 0x00
+};
+static const tImage Font_25x27_rle_0x28 = { image_data_Font_25x27_rle_0x28,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x29[110] = {
+    // ∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0xfe, 0x01, 0xf0, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02,
+    0x00, 0xfe, 0x01, 0x80, 0x02, 0x00, 0xff, 0xc0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38,
+    0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03,
+    0x80, 0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38,
+    0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03,
+    0x80, 0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xc0, 0x02, 0x00, 0xff, 0x60, 0x02, 0x00, 0xff, 0x70,
+    0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00
+};
+static const tImage Font_25x27_rle_0x29 = { image_data_Font_25x27_rle_0x29,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x2a[48] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███∙∙∙██∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙███∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██∙∙∙∙∙██∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xef, 0x03, 0x80, 0x00, 0x01, 0xc0,
+    0x00, 0x1c, 0x67, 0x00, 0x0f, 0xbf, 0xc0, 0x03, 0xff, 0x80, 0x00, 0x1c, 0x02, 0x00, 0xff, 0x1f,
+    0x02, 0x00, 0xf5, 0x1d, 0xc0, 0x00, 0x1c, 0x70, 0x00, 0x0e, 0x3c, 0x00, 0x06, 0x0c, 0x2a, 0x00
+};
+static const tImage Font_25x27_rle_0x2a = { image_data_Font_25x27_rle_0x2a,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x2b[61] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x11, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x1c,
+    0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xf5, 0xff, 0xfe, 0x00, 0x7f, 0xff,
+    0x00, 0x3f, 0xff, 0x80, 0x00, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00,
+    0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfe, 0x03, 0x80, 0x17, 0x00
+};
+static const tImage Font_25x27_rle_0x2b = { image_data_Font_25x27_rle_0x2b,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x2c[36] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    0x39, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00,
+    0xff, 0xf8, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00,
+    0xfd, 0x03, 0x80, 0x00
+};
+static const tImage Font_25x27_rle_0x2c = { image_data_Font_25x27_rle_0x2c,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x2d[13] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x26, 0x00, 0xf8, 0x07, 0xf0, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xfc, 0x27, 0x00
+};
+static const tImage Font_25x27_rle_0x2d = { image_data_Font_25x27_rle_0x2d,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x2e[20] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x39, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00,
+    0xff, 0xf8, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x2e = { image_data_Font_25x27_rle_0x2e,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x2f[100] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xfb, 0x01, 0xc0, 0x00, 0x01, 0xe0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70,
+    0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e,
+    0x02, 0x00, 0xff, 0x0f, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xf8, 0x03, 0x80, 0x00, 0x01, 0xc0,
+    0x00, 0x01, 0xe0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x78, 0x02,
+    0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x0f, 0x02,
+    0x00, 0xff, 0x07, 0x02, 0x00, 0xf8, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0, 0x02, 0x00,
+    0xff, 0xe0, 0x05, 0x00
+};
+static const tImage Font_25x27_rle_0x2f = { image_data_Font_25x27_rle_0x2f,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x30[70] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xbf, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3e, 0x0f, 0x80, 0x1f,
+    0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xf8,
+    0x3e, 0x00, 0x7c, 0x1f, 0x00, 0x3e, 0x0f, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1,
+    0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xf8, 0x3e, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff,
+    0x00, 0x0f, 0xff, 0x80, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x30 = { image_data_Font_25x27_rle_0x30,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x31[79] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xf5, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x02, 0x00,
+    0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00,
+    0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8,
+    0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf2, 0x7f,
+    0xf0, 0x00, 0x3f, 0xf8, 0x00, 0x1f, 0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x07, 0xff, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x31 = { image_data_Font_25x27_rle_0x31,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x32[76] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙████████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙█████████████∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xf7, 0x01, 0xff, 0xe0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x02, 0x00, 0xf5, 0x0f,
+    0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00,
+    0xf4, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0x02, 0x00, 0xf5,
+    0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xf4, 0xff, 0xfe,
+    0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x32 = { image_data_Font_25x27_rle_0x32,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x33[77] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xf7, 0x01, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x02, 0x00, 0xff, 0x1f,
+    0x02, 0x00, 0xe9, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x01,
+    0xf8, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x02, 0x00, 0xf5, 0x0f, 0xc0, 0x00,
+    0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xfe, 0x7e,
+    0x00, 0x02, 0xff, 0xf9, 0x00, 0x7f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x33 = { image_data_Font_25x27_rle_0x33,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x34[80] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xfe, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff,
+    0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xde, 0x0f, 0x80, 0x00, 0x07, 0xc3, 0xf0, 0x03, 0xe1,
+    0xf8, 0x01, 0xf0, 0xfc, 0x00, 0xf8, 0x7e, 0x00, 0x7c, 0x3f, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff,
+    0xc0, 0x07, 0xff, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00,
+    0xff, 0x7e, 0x02, 0x00, 0xff, 0x3f, 0x02, 0x00, 0xfb, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x34 = { image_data_Font_25x27_rle_0x34,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x35[75] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xf6, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x1f, 0x02, 0x00, 0xf5,
+    0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xf8, 0xff, 0xf0,
+    0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xff, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+    0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xf6, 0x3e,
+    0x00, 0x3f, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xff, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x35 = { image_data_Font_25x27_rle_0x35,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x36[70] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xe6, 0x7f, 0xe0, 0x00, 0x7f, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x3e, 0x1f, 0x00, 0x1f,
+    0x0f, 0x80, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xdc,
+    0xff, 0xf8, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07,
+    0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xf8, 0x3e, 0x00, 0x7f, 0xff, 0x00, 0x1f,
+    0xff, 0x00, 0x07, 0xff, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x36 = { image_data_Font_25x27_rle_0x36,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x37[77] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙█████████████████∙∙∙∙
+    // ∙∙∙∙█████████████████∙∙∙∙
+    // ∙∙∙∙█████████████████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xfc, 0x03, 0xff, 0xfe, 0x01, 0x02, 0xff, 0xff, 0x00, 0x02, 0xff, 0xe1, 0x80, 0x7c,
+    0x07, 0xc0, 0x3e, 0x03, 0xe0, 0x1f, 0x01, 0xf0, 0x0f, 0x80, 0xf8, 0x00, 0x01, 0xfc, 0x00, 0x01,
+    0xfe, 0x00, 0x01, 0xfe, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x02, 0x00, 0xff,
+    0xfc, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5,
+    0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x37 = { image_data_Font_25x27_rle_0x37,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x38[73] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xf9, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xfe, 0x00, 0x02, 0xff, 0xd0, 0x00, 0x7c, 0x0f,
+    0x80, 0x3e, 0x07, 0xc0, 0x1f, 0x03, 0xe0, 0x0f, 0x81, 0xf0, 0x07, 0xc0, 0xf8, 0x03, 0xe0, 0x7c,
+    0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xff, 0x80, 0x3e, 0x07, 0xc0, 0x1f, 0x03, 0xe0,
+    0x0f, 0x81, 0xf0, 0x07, 0xc0, 0xf8, 0x03, 0xe0, 0x7c, 0x01, 0xf0, 0x3e, 0x00, 0x02, 0xff, 0xf9,
+    0x00, 0x7f, 0xff, 0x80, 0x1f, 0xff, 0x80, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x38 = { image_data_Font_25x27_rle_0x38,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x39[69] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙█████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xc0, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3e, 0x0f, 0x80, 0x1f,
+    0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00, 0xff,
+    0xfe, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01,
+    0xf0, 0x01, 0xe0, 0xf8, 0x00, 0xf0, 0x7c, 0x00, 0x78, 0x3e, 0x00, 0x3f, 0xff, 0x00, 0x1f, 0xff,
+    0x00, 0x07, 0xfe, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x39 = { image_data_Font_25x27_rle_0x39,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x3a[39] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x1a, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x07, 0xc0,
+    0x00, 0x03, 0xe0, 0x11, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01,
+    0xf0, 0x02, 0x00, 0xff, 0xf8, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x3a = { image_data_Font_25x27_rle_0x3a,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x3b[56] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    0x1a, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x07, 0xc0,
+    0x00, 0x03, 0xe0, 0x11, 0x00, 0xff, 0x07, 0x02, 0x00, 0xf8, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00,
+    0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x3c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00,
+    0xff, 0x07, 0x02, 0x00, 0xfd, 0x03, 0x80, 0x00
+};
+static const tImage Font_25x27_rle_0x3b = { image_data_Font_25x27_rle_0x3b,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x3c[58] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x11, 0x00, 0xf0, 0x03, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x3f,
+    0x80, 0x00, 0xfe, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xff, 0x78, 0x02, 0x00, 0xff, 0x3f, 0x02,
+    0x00, 0xfe, 0x0f, 0xe0, 0x02, 0x00, 0xff, 0xfe, 0x02, 0x00, 0xfb, 0x1f, 0xc0, 0x00, 0x03, 0xf8,
+    0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x0e, 0x17, 0x00
+};
+static const tImage Font_25x27_rle_0x3c = { image_data_Font_25x27_rle_0x3c,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x3d[26] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xf7, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x0d, 0x00, 0xf7, 0x1f,
+    0xff, 0xc0, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x20, 0x00
+};
+static const tImage Font_25x27_rle_0x3d = { image_data_Font_25x27_rle_0x3d,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x3e[58] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x10, 0x00, 0xff, 0x30, 0x02, 0x00, 0xff, 0x1e, 0x02, 0x00, 0xfb, 0x0f, 0xe0, 0x00, 0x01, 0xfc,
+    0x02, 0x00, 0xfb, 0x3f, 0x80, 0x00, 0x07, 0xf0, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x0f,
+    0x02, 0x00, 0xfc, 0x1f, 0x80, 0x00, 0x7f, 0x02, 0x00, 0xf6, 0xfe, 0x00, 0x01, 0xfc, 0x00, 0x03,
+    0xf8, 0x00, 0x01, 0xe0, 0x02, 0x00, 0xff, 0xc0, 0x18, 0x00
+};
+static const tImage Font_25x27_rle_0x3e = { image_data_Font_25x27_rle_0x3e,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x3f[67] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xd5, 0x01, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7c, 0x1f, 0x00,
+    0x3e, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0xf0, 0x00, 0x3f, 0xf8, 0x00,
+    0x1f, 0xf0, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x08, 0x00,
+    0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03,
+    0xe0, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x3f = { image_data_Font_25x27_rle_0x3f,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x40[78] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙████∙∙∙∙∙∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙∙█████████∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙██████████∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙██████████∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙███∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙███∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙███∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙███∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙██████████∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙██████████∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙∙█████████∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    0x0d, 0x00, 0xcd, 0x3f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0xc0, 0x1e, 0x00, 0xe0, 0x0e,
+    0x00, 0x70, 0x07, 0x00, 0x38, 0x03, 0x87, 0xfc, 0x01, 0xc7, 0xfe, 0x00, 0xe3, 0xff, 0x00, 0x71,
+    0xc3, 0x80, 0x38, 0xe1, 0xc0, 0x1c, 0x70, 0xe0, 0x0e, 0x38, 0x70, 0x07, 0x1f, 0xf8, 0x03, 0x8f,
+    0xfc, 0x01, 0xc3, 0xfe, 0x00, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00,
+    0xf3, 0x1c, 0x01, 0xc0, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xf0, 0x01, 0xff, 0xf8, 0x00
+};
+static const tImage Font_25x27_rle_0x40 = { image_data_Font_25x27_rle_0x40,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x41[70] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙██████████████████∙∙∙∙
+    // ∙∙∙██████████████████∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙██████∙∙∙∙∙∙∙█████∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xbf, 0xff, 0xe0, 0x00, 0xff, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0x0e, 0x00, 0x1f,
+    0x87, 0x00, 0x0f, 0xc3, 0x80, 0x07, 0xe1, 0xc0, 0x03, 0xf0, 0xe0, 0x01, 0xf8, 0x70, 0x00, 0xfc,
+    0x38, 0x00, 0x7e, 0x1c, 0x00, 0x7f, 0xff, 0x00, 0x7f, 0xff, 0xe0, 0x3f, 0xff, 0xf0, 0x1f, 0x80,
+    0xf8, 0x0f, 0xc0, 0x7c, 0x07, 0xe0, 0x3e, 0x03, 0xf0, 0x1f, 0x01, 0xf8, 0x0f, 0x80, 0xfc, 0x07,
+    0xc0, 0x7e, 0x03, 0xe0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x41 = { image_data_Font_25x27_rle_0x41,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x42[71] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙∙████████████████∙∙∙∙
+    // ∙∙∙∙∙████████████████∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xbe, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3e, 0x0f, 0x80,
+    0x1f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xf0, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0x7c, 0x00,
+    0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0x07, 0xe0, 0x0f, 0x83, 0xf0, 0x07,
+    0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0x7e, 0x00, 0xf8, 0x3f, 0x00, 0x7f, 0xff, 0x80, 0x3f,
+    0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x42 = { image_data_Font_25x27_rle_0x42,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x43[73] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xe6, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0x0f, 0x80, 0x1f,
+    0x87, 0xc0, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff,
+    0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x3f, 0x02, 0x00, 0xe5, 0x1f, 0x80, 0x00, 0x0f,
+    0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7f,
+    0xff, 0x00, 0x1f, 0xff, 0x00, 0x07, 0xff, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x43 = { image_data_Font_25x27_rle_0x43,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x44[71] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙██████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙████████████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xf9, 0x03, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0x02, 0xff, 0xc8, 0x00, 0x7c, 0x1f,
+    0x80, 0x3e, 0x0f, 0xc0, 0x1f, 0x07, 0xe0, 0x0f, 0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc,
+    0x01, 0xf0, 0x7e, 0x00, 0xf8, 0x3f, 0x00, 0x7c, 0x1f, 0x80, 0x3e, 0x0f, 0xc0, 0x1f, 0x07, 0xe0,
+    0x0f, 0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0xfc, 0x00, 0xff, 0xfe, 0x00,
+    0x7f, 0xfe, 0x00, 0x3f, 0xfc, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x44 = { image_data_Font_25x27_rle_0x44,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x45[75] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙█████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xe9, 0xff, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0x80, 0x00, 0x0f,
+    0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00,
+    0xec, 0x7f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00,
+    0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xf7,
+    0x3f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x45 = { image_data_Font_25x27_rle_0x45,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x46[77] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xf6, 0xff, 0xf0, 0x00, 0x7f, 0xf8, 0x00, 0x3f, 0xfc, 0x00, 0x1f, 0x02, 0x00, 0xf5,
+    0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02,
+    0x00, 0xff, 0x7c, 0x02, 0x00, 0xef, 0x3f, 0xfc, 0x00, 0x1f, 0xfe, 0x00, 0x0f, 0xff, 0x00, 0x07,
+    0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02,
+    0x00, 0xff, 0x3f, 0x02, 0x00, 0xfb, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x46 = { image_data_Font_25x27_rle_0x46,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x47[72] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xe6, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0x0f, 0x80, 0x1f,
+    0x87, 0xc0, 0x0f, 0xc3, 0xe0, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff,
+    0xfc, 0x02, 0x00, 0xde, 0x7e, 0x1e, 0x00, 0x3f, 0x1f, 0x80, 0x1f, 0x8f, 0xc0, 0x0f, 0xc7, 0xe0,
+    0x07, 0xe1, 0xf0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7f, 0xff, 0x00,
+    0x1f, 0xff, 0x80, 0x07, 0xff, 0x80, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x47 = { image_data_Font_25x27_rle_0x47,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x48[72] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xe0, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80,
+    0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01,
+    0xff, 0xfe, 0x00, 0x02, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0,
+    0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00,
+    0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x48 = { image_data_Font_25x27_rle_0x48,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x49[77] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xf2, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01,
+    0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x3f, 0x02, 0x00, 0xf2,
+    0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00,
+    0xff, 0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x3f, 0x02, 0x00, 0xf2, 0x1f, 0x80, 0x00,
+    0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x49 = { image_data_Font_25x27_rle_0x49,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x4a[77] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙████∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙████∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙██████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙█████████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xfb, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xff, 0x7e,
+    0x02, 0x00, 0xff, 0x3f, 0x02, 0x00, 0xf2, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00,
+    0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff,
+    0x3f, 0x02, 0x00, 0xe9, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x03, 0xc3, 0xf0, 0x01,
+    0xe1, 0xf8, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfc, 0x00, 0x1f, 0xfc, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x4a = { image_data_Font_25x27_rle_0x4a,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x4b[71] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙████∙∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙█████∙∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙█████████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xbe, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00,
+    0x3f, 0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0f, 0xc3, 0xc0, 0x07, 0xe3, 0xe0, 0x03, 0xf1, 0xe0, 0x01,
+    0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0x0f, 0xc0, 0x1f, 0x87, 0xe0, 0x0f,
+    0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e,
+    0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x4b = { image_data_Font_25x27_rle_0x4b,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x4c[80] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙█████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙█████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x3f, 0x02, 0x00, 0xf2, 0x1f, 0x80, 0x00, 0x0f, 0xc0,
+    0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xff,
+    0x7e, 0x02, 0x00, 0xff, 0x3f, 0x02, 0x00, 0xf2, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0,
+    0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00,
+    0xff, 0x3f, 0x02, 0x00, 0xf7, 0x1f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x4c = { image_data_Font_25x27_rle_0x4c,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x4d[73] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ███████████████████████∙∙
+    // ████████████████████████∙
+    // █████████████████████████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ██████∙∙∙∙██████∙∙∙∙█████
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xff, 0x3f, 0x02, 0xff, 0xff, 0x9f, 0x02, 0xff, 0xff, 0xef, 0x03, 0xff, 0xc8, 0xe1,
+    0xf8, 0x7f, 0xf0, 0xfc, 0x3f, 0xf8, 0x7e, 0x1f, 0xfc, 0x3f, 0x0f, 0xfe, 0x1f, 0x87, 0xff, 0x0f,
+    0xc3, 0xff, 0x87, 0xe1, 0xff, 0xc3, 0xf0, 0xff, 0xe1, 0xf8, 0x7f, 0xf0, 0xfc, 0x3f, 0xf8, 0x7e,
+    0x1f, 0xfc, 0x3f, 0x0f, 0xfe, 0x1f, 0x87, 0xff, 0x0f, 0xc3, 0xff, 0x87, 0xe1, 0xff, 0xc3, 0xf0,
+    0xff, 0xe1, 0xf8, 0x7f, 0xf0, 0xfc, 0x3e, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x4d = { image_data_Font_25x27_rle_0x4d,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x4e[72] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xf9, 0x03, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0x02, 0xff, 0xc7, 0x00, 0x7e, 0x0f,
+    0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c,
+    0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0,
+    0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00,
+    0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x4e = { image_data_Font_25x27_rle_0x4e,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x4f[71] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xfa, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0x02, 0xff, 0xd0, 0x00, 0x7e, 0x0f, 0x80,
+    0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01,
+    0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f,
+    0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0x02, 0xff, 0xfa, 0x00,
+    0x3f, 0xff, 0x00, 0x0f, 0xff, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x4f = { image_data_Font_25x27_rle_0x4f,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x50[74] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xcc, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0x0f, 0x80,
+    0x1f, 0x87, 0xc0, 0x0f, 0xc3, 0xe0, 0x07, 0xe1, 0xf0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00,
+    0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x07,
+    0xe0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02,
+    0x00, 0xff, 0x3f, 0x02, 0x00, 0xfe, 0x1f, 0x80, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x50 = { image_data_Font_25x27_rle_0x50,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x51[74] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙███████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙████████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xfa, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0x02, 0xff, 0xc4, 0x00, 0x7e, 0x0f, 0x80,
+    0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01,
+    0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f,
+    0xc7, 0xf0, 0x07, 0xe7, 0xf8, 0x03, 0xff, 0xfc, 0x01, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x1f,
+    0xff, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x0a, 0x00
+};
+static const tImage Font_25x27_rle_0x51 = { image_data_Font_25x27_rle_0x51,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x52[71] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙██████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙███████████████∙∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xbe, 0x03, 0xff, 0xf0, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7c, 0x3f, 0x00,
+    0x3e, 0x1f, 0x80, 0x1f, 0x0f, 0xc0, 0x0f, 0x87, 0xe0, 0x07, 0xc3, 0xf0, 0x03, 0xe1, 0xf8, 0x01,
+    0xf0, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0xc0, 0x1f, 0x07, 0xe0, 0x0f,
+    0x83, 0xf0, 0x07, 0xc1, 0xf8, 0x03, 0xe0, 0xfc, 0x01, 0xf0, 0x7e, 0x00, 0xf8, 0x3f, 0x00, 0x7c,
+    0x1f, 0x80, 0x3e, 0x0f, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x52 = { image_data_Font_25x27_rle_0x52,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x53[69] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙████████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙█████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙██████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xc0, 0x7f, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x3e, 0x0f, 0x00, 0x1f,
+    0x07, 0x80, 0x0f, 0x83, 0xc0, 0x07, 0xc0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xff, 0xe0, 0x00, 0xff,
+    0xfc, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x00, 0x1f, 0xe0, 0x00, 0x03,
+    0xf0, 0x03, 0xc1, 0xf8, 0x01, 0xe0, 0xfc, 0x00, 0xf0, 0x7e, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff,
+    0x00, 0x07, 0xff, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x53 = { image_data_Font_25x27_rle_0x53,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x54[80] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xf1, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x80,
+    0x00, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00,
+    0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8,
+    0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f,
+    0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x54 = { image_data_Font_25x27_rle_0x54,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x55[71] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙████████████████∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xc7, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80,
+    0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01,
+    0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f,
+    0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0x02, 0xff, 0xfa, 0x00,
+    0x3f, 0xff, 0x00, 0x0f, 0xff, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x55 = { image_data_Font_25x27_rle_0x55,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x56[70] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xbf, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80,
+    0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01,
+    0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x0f, 0xc7, 0xc0, 0x07,
+    0xe3, 0xe0, 0x01, 0xff, 0xe0, 0x00, 0x7f, 0xf0, 0x00, 0x3f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x03,
+    0xf0, 0x00, 0x01, 0xf8, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x56 = { image_data_Font_25x27_rle_0x56,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x57[73] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙██████∙∙∙∙█████∙∙∙█████∙
+    // ∙███████████████████████∙
+    // ∙∙█████████████████████∙∙
+    // ∙∙∙███████████████████∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xc7, 0x1f, 0x87, 0xc7, 0xcf, 0xc3, 0xe3, 0xe7, 0xe1, 0xf1, 0xf3, 0xf0, 0xf8, 0xf9,
+    0xf8, 0x7c, 0x7c, 0xfc, 0x3e, 0x3e, 0x7e, 0x1f, 0x1f, 0x3f, 0x0f, 0x8f, 0x9f, 0x87, 0xc7, 0xcf,
+    0xc3, 0xe3, 0xe7, 0xe1, 0xf1, 0xf3, 0xf0, 0xf8, 0xf9, 0xf8, 0x7c, 0x7c, 0xfc, 0x3e, 0x3e, 0x7e,
+    0x1f, 0x1f, 0x3f, 0x0f, 0x8f, 0x9f, 0x87, 0xc7, 0xcf, 0xc3, 0xe3, 0xe7, 0x02, 0xff, 0xff, 0xf1,
+    0x02, 0xff, 0xfc, 0xf0, 0x7f, 0xff, 0xf0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x57 = { image_data_Font_25x27_rle_0x57,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x58[71] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙██████∙∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xbe, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e, 0x0f, 0x80,
+    0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f, 0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x00,
+    0xff, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x3f, 0x07, 0xc0, 0x1f, 0x83, 0xe0, 0x0f,
+    0xc1, 0xf0, 0x07, 0xe0, 0xf8, 0x03, 0xf0, 0x7c, 0x01, 0xf8, 0x3e, 0x00, 0xfc, 0x1f, 0x00, 0x7e,
+    0x0f, 0x80, 0x3f, 0x07, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x58 = { image_data_Font_25x27_rle_0x58,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x59[75] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████∙∙∙∙∙∙██████∙∙∙∙
+    // ∙∙∙∙█████████████████∙∙∙∙
+    // ∙∙∙∙█████████████████∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xe0, 0x03, 0xe0, 0x7e, 0x01, 0xf0, 0x3f, 0x00, 0xf8, 0x1f, 0x80, 0x7c, 0x0f, 0xc0,
+    0x3e, 0x07, 0xe0, 0x1f, 0x03, 0xf0, 0x0f, 0x81, 0xf8, 0x07, 0xc0, 0xfc, 0x03, 0xe0, 0x7e, 0x01,
+    0xf0, 0x3f, 0x00, 0x02, 0xff, 0xf7, 0x80, 0x7f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x00, 0x7c, 0x02,
+    0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00,
+    0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x59 = { image_data_Font_25x27_rle_0x59,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x5a[73] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x06, 0x00, 0xf7, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x02, 0x00, 0xff, 0x1f,
+    0x02, 0x00, 0xcc, 0x0f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xf0, 0x00, 0x1f,
+    0xf0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x0f, 0xc0,
+    0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xff,
+    0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x5a = { image_data_Font_25x27_rle_0x5a,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x5b[107] = {
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    0xfe, 0x00, 0x3f, 0x02, 0x00, 0xfc, 0x1f, 0x80, 0x00, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00,
+    0xfb, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00,
+    0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00,
+    0xfb, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00,
+    0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00,
+    0xfb, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00,
+    0xff, 0x38, 0x02, 0x00, 0xfa, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00
+};
+static const tImage Font_25x27_rle_0x5b = { image_data_Font_25x27_rle_0x5b,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x5c[103] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e,
+    0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfe, 0x03, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff,
+    0x70, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x1e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb,
+    0x03, 0x80, 0x00, 0x01, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff,
+    0x1c, 0x02, 0x00, 0xff, 0x0f, 0x02, 0x00, 0xfb, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x02, 0x00, 0xff,
+    0xe0, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xfb,
+    0x07, 0x80, 0x00, 0x01, 0xc0, 0x04, 0x00
+};
+static const tImage Font_25x27_rle_0x5c = { image_data_Font_25x27_rle_0x5c,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x5d[109] = {
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    0xfe, 0x00, 0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80,
+    0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80,
+    0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80,
+    0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x3f, 0x02, 0x00
+};
+static const tImage Font_25x27_rle_0x5d = { image_data_Font_25x27_rle_0x5d,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x5e[53] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███∙███∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙████∙███∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙███∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███∙∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████∙∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███∙∙∙∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙████∙∙∙∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙███∙∙∙∙∙∙∙∙████∙∙∙∙∙
+    // ∙∙∙∙∙███∙∙∙∙∙∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xff, 0x07, 0x02, 0x00, 0xf2, 0x07, 0x80, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xf0, 0x00,
+    0x01, 0xdc, 0x00, 0x01, 0xee, 0x02, 0x00, 0xe5, 0xe7, 0x80, 0x00, 0x71, 0xc0, 0x00, 0x70, 0xe0,
+    0x00, 0x38, 0x38, 0x00, 0x3c, 0x1c, 0x00, 0x1c, 0x07, 0x00, 0x1e, 0x03, 0x80, 0x0e, 0x01, 0xe0,
+    0x07, 0x00, 0x70, 0x20, 0x00
+};
+static const tImage Font_25x27_rle_0x5e = { image_data_Font_25x27_rle_0x5e,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x5f[10] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙██████████████████∙∙∙∙
+    // ∙∙∙██████████████████∙∙∙∙
+    0x4e, 0x00, 0xf9, 0x0f, 0xff, 0xfc, 0x07, 0xff, 0xfe, 0x00
+};
+static const tImage Font_25x27_rle_0x5f = { image_data_Font_25x27_rle_0x5f,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x60[23] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xff, 0x3c, 0x02, 0x00, 0xff, 0x0f, 0x02, 0x00, 0xfe, 0x03, 0xc0, 0x02, 0x00, 0xff,
+    0xe0, 0x02, 0x00, 0xff, 0x78, 0x43, 0x00
+};
+static const tImage Font_25x27_rle_0x60 = { image_data_Font_25x27_rle_0x60,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x61[56] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xf1, 0x03, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x00, 0xf0, 0xf8, 0x00,
+    0x78, 0x7c, 0x02, 0x00, 0xdf, 0x3e, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0xc0,
+    0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f, 0xfe, 0x00,
+    0x3f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x61 = { image_data_Font_25x27_rle_0x61,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x62[78] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙████████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙████████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x03, 0x00, 0xfb, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c,
+    0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xcf, 0x0f, 0xff, 0x00, 0x07, 0xff,
+    0xc0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f,
+    0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8,
+    0x00, 0xf8, 0x7c, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xfe, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x62 = { image_data_Font_25x27_rle_0x62,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x63[57] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xef, 0x01, 0xff, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x00, 0xf8, 0xf0, 0x00,
+    0x7c, 0x78, 0x00, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0,
+    0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xf2, 0xf8, 0xf0, 0x00, 0x7c, 0x78, 0x00, 0x3f,
+    0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xfe, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x63 = { image_data_Font_25x27_rle_0x63,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x64[78] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙███████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙█████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙████████████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xfe, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff,
+    0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xcc, 0x0f, 0x80, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xe0,
+    0x01, 0xff, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00,
+    0x0f, 0x8f, 0x80, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00,
+    0x7c, 0x7c, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x64 = { image_data_Font_25x27_rle_0x64,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x65[55] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xdf, 0x01, 0xfe, 0x00, 0x01, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x00, 0xf8, 0x70, 0x00,
+    0x7c, 0x38, 0x00, 0x3e, 0x1c, 0x00, 0x1f, 0x0e, 0x00, 0x0f, 0xff, 0x00, 0x07, 0xff, 0x80, 0x03,
+    0xff, 0xc0, 0x01, 0xf0, 0x02, 0x00, 0xf2, 0xf8, 0xf0, 0x00, 0x7c, 0x78, 0x00, 0x3f, 0xfc, 0x00,
+    0x0f, 0xfe, 0x00, 0x03, 0xfe, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x65 = { image_data_Font_25x27_rle_0x65,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x66[78] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xe3, 0x1f, 0xe0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf8, 0x00, 0x07, 0xc0, 0x00, 0x03,
+    0xe0, 0x00, 0x01, 0xf0, 0x00, 0x03, 0xff, 0x80, 0x01, 0xff, 0xc0, 0x00, 0xff, 0xe0, 0x00, 0x1f,
+    0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00,
+    0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00,
+    0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x66 = { image_data_Font_25x27_rle_0x66,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x67[67] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙∙███∙∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙∙███∙∙∙∙∙██████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    0x16, 0x00, 0xd2, 0x07, 0xff, 0xc0, 0x07, 0xff, 0xe0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00,
+    0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07,
+    0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x1f,
+    0xff, 0x02, 0x00, 0xf1, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x07, 0x07, 0xe0, 0x03, 0x83, 0xf0, 0x01,
+    0xff, 0xf8, 0x00
+};
+static const tImage Font_25x27_rle_0x67 = { image_data_Font_25x27_rle_0x67,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x68[79] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x03, 0x00, 0xfb, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c,
+    0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xce, 0x0f, 0xff, 0x80, 0x07, 0xff,
+    0xc0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f,
+    0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07, 0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8,
+    0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x68 = { image_data_Font_25x27_rle_0x68,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x69[73] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x08, 0x00, 0xff, 0x7c, 0x02,
+    0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00,
+    0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff,
+    0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xf0,
+    0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xfc, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x69 = { image_data_Font_25x27_rle_0x69,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x6a[86] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙███∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙███████████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙███████████∙∙∙∙∙∙∙∙∙∙
+    0x07, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x08, 0x00, 0xff, 0x7c, 0x02,
+    0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00,
+    0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff,
+    0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0,
+    0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xf4, 0x7c, 0x00, 0x0e, 0x3e, 0x00, 0x07,
+    0xff, 0x00, 0x03, 0xff, 0x80, 0x00
+};
+static const tImage Font_25x27_rle_0x6a = { image_data_Font_25x27_rle_0x6a,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x6b[79] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙█████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x03, 0x00, 0xfe, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff,
+    0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xcb, 0x0f, 0x80, 0x00, 0x07, 0xc7, 0xc0, 0x03, 0xe3,
+    0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x7c, 0x00, 0x1f, 0xfc,
+    0x00, 0x0f, 0xfe, 0x00, 0x07, 0xff, 0x80, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8,
+    0x00, 0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x6b = { image_data_Font_25x27_rle_0x6b,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x6c[84] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x04, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00,
+    0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00,
+    0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0,
+    0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f,
+    0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf8, 0x02, 0x00,
+    0xff, 0xfc, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x6c = { image_data_Font_25x27_rle_0x6c,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x6d[52] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙████████████████████∙∙∙
+    // ∙∙█████████████████████∙∙
+    // ∙∙█████████████████████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xf9, 0x7f, 0xff, 0xf8, 0x3f, 0xff, 0xfe, 0x1f, 0x02, 0xff, 0xf3, 0x0f, 0x8f, 0x8f,
+    0x87, 0xc7, 0xc7, 0xc3, 0xe3, 0xe3, 0xe1, 0xf1, 0xf1, 0xf0, 0x03, 0xf8, 0x03, 0x7c, 0x03, 0x3e,
+    0x03, 0x1f, 0xf3, 0x0f, 0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0xe3, 0xe3, 0xe1, 0xf1, 0xf1, 0xf0,
+    0x03, 0xf8, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x6d = { image_data_Font_25x27_rle_0x6d,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x6e[55] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙█████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xce, 0x0f, 0xff, 0x80, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00,
+    0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07,
+    0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e,
+    0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x6e = { image_data_Font_25x27_rle_0x6e,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x6f[54] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xcf, 0x03, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00,
+    0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07,
+    0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f, 0xfe, 0x00, 0x1f,
+    0xfe, 0x00, 0x07, 0xfe, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x6f = { image_data_Font_25x27_rle_0x6f,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x70[67] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xc6, 0x07, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x00, 0xf8, 0xf8, 0x00,
+    0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07, 0xc7, 0xc0, 0x03,
+    0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3f, 0xfe, 0x00, 0x1f,
+    0xfe, 0x00, 0x0f, 0xfe, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff,
+    0xf8, 0x02, 0x00
+};
+static const tImage Font_25x27_rle_0x70 = { image_data_Font_25x27_rle_0x70,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x71[67] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙█████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    0x16, 0x00, 0xc5, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xe0, 0x03, 0xff, 0xf0, 0x01, 0xf0, 0xf8, 0x00,
+    0xf8, 0x7c, 0x00, 0x7c, 0x3e, 0x00, 0x3e, 0x1f, 0x00, 0x1f, 0x0f, 0x80, 0x0f, 0x87, 0xc0, 0x07,
+    0xc3, 0xe0, 0x03, 0xe1, 0xf0, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0x7c, 0x00, 0x7f, 0xfe, 0x00, 0x1f,
+    0xff, 0x00, 0x07, 0xff, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00,
+    0xfe, 0xf8, 0x00
+};
+static const tImage Font_25x27_rle_0x71 = { image_data_Font_25x27_rle_0x71,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x72[61] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xf5, 0x01, 0xff, 0x80, 0x00, 0xff, 0xc0, 0x00, 0x7f, 0xe0, 0x00, 0x3e, 0x02, 0x00,
+    0xff, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0,
+    0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xff, 0x1f,
+    0x02, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x72 = { image_data_Font_25x27_rle_0x72,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x73[56] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙███∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xf2, 0x03, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xf0, 0x00, 0xf8, 0x70, 0x00,
+    0x7c, 0x02, 0x00, 0xff, 0x3e, 0x02, 0x00, 0xe2, 0x1f, 0xfc, 0x00, 0x0f, 0xff, 0x00, 0x03, 0xff,
+    0xc0, 0x00, 0x7f, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0xf0, 0xf8, 0x00, 0x78, 0x7c, 0x00, 0x3f, 0xfe,
+    0x00, 0x1f, 0xfe, 0x00, 0x07, 0xfe, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x73 = { image_data_Font_25x27_rle_0x73,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x74[70] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙██████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x0d, 0x00, 0xec, 0x07, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xff, 0x00, 0x01,
+    0xff, 0x80, 0x00, 0xff, 0xc0, 0x00, 0x1f, 0x02, 0x00, 0xf5, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x00,
+    0x03, 0xe0, 0x00, 0x01, 0xf0, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff,
+    0x3e, 0x02, 0x00, 0xff, 0x1f, 0x02, 0x00, 0xf8, 0x0f, 0x80, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf0,
+    0x02, 0x00, 0xff, 0xf8, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x74 = { image_data_Font_25x27_rle_0x74,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x75[54] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xcf, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00,
+    0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07, 0xc7, 0xc0, 0x03,
+    0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7c, 0x7c, 0x00, 0x3f, 0xfe, 0x00, 0x1f,
+    0xfe, 0x00, 0x03, 0xfe, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x75 = { image_data_Font_25x27_rle_0x75,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x76[55] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙███∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███████∙∙████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xd2, 0x07, 0xe1, 0xc0, 0x03, 0xf0, 0xe0, 0x01, 0xf8, 0x70, 0x00, 0xfc, 0x38, 0x00,
+    0x7e, 0x1c, 0x00, 0x3f, 0x0e, 0x00, 0x1f, 0x87, 0x00, 0x0f, 0xc3, 0x80, 0x07, 0xe1, 0xc0, 0x03,
+    0xf0, 0xe0, 0x01, 0xfc, 0xf0, 0x00, 0x7f, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x03,
+    0xf8, 0x02, 0x00, 0xff, 0xf8, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x76 = { image_data_Font_25x27_rle_0x76,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x77[51] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████∙∙∙█████∙∙∙█████∙∙
+    // ∙∙█████████████████████∙∙
+    // ∙∙█████████████████████∙∙
+    // ∙∙∙███████████████████∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0x03, 0x7c, 0x03, 0x3e, 0x03, 0x1f, 0xf3, 0x0f, 0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3,
+    0xe3, 0xe3, 0xe1, 0xf1, 0xf1, 0xf0, 0x03, 0xf8, 0x03, 0x7c, 0x03, 0x3e, 0x03, 0x1f, 0xf9, 0x0f,
+    0x8f, 0x8f, 0x87, 0xc7, 0xc7, 0xc3, 0x02, 0xff, 0xff, 0xe1, 0x02, 0xff, 0xfc, 0xf0, 0x7f, 0xff,
+    0xf0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x77 = { image_data_Font_25x27_rle_0x77,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x78[55] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙███████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙██████∙∙∙∙█████∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xce, 0x0f, 0xc3, 0xe0, 0x07, 0xe1, 0xf0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00,
+    0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00, 0x1f, 0x0f, 0x00, 0x0f, 0xff, 0x80, 0x03, 0xff, 0x80, 0x03,
+    0xff, 0xe0, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x7c, 0x00, 0xfc, 0x3e, 0x00, 0x7e, 0x1f, 0x00, 0x3f,
+    0x0f, 0x80, 0x1f, 0x87, 0xc0, 0x0d, 0x00
+};
+static const tImage Font_25x27_rle_0x78 = { image_data_Font_25x27_rle_0x78,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x79[67] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙████████████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙███∙∙∙∙∙█████∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████████████∙∙∙∙∙∙
+    0x16, 0x00, 0xd2, 0x07, 0xc7, 0xc0, 0x03, 0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00,
+    0x7c, 0x7c, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x8f, 0x80, 0x07, 0xc7, 0xc0, 0x03,
+    0xe3, 0xe0, 0x01, 0xf1, 0xf0, 0x00, 0xf8, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x0f,
+    0xff, 0x02, 0x00, 0xf1, 0x0f, 0x80, 0x00, 0x07, 0xc0, 0x03, 0x83, 0xe0, 0x01, 0xc1, 0xf0, 0x00,
+    0xff, 0xf8, 0x00
+};
+static const tImage Font_25x27_rle_0x79 = { image_data_Font_25x27_rle_0x79,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x7a[58] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙████████████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x16, 0x00, 0xf7, 0x07, 0xff, 0x80, 0x03, 0xff, 0xc0, 0x01, 0xff, 0xe0, 0x02, 0x00, 0xea, 0xf0,
+    0x00, 0x01, 0xf8, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x03, 0xfc, 0x00, 0x03, 0xfc, 0x00,
+    0x03, 0xfc, 0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xf8,
+    0x3f, 0xfc, 0x00, 0x1f, 0xfe, 0x00, 0x0f, 0xff, 0x0e, 0x00
+};
+static const tImage Font_25x27_rle_0x7a = { image_data_Font_25x27_rle_0x7a,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x7b[104] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙
+    0xf8, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80, 0x00, 0x01,
+    0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff,
+    0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xf5, 0x03, 0x80, 0x00, 0x0f,
+    0xc0, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xf0, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02,
+    0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x02,
+    0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02, 0x00, 0xff, 0x1c, 0x02,
+    0x00, 0xfa, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x00
+};
+static const tImage Font_25x27_rle_0x7b = { image_data_Font_25x27_rle_0x7b,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x7c[109] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    0xfe, 0x00, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80,
+    0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80,
+    0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80,
+    0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00
+};
+static const tImage Font_25x27_rle_0x7c = { image_data_Font_25x27_rle_0x7c,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x7d[109] = {
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙█████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙███∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙██████∙∙∙∙∙∙∙∙∙∙∙
+    0xfe, 0x00, 0xfc, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80,
+    0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80,
+    0x00, 0x01, 0xf8, 0x02, 0x00, 0xff, 0x7c, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x07, 0x02, 0x00, 0xfb, 0x03, 0x80,
+    0x00, 0x01, 0xc0, 0x02, 0x00, 0xff, 0xe0, 0x02, 0x00, 0xff, 0x70, 0x02, 0x00, 0xff, 0x38, 0x02,
+    0x00, 0xff, 0x1c, 0x02, 0x00, 0xff, 0x7e, 0x02, 0x00, 0xff, 0x3f, 0x02, 0x00
+};
+static const tImage Font_25x27_rle_0x7d = { image_data_Font_25x27_rle_0x7d,
+    25, 27, 8, IMAGE_RLE};
+
+static const uint8_t image_data_Font_25x27_rle_0x7e[19] = {
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙█████∙∙∙∙∙∙∙██∙∙∙∙∙
+    // ∙∙∙∙∙████████∙∙∙∙███∙∙∙∙∙
+    // ∙∙∙∙∙███████████████∙∙∙∙∙
+    // ∙∙∙∙∙███∙∙∙████████∙∙∙∙∙∙
+    // ∙∙∙∙∙██∙∙∙∙∙∙█████∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
+    0x20, 0x00, 0xf2, 0xf8, 0x0c, 0x00, 0xff, 0x0e, 0x00, 0x7f, 0xff, 0x00, 0x38, 0xff, 0x00, 0x18,
+    0x1f, 0x27, 0x00
+};
+static const tImage Font_25x27_rle_0x7e = { image_data_Font_25x27_rle_0x7e,
+    25, 27, 8, IMAGE_RLE};
+
+
+static const tChar Font_25x27_rle_array[] = {
+  // character: ' '
+  {0x20, &Font_25x27_rle_0x20},
+  // character: '!'
+  {0x21, &Font_25x27_rle_0x21},
+  // character: '"'
+  {0x22, &Font_25x27_rle_0x22},
+  // character: '#'
+  {0x23, &Font_25x27_rle_0x23},
+  // character: '$'
+  {0x24, &Font_25x27_rle_0x24},
+  // character: '%'
+  {0x25, &Font_25x27_rle_0x25},
+  // character: '&'
+  {0x26, &Font_25x27_rle_0x26},
+  // character: '''
+  {0x27, &Font_25x27_rle_0x27},
+  // character: '('
+  {0x28, &Font_25x27_rle_0x28},
+  // character: ')'
+  {0x29, &Font_25x27_rle_0x29},
+  // character: '*'
+  {0x2a, &Font_25x27_rle_0x2a},
+  // character: '+'
+  {0x2b, &Font_25x27_rle_0x2b},
+  // character: ','
+  {0x2c, &Font_25x27_rle_0x2c},
+  // character: '-'
+  {0x2d, &Font_25x27_rle_0x2d},
+  // character: '.'
+  {0x2e, &Font_25x27_rle_0x2e},
+  // character: '/'
+  {0x2f, &Font_25x27_rle_0x2f},
+  // character: '0'
+  {0x30, &Font_25x27_rle_0x30},
+  // character: '1'
+  {0x31, &Font_25x27_rle_0x31},
+  // character: '2'
+  {0x32, &Font_25x27_rle_0x32},
+  // character: '3'
+  {0x33, &Font_25x27_rle_0x33},
+  // character: '4'
+  {0x34, &Font_25x27_rle_0x34},
+  // character: '5'
+  {0x35, &Font_25x27_rle_0x35},
+  // character: '6'
+  {0x36, &Font_25x27_rle_0x36},
+  // character: '7'
+  {0x37, &Font_25x27_rle_0x37},
+  // character: '8'
+  {0x38, &Font_25x27_rle_0x38},
+  // character: '9'
+  {0x39, &Font_25x27_rle_0x39},
+  // character: ':'
+  {0x3a, &Font_25x27_rle_0x3a},
+  // character: ';'
+  {0x3b, &Font_25x27_rle_0x3b},
+  // character: '<'
+  {0x3c, &Font_25x27_rle_0x3c},
+  // character: '='
+  {0x3d, &Font_25x27_rle_0x3d},
+  // character: '>'
+  {0x3e, &Font_25x27_rle_0x3e},
+  // character: '?'
+  {0x3f, &Font_25x27_rle_0x3f},
+  // character: '@'
+  {0x40, &Font_25x27_rle_0x40},
+  // character: 'A'
+  {0x41, &Font_25x27_rle_0x41},
+  // character: 'B'
+  {0x42, &Font_25x27_rle_0x42},
+  // character: 'C'
+  {0x43, &Font_25x27_rle_0x43},
+  // character: 'D'
+  {0x44, &Font_25x27_rle_0x44},
+  // character: 'E'
+  {0x45, &Font_25x27_rle_0x45},
+  // character: 'F'
+  {0x46, &Font_25x27_rle_0x46},
+  // character: 'G'
+  {0x47, &Font_25x27_rle_0x47},
+  // character: 'H'
+  {0x48, &Font_25x27_rle_0x48},
+  // character: 'I'
+  {0x49, &Font_25x27_rle_0x49},
+  // character: 'J'
+  {0x4a, &Font_25x27_rle_0x4a},
+  // character: 'K'
+  {0x4b, &Font_25x27_rle_0x4b},
+  // character: 'L'
+  {0x4c, &Font_25x27_rle_0x4c},
+  // character: 'M'
+  {0x4d, &Font_25x27_rle_0x4d},
+  // character: 'N'
+  {0x4e, &Font_25x27_rle_0x4e},
+  // character: 'O'
+  {0x4f, &Font_25x27_rle_0x4f},
+  // character: 'P'
+  {0x50, &Font_25x27_rle_0x50},
+  // character: 'Q'
+  {0x51, &Font_25x27_rle_0x51},
+  // character: 'R'
+  {0x52, &Font_25x27_rle_0x52},
+  // character: 'S'
+  {0x53, &Font_25x27_rle_0x53},
+  // character: 'T'
+  {0x54, &Font_25x27_rle_0x54},
+  // character: 'U'
+  {0x55, &Font_25x27_rle_0x55},
+  // character: 'V'
+  {0x56, &Font_25x27_rle_0x56},
+  // character: 'W'
+  {0x57, &Font_25x27_rle_0x57},
+  // character: 'X'
+  {0x58, &Font_25x27_rle_0x58},
+  // character: 'Y'
+  {0x59, &Font_25x27_rle_0x59},
+  // character: 'Z'
+  {0x5a, &Font_25x27_rle_0x5a},
+  // character: '['
+  {0x5b, &Font_25x27_rle_0x5b},
+  // character: '\\'
+  {0x5c, &Font_25x27_rle_0x5c},
+  // character: ']'
+  {0x5d, &Font_25x27_rle_0x5d},
+  // character: '^'
+  {0x5e, &Font_25x27_rle_0x5e},
+  // character: '_'
+  {0x5f, &Font_25x27_rle_0x5f},
+  // character: '`'
+  {0x60, &Font_25x27_rle_0x60},
+  // character: 'a'
+  {0x61, &Font_25x27_rle_0x61},
+  // character: 'b'
+  {0x62, &Font_25x27_rle_0x62},
+  // character: 'c'
+  {0x63, &Font_25x27_rle_0x63},
+  // character: 'd'
+  {0x64, &Font_25x27_rle_0x64},
+  // character: 'e'
+  {0x65, &Font_25x27_rle_0x65},
+  // character: 'f'
+  {0x66, &Font_25x27_rle_0x66},
+  // character: 'g'
+  {0x67, &Font_25x27_rle_0x67},
+  // character: 'h'
+  {0x68, &Font_25x27_rle_0x68},
+  // character: 'i'
+  {0x69, &Font_25x27_rle_0x69},
+  // character: 'j'
+  {0x6a, &Font_25x27_rle_0x6a},
+  // character: 'k'
+  {0x6b, &Font_25x27_rle_0x6b},
+  // character: 'l'
+  {0x6c, &Font_25x27_rle_0x6c},
+  // character: 'm'
+  {0x6d, &Font_25x27_rle_0x6d},
+  // character: 'n'
+  {0x6e, &Font_25x27_rle_0x6e},
+  // character: 'o'
+  {0x6f, &Font_25x27_rle_0x6f},
+  // character: 'p'
+  {0x70, &Font_25x27_rle_0x70},
+  // character: 'q'
+  {0x71, &Font_25x27_rle_0x71},
+  // character: 'r'
+  {0x72, &Font_25x27_rle_0x72},
+  // character: 's'
+  {0x73, &Font_25x27_rle_0x73},
+  // character: 't'
+  {0x74, &Font_25x27_rle_0x74},
+  // character: 'u'
+  {0x75, &Font_25x27_rle_0x75},
+  // character: 'v'
+  {0x76, &Font_25x27_rle_0x76},
+  // character: 'w'
+  {0x77, &Font_25x27_rle_0x77},
+  // character: 'x'
+  {0x78, &Font_25x27_rle_0x78},
+  // character: 'y'
+  {0x79, &Font_25x27_rle_0x79},
+  // character: 'z'
+  {0x7a, &Font_25x27_rle_0x7a},
+  // character: '{'
+  {0x7b, &Font_25x27_rle_0x7b},
+  // character: '|'
+  {0x7c, &Font_25x27_rle_0x7c},
+  // character: '}'
+  {0x7d, &Font_25x27_rle_0x7d},
+  // character: '~'
+  {0x7e, &Font_25x27_rle_0x7e}
+};
+
+
+const tFont Font_25x27_rle = { 95, Font_25x27_rle_array, .first_code = 0x20, .dense = 95 };
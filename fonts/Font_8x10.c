@@ -57,7 +57,7 @@ static const uint8_t image_data_Font_8x10_0x20[10] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_8x10_0x20 = { image_data_Font_8x10_0x20,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -75,7 +75,7 @@ static const uint8_t image_data_Font_8x10_0x21[10] = {
   0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x21 = { image_data_Font_8x10_0x21,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -93,7 +93,7 @@ static const uint8_t image_data_Font_8x10_0x22[10] = {
   0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_8x10_0x22 = { image_data_Font_8x10_0x22,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -111,7 +111,7 @@ static const uint8_t image_data_Font_8x10_0x23[10] = {
   0x0a, 0x0a, 0x0a, 0x7f, 0x14, 0xfe, 0x28, 0x28, 0x28, 0x00
 };
 static const tImage Font_8x10_0x23 = { image_data_Font_8x10_0x23,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -129,7 +129,7 @@ static const uint8_t image_data_Font_8x10_0x24[10] = {
   0x10, 0x10, 0x3c, 0x50, 0x30, 0x18, 0x14, 0x78, 0x10, 0x10
 };
 static const tImage Font_8x10_0x24 = { image_data_Font_8x10_0x24,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -147,7 +147,7 @@ static const uint8_t image_data_Font_8x10_0x25[10] = {
   0x42, 0xa4, 0xa8, 0xa8, 0x54, 0x2a, 0x2a, 0x4a, 0x84, 0x00
 };
 static const tImage Font_8x10_0x25 = { image_data_Font_8x10_0x25,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -165,7 +165,7 @@ static const uint8_t image_data_Font_8x10_0x26[10] = {
   0x00, 0x30, 0x48, 0x48, 0x32, 0x4a, 0x44, 0x3a, 0x00, 0x00
 };
 static const tImage Font_8x10_0x26 = { image_data_Font_8x10_0x26,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -183,7 +183,7 @@ static const uint8_t image_data_Font_8x10_0x27[10] = {
   0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_8x10_0x27 = { image_data_Font_8x10_0x27,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -201,7 +201,7 @@ static const uint8_t image_data_Font_8x10_0x28[10] = {
   0x08, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x08
 };
 static const tImage Font_8x10_0x28 = { image_data_Font_8x10_0x28,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -219,7 +219,7 @@ static const uint8_t image_data_Font_8x10_0x29[10] = {
   0x20, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x20
 };
 static const tImage Font_8x10_0x29 = { image_data_Font_8x10_0x29,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -237,7 +237,7 @@ static const uint8_t image_data_Font_8x10_0x2a[10] = {
   0x00, 0x10, 0x92, 0x54, 0x38, 0x54, 0x92, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x2a = { image_data_Font_8x10_0x2a,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -255,7 +255,7 @@ static const uint8_t image_data_Font_8x10_0x2b[10] = {
   0x00, 0x00, 0x18, 0x18, 0x7e, 0x7e, 0x18, 0x18, 0x00, 0x00
 };
 static const tImage Font_8x10_0x2b = { image_data_Font_8x10_0x2b,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -273,7 +273,7 @@ static const uint8_t image_data_Font_8x10_0x2c[10] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x10, 0x00
 };
 static const tImage Font_8x10_0x2c = { image_data_Font_8x10_0x2c,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -291,7 +291,7 @@ static const uint8_t image_data_Font_8x10_0x2d[10] = {
   0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_8x10_0x2d = { image_data_Font_8x10_0x2d,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -309,7 +309,7 @@ static const uint8_t image_data_Font_8x10_0x2e[10] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00
 };
 static const tImage Font_8x10_0x2e = { image_data_Font_8x10_0x2e,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -327,7 +327,7 @@ static const uint8_t image_data_Font_8x10_0x2f[10] = {
   0x04, 0x04, 0x08, 0x08, 0x08, 0x10, 0x10, 0x10, 0x20, 0x20
 };
 static const tImage Font_8x10_0x2f = { image_data_Font_8x10_0x2f,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -345,7 +345,7 @@ static const uint8_t image_data_Font_8x10_0x30[10] = {
   0x00, 0x18, 0x24, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00
 };
 static const tImage Font_8x10_0x30 = { image_data_Font_8x10_0x30,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -363,7 +363,7 @@ static const uint8_t image_data_Font_8x10_0x31[10] = {
   0x00, 0x08, 0x18, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x31 = { image_data_Font_8x10_0x31,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -381,7 +381,7 @@ static const uint8_t image_data_Font_8x10_0x32[10] = {
   0x00, 0x38, 0x04, 0x04, 0x08, 0x10, 0x20, 0x3c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x32 = { image_data_Font_8x10_0x32,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -399,7 +399,7 @@ static const uint8_t image_data_Font_8x10_0x33[10] = {
   0x00, 0x38, 0x04, 0x04, 0x18, 0x04, 0x04, 0x38, 0x00, 0x00
 };
 static const tImage Font_8x10_0x33 = { image_data_Font_8x10_0x33,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -417,7 +417,7 @@ static const uint8_t image_data_Font_8x10_0x34[10] = {
   0x00, 0x04, 0x0c, 0x14, 0x24, 0x3e, 0x04, 0x04, 0x00, 0x00
 };
 static const tImage Font_8x10_0x34 = { image_data_Font_8x10_0x34,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -435,7 +435,7 @@ static const uint8_t image_data_Font_8x10_0x35[10] = {
   0x00, 0x3c, 0x20, 0x38, 0x04, 0x04, 0x04, 0x38, 0x00, 0x00
 };
 static const tImage Font_8x10_0x35 = { image_data_Font_8x10_0x35,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -453,7 +453,7 @@ static const uint8_t image_data_Font_8x10_0x36[10] = {
   0x00, 0x18, 0x20, 0x20, 0x38, 0x24, 0x24, 0x18, 0x00, 0x00
 };
 static const tImage Font_8x10_0x36 = { image_data_Font_8x10_0x36,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -471,7 +471,7 @@ static const uint8_t image_data_Font_8x10_0x37[10] = {
   0x00, 0x3c, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x00, 0x00
 };
 static const tImage Font_8x10_0x37 = { image_data_Font_8x10_0x37,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -489,7 +489,7 @@ static const uint8_t image_data_Font_8x10_0x38[10] = {
   0x00, 0x18, 0x24, 0x24, 0x18, 0x24, 0x24, 0x18, 0x00, 0x00
 };
 static const tImage Font_8x10_0x38 = { image_data_Font_8x10_0x38,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -507,7 +507,7 @@ static const uint8_t image_data_Font_8x10_0x39[10] = {
   0x00, 0x18, 0x24, 0x24, 0x1c, 0x04, 0x04, 0x18, 0x00, 0x00
 };
 static const tImage Font_8x10_0x39 = { image_data_Font_8x10_0x39,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -525,7 +525,7 @@ static const uint8_t image_data_Font_8x10_0x3a[10] = {
   0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x3a = { image_data_Font_8x10_0x3a,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -543,7 +543,7 @@ static const uint8_t image_data_Font_8x10_0x3b[10] = {
   0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x20, 0x00
 };
 static const tImage Font_8x10_0x3b = { image_data_Font_8x10_0x3b,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -561,7 +561,7 @@ static const uint8_t image_data_Font_8x10_0x3c[10] = {
   0x00, 0x00, 0x00, 0x02, 0x1c, 0x20, 0x1c, 0x02, 0x00, 0x00
 };
 static const tImage Font_8x10_0x3c = { image_data_Font_8x10_0x3c,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -579,7 +579,7 @@ static const uint8_t image_data_Font_8x10_0x3d[10] = {
   0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_8x10_0x3d = { image_data_Font_8x10_0x3d,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -597,7 +597,7 @@ static const uint8_t image_data_Font_8x10_0x3e[10] = {
   0x00, 0x00, 0x00, 0x20, 0x1c, 0x02, 0x1c, 0x20, 0x00, 0x00
 };
 static const tImage Font_8x10_0x3e = { image_data_Font_8x10_0x3e,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -615,7 +615,7 @@ static const uint8_t image_data_Font_8x10_0x3f[10] = {
   0x00, 0x38, 0x04, 0x04, 0x08, 0x10, 0x00, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x3f = { image_data_Font_8x10_0x3f,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -633,7 +633,7 @@ static const uint8_t image_data_Font_8x10_0x40[10] = {
   0x00, 0x3c, 0x42, 0x9d, 0xa5, 0xa5, 0x9e, 0x40, 0x3c, 0x00
 };
 static const tImage Font_8x10_0x40 = { image_data_Font_8x10_0x40,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -651,7 +651,7 @@ static const uint8_t image_data_Font_8x10_0x41[10] = {
   0x00, 0x18, 0x18, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x00, 0x00
 };
 static const tImage Font_8x10_0x41 = { image_data_Font_8x10_0x41,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -669,7 +669,7 @@ static const uint8_t image_data_Font_8x10_0x42[10] = {
   0x00, 0x78, 0x44, 0x44, 0x78, 0x44, 0x44, 0x78, 0x00, 0x00
 };
 static const tImage Font_8x10_0x42 = { image_data_Font_8x10_0x42,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -687,7 +687,7 @@ static const uint8_t image_data_Font_8x10_0x43[10] = {
   0x00, 0x1e, 0x20, 0x40, 0x40, 0x40, 0x20, 0x1e, 0x00, 0x00
 };
 static const tImage Font_8x10_0x43 = { image_data_Font_8x10_0x43,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -705,7 +705,7 @@ static const uint8_t image_data_Font_8x10_0x44[10] = {
   0x00, 0x78, 0x44, 0x42, 0x42, 0x42, 0x44, 0x78, 0x00, 0x00
 };
 static const tImage Font_8x10_0x44 = { image_data_Font_8x10_0x44,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -723,7 +723,7 @@ static const uint8_t image_data_Font_8x10_0x45[10] = {
   0x00, 0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x7c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x45 = { image_data_Font_8x10_0x45,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -741,7 +741,7 @@ static const uint8_t image_data_Font_8x10_0x46[10] = {
   0x00, 0x7c, 0x40, 0x40, 0x7c, 0x40, 0x40, 0x40, 0x00, 0x00
 };
 static const tImage Font_8x10_0x46 = { image_data_Font_8x10_0x46,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -759,7 +759,7 @@ static const uint8_t image_data_Font_8x10_0x47[10] = {
   0x00, 0x1e, 0x20, 0x40, 0x4e, 0x42, 0x22, 0x1e, 0x00, 0x00
 };
 static const tImage Font_8x10_0x47 = { image_data_Font_8x10_0x47,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -777,7 +777,7 @@ static const uint8_t image_data_Font_8x10_0x48[10] = {
   0x00, 0x42, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x42, 0x00, 0x00
 };
 static const tImage Font_8x10_0x48 = { image_data_Font_8x10_0x48,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -795,7 +795,7 @@ static const uint8_t image_data_Font_8x10_0x49[10] = {
   0x00, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00
 };
 static const tImage Font_8x10_0x49 = { image_data_Font_8x10_0x49,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -813,7 +813,7 @@ static const uint8_t image_data_Font_8x10_0x4a[10] = {
   0x00, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x30, 0x00, 0x00
 };
 static const tImage Font_8x10_0x4a = { image_data_Font_8x10_0x4a,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -831,7 +831,7 @@ static const uint8_t image_data_Font_8x10_0x4b[10] = {
   0x00, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x00, 0x00
 };
 static const tImage Font_8x10_0x4b = { image_data_Font_8x10_0x4b,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -849,7 +849,7 @@ static const uint8_t image_data_Font_8x10_0x4c[10] = {
   0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x4c = { image_data_Font_8x10_0x4c,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -867,7 +867,7 @@ static const uint8_t image_data_Font_8x10_0x4d[10] = {
   0x00, 0xc6, 0xc6, 0xaa, 0xaa, 0x92, 0x92, 0x82, 0x00, 0x00
 };
 static const tImage Font_8x10_0x4d = { image_data_Font_8x10_0x4d,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -885,7 +885,7 @@ static const uint8_t image_data_Font_8x10_0x4e[10] = {
   0x00, 0x42, 0x62, 0x52, 0x4a, 0x46, 0x42, 0x42, 0x00, 0x00
 };
 static const tImage Font_8x10_0x4e = { image_data_Font_8x10_0x4e,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -903,7 +903,7 @@ static const uint8_t image_data_Font_8x10_0x4f[10] = {
   0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00
 };
 static const tImage Font_8x10_0x4f = { image_data_Font_8x10_0x4f,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -921,7 +921,7 @@ static const uint8_t image_data_Font_8x10_0x50[10] = {
   0x00, 0x78, 0x44, 0x44, 0x44, 0x78, 0x40, 0x40, 0x00, 0x00
 };
 static const tImage Font_8x10_0x50 = { image_data_Font_8x10_0x50,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -939,7 +939,7 @@ static const uint8_t image_data_Font_8x10_0x51[10] = {
   0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38, 0x0e, 0x00
 };
 static const tImage Font_8x10_0x51 = { image_data_Font_8x10_0x51,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -957,7 +957,7 @@ static const uint8_t image_data_Font_8x10_0x52[10] = {
   0x00, 0x70, 0x48, 0x48, 0x70, 0x50, 0x48, 0x44, 0x00, 0x00
 };
 static const tImage Font_8x10_0x52 = { image_data_Font_8x10_0x52,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -975,7 +975,7 @@ static const uint8_t image_data_Font_8x10_0x53[10] = {
   0x00, 0x3c, 0x40, 0x40, 0x38, 0x04, 0x04, 0x78, 0x00, 0x00
 };
 static const tImage Font_8x10_0x53 = { image_data_Font_8x10_0x53,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -993,7 +993,7 @@ static const uint8_t image_data_Font_8x10_0x54[10] = {
   0x00, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x54 = { image_data_Font_8x10_0x54,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1011,7 +1011,7 @@ static const uint8_t image_data_Font_8x10_0x55[10] = {
   0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x55 = { image_data_Font_8x10_0x55,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1029,7 +1029,7 @@ static const uint8_t image_data_Font_8x10_0x56[10] = {
   0x00, 0x44, 0x44, 0x44, 0x28, 0x28, 0x28, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x56 = { image_data_Font_8x10_0x56,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1047,7 +1047,7 @@ static const uint8_t image_data_Font_8x10_0x57[10] = {
   0x00, 0x92, 0x92, 0xaa, 0xaa, 0xaa, 0xaa, 0x44, 0x00, 0x00
 };
 static const tImage Font_8x10_0x57 = { image_data_Font_8x10_0x57,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1065,7 +1065,7 @@ static const uint8_t image_data_Font_8x10_0x58[10] = {
   0x00, 0x44, 0x28, 0x28, 0x10, 0x28, 0x28, 0x44, 0x00, 0x00
 };
 static const tImage Font_8x10_0x58 = { image_data_Font_8x10_0x58,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1083,7 +1083,7 @@ static const uint8_t image_data_Font_8x10_0x59[10] = {
   0x00, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x59 = { image_data_Font_8x10_0x59,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1101,7 +1101,7 @@ static const uint8_t image_data_Font_8x10_0x5a[10] = {
   0x00, 0x7c, 0x04, 0x08, 0x10, 0x20, 0x40, 0x7c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x5a = { image_data_Font_8x10_0x5a,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1119,7 +1119,7 @@ static const uint8_t image_data_Font_8x10_0x5b[10] = {
   0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38
 };
 static const tImage Font_8x10_0x5b = { image_data_Font_8x10_0x5b,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1137,7 +1137,7 @@ static const uint8_t image_data_Font_8x10_0x5c[10] = {
   0x20, 0x20, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x04, 0x04
 };
 static const tImage Font_8x10_0x5c = { image_data_Font_8x10_0x5c,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1155,7 +1155,7 @@ static const uint8_t image_data_Font_8x10_0x5d[10] = {
   0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x38
 };
 static const tImage Font_8x10_0x5d = { image_data_Font_8x10_0x5d,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1173,7 +1173,7 @@ static const uint8_t image_data_Font_8x10_0x5e[10] = {
   0x00, 0x18, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_8x10_0x5e = { image_data_Font_8x10_0x5e,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1191,7 +1191,7 @@ static const uint8_t image_data_Font_8x10_0x5f[10] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e
 };
 static const tImage Font_8x10_0x5f = { image_data_Font_8x10_0x5f,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1209,7 +1209,7 @@ static const uint8_t image_data_Font_8x10_0x60[10] = {
   0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 static const tImage Font_8x10_0x60 = { image_data_Font_8x10_0x60,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1227,7 +1227,7 @@ static const uint8_t image_data_Font_8x10_0x61[10] = {
   0x00, 0x00, 0x00, 0x18, 0x04, 0x1c, 0x24, 0x1c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x61 = { image_data_Font_8x10_0x61,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1245,7 +1245,7 @@ static const uint8_t image_data_Font_8x10_0x62[10] = {
   0x40, 0x40, 0x40, 0x78, 0x44, 0x44, 0x44, 0x78, 0x00, 0x00
 };
 static const tImage Font_8x10_0x62 = { image_data_Font_8x10_0x62,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1263,7 +1263,7 @@ static const uint8_t image_data_Font_8x10_0x63[10] = {
   0x00, 0x00, 0x00, 0x1c, 0x20, 0x20, 0x20, 0x1c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x63 = { image_data_Font_8x10_0x63,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1281,7 +1281,7 @@ static const uint8_t image_data_Font_8x10_0x64[10] = {
   0x04, 0x04, 0x04, 0x3c, 0x44, 0x44, 0x44, 0x3c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x64 = { image_data_Font_8x10_0x64,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1299,7 +1299,7 @@ static const uint8_t image_data_Font_8x10_0x65[10] = {
   0x00, 0x00, 0x00, 0x18, 0x24, 0x3c, 0x20, 0x1c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x65 = { image_data_Font_8x10_0x65,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1317,7 +1317,7 @@ static const uint8_t image_data_Font_8x10_0x66[10] = {
   0x0c, 0x10, 0x10, 0x1c, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x66 = { image_data_Font_8x10_0x66,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1335,7 +1335,7 @@ static const uint8_t image_data_Font_8x10_0x67[10] = {
   0x00, 0x00, 0x00, 0x3c, 0x44, 0x44, 0x44, 0x3c, 0x04, 0x38
 };
 static const tImage Font_8x10_0x67 = { image_data_Font_8x10_0x67,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1353,7 +1353,7 @@ static const uint8_t image_data_Font_8x10_0x68[10] = {
   0x40, 0x40, 0x40, 0x78, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00
 };
 static const tImage Font_8x10_0x68 = { image_data_Font_8x10_0x68,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1371,7 +1371,7 @@ static const uint8_t image_data_Font_8x10_0x69[10] = {
   0x00, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x69 = { image_data_Font_8x10_0x69,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1389,7 +1389,7 @@ static const uint8_t image_data_Font_8x10_0x6a[10] = {
   0x00, 0x08, 0x00, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10
 };
 static const tImage Font_8x10_0x6a = { image_data_Font_8x10_0x6a,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1407,7 +1407,7 @@ static const uint8_t image_data_Font_8x10_0x6b[10] = {
   0x40, 0x40, 0x44, 0x48, 0x50, 0x70, 0x48, 0x44, 0x00, 0x00
 };
 static const tImage Font_8x10_0x6b = { image_data_Font_8x10_0x6b,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1425,7 +1425,7 @@ static const uint8_t image_data_Font_8x10_0x6c[10] = {
   0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x6c = { image_data_Font_8x10_0x6c,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1443,7 +1443,7 @@ static const uint8_t image_data_Font_8x10_0x6d[10] = {
   0x00, 0x00, 0x00, 0xec, 0x92, 0x92, 0x92, 0x92, 0x00, 0x00
 };
 static const tImage Font_8x10_0x6d = { image_data_Font_8x10_0x6d,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1461,7 +1461,7 @@ static const uint8_t image_data_Font_8x10_0x6e[10] = {
   0x00, 0x00, 0x00, 0x78, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00
 };
 static const tImage Font_8x10_0x6e = { image_data_Font_8x10_0x6e,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1479,7 +1479,7 @@ static const uint8_t image_data_Font_8x10_0x6f[10] = {
   0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00
 };
 static const tImage Font_8x10_0x6f = { image_data_Font_8x10_0x6f,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1497,7 +1497,7 @@ static const uint8_t image_data_Font_8x10_0x70[10] = {
   0x00, 0x00, 0x00, 0x78, 0x44, 0x44, 0x44, 0x78, 0x40, 0x40
 };
 static const tImage Font_8x10_0x70 = { image_data_Font_8x10_0x70,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1515,7 +1515,7 @@ static const uint8_t image_data_Font_8x10_0x71[10] = {
   0x00, 0x00, 0x00, 0x3c, 0x44, 0x44, 0x44, 0x3c, 0x04, 0x04
 };
 static const tImage Font_8x10_0x71 = { image_data_Font_8x10_0x71,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1533,7 +1533,7 @@ static const uint8_t image_data_Font_8x10_0x72[10] = {
   0x00, 0x00, 0x00, 0x28, 0x30, 0x20, 0x20, 0x20, 0x00, 0x00
 };
 static const tImage Font_8x10_0x72 = { image_data_Font_8x10_0x72,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1551,7 +1551,7 @@ static const uint8_t image_data_Font_8x10_0x73[10] = {
   0x00, 0x00, 0x00, 0x38, 0x20, 0x10, 0x08, 0x38, 0x00, 0x00
 };
 static const tImage Font_8x10_0x73 = { image_data_Font_8x10_0x73,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1569,7 +1569,7 @@ static const uint8_t image_data_Font_8x10_0x74[10] = {
   0x00, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x08, 0x00, 0x00
 };
 static const tImage Font_8x10_0x74 = { image_data_Font_8x10_0x74,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1587,7 +1587,7 @@ static const uint8_t image_data_Font_8x10_0x75[10] = {
   0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x3c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x75 = { image_data_Font_8x10_0x75,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1605,7 +1605,7 @@ static const uint8_t image_data_Font_8x10_0x76[10] = {
   0x00, 0x00, 0x00, 0x44, 0x28, 0x28, 0x28, 0x10, 0x00, 0x00
 };
 static const tImage Font_8x10_0x76 = { image_data_Font_8x10_0x76,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1623,7 +1623,7 @@ static const uint8_t image_data_Font_8x10_0x77[10] = {
   0x00, 0x00, 0x00, 0x92, 0x92, 0xaa, 0x6c, 0x44, 0x00, 0x00
 };
 static const tImage Font_8x10_0x77 = { image_data_Font_8x10_0x77,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1641,7 +1641,7 @@ static const uint8_t image_data_Font_8x10_0x78[10] = {
   0x00, 0x00, 0x00, 0x24, 0x18, 0x18, 0x18, 0x24, 0x00, 0x00
 };
 static const tImage Font_8x10_0x78 = { image_data_Font_8x10_0x78,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1659,7 +1659,7 @@ static const uint8_t image_data_Font_8x10_0x79[10] = {
   0x00, 0x00, 0x00, 0x44, 0x28, 0x28, 0x28, 0x10, 0x10, 0x20
 };
 static const tImage Font_8x10_0x79 = { image_data_Font_8x10_0x79,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1677,7 +1677,7 @@ static const uint8_t image_data_Font_8x10_0x7a[10] = {
   0x00, 0x00, 0x00, 0x38, 0x08, 0x10, 0x20, 0x38, 0x00, 0x00
 };
 static const tImage Font_8x10_0x7a = { image_data_Font_8x10_0x7a,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1695,7 +1695,7 @@ static const uint8_t image_data_Font_8x10_0x7b[10] = {
   0x00, 0x0c, 0x08, 0x08, 0x08, 0x30, 0x08, 0x08, 0x08, 0x0c
 };
 static const tImage Font_8x10_0x7b = { image_data_Font_8x10_0x7b,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1713,7 +1713,7 @@ static const uint8_t image_data_Font_8x10_0x7c[10] = {
   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
 };
 static const tImage Font_8x10_0x7c = { image_data_Font_8x10_0x7c,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1731,7 +1731,7 @@ static const uint8_t image_data_Font_8x10_0x7d[10] = {
   0x00, 0x30, 0x10, 0x10, 0x10, 0x0c, 0x10, 0x10, 0x10, 0x30
 };
 static const tImage Font_8x10_0x7d = { image_data_Font_8x10_0x7d,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 #if (0x0 == 0x0)
@@ -1749,7 +1749,7 @@ static const uint8_t image_data_Font_8x10_0x7e[10] = {
         0x40, 0xa0, 0x40, 0x0c, 0x10, 0x10, 0x10, 0x0c, 0x00, 0x00
 };
 static const tImage Font_8x10_0x7e = { image_data_Font_8x10_0x7e,
-                                        8, 10, 8};
+                                        8, 10, 8, 0};
 #endif
 
 
@@ -2518,5 +2518,5 @@ static const tChar Font_8x10_array[] = {
 };
 
 
-const tFont Font_8x10 = { 95, Font_8x10_array };
+const tFont Font_8x10 = { 95, Font_8x10_array, .first_code = 0x20, .dense = 95 };
 
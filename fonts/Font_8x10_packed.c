@@ -0,0 +1,213 @@
+/*******************************************************************************
+* name: Font_8x10
+* family: ISOCPEUR
+* size: 10
+* style: Regular
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* type: monospaced
+* encoding: UTF-8
+*
+* packed: 95 glyphs 8x10, 10 bytes per glyph, first code 0x20
+* glyph bits are continuous across rows like tImage, glyph of code c is at
+* data + (c - first_code) * stride
+*******************************************************************************/
+
+#include "fonts.h"
+
+
+static const uint8_t Font_8x10_packed_data[950] = {
+  // character: ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '!'
+  0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00,
+  // character: '"'
+  0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '#'
+  0x0a, 0x0a, 0x0a, 0x7f, 0x14, 0xfe, 0x28, 0x28, 0x28, 0x00,
+  // character: '$'
+  0x10, 0x10, 0x3c, 0x50, 0x30, 0x18, 0x14, 0x78, 0x10, 0x10,
+  // character: '%'
+  0x42, 0xa4, 0xa8, 0xa8, 0x54, 0x2a, 0x2a, 0x4a, 0x84, 0x00,
+  // character: '&'
+  0x00, 0x30, 0x48, 0x48, 0x32, 0x4a, 0x44, 0x3a, 0x00, 0x00,
+  // character: '''
+  0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '('
+  0x08, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x08,
+  // character: ')'
+  0x20, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x20,
+  // character: '*'
+  0x00, 0x10, 0x92, 0x54, 0x38, 0x54, 0x92, 0x10, 0x00, 0x00,
+  // character: '+'
+  0x00, 0x00, 0x18, 0x18, 0x7e, 0x7e, 0x18, 0x18, 0x00, 0x00,
+  // character: ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x10, 0x00,
+  // character: '-'
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+  // character: '/'
+  0x04, 0x04, 0x08, 0x08, 0x08, 0x10, 0x10, 0x10, 0x20, 0x20,
+  // character: '0'
+  0x00, 0x18, 0x24, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00,
+  // character: '1'
+  0x00, 0x08, 0x18, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x00,
+  // character: '2'
+  0x00, 0x38, 0x04, 0x04, 0x08, 0x10, 0x20, 0x3c, 0x00, 0x00,
+  // character: '3'
+  0x00, 0x38, 0x04, 0x04, 0x18, 0x04, 0x04, 0x38, 0x00, 0x00,
+  // character: '4'
+  0x00, 0x04, 0x0c, 0x14, 0x24, 0x3e, 0x04, 0x04, 0x00, 0x00,
+  // character: '5'
+  0x00, 0x3c, 0x20, 0x38, 0x04, 0x04, 0x04, 0x38, 0x00, 0x00,
+  // character: '6'
+  0x00, 0x18, 0x20, 0x20, 0x38, 0x24, 0x24, 0x18, 0x00, 0x00,
+  // character: '7'
+  0x00, 0x3c, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x00, 0x00,
+  // character: '8'
+  0x00, 0x18, 0x24, 0x24, 0x18, 0x24, 0x24, 0x18, 0x00, 0x00,
+  // character: '9'
+  0x00, 0x18, 0x24, 0x24, 0x1c, 0x04, 0x04, 0x18, 0x00, 0x00,
+  // character: ':'
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00,
+  // character: ';'
+  0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x20, 0x00,
+  // character: '<'
+  0x00, 0x00, 0x00, 0x02, 0x1c, 0x20, 0x1c, 0x02, 0x00, 0x00,
+  // character: '='
+  0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,
+  // character: '>'
+  0x00, 0x00, 0x00, 0x20, 0x1c, 0x02, 0x1c, 0x20, 0x00, 0x00,
+  // character: '?'
+  0x00, 0x38, 0x04, 0x04, 0x08, 0x10, 0x00, 0x10, 0x00, 0x00,
+  // character: '@'
+  0x00, 0x3c, 0x42, 0x9d, 0xa5, 0xa5, 0x9e, 0x40, 0x3c, 0x00,
+  // character: 'A'
+  0x00, 0x18, 0x18, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x00, 0x00,
+  // character: 'B'
+  0x00, 0x78, 0x44, 0x44, 0x78, 0x44, 0x44, 0x78, 0x00, 0x00,
+  // character: 'C'
+  0x00, 0x1e, 0x20, 0x40, 0x40, 0x40, 0x20, 0x1e, 0x00, 0x00,
+  // character: 'D'
+  0x00, 0x78, 0x44, 0x42, 0x42, 0x42, 0x44, 0x78, 0x00, 0x00,
+  // character: 'E'
+  0x00, 0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x7c, 0x00, 0x00,
+  // character: 'F'
+  0x00, 0x7c, 0x40, 0x40, 0x7c, 0x40, 0x40, 0x40, 0x00, 0x00,
+  // character: 'G'
+  0x00, 0x1e, 0x20, 0x40, 0x4e, 0x42, 0x22, 0x1e, 0x00, 0x00,
+  // character: 'H'
+  0x00, 0x42, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x42, 0x00, 0x00,
+  // character: 'I'
+  0x00, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00,
+  // character: 'J'
+  0x00, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x30, 0x00, 0x00,
+  // character: 'K'
+  0x00, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x00, 0x00,
+  // character: 'L'
+  0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x00, 0x00,
+  // character: 'M'
+  0x00, 0xc6, 0xc6, 0xaa, 0xaa, 0x92, 0x92, 0x82, 0x00, 0x00,
+  // character: 'N'
+  0x00, 0x42, 0x62, 0x52, 0x4a, 0x46, 0x42, 0x42, 0x00, 0x00,
+  // character: 'O'
+  0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00, 0x00,
+  // character: 'P'
+  0x00, 0x78, 0x44, 0x44, 0x44, 0x78, 0x40, 0x40, 0x00, 0x00,
+  // character: 'Q'
+  0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38, 0x0e, 0x00,
+  // character: 'R'
+  0x00, 0x70, 0x48, 0x48, 0x70, 0x50, 0x48, 0x44, 0x00, 0x00,
+  // character: 'S'
+  0x00, 0x3c, 0x40, 0x40, 0x38, 0x04, 0x04, 0x78, 0x00, 0x00,
+  // character: 'T'
+  0x00, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+  // character: 'U'
+  0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00,
+  // character: 'V'
+  0x00, 0x44, 0x44, 0x44, 0x28, 0x28, 0x28, 0x10, 0x00, 0x00,
+  // character: 'W'
+  0x00, 0x92, 0x92, 0xaa, 0xaa, 0xaa, 0xaa, 0x44, 0x00, 0x00,
+  // character: 'X'
+  0x00, 0x44, 0x28, 0x28, 0x10, 0x28, 0x28, 0x44, 0x00, 0x00,
+  // character: 'Y'
+  0x00, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+  // character: 'Z'
+  0x00, 0x7c, 0x04, 0x08, 0x10, 0x20, 0x40, 0x7c, 0x00, 0x00,
+  // character: '['
+  0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38,
+  // character: '\\'
+  0x20, 0x20, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x04, 0x04,
+  // character: ']'
+  0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x38,
+  // character: '^'
+  0x00, 0x18, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: '_'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e,
+  // character: '`'
+  0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // character: 'a'
+  0x00, 0x00, 0x00, 0x18, 0x04, 0x1c, 0x24, 0x1c, 0x00, 0x00,
+  // character: 'b'
+  0x40, 0x40, 0x40, 0x78, 0x44, 0x44, 0x44, 0x78, 0x00, 0x00,
+  // character: 'c'
+  0x00, 0x00, 0x00, 0x1c, 0x20, 0x20, 0x20, 0x1c, 0x00, 0x00,
+  // character: 'd'
+  0x04, 0x04, 0x04, 0x3c, 0x44, 0x44, 0x44, 0x3c, 0x00, 0x00,
+  // character: 'e'
+  0x00, 0x00, 0x00, 0x18, 0x24, 0x3c, 0x20, 0x1c, 0x00, 0x00,
+  // character: 'f'
+  0x0c, 0x10, 0x10, 0x1c, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+  // character: 'g'
+  0x00, 0x00, 0x00, 0x3c, 0x44, 0x44, 0x44, 0x3c, 0x04, 0x38,
+  // character: 'h'
+  0x40, 0x40, 0x40, 0x78, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+  // character: 'i'
+  0x00, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+  // character: 'j'
+  0x00, 0x08, 0x00, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10,
+  // character: 'k'
+  0x40, 0x40, 0x44, 0x48, 0x50, 0x70, 0x48, 0x44, 0x00, 0x00,
+  // character: 'l'
+  0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+  // character: 'm'
+  0x00, 0x00, 0x00, 0xec, 0x92, 0x92, 0x92, 0x92, 0x00, 0x00,
+  // character: 'n'
+  0x00, 0x00, 0x00, 0x78, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+  // character: 'o'
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00,
+  // character: 'p'
+  0x00, 0x00, 0x00, 0x78, 0x44, 0x44, 0x44, 0x78, 0x40, 0x40,
+  // character: 'q'
+  0x00, 0x00, 0x00, 0x3c, 0x44, 0x44, 0x44, 0x3c, 0x04, 0x04,
+  // character: 'r'
+  0x00, 0x00, 0x00, 0x28, 0x30, 0x20, 0x20, 0x20, 0x00, 0x00,
+  // character: 's'
+  0x00, 0x00, 0x00, 0x38, 0x20, 0x10, 0x08, 0x38, 0x00, 0x00,
+  // character: 't'
+  0x00, 0x10, 0x10, 0x38, 0x10, 0x10, 0x10, 0x08, 0x00, 0x00,
+  // character: 'u'
+  0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x3c, 0x00, 0x00,
+  // character: 'v'
+  0x00, 0x00, 0x00, 0x44, 0x28, 0x28, 0x28, 0x10, 0x00, 0x00,
+  // character: 'w'
+  0x00, 0x00, 0x00, 0x92, 0x92, 0xaa, 0x6c, 0x44, 0x00, 0x00,
+  // character: 'x'
+  0x00, 0x00, 0x00, 0x24, 0x18, 0x18, 0x18, 0x24, 0x00, 0x00,
+  // character: 'y'
+  0x00, 0x00, 0x00, 0x44, 0x28, 0x28, 0x28, 0x10, 0x10, 0x20,
+  // character: 'z'
+  0x00, 0x00, 0x00, 0x38, 0x08, 0x10, 0x20, 0x38, 0x00, 0x00,
+  // character: '{'
+  0x00, 0x0c, 0x08, 0x08, 0x08, 0x30, 0x08, 0x08, 0x08, 0x0c,
+  // character: '|'
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  // character: '}'
+  0x00, 0x30, 0x10, 0x10, 0x10, 0x0c, 0x10, 0x10, 0x10, 0x30,
+  // character: '~'
+  0x40, 0xa0, 0x40, 0x0c, 0x10, 0x10, 0x10, 0x0c, 0x00, 0x00
+};
+
+static const tFontPacked Font_8x10_packed_glyphs = { 8, 10, 10, 0x20, 95, Font_8x10_packed_data };
+
+const tFont Font_8x10_packed = { .packed = &Font_8x10_packed_glyphs };
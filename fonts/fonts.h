@@ -9,9 +9,53 @@ typedef struct {
     const tImage *image;
 } tChar;
 
+/**
+ * Monospaced font in one bitmap blob, glyph pixels are continuous across rows like tImage,
+ * glyph of code c is at data + (c - first_code) * stride
+ */
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    uint16_t stride;                /** bytes per glyph */
+    uint32_t first_code;
+    uint16_t count;
+    const uint8_t *data;
+} tFontPacked;
+
+/** Placement of a glyph of a proportional font */
+typedef struct {
+    int8_t bearing;                 /** bitmap x offset from the pen position */
+    uint8_t advance;                /** pen movement to the next glyph */
+} tGlyphMetrics;
+
+/** Kerning pair, tables are sorted by left and then right code */
+typedef struct {
+    uint16_t left;
+    uint16_t right;
+    int8_t adjust;                  /** added to the pen between the two glyphs */
+} tKernPair;
+
+/** Codes per page of tFont.pages */
+#define FONT_PAGE_SIZE 256
+
 typedef struct {
     int length;
     const tChar *chars;
+    /** optional lookup acceleration, fonts without it (zeros) are binary searched */
+    /** chars[0 .. dense - 1] have codes first_code .. first_code + dense - 1 */
+    long int first_code;
+    int dense;
+    /** pages[code / FONT_PAGE_SIZE][code % FONT_PAGE_SIZE] is index to chars or -1, NULL page has no chars */
+    const int16_t *const *pages;
+    int page_count;
+    /** glyphs of packed fonts, chars are not used then */
+    const tFontPacked *packed;
+    /** optional proportional metrics, in chars order (packed: code - first_code), NULL is monospaced */
+    const tGlyphMetrics *metrics;
+    const tKernPair *kerning;
+    int kerning_count;
+    /** bits per glyph pixel: 0 or 1 is mono, 2 and 4 are coverage levels (anti-aliased) */
+    int bpp;
 } tFont;
 
 extern const tFont Font_8x10;
@@ -24,4 +68,24 @@ extern const tFont Font_20x24;
 extern const tFont Font_24x17;
 extern const tFont Font_25x27;
 
+/** Same fonts in tFontPacked format, about a third less flash */
+extern const tFont Font_8x10_packed;
+extern const tFont Font_10x20_packed;
+extern const tFont Font_11x22_packed;
+extern const tFont Font_13x16_packed;
+extern const tFont Font_16x24_packed;
+extern const tFont Font_LET_18x26_packed;
+extern const tFont Font_20x24_packed;
+extern const tFont Font_24x17_packed;
+extern const tFont Font_25x27_packed;
+
+/** Proportional Font_13x16 with kerning */
+extern const tFont Font_13x16_prop;
+
+/** Anti-aliased, 4 bpp packed */
+extern const tFont Font_13x14_aa;
+
+/** Font_25x27 with RLE compressed glyphs */
+extern const tFont Font_25x27_rle;
+
 #endif //ST7735S_FONTS_H
@@ -11,6 +11,7 @@
 * conversion type: Color, not_used not_used
 * split to rows: yes
 * bits per pixel: 16
+* byte order: big-endian (panel wire order)
 *
 * preprocess:
 *  main scan direction: top_to_bottom
@@ -24,7 +25,8 @@
      uint16_t width;
      uint16_t height;
      uint8_t dataSize;
-     } tImage;
+     uint8_t flags;
+     } tImage_RGB;
 */
 #include <stdint.h>
 #include "picts.h"
@@ -107,81 +109,81 @@ static const uint16_t image_data_Image_Battery[12000] = {
         // ∙∙∙∙∙∙∙∙∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
         // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
         0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x18c3, 0x18c3, 0x1061, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x7bcf, 0xa534, 0xb5b6, 0xb596, 0x8c71, 0x49c7, 0x8001, 0x40a2, 0x0841, 0x1061, 0x1061, 0x1061, 0x1061, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x4228, 0x94d3, 0xb596, 0xad75, 0x94b2, 0x5aeb, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0xce79, 0xce59, 0xce59, 0xce39, 0xa555, 0x92aa, 0xd964, 0xa227, 0x3144, 0x3965, 0x3165, 0x3165, 0x3165, 0x3165, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2104, 0x0000, 0x5acb, 0xbdf7, 0xc638, 0xc639, 0xc639, 0xbdd7, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x94b2, 0xb5b6, 0xad55, 0xa514, 0x9d14, 0x8410, 0xa1a5, 0xd165, 0xb9c5, 0x3923, 0x2903, 0x2903, 0x2903, 0x2103, 0x2103, 0x20e3, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 0x18e3, 0x0000, 0x2124, 0x8c71, 0x94b2, 0x9cf3, 0xad55, 0xad75, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0x8430, 0x738e, 0x5aeb, 0x5aeb, 0x630c, 0x6aeb, 0xb8a4, 0xc884, 0xc8c4, 0x48a2, 0x1060, 0x1861, 0x1061, 0x1061, 0x1041, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0000, 0x0861, 0x4a28, 0x4228, 0x4a28, 0x528a, 0x73ae, 0x738e, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0x5aeb, 0x5269, 0x5acb, 0x62eb, 0x632c, 0x6aa9, 0xc084, 0xc824, 0xd044, 0x6022, 0x0800, 0x1000, 0x1000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39c6, 0x4a49, 0x4228, 0x4208, 0x41e7, 0x5acb, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4a49, 0x528a, 0x5aaa, 0x5acb, 0x62eb, 0x5b4d, 0x8208, 0xc802, 0xc864, 0xd044, 0x8042, 0x1020, 0x1820, 0x1020, 0x0820, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x4a28, 0x4208, 0x4228, 0x4208, 0x4a28, 0x3165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e3, 0x5acb, 0x528a, 0x5aaa, 0x5acb, 0x62eb, 0x530c, 0x89c7, 0xd002, 0xc864, 0xd044, 0x9843, 0x1820, 0x1820, 0x1020, 0x1020, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x41e7, 0x41e7, 0x4208, 0x4228, 0x4208, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x630c, 0x5acb, 0x62eb, 0x62eb, 0x6b2c, 0x52eb, 0x9165, 0xd803, 0xc864, 0xd044, 0xb063, 0x2040, 0x1820, 0x1020, 0x1020, 0x0820, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x41e7, 0x4a48, 0x4a69, 0x4a69, 0x4a28, 0x4a28, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39c7, 0x5aaa, 0x4208, 0x4208, 0x41e7, 0x4a28, 0x4a89, 0x90c3, 0xd803, 0xd023, 0xd003, 0xc003, 0x2020, 0x1800, 0x1000, 0x1000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1061, 0x0000, 0x1861, 0x1882, 0x2903, 0x41e7, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0x6b4d, 0xad75, 0xbdd7, 0xb5b6, 0xbdf7, 0x738d, 0xa000, 0xd884, 0xd0a4, 0xd8a4, 0xc8c3, 0x38a1, 0x2061, 0x2061, 0x1861, 0x1061, 0x1041, 0x0841, 0x0841, 0x0841, 0x0820, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x1082, 0x0861, 0x0000, 0x0000, 0x0000, 0x73ae, 0xb5b6, 0xb576, 0xb596, 0x9cd3, 0x4208, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x7bae, 0xdedb, 0xf79e, 0xf79e, 0xf79e, 0xffff, 0x83cf, 0xa800, 0xe288, 0xe3ec, 0xe40c, 0xdbab, 0x830a, 0x62ca, 0x62ca, 0x62ca, 0x5aaa, 0x5aaa, 0x5aaa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x52aa, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x5acb, 0x632c, 0x634d, 0x630c, 0x2945, 0x0000, 0x0000, 0x9492, 0xffff, 0xef7d, 0xf79e, 0xef7d, 0xc638, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x9cf3, 0xef7d, 0xe71c, 0xe73c, 0xe73c, 0xe75d, 0x6aca, 0xb800, 0xe36a, 0xe48e, 0xec8e, 0xe42c, 0x938c, 0x732b, 0x734c, 0x6b2c, 0x6b2c, 0x6b2c, 0x632c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x6b4d, 0x73ae, 0x73ae, 0x7bcf, 0x4208, 0x0000, 0x0000, 0x5aeb, 0xef5d, 0xdefb, 0xe71c, 0xe71c, 0xef5d, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xad55, 0xe71c, 0xdedb, 0xdefb, 0xdefc, 0xce9a, 0x51a6, 0xc000, 0xe3ab, 0xe46d, 0xe44d, 0xe40c, 0x9b6b, 0x6aea, 0x6b0b, 0x6aeb, 0x62eb, 0x62eb, 0x62eb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x632c, 0x6b6d, 0x6b8e, 0x73ae, 0x4a49, 0x0000, 0x0000, 0x39c7, 0xdedb, 0xd6bb, 0xdedb, 0xd6ba, 0xdefc, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xbdd7, 0xd6bb, 0xd6ba, 0xd6ba, 0xdedb, 0xbdf7, 0x5103, 0xd883, 0xe3cb, 0xec4d, 0xe42d, 0xec0b, 0x9b6b, 0x62ca, 0x6aea, 0x62ea, 0x62ea, 0x62ca, 0x5aca, 0x5aca, 0x5aca, 0x5aaa, 0x5aaa, 0x5aaa, 0x5aaa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x632c, 0x6b4d, 0x6b6d, 0x6b8e, 0x528a, 0x0020, 0x0000, 0x18e3, 0xce59, 0xd69a, 0xce79, 0xce79, 0xd6ba, 0x8431, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0xc618, 0xce79, 0xce79, 0xce79, 0xd6ba, 0xa555, 0x48a1, 0xd984, 0xe3cb, 0xec2c, 0xe40c, 0xebeb, 0xa36b, 0x62a9, 0x6aca, 0x62ca, 0x5aaa, 0x5aaa, 0x5aaa, 0x52aa, 0x52aa, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x52aa, 0x630c, 0x634d, 0x6b4d, 0x6b4d, 0x5acb, 0x0861, 0x0000, 0x0841, 0xb596, 0xc659, 0xc638, 0xc638, 0xc659, 0x9cd3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0020, 0x0000, 0x4a49, 0xc618, 0xc618, 0xc638, 0xc638, 0xce79, 0x8c71, 0x5860, 0xe1e5, 0xe3cb, 0xec0b, 0xe3eb, 0xf3cb, 0xab4a, 0x5a89, 0x62a9, 0x5aa9, 0x5a89, 0x5a89, 0x5289, 0x5289, 0x5289, 0x5269, 0x5269, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x528a, 0x5aeb, 0x630c, 0x632c, 0x632c, 0x5acb, 0x1082, 0x0000, 0x0000, 0x9492, 0xbdf7, 0xbdd7, 0xbdd7, 0xbdf7, 0x9cf3, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xc659, 0x738e, 0x5800, 0xe226, 0xe3aa, 0xebcb, 0xe3cb, 0xf3ca, 0xab4a, 0x5a68, 0x6289, 0x5a89, 0x5a69, 0x5269, 0x5269, 0x4a69, 0x4a69, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a49, 0x4a69, 0x5acb, 0x5b0c, 0x630c, 0x5b0c, 0x5acb, 0x1082, 0x0000, 0x0000, 0x7bcf, 0xb5b6, 0xad75, 0xad75, 0xb596, 0x9cf3, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x5289, 0xb596, 0xb5b6, 0xb5b6, 0xb5b6, 0xbdf7, 0x630c, 0x6000, 0xea46, 0xe3aa, 0xebaa, 0xe3aa, 0xf3aa, 0xb349, 0x5a68, 0x5a68, 0x5a68, 0x5248, 0x5248, 0x4a48, 0x4a48, 0x4a28, 0x4a28, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x52ab, 0x5aeb, 0x5aeb, 0x5aeb, 0x52cb, 0x1082, 0x0000, 0x0000, 0x632c, 0xad75, 0xa514, 0xa534, 0xa534, 0x9cd3, 0x20e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x62eb, 0xa555, 0xad55, 0xad75, 0xad75, 0xb5b6, 0x52aa, 0x7000, 0xea26, 0xe389, 0xeb8a, 0xe38a, 0xeb89, 0xbb29, 0x5a48, 0x5a48, 0x5248, 0x5228, 0x4a28, 0x4a28, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x52aa, 0x5acb, 0x5acb, 0x5acb, 0x52aa, 0x1082, 0x0000, 0x0000, 0x528a, 0xa514, 0x9cd3, 0x9cd3, 0x9cd3, 0x9492, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0x9cd3, 0x9d14, 0xa514, 0xa534, 0xa555, 0x4a48, 0x7800, 0xea26, 0xe369, 0xe369, 0xe369, 0xeb69, 0xbb29, 0x5a27, 0x5227, 0x5227, 0x4a07, 0x4a07, 0x4207, 0x4207, 0x4207, 0x41e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x4228, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x528a, 0x1082, 0x0000, 0x0000, 0x39e7, 0x94b2, 0x8c92, 0x8c92, 0x9492, 0x8c71, 0x39c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0841, 0x73ae, 0x8c71, 0x94b2, 0x94b2, 0x9cf3, 0x9cd3, 0x4207, 0x80a0, 0xea05, 0xe348, 0xeb48, 0xe348, 0xeb48, 0xbb09, 0x5a27, 0x5207, 0x4a07, 0x4a07, 0x41e7, 0x41e7, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x4228, 0x4a69, 0x528a, 0x528a, 0x528a, 0x4a69, 0x1082, 0x0000, 0x0000, 0x2945, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x528a, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0841, 0x7bef, 0x8410, 0x8c51, 0x8c71, 0x94b2, 0x8c71, 0x41c6, 0x80c1, 0xe9e5, 0xe328, 0xeb28, 0xe328, 0xeb08, 0xcae8, 0x5a06, 0x49e6, 0x49e6, 0x41c6, 0x41c6, 0x39c6, 0x39c6, 0x39c6, 0x39a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x4208, 0x4a49, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x1082, 0x0000, 0x0000, 0x18e3, 0x7bcf, 0x7bef, 0x7bcf, 0x7bef, 0x7bcf, 0x738e, 0x6b6d, 0x5aaa, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0861, 0x7bcf, 0x7bcf, 0x83ef, 0x8410, 0x8c71, 0x8430, 0x3985, 0x98a2, 0xe9a4, 0xe2e7, 0xe307, 0xe307, 0xeae7, 0xcae7, 0x5a06, 0x49c6, 0x49c6, 0x41c6, 0x39a6, 0x39a6, 0x39a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x39e7, 0x4228, 0x4a49, 0x4a49, 0x4a49, 0x4228, 0x1082, 0x0000, 0x0000, 0x1061, 0x6b6d, 0x738e, 0x738e, 0x738e, 0x736d, 0x632c, 0x5acb, 0x630c, 0x528a, 0x1081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x1061, 0x6b4d, 0x738e, 0x7bae, 0x7bef, 0x8430, 0x7bef, 0x3964, 0x98c2, 0xe964, 0xe2c6, 0xeae7, 0xe2c7, 0xeac6, 0xcac7, 0x5a06, 0x49a5, 0x41a5, 0x41a5, 0x3985, 0x3185, 0x3185, 0x3185, 0x3185, 0x3165, 0x3165, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x39c7, 0x4208, 0x4228, 0x4228, 0x4228, 0x41e8, 0x0861, 0x0000, 0x0000, 0x0000, 0x630c, 0x6b4d, 0x6b2c, 0x6b2c, 0x6b4d, 0x5acb, 0x1000, 0x1881, 0x3145, 0x39c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x10a2, 0x6b4d, 0x6b2c, 0x6b6d, 0x73ae, 0x7bef, 0x73ae, 0x30e3, 0x98e2, 0xe903, 0xe286, 0xeaa6, 0xe2a6, 0xeaa6, 0xcac7, 0x5a06, 0x4185, 0x4185, 0x3985, 0x3985, 0x3165, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x39c7, 0x39e7, 0x4208, 0x4208, 0x4208, 0x39c7, 0x0861, 0x0000, 0x0000, 0x0000, 0x5acb, 0x62eb, 0x5aeb, 0x62eb, 0x5acb, 0x62eb, 0x8c30, 0x8c30, 0x7bef, 0x5289, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x1082, 0x5acb, 0x630c, 0x6b2c, 0x6b6d, 0x73ae, 0x738e, 0x3103, 0x9902, 0xe822, 0xe245, 0xea86, 0xe286, 0xea66, 0xcaa7, 0x59e6, 0x4164, 0x4164, 0x3964, 0x3164, 0x3144, 0x2944, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x31a6, 0x39e7, 0x39e7, 0x39e7, 0x41e7, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0x5aaa, 0x528a, 0x5aaa, 0x4208, 0x8410, 0xe75d, 0xe73c, 0xe71c, 0xce79, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x18e3, 0x5aaa, 0x5acb, 0x630c, 0x6b2c, 0x736d, 0x6b4d, 0x3103, 0x9903, 0xe802, 0xe205, 0xea65, 0xe265, 0xea45, 0xca86, 0x51e6, 0x4164, 0x3964, 0x3144, 0x3144, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x3186, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x5269, 0x4a69, 0x5269, 0x41e7, 0x6b6d, 0xce79, 0xce59, 0xce59, 0xd6ba, 0x9cd3, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x2924, 0x52aa, 0x528a, 0x5acb, 0x630c, 0x6b4d, 0x632c, 0x3103, 0x9903, 0xe802, 0xe1c4, 0xea45, 0xe245, 0xea25, 0xda65, 0x59e5, 0x3943, 0x3944, 0x3124, 0x3124, 0x2924, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2965, 0x31a6, 0x31a6, 0x31a6, 0x39a6, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x39c7, 0x4a28, 0x4a28, 0x4a48, 0x39c7, 0x5aeb, 0xb5b6, 0xb596, 0xb596, 0xb596, 0xad55, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x2124, 0x4228, 0x4a28, 0x528a, 0x5aca, 0x630c, 0x62eb, 0x3103, 0xa903, 0xe802, 0xe123, 0xe204, 0xe204, 0xea04, 0xda25, 0x59c5, 0x3923, 0x3123, 0x3103, 0x2903, 0x2103, 0x20e3, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x2945, 0x3185, 0x3186, 0x3186, 0x3165, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x39a6, 0x31a6, 0x39a6, 0x2944, 0x528a, 0x9cf3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x2924, 0x2945, 0x2104, 0x39a6, 0x4208, 0x5269, 0x528a, 0x3123, 0xb903, 0xf001, 0xe022, 0xe082, 0xe0a2, 0xe882, 0xd103, 0x4923, 0x2061, 0x2061, 0x1861, 0x1041, 0x1041, 0x0840, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x1082, 0x1082, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x4228, 0x8c51, 0x7bef, 0x83ef, 0x83ef, 0x7bef, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x39a6, 0x3186, 0x18a2, 0x3186, 0x4207, 0x4a69, 0x528a, 0x3923, 0xb123, 0xf001, 0xe002, 0xe002, 0xe002, 0xe802, 0xd082, 0x4902, 0x2040, 0x1820, 0x1020, 0x1000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x31a6, 0x6b6d, 0x632c, 0x6b2c, 0x632c, 0x6b2c, 0x5aeb, 0x0841, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x39c7, 0x31a6, 0x18c3, 0x3186, 0x4208, 0x4a69, 0x528a, 0x3943, 0xb923, 0xf001, 0xe022, 0xe002, 0xe002, 0xe802, 0xd0a2, 0x4903, 0x2040, 0x1840, 0x1820, 0x1020, 0x0820, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2924, 0x52aa, 0x4a69, 0x5269, 0x4a69, 0x5269, 0x4a48, 0x1082, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x39c7, 0x3186, 0x18c3, 0x3186, 0x4208, 0x4a69, 0x528a, 0x3943, 0xb923, 0xf001, 0xe022, 0xe002, 0xe002, 0xe802, 0xd082, 0x4903, 0x2040, 0x2040, 0x1840, 0x1020, 0x0820, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2124, 0x31a6, 0x0841, 0x18c3, 0x18c2, 0x1082, 0x2124, 0x2104, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x39a6, 0x2965, 0x18c3, 0x3186, 0x4208, 0x4a69, 0x528a, 0x3944, 0xb923, 0xf001, 0xe022, 0xe002, 0xe002, 0xe802, 0xd0a2, 0x4903, 0x2041, 0x2040, 0x1840, 0x1020, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2124, 0x3165, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x2965, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x3186, 0x2944, 0x18e3, 0x3186, 0x4208, 0x4a69, 0x528a, 0x3944, 0xb123, 0xe801, 0xe022, 0xe002, 0xe002, 0xe802, 0xd0a2, 0x4903, 0x2041, 0x2040, 0x1840, 0x1020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2124, 0x3165, 0x0000, 0x0020, 0x0020, 0x0000, 0x2104, 0x3186, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x3165, 0x2124, 0x18c3, 0x3186, 0x4207, 0x4a49, 0x528a, 0x3944, 0xb123, 0xe801, 0xe022, 0xe002, 0xe002, 0xe802, 0xd0a2, 0x4903, 0x2041, 0x2040, 0x1840, 0x1020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x2965, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x3165, 0x2124, 0x18c3, 0x3186, 0x4207, 0x4a49, 0x528a, 0x3943, 0xb123, 0xe801, 0xe022, 0xe002, 0xe002, 0xe802, 0xd0a2, 0x4923, 0x2061, 0x2040, 0x1840, 0x1020, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x2124, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x3165, 0x2124, 0x18c3, 0x3186, 0x4207, 0x4a49, 0x528a, 0x3943, 0xb123, 0xe802, 0xe022, 0xe002, 0xe002, 0xe002, 0xd0a3, 0x4923, 0x2060, 0x2040, 0x1840, 0x1040, 0x0820, 0x0820, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x18e3, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x2965, 0x2124, 0x18c3, 0x3186, 0x4207, 0x4a49, 0x528a, 0x3943, 0xb123, 0xe802, 0xe022, 0xe002, 0xe002, 0xe002, 0xd0a3, 0x4923, 0x2060, 0x2040, 0x1840, 0x1040, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2103, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x1082, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x3165, 0x2945, 0x18c3, 0x3186, 0x4207, 0x4a49, 0x528a, 0x3923, 0xb123, 0xe802, 0xe022, 0xe002, 0xe002, 0xe002, 0xd0a3, 0x4923, 0x2061, 0x2040, 0x1840, 0x1040, 0x0820, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0841, 0x0840, 0x0840, 0x0841, 0x0820, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e3, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x3165, 0x2945, 0x18c3, 0x3186, 0x4207, 0x4a49, 0x528a, 0x3123, 0xb103, 0xe802, 0xe022, 0xe002, 0xe002, 0xe002, 0xd0a3, 0x4923, 0x2061, 0x2040, 0x1840, 0x1040, 0x0820, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e3, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x2965, 0x2945, 0x18c3, 0x3185, 0x41e7, 0x4a49, 0x528a, 0x3103, 0xb103, 0xe802, 0xe022, 0xe002, 0xe002, 0xe002, 0xd0c3, 0x4923, 0x2061, 0x2061, 0x1840, 0x1040, 0x1040, 0x0820, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x2124, 0x2124, 0x18c3, 0x3165, 0x41e7, 0x4a49, 0x528a, 0x3103, 0xa903, 0xe802, 0xe022, 0xe002, 0xe002, 0xe002, 0xd0a3, 0x4923, 0x2061, 0x2061, 0x1840, 0x1040, 0x1040, 0x0820, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x2104, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x18c3, 0x18e3, 0x18e3, 0x3165, 0x41e7, 0x4a49, 0x528a, 0x3103, 0x9923, 0xe802, 0xe022, 0xe002, 0xe002, 0xe002, 0xc8e3, 0x4903, 0x2061, 0x2061, 0x1840, 0x1040, 0x1040, 0x0840, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x18c3, 0x2945, 0x18c3, 0x3185, 0x41e7, 0x4a49, 0x5aaa, 0x3103, 0x9903, 0xe802, 0xe022, 0xe002, 0xe022, 0xe002, 0xc123, 0x4102, 0x2881, 0x2081, 0x1861, 0x1861, 0x1061, 0x1061, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x41e7, 0x39c7, 0x39c7, 0x41e7, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x18a2, 0x2965, 0x18c3, 0x3165, 0x4207, 0x4a49, 0x5aaa, 0x3103, 0x9903, 0xe802, 0xd822, 0xe002, 0xd822, 0xe002, 0xc103, 0x4102, 0x28a1, 0x2081, 0x2081, 0x1861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x3186, 0x6b4d, 0x6b4d, 0x6b4d, 0x630c, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x1061, 0x2945, 0x18c3, 0x3165, 0x41e7, 0x4a49, 0x5aaa, 0x30e3, 0x98e2, 0xe802, 0xd822, 0xe002, 0xd822, 0xe002, 0xb903, 0x4102, 0x28a1, 0x28a2, 0x20a1, 0x1881, 0x1881, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x41e7, 0x7bcf, 0x73ae, 0x7bcf, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x1061, 0x31a6, 0x10a2, 0x3165, 0x41e7, 0x4a49, 0x5aaa, 0x3144, 0x98e2, 0xe803, 0xd823, 0xe003, 0xd823, 0xe002, 0xb903, 0x4102, 0x28c2, 0x28c2, 0x20a2, 0x18a2, 0x18a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2924, 0x4a28, 0x4a28, 0x3165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0841, 0x3186, 0x10a2, 0x3165, 0x41e7, 0x4a48, 0x5aaa, 0x3185, 0x90a2, 0xe803, 0xd823, 0xd803, 0xd823, 0xe002, 0xb903, 0x4102, 0x30c2, 0x28e2, 0x28c2, 0x20c2, 0x18a2, 0x18a2, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x1082, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39a6, 0x528a, 0x41e7, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0841, 0x39a6, 0x1082, 0x3165, 0x41e7, 0x4a28, 0x5aaa, 0x3985, 0x88a1, 0xe823, 0xd803, 0xd803, 0xd823, 0xe003, 0xb903, 0x3902, 0x30e2, 0x30e2, 0x28e2, 0x20c2, 0x20c2, 0x18c2, 0x18c2, 0x18c2, 0x18c2, 0x18a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x0841, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0820, 0x31a6, 0x10a2, 0x2965, 0x39e7, 0x4a28, 0x5aaa, 0x39c6, 0x78c1, 0xe043, 0xd803, 0xd803, 0xd823, 0xe003, 0xa943, 0x30e2, 0x3903, 0x3103, 0x2903, 0x28e3, 0x20e3, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0861, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0020, 0x3165, 0x10a2, 0x2965, 0x39c7, 0x4a28, 0x5aaa, 0x39c7, 0x78a1, 0xe043, 0xd803, 0xd823, 0xd823, 0xe003, 0xa943, 0x30e2, 0x3923, 0x3123, 0x3103, 0x2903, 0x2103, 0x2103, 0x2103, 0x20e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x0861, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x2944, 0x18a2, 0x2945, 0x39c7, 0x4a28, 0x5aaa, 0x39e7, 0x7861, 0xe043, 0xd823, 0xd823, 0xd823, 0xe003, 0xa943, 0x30e2, 0x3923, 0x3944, 0x3124, 0x2924, 0x2924, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x1082, 0x18c2, 0x18e3, 0x18e3, 0x18e3, 0x20e3, 0x18c3, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x18e3, 0x2945, 0x39c7, 0x4a28, 0x5aaa, 0x4208, 0x6860, 0xe043, 0xd823, 0xd823, 0xd823, 0xe003, 0xa923, 0x3102, 0x3944, 0x3944, 0x3144, 0x3144, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x10a2, 0x10a2, 0x2103, 0x2104, 0x2104, 0x2103, 0x18c3, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x20e3, 0x2104, 0x2945, 0x39c7, 0x4a28, 0x528a, 0x4248, 0x58c2, 0xd803, 0xd823, 0xd823, 0xd843, 0xe003, 0x9164, 0x3102, 0x4164, 0x3964, 0x3964, 0x3164, 0x3144, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x18c3, 0x18c3, 0x2104, 0x2124, 0x2124, 0x2104, 0x18e3, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x20e3, 0x2124, 0x2124, 0x39a6, 0x4a28, 0x5269, 0x4a89, 0x6104, 0xd802, 0xd843, 0xd823, 0xd043, 0xe003, 0x9164, 0x3103, 0x4985, 0x4185, 0x3985, 0x3165, 0x3165, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x18c3, 0x18c3, 0x2104, 0x2124, 0x2124, 0x2124, 0x20e3, 0x18c3, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x3165, 0x3165, 0x39c6, 0x4208, 0x5269, 0x4aaa, 0x5924, 0xd802, 0xd843, 0xd823, 0xd043, 0xe003, 0x9144, 0x3123, 0x49a5, 0x41a5, 0x39a5, 0x3985, 0x3185, 0x3185, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2104, 0x18c3, 0x2124, 0x2945, 0x2945, 0x2924, 0x2104, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x10a2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x39c7, 0x4228, 0x4a49, 0x5269, 0x5aaa, 0x52eb, 0x5124, 0xd002, 0xd844, 0xd803, 0xd023, 0xd803, 0x7943, 0x3964, 0x49c6, 0x41c6, 0x41a6, 0x39a6, 0x39a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31a6, 0x2945, 0x18e3, 0x2124, 0x2945, 0x2945, 0x2944, 0x2104, 0x18c3, 0x0000, 0x0000, 0x18e3, 0x18c3, 0x18c3, 0x2104, 0x2104, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x5289, 0x52aa, 0x5aeb, 0x6b2c, 0x634d, 0x5965, 0xc802, 0xd8c4, 0xd8c4, 0xd0c4, 0xd8a4, 0x8184, 0x41a5, 0x5227, 0x4a07, 0x4a07, 0x4207, 0x41e7, 0x41e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x31a6, 0x2124, 0x2965, 0x3186, 0x3186, 0x3186, 0x2965, 0x18c3, 0x0000, 0x1082, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x20e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x62eb, 0x630c, 0x6b2c, 0x6b6d, 0x6b8e, 0x5a07, 0xc042, 0xd9c5, 0xda06, 0xd9e6, 0xd9e5, 0x7a26, 0x5a68, 0x62a9, 0x5aa9, 0x5a89, 0x5a89, 0x5289, 0x5289, 0x5289, 0x528a, 0x5289, 0x5289, 0x5289, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x528a, 0x4a69, 0x39e7, 0x4208, 0x4a49, 0x4a49, 0x4228, 0x39e7, 0x18e3, 0x0000, 0x2924, 0x5289, 0x4a49, 0x4a49, 0x4a49, 0x5269, 0x20e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x6b4d, 0x6b4d, 0x738e, 0x7bae, 0x7bef, 0x628a, 0xb802, 0xda67, 0xdaa7, 0xdaa7, 0xda86, 0x82c9, 0x6b0b, 0x732c, 0x6b2b, 0x6b2c, 0x6b0c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x528a, 0x528a, 0x5acb, 0x5acb, 0x5acb, 0x4a69, 0x18c3, 0x0000, 0x39c7, 0x62eb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39a6, 0x7bcf, 0x7bae, 0x7bef, 0x8410, 0x8c51, 0x6b0c, 0xa800, 0xe2c8, 0xdb4a, 0xe349, 0xdb08, 0x8b4b, 0x7bad, 0x83ae, 0x7bad, 0x7bae, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e, 0x632c, 0x630c, 0x6b4d, 0x6b6d, 0x6b4d, 0x52aa, 0x10a2, 0x0000, 0x5aaa, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b4d, 0x632c, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2944, 0x8410, 0x8410, 0x8430, 0x8c51, 0x94b2, 0x73ae, 0xa103, 0xe2e8, 0xdbec, 0xe3cc, 0xdbab, 0x93ce, 0x8c2f, 0x8c2f, 0x8c0f, 0x840f, 0x840f, 0x840f, 0x840f, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x83ef, 0x83ef, 0x8410, 0x7bef, 0x7bef, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x7bef, 0x8410, 0x8410, 0x8410, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x7bef, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x8410, 0x7bcf, 0x738e, 0x73af, 0x7bcf, 0x7bcf, 0x5aeb, 0x0861, 0x0820, 0x738e, 0x7bcf, 0x73ae, 0x73ae, 0x7bcf, 0x6b2c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a2, 0x8c51, 0x94b2, 0x94b2, 0x94b2, 0x9cf3, 0x8471, 0xa1a6, 0xda87, 0xe42d, 0xe44d, 0xdc2d, 0x9c70, 0x9cb2, 0x9cb1, 0x9c92, 0x9491, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9472, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8c71, 0x8410, 0x8430, 0x8c51, 0x8c51, 0x5aeb, 0x0000, 0x2104, 0x8c51, 0x8430, 0x8430, 0x8430, 0x8c71, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x6b6d, 0x9492, 0x9cd3, 0xa514, 0xa534, 0x94f3, 0xa249, 0xd103, 0xd2a8, 0xdac8, 0xc2e9, 0x732c, 0x736d, 0x736d, 0x736d, 0x736d, 0x6b6d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x6b6d, 0x738e, 0x73ae, 0x7bef, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8c71, 0x8c71, 0x8c71, 0x8c71, 0x8c51, 0x8410, 0x8410, 0x8430, 0x7bf0, 0x528a, 0x0000, 0x4228, 0x9cd3, 0x9492, 0x9492, 0x8c51, 0x8410, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0x5289, 0x630c, 0x738e, 0x73ae, 0x6bae, 0x9269, 0xc801, 0xc803, 0xd002, 0xa104, 0x4185, 0x4185, 0x3985, 0x3985, 0x3185, 0x3185, 0x3165, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x4208, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x4228, 0x4a49, 0x4228, 0x31a6, 0x0020, 0x31a6, 0x62eb, 0x5acb, 0x5acb, 0x4a28, 0x39c7, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3165, 0x5aaa, 0x5269, 0x52aa, 0x5acb, 0x5b0c, 0x8b0b, 0xc8e4, 0xc864, 0xd004, 0x9185, 0x3985, 0x41a5, 0x3985, 0x3985, 0x3185, 0x3185, 0x3185, 0x3165, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x31a6, 0x39c7, 0x39c7, 0x2945, 0x10a2, 0x39a6, 0x41e7, 0x39c7, 0x39c7, 0x41e7, 0x4228, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a2, 0x62eb, 0x5aeb, 0x5acb, 0x62eb, 0x630c, 0x732c, 0xc0c5, 0xc824, 0xd002, 0x71c6, 0x3985, 0x41a5, 0x3985, 0x3985, 0x3985, 0x3185, 0x3185, 0x3185, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x31a6, 0x39e7, 0x39e7, 0x18e3, 0x18c3, 0x4a48, 0x4a28, 0x4a28, 0x4a28, 0x5269, 0x4a69, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x5acb, 0x7bae, 0x738e, 0x736d, 0x6b6d, 0x736d, 0xb9c6, 0xc905, 0xc964, 0x7289, 0x5269, 0x5a89, 0x5289, 0x5289, 0x5269, 0x5269, 0x5269, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a69, 0x4a49, 0x4a69, 0x528a, 0x4a49, 0x18c3, 0x2945, 0x5aca, 0x5aaa, 0x5acb, 0x630c, 0x736d, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0x8410, 0x8c51, 0x8c51, 0x8c51, 0x8451, 0xab0b, 0xd964, 0xcb09, 0x7b8d, 0x7bae, 0x7bae, 0x7bae, 0x7bae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x738e, 0x73ae, 0x738e, 0x738e, 0x738e, 0x73ae, 0x738e, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x738e, 0x738e, 0x738e, 0x6b6d, 0x630c, 0x2124, 0x41e7, 0x7bcf, 0x7bcf, 0x7bef, 0x8410, 0x7bae, 0x20e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x2924, 0x4228, 0x528a, 0x528a, 0x4228, 0x4104, 0x8081, 0x61c6, 0x4207, 0x4a07, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x41e7, 0x4208, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x3186, 0x1082, 0x1082, 0x39c7, 0x4228, 0x4228, 0x39c7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6110, 0xc318, 0xc318, 0x6110, 0x0000, 0x0000, 0x0008, 0x0008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0xa210, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0xcf7b, 0x34a5, 0xb6b5, 0x96b5, 0x718c, 0xc749, 0x0180, 0xa240, 0x4108, 0x6110, 0x6110, 0x6110, 0x6110, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x0000, 0x2842, 0xd394, 0x96b5, 0x75ad, 0xb294, 0xeb5a, 0x2008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8e73, 0x79ce, 0x59ce, 0x59ce, 0x39ce, 0x55a5, 0xaa92, 0x64d9, 0x27a2, 0x4431, 0x6539, 0x6531, 0x6531, 0x6531, 0x6531, 0x6529, 0x6529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x6529, 0x0421, 0x0000, 0xcb5a, 0xf7bd, 0x38c6, 0x39c6, 0x39c6, 0xd7bd, 0xe739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6110, 0xb294, 0xb6b5, 0x55ad, 0x14a5, 0x149d, 0x1084, 0xa5a1, 0x65d1, 0xc5b9, 0x2339, 0x0329, 0x0329, 0x0329, 0x0321, 0x0321, 0xe320, 0xe320, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x0421, 0xe318, 0x0000, 0x2421, 0x718c, 0xb294, 0xf39c, 0x55ad, 0x75ad, 0x4d6b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8631, 0x3084, 0x8e73, 0xeb5a, 0xeb5a, 0x0c63, 0xeb6a, 0xa4b8, 0x84c8, 0xc4c8, 0xa248, 0x6010, 0x6118, 0x6110, 0x6110, 0x4110, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x4108, 0x0000, 0x6108, 0x284a, 0x2842, 0x284a, 0x8a52, 0xae73, 0x8e73, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x494a, 0xeb5a, 0x6952, 0xcb5a, 0xeb62, 0x2c63, 0xa96a, 0x84c0, 0x24c8, 0x44d0, 0x2260, 0x0008, 0x0010, 0x0010, 0x0008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc639, 0x494a, 0x2842, 0x0842, 0xe741, 0xcb5a, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x494a, 0x8a52, 0xaa5a, 0xcb5a, 0xeb62, 0x4d5b, 0x0882, 0x02c8, 0x64c8, 0x44d0, 0x4280, 0x2010, 0x2018, 0x2010, 0x2008, 0x0008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0x284a, 0x0842, 0x2842, 0x0842, 0x284a, 0x6531, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe320, 0xcb5a, 0x8a52, 0xaa5a, 0xcb5a, 0xeb62, 0x0c53, 0xc789, 0x02d0, 0x64c8, 0x44d0, 0x4398, 0x2018, 0x2018, 0x2010, 0x2010, 0x0008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0xe741, 0xe741, 0x0842, 0x2842, 0x0842, 0xe739, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0x0c63, 0xcb5a, 0xeb62, 0xeb62, 0x2c6b, 0xeb52, 0x6591, 0x03d8, 0x64c8, 0x44d0, 0x63b0, 0x4020, 0x2018, 0x2010, 0x2010, 0x2008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0xe741, 0x484a, 0x694a, 0x694a, 0x284a, 0x284a, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc739, 0xaa5a, 0x0842, 0x0842, 0xe741, 0x284a, 0x894a, 0xc390, 0x03d8, 0x23d0, 0x03d0, 0x03c0, 0x2020, 0x0018, 0x0010, 0x0010, 0x0008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x6110, 0x0000, 0x6118, 0x8218, 0x0329, 0xe741, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8a52, 0x4d6b, 0x75ad, 0xd7bd, 0xb6b5, 0xf7bd, 0x8d73, 0x00a0, 0x84d8, 0xa4d0, 0xa4d8, 0xc3c8, 0xa138, 0x6120, 0x6120, 0x6118, 0x6110, 0x4110, 0x4108, 0x4108, 0x4108, 0x2008, 0x2008, 0x2008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x6108, 0x8210, 0x8210, 0x6108, 0x0000, 0x0000, 0x0000, 0xae73, 0xb6b5, 0x76b5, 0x96b5, 0xd39c, 0x0842, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x2008, 0xae7b, 0xdbde, 0x9ef7, 0x9ef7, 0x9ef7, 0xffff, 0xcf83, 0x00a8, 0x88e2, 0xece3, 0x0ce4, 0xabdb, 0x0a83, 0xca62, 0xca62, 0xca62, 0xaa5a, 0xaa5a, 0xaa5a, 0xaa52, 0xaa52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0x8a52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0x8a52, 0xaa52, 0xaa52, 0xaa52, 0x8a52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0x8a52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0x8a52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0x8a52, 0xaa52, 0x8a52, 0x8a52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0x8a52, 0x8a52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0x8a52, 0xcb5a, 0x2c63, 0x4d63, 0x0c63, 0x4529, 0x0000, 0x0000, 0x9294, 0xffff, 0x7def, 0x9ef7, 0x7def, 0x38c6, 0xa631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0xf39c, 0x7def, 0x1ce7, 0x3ce7, 0x3ce7, 0x5de7, 0xca6a, 0x00b8, 0x6ae3, 0x8ee4, 0x8eec, 0x2ce4, 0x8c93, 0x2b73, 0x4c73, 0x2c6b, 0x2c6b, 0x2c6b, 0x2c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x4d6b, 0xae73, 0xae73, 0xcf7b, 0x0842, 0x0000, 0x0000, 0xeb5a, 0x5def, 0xfbde, 0x1ce7, 0x1ce7, 0x5def, 0xeb5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xa210, 0x55ad, 0x1ce7, 0xdbde, 0xfbde, 0xfcde, 0x9ace, 0xa651, 0x00c0, 0xabe3, 0x6de4, 0x4de4, 0x0ce4, 0x6b9b, 0xea6a, 0x0b6b, 0xeb6a, 0xeb62, 0xeb62, 0xeb62, 0xeb5a, 0xeb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0x2c63, 0x6d6b, 0x8e6b, 0xae73, 0x494a, 0x0000, 0x0000, 0xc739, 0xdbde, 0xbbd6, 0xdbde, 0xbad6, 0xfcde, 0x8e73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0xd7bd, 0xbbd6, 0xbad6, 0xbad6, 0xdbde, 0xf7bd, 0x0351, 0x83d8, 0xcbe3, 0x4dec, 0x2de4, 0x0bec, 0x6b9b, 0xca62, 0xea6a, 0xea62, 0xea62, 0xca62, 0xca5a, 0xca5a, 0xca5a, 0xaa5a, 0xaa5a, 0xaa5a, 0xaa5a, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0xaa52, 0x2c63, 0x4d6b, 0x6d6b, 0x8e6b, 0x8a52, 0x2000, 0x0000, 0xe318, 0x59ce, 0x9ad6, 0x79ce, 0x79ce, 0xbad6, 0x3184, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xe739, 0x18c6, 0x79ce, 0x79ce, 0x79ce, 0xbad6, 0x55a5, 0xa148, 0x84d9, 0xcbe3, 0x2cec, 0x0ce4, 0xebeb, 0x6ba3, 0xa962, 0xca6a, 0xca62, 0xaa5a, 0xaa5a, 0xaa5a, 0xaa52, 0xaa52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0xaa52, 0x0c63, 0x4d63, 0x4d6b, 0x4d6b, 0xcb5a, 0x6108, 0x0000, 0x4108, 0x96b5, 0x59c6, 0x38c6, 0x38c6, 0x59c6, 0xd39c, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x2000, 0x0000, 0x494a, 0x18c6, 0x18c6, 0x38c6, 0x38c6, 0x79ce, 0x718c, 0x6058, 0xe5e1, 0xcbe3, 0x0bec, 0xebe3, 0xcbf3, 0x4aab, 0x895a, 0xa962, 0xa95a, 0x895a, 0x895a, 0x8952, 0x8952, 0x8952, 0x6952, 0x6952, 0x6952, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x8a52, 0xeb5a, 0x0c63, 0x2c63, 0x2c63, 0xcb5a, 0x8210, 0x0000, 0x0000, 0x9294, 0xf7bd, 0xd7bd, 0xd7bd, 0xf7bd, 0xf39c, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x494a, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0x59c6, 0x8e73, 0x0058, 0x26e2, 0xaae3, 0xcbeb, 0xcbe3, 0xcaf3, 0x4aab, 0x685a, 0x8962, 0x895a, 0x695a, 0x6952, 0x6952, 0x694a, 0x694a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x494a, 0x694a, 0xcb5a, 0x0c5b, 0x0c63, 0x0c5b, 0xcb5a, 0x8210, 0x0000, 0x0000, 0xcf7b, 0xb6b5, 0x75ad, 0x75ad, 0x96b5, 0xf39c, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x8952, 0x96b5, 0xb6b5, 0xb6b5, 0xb6b5, 0xf7bd, 0x0c63, 0x0060, 0x46ea, 0xaae3, 0xaaeb, 0xaae3, 0xaaf3, 0x49b3, 0x685a, 0x685a, 0x685a, 0x4852, 0x4852, 0x484a, 0x484a, 0x284a, 0x284a, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x494a, 0xab52, 0xeb5a, 0xeb5a, 0xeb5a, 0xcb52, 0x8210, 0x0000, 0x0000, 0x2c63, 0x75ad, 0x14a5, 0x34a5, 0x34a5, 0xd39c, 0xe320, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xeb62, 0x55a5, 0x55ad, 0x75ad, 0x75ad, 0xb6b5, 0xaa52, 0x0070, 0x26ea, 0x89e3, 0x8aeb, 0x8ae3, 0x89eb, 0x29bb, 0x485a, 0x485a, 0x4852, 0x2852, 0x284a, 0x284a, 0x2842, 0x2842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x494a, 0xaa52, 0xcb5a, 0xcb5a, 0xcb5a, 0xaa52, 0x8210, 0x0000, 0x0000, 0x8a52, 0x14a5, 0xd39c, 0xd39c, 0xd39c, 0x9294, 0x6529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x8e73, 0xd39c, 0x149d, 0x14a5, 0x34a5, 0x55a5, 0x484a, 0x0078, 0x26ea, 0x69e3, 0x69e3, 0x69e3, 0x69eb, 0x29bb, 0x275a, 0x2752, 0x2752, 0x074a, 0x074a, 0x0742, 0x0742, 0x0742, 0xe741, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0x2842, 0x8a52, 0xaa52, 0xaa52, 0xaa52, 0x8a52, 0x8210, 0x0000, 0x0000, 0xe739, 0xb294, 0x928c, 0x928c, 0x9294, 0x718c, 0xc739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x4108, 0xae73, 0x718c, 0xb294, 0xb294, 0xf39c, 0xd39c, 0x0742, 0xa080, 0x05ea, 0x48e3, 0x48eb, 0x48e3, 0x48eb, 0x09bb, 0x275a, 0x0752, 0x074a, 0x074a, 0xe741, 0xe741, 0xe739, 0xe739, 0xe739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0x2842, 0x694a, 0x8a52, 0x8a52, 0x8a52, 0x694a, 0x8210, 0x0000, 0x0000, 0x4529, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x8a52, 0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x4108, 0xef7b, 0x1084, 0x518c, 0x718c, 0xb294, 0x718c, 0xc641, 0xc180, 0xe5e9, 0x28e3, 0x28eb, 0x28e3, 0x08eb, 0xe8ca, 0x065a, 0xe649, 0xe649, 0xc641, 0xc641, 0xc639, 0xc639, 0xc639, 0xa639, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0x0842, 0x494a, 0x694a, 0x694a, 0x694a, 0x494a, 0x8210, 0x0000, 0x0000, 0xe318, 0xcf7b, 0xef7b, 0xcf7b, 0xef7b, 0xcf7b, 0x8e73, 0x6d6b, 0xaa5a, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6108, 0xcf7b, 0xcf7b, 0xef83, 0x1084, 0x718c, 0x3084, 0x8539, 0xa298, 0xa4e9, 0xe7e2, 0x07e3, 0x07e3, 0xe7ea, 0xe7ca, 0x065a, 0xc649, 0xc649, 0xc641, 0xa639, 0xa639, 0xa639, 0xa631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0xe739, 0x2842, 0x494a, 0x494a, 0x494a, 0x2842, 0x8210, 0x0000, 0x0000, 0x6110, 0x6d6b, 0x8e73, 0x8e73, 0x8e73, 0x6d73, 0x2c63, 0xcb5a, 0x0c63, 0x8a52, 0x8110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6110, 0x4d6b, 0x8e73, 0xae7b, 0xef7b, 0x3084, 0xef7b, 0x6439, 0xc298, 0x64e9, 0xc6e2, 0xe7ea, 0xc7e2, 0xc6ea, 0xc7ca, 0x065a, 0xa549, 0xa541, 0xa541, 0x8539, 0x8531, 0x8531, 0x8531, 0x8531, 0x6531, 0x6531, 0x6531, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0xc739, 0x0842, 0x2842, 0x2842, 0x2842, 0xe841, 0x6108, 0x0000, 0x0000, 0x0000, 0x0c63, 0x4d6b, 0x2c6b, 0x2c6b, 0x4d6b, 0xcb5a, 0x0010, 0x8118, 0x4531, 0xc739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xa210, 0x4d6b, 0x2c6b, 0x6d6b, 0xae73, 0xef7b, 0xae73, 0xe330, 0xe298, 0x03e9, 0x86e2, 0xa6ea, 0xa6e2, 0xa6ea, 0xc7ca, 0x065a, 0x8541, 0x8541, 0x8539, 0x8539, 0x6531, 0x6531, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0xc739, 0xe739, 0x0842, 0x0842, 0x0842, 0xc739, 0x6108, 0x0000, 0x0000, 0x0000, 0xcb5a, 0xeb62, 0xeb5a, 0xeb62, 0xcb5a, 0xeb62, 0x308c, 0x308c, 0xef7b, 0x8952, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x8210, 0xcb5a, 0x0c63, 0x2c6b, 0x6d6b, 0xae73, 0x8e73, 0x0331, 0x0299, 0x22e8, 0x45e2, 0x86ea, 0x86e2, 0x66ea, 0xa7ca, 0xe659, 0x6441, 0x6441, 0x6439, 0x6431, 0x4431, 0x4429, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0xa631, 0xe739, 0xe739, 0xe739, 0xe741, 0x8631, 0x0000, 0x0000, 0x0000, 0x0000, 0x694a, 0xaa5a, 0x8a52, 0xaa5a, 0x0842, 0x1084, 0x5de7, 0x3ce7, 0x1ce7, 0x79ce, 0xeb5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xe318, 0xaa5a, 0xcb5a, 0x0c63, 0x2c6b, 0x6d73, 0x4d6b, 0x0331, 0x0399, 0x02e8, 0x05e2, 0x65ea, 0x65e2, 0x45ea, 0x86ca, 0xe651, 0x6441, 0x6439, 0x4431, 0x4431, 0x2429, 0x2429, 0x2429, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x8631, 0xc739, 0xc739, 0xc739, 0xc739, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x2842, 0x6952, 0x694a, 0x6952, 0xe741, 0x6d6b, 0x79ce, 0x59ce, 0x59ce, 0xbad6, 0xd39c, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x2429, 0xaa52, 0x8a52, 0xcb5a, 0x0c63, 0x4d6b, 0x2c63, 0x0331, 0x0399, 0x02e8, 0xc4e1, 0x45ea, 0x45e2, 0x25ea, 0x65da, 0xe559, 0x4339, 0x4439, 0x2431, 0x2431, 0x2429, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0xa631, 0xa631, 0xa631, 0xa639, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0xc739, 0x284a, 0x284a, 0x484a, 0xc739, 0xeb5a, 0xb6b5, 0x96b5, 0x96b5, 0x96b5, 0x55ad, 0xa631, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x2421, 0x2842, 0x284a, 0x8a52, 0xca5a, 0x0c63, 0xeb62, 0x0331, 0x03a9, 0x02e8, 0x23e1, 0x04e2, 0x04e2, 0x04ea, 0x25da, 0xc559, 0x2339, 0x2331, 0x0331, 0x0329, 0x0321, 0xe320, 0xe320, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x4529, 0x8531, 0x8631, 0x8631, 0x6531, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0xa639, 0xa631, 0xa639, 0x4429, 0x8a52, 0xf39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0x494a, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x2429, 0x4529, 0x0421, 0xa639, 0x0842, 0x6952, 0x8a52, 0x2331, 0x03b9, 0x01f0, 0x22e0, 0x82e0, 0xa2e0, 0x82e8, 0x03d1, 0x2349, 0x6120, 0x6120, 0x6118, 0x4110, 0x4110, 0x4008, 0x2008, 0x2008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x6108, 0x8210, 0x8210, 0x8210, 0x6110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x0000, 0x2842, 0x518c, 0xef7b, 0xef83, 0xef83, 0xef7b, 0x2c63, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xa639, 0x8631, 0xa218, 0x8631, 0x0742, 0x694a, 0x8a52, 0x2339, 0x23b1, 0x01f0, 0x02e0, 0x02e0, 0x02e0, 0x02e8, 0x82d0, 0x0249, 0x4020, 0x2018, 0x2010, 0x0010, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x0000, 0xa631, 0x6d6b, 0x2c63, 0x2c6b, 0x2c63, 0x2c6b, 0xeb5a, 0x4108, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xc739, 0xa631, 0xc318, 0x8631, 0x0842, 0x694a, 0x8a52, 0x4339, 0x23b9, 0x01f0, 0x22e0, 0x02e0, 0x02e0, 0x02e8, 0xa2d0, 0x0349, 0x4020, 0x4018, 0x2018, 0x2010, 0x2008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2429, 0xaa52, 0x694a, 0x6952, 0x694a, 0x6952, 0x484a, 0x8210, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xc739, 0x8631, 0xc318, 0x8631, 0x0842, 0x694a, 0x8a52, 0x4339, 0x23b9, 0x01f0, 0x22e0, 0x02e0, 0x02e0, 0x02e8, 0x82d0, 0x0349, 0x4020, 0x4020, 0x4018, 0x2010, 0x2008, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2421, 0xa631, 0x4108, 0xc318, 0xc218, 0x8210, 0x2421, 0x0421, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xa639, 0x6529, 0xc318, 0x8631, 0x0842, 0x694a, 0x8a52, 0x4439, 0x23b9, 0x01f0, 0x22e0, 0x02e0, 0x02e0, 0x02e8, 0xa2d0, 0x0349, 0x4120, 0x4020, 0x4018, 0x2010, 0x2008, 0x2008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2421, 0x6531, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x6529, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x8631, 0x4429, 0xe318, 0x8631, 0x0842, 0x694a, 0x8a52, 0x4439, 0x23b1, 0x01e8, 0x22e0, 0x02e0, 0x02e0, 0x02e8, 0xa2d0, 0x0349, 0x4120, 0x4020, 0x4018, 0x2010, 0x2008, 0x2008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2421, 0x6531, 0x0000, 0x2000, 0x2000, 0x0000, 0x0421, 0x8631, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6531, 0x2421, 0xc318, 0x8631, 0x0742, 0x494a, 0x8a52, 0x4439, 0x23b1, 0x01e8, 0x22e0, 0x02e0, 0x02e0, 0x02e8, 0xa2d0, 0x0349, 0x4120, 0x4020, 0x4018, 0x2010, 0x2008, 0x2008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x6529, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x6529, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6531, 0x2421, 0xc318, 0x8631, 0x0742, 0x494a, 0x8a52, 0x4339, 0x23b1, 0x01e8, 0x22e0, 0x02e0, 0x02e0, 0x02e8, 0xa2d0, 0x2349, 0x6120, 0x4020, 0x4018, 0x2010, 0x2008, 0x2008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x2421, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6531, 0x2421, 0xc318, 0x8631, 0x0742, 0x494a, 0x8a52, 0x4339, 0x23b1, 0x02e8, 0x22e0, 0x02e0, 0x02e0, 0x02e0, 0xa3d0, 0x2349, 0x6020, 0x4020, 0x4018, 0x4010, 0x2008, 0x2008, 0x2008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0xe318, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6529, 0x2421, 0xc318, 0x8631, 0x0742, 0x494a, 0x8a52, 0x4339, 0x23b1, 0x02e8, 0x22e0, 0x02e0, 0x02e0, 0x02e0, 0xa3d0, 0x2349, 0x6020, 0x4020, 0x4018, 0x4010, 0x2008, 0x2008, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0321, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x6110, 0x8210, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6531, 0x4529, 0xc318, 0x8631, 0x0742, 0x494a, 0x8a52, 0x2339, 0x23b1, 0x02e8, 0x22e0, 0x02e0, 0x02e0, 0x02e0, 0xa3d0, 0x2349, 0x6120, 0x4020, 0x4018, 0x4010, 0x2008, 0x2008, 0x2008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x2000, 0x4108, 0x4008, 0x4008, 0x4108, 0x2008, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe320, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0xa210, 0x2000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6531, 0x4529, 0xc318, 0x8631, 0x0742, 0x494a, 0x8a52, 0x2331, 0x03b1, 0x02e8, 0x22e0, 0x02e0, 0x02e0, 0x02e0, 0xa3d0, 0x2349, 0x6120, 0x4020, 0x4018, 0x4010, 0x2008, 0x2008, 0x2008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4008, 0x4108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0xe320, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6529, 0x4529, 0xc318, 0x8531, 0xe741, 0x494a, 0x8a52, 0x0331, 0x03b1, 0x02e8, 0x22e0, 0x02e0, 0x02e0, 0x02e0, 0xc3d0, 0x2349, 0x6120, 0x6120, 0x4018, 0x4010, 0x4010, 0x2008, 0x2008, 0x2008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x2421, 0x2421, 0xc318, 0x6531, 0xe741, 0x494a, 0x8a52, 0x0331, 0x03a9, 0x02e8, 0x22e0, 0x02e0, 0x02e0, 0x02e0, 0xa3d0, 0x2349, 0x6120, 0x6120, 0x4018, 0x4010, 0x4010, 0x2008, 0x2008, 0x2008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x0421, 0x0000, 0x0000, 0x0000, 0x2000, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xc318, 0xe318, 0xe318, 0x6531, 0xe741, 0x494a, 0x8a52, 0x0331, 0x2399, 0x02e8, 0x22e0, 0x02e0, 0x02e0, 0x02e0, 0xe3c8, 0x0349, 0x6120, 0x6120, 0x4018, 0x4010, 0x4010, 0x4008, 0x2008, 0x2008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x6108, 0x6108, 0x6108, 0x4108, 0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0xa210, 0x0000, 0x0000, 0x0000, 0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xc318, 0x4529, 0xc318, 0x8531, 0xe741, 0x494a, 0xaa5a, 0x0331, 0x0399, 0x02e8, 0x22e0, 0x02e0, 0x22e0, 0x02e0, 0x23c1, 0x0241, 0x8128, 0x8120, 0x6118, 0x6118, 0x6110, 0x6110, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x4108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0xe741, 0xc739, 0xc739, 0xe741, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xa218, 0x6529, 0xc318, 0x6531, 0x0742, 0x494a, 0xaa5a, 0x0331, 0x0399, 0x02e8, 0x22d8, 0x02e0, 0x22d8, 0x02e0, 0x03c1, 0x0241, 0xa128, 0x8120, 0x8120, 0x6118, 0x6110, 0x6110, 0x6110, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x4108, 0x4108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x8631, 0x4d6b, 0x4d6b, 0x4d6b, 0x0c63, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6110, 0x4529, 0xc318, 0x6531, 0xe741, 0x494a, 0xaa5a, 0xe330, 0xe298, 0x02e8, 0x22d8, 0x02e0, 0x22d8, 0x02e0, 0x03b9, 0x0241, 0xa128, 0xa228, 0xa120, 0x8118, 0x8118, 0x8110, 0x8110, 0x8110, 0x8110, 0x6110, 0x6110, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x4108, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0xe741, 0xcf7b, 0xae73, 0xcf7b, 0xe739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x6110, 0xa631, 0xa210, 0x6531, 0xe741, 0x494a, 0xaa5a, 0x4431, 0xe298, 0x03e8, 0x23d8, 0x03e0, 0x23d8, 0x02e0, 0x03b9, 0x0241, 0xc228, 0xc228, 0xa220, 0xa218, 0xa218, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x4108, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2429, 0x284a, 0x284a, 0x6531, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x4108, 0x8631, 0xa210, 0x6531, 0xe741, 0x484a, 0xaa5a, 0x8531, 0xa290, 0x03e8, 0x23d8, 0x03d8, 0x23d8, 0x02e0, 0x03b9, 0x0241, 0xc230, 0xe228, 0xc228, 0xc220, 0xa218, 0xa218, 0xa218, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0x8210, 0x4108, 0x8210, 0x8210, 0x8210, 0x8210, 0xa210, 0x8210, 0x8210, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa639, 0x8a52, 0xe741, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x4108, 0xa639, 0x8210, 0x6531, 0xe741, 0x284a, 0xaa5a, 0x8539, 0xa188, 0x23e8, 0x03d8, 0x03d8, 0x23d8, 0x03e0, 0x03b9, 0x0239, 0xe230, 0xe230, 0xe228, 0xc220, 0xc220, 0xc218, 0xc218, 0xc218, 0xc218, 0xa218, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0x4108, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0x8210, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x2008, 0xa631, 0xa210, 0x6529, 0xe739, 0x284a, 0xaa5a, 0xc639, 0xc178, 0x43e0, 0x03d8, 0x03d8, 0x23d8, 0x03e0, 0x43a9, 0xe230, 0x0339, 0x0331, 0x0329, 0xe328, 0xe320, 0xe320, 0xe318, 0xe318, 0xe318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0x6108, 0xa210, 0xc318, 0xc318, 0xc318, 0xc318, 0xa218, 0xa210, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x2000, 0x6531, 0xa210, 0x6529, 0xc739, 0x284a, 0xaa5a, 0xc739, 0xa178, 0x43e0, 0x03d8, 0x23d8, 0x23d8, 0x03e0, 0x43a9, 0xe230, 0x2339, 0x2331, 0x0331, 0x0329, 0x0321, 0x0321, 0x0321, 0xe320, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x6108, 0xa210, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xa210, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x4429, 0xa218, 0x4529, 0xc739, 0x284a, 0xaa5a, 0xe739, 0x6178, 0x43e0, 0x23d8, 0x23d8, 0x23d8, 0x03e0, 0x43a9, 0xe230, 0x2339, 0x4439, 0x2431, 0x2429, 0x2429, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8210, 0xc218, 0xe318, 0xe318, 0xe318, 0xe320, 0xc318, 0xa210, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0xe318, 0x4529, 0xc739, 0x284a, 0xaa5a, 0x0842, 0x6068, 0x43e0, 0x23d8, 0x23d8, 0x23d8, 0x03e0, 0x23a9, 0x0231, 0x4439, 0x4439, 0x4431, 0x4431, 0x2429, 0x2429, 0x2429, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0xa210, 0xa210, 0x0321, 0x0421, 0x0421, 0x0321, 0xc318, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xe320, 0x0421, 0x4529, 0xc739, 0x284a, 0x8a52, 0x4842, 0xc258, 0x03d8, 0x23d8, 0x23d8, 0x43d8, 0x03e0, 0x6491, 0x0231, 0x6441, 0x6439, 0x6439, 0x6431, 0x4431, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0xc318, 0xc318, 0x0421, 0x2421, 0x2421, 0x0421, 0xe318, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xe320, 0x2421, 0x2421, 0xa639, 0x284a, 0x6952, 0x894a, 0x0461, 0x02d8, 0x43d8, 0x23d8, 0x43d0, 0x03e0, 0x6491, 0x0331, 0x8549, 0x8541, 0x8539, 0x6531, 0x6531, 0x6531, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0xc318, 0xc318, 0x0421, 0x2421, 0x2421, 0x2421, 0xe320, 0xc318, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x6531, 0x6531, 0xc639, 0x0842, 0x6952, 0xaa4a, 0x2459, 0x02d8, 0x43d8, 0x23d8, 0x43d0, 0x03e0, 0x4491, 0x2331, 0xa549, 0xa541, 0xa539, 0x8539, 0x8531, 0x8531, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x0421, 0xc318, 0x2421, 0x4529, 0x4529, 0x2429, 0x0421, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x4108, 0xa210, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0xc739, 0x2842, 0x494a, 0x6952, 0xaa5a, 0xeb52, 0x2451, 0x02d0, 0x44d8, 0x03d8, 0x23d0, 0x03d8, 0x4379, 0x6439, 0xc649, 0xc641, 0xa641, 0xa639, 0xa639, 0xa631, 0xa631, 0xa631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0xa631, 0x4529, 0xe318, 0x2421, 0x4529, 0x4529, 0x4429, 0x0421, 0xc318, 0x0000, 0x0000, 0xe318, 0xc318, 0xc318, 0x0421, 0x0421, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x0842, 0x8952, 0xaa52, 0xeb5a, 0x2c6b, 0x4d63, 0x6559, 0x02c8, 0xc4d8, 0xc4d8, 0xc4d0, 0xa4d8, 0x8481, 0xa541, 0x2752, 0x074a, 0x074a, 0x0742, 0xe741, 0xe741, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xa631, 0x2421, 0x6529, 0x8631, 0x8631, 0x8631, 0x6529, 0xc318, 0x0000, 0x8210, 0xe739, 0xc739, 0xc739, 0xc739, 0xe739, 0xe320, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2842, 0xeb62, 0x0c63, 0x2c6b, 0x6d6b, 0x8e6b, 0x075a, 0x42c0, 0xc5d9, 0x06da, 0xe6d9, 0xe5d9, 0x267a, 0x685a, 0xa962, 0xa95a, 0x895a, 0x895a, 0x8952, 0x8952, 0x8952, 0x8a52, 0x8952, 0x8952, 0x8952, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x8a52, 0x694a, 0xe739, 0x0842, 0x494a, 0x494a, 0x2842, 0xe739, 0xe318, 0x0000, 0x2429, 0x8952, 0x494a, 0x494a, 0x494a, 0x6952, 0xe320, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x4d6b, 0x4d6b, 0x8e73, 0xae7b, 0xef7b, 0x8a62, 0x02b8, 0x67da, 0xa7da, 0xa7da, 0x86da, 0xc982, 0x0b6b, 0x2c73, 0x2b6b, 0x2c6b, 0x0c6b, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x0c63, 0x8a52, 0x8a52, 0xcb5a, 0xcb5a, 0xcb5a, 0x694a, 0xc318, 0x0000, 0xc739, 0xeb62, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa639, 0xcf7b, 0xae7b, 0xef7b, 0x1084, 0x518c, 0x0c6b, 0x00a8, 0xc8e2, 0x4adb, 0x49e3, 0x08db, 0x4b8b, 0xad7b, 0xae83, 0xad7b, 0xae7b, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x8e73, 0x2c63, 0x0c63, 0x4d6b, 0x6d6b, 0x4d6b, 0xaa52, 0xa210, 0x0000, 0xaa5a, 0x6d6b, 0x4d6b, 0x4d6b, 0x4d6b, 0x2c63, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4429, 0x1084, 0x1084, 0x3084, 0x518c, 0xb294, 0xae73, 0x03a1, 0xe8e2, 0xecdb, 0xcce3, 0xabdb, 0xce93, 0x2f8c, 0x2f8c, 0x0f8c, 0x0f84, 0x0f84, 0x0f84, 0x0f84, 0x1084, 0x1084, 0x1084, 0x1084, 0xef7b, 0xef83, 0xef83, 0x1084, 0xef7b, 0xef7b, 0xef7b, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0xef7b, 0xef7b, 0x1084, 0x1084, 0x1084, 0xef7b, 0x1084, 0x1084, 0x1084, 0x1084, 0xef7b, 0xef7b, 0xef7b, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0xef7b, 0x1084, 0xcf7b, 0x8e73, 0xaf73, 0xcf7b, 0xcf7b, 0xeb5a, 0x6108, 0x2008, 0x8e73, 0xcf7b, 0xae73, 0xae73, 0xcf7b, 0x2c6b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa218, 0x518c, 0xb294, 0xb294, 0xb294, 0xf39c, 0x7184, 0xa6a1, 0x87da, 0x2de4, 0x4de4, 0x2ddc, 0x709c, 0xb29c, 0xb19c, 0x929c, 0x9194, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x7294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x9294, 0x718c, 0x1084, 0x3084, 0x518c, 0x518c, 0xeb5a, 0x0000, 0x0421, 0x518c, 0x3084, 0x3084, 0x3084, 0x718c, 0x2c63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x6d6b, 0x9294, 0xd39c, 0x14a5, 0x34a5, 0xf394, 0x49a2, 0x03d1, 0xa8d2, 0xc8da, 0xe9c2, 0x2c73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d6b, 0x4d6b, 0x4d6b, 0x4d6b, 0x4d6b, 0x4d6b, 0x4d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x6d6b, 0x8e73, 0xae73, 0xef7b, 0xef7b, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x718c, 0x718c, 0x718c, 0x718c, 0x518c, 0x1084, 0x1084, 0x3084, 0xf07b, 0x8a52, 0x0000, 0x2842, 0xd39c, 0x9294, 0x9294, 0x518c, 0x1084, 0x0842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8631, 0x8952, 0x0c63, 0x8e73, 0xae73, 0xae6b, 0x6992, 0x01c8, 0x03c8, 0x02d0, 0x04a1, 0x8541, 0x8541, 0x8539, 0x8539, 0x8531, 0x8531, 0x6531, 0x6531, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x8631, 0x8631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xe739, 0x0842, 0x0842, 0x0842, 0xe739, 0xe739, 0x2842, 0x494a, 0x2842, 0xa631, 0x2000, 0xa631, 0xeb62, 0xcb5a, 0xcb5a, 0x284a, 0xc739, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6531, 0xaa5a, 0x6952, 0xaa52, 0xcb5a, 0x0c5b, 0x0b8b, 0xe4c8, 0x64c8, 0x04d0, 0x8591, 0x8539, 0xa541, 0x8539, 0x8539, 0x8531, 0x8531, 0x8531, 0x6531, 0x6531, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x6529, 0xa631, 0xc739, 0xc739, 0x4529, 0xa210, 0xa639, 0xe741, 0xc739, 0xc739, 0xe741, 0x2842, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa218, 0xeb62, 0xeb5a, 0xcb5a, 0xeb62, 0x0c63, 0x2c73, 0xc5c0, 0x24c8, 0x02d0, 0xc671, 0x8539, 0xa541, 0x8539, 0x8539, 0x8539, 0x8531, 0x8531, 0x8531, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x6529, 0xa631, 0xe739, 0xe739, 0xe318, 0xc318, 0x484a, 0x284a, 0x284a, 0x284a, 0x6952, 0x694a, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0xcb5a, 0xae7b, 0x8e73, 0x6d73, 0x6d6b, 0x6d73, 0xc6b9, 0x05c9, 0x64c9, 0x8972, 0x6952, 0x895a, 0x8952, 0x8952, 0x6952, 0x6952, 0x6952, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x694a, 0x494a, 0x694a, 0x8a52, 0x494a, 0xc318, 0x4529, 0xca5a, 0xaa5a, 0xcb5a, 0x0c63, 0x6d73, 0x0842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8631, 0x1084, 0x518c, 0x518c, 0x518c, 0x5184, 0x0bab, 0x64d9, 0x09cb, 0x8d7b, 0xae7b, 0xae7b, 0xae7b, 0xae7b, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0x8e73, 0xae73, 0x8e73, 0x8e73, 0x8e73, 0xae73, 0x8e73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0xae73, 0x8e73, 0x8e73, 0x8e73, 0x6d6b, 0x0c63, 0x2421, 0xe741, 0xcf7b, 0xcf7b, 0xef7b, 0x1084, 0xae7b, 0xe320, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x2429, 0x2842, 0x8a52, 0x8a52, 0x2842, 0x0441, 0x8180, 0xc661, 0x0742, 0x074a, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0xe741, 0x0842, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xc739, 0xc739, 0xc739, 0x8631, 0x8210, 0x8210, 0xc739, 0x2842, 0x2842, 0xc739, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
         0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
 };
 const tImage_RGB Image_Battery = { image_data_Image_Battery, 160, 75,
-                               16 };
+                               16, IMAGE_RGB_BIG_ENDIAN };
 
@@ -11,6 +11,7 @@
 * conversion type: Color, not_used not_used
 * split to rows: yes
 * bits per pixel: 16
+* byte order: big-endian (panel wire order)
 *
 * preprocess:
 *  main scan direction: top_to_bottom
@@ -24,7 +25,8 @@
      uint16_t width;
      uint16_t height;
      uint8_t dataSize;
-     } tImage;
+     uint8_t flags;
+     } tImage_RGB;
 */
 #include <stdint.h>
 #include "picts.h"
@@ -110,84 +112,84 @@ static const uint16_t image_data_Image_Battery_2[12324] = {
     // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
     // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
     // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0040, 0x0040, 0x0060, 0x0060, 0x0080, 0x0080, 0x00a0, 0x00a0, 0x00a0, 0x00a0, 0x00a0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00a0, 0x00a0, 0x00a0, 0x00a0, 0x0080, 0x0080, 0x0060, 0x0060, 0x0040, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0040, 0x0040, 0x0060, 0x0060, 0x0080, 0x0080, 0x00a0, 0x00c0, 0x08c1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x0901, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08c1, 0x00c1, 0x00a0, 0x00a0, 0x0080, 0x0060, 0x0060, 0x0060, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0080, 0x00a0, 0x00a0, 0x00a0, 0x00c1, 0x00e1, 0x00e1, 0x0101, 0x0101, 0x0101, 0x0101, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0101, 0x0101, 0x0101, 0x0101, 0x00e1, 0x00e1, 0x00c1, 0x00a0, 0x00a0, 0x0080, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2985, 0x4a89, 0x52aa, 0x4a89, 0x31c6, 0x10e2, 0x00a0, 0x0901, 0x1161, 0x1161, 0x1181, 0x11a1, 0x11a1, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11c2, 0x11a1, 0x11a1, 0x11a1, 0x1181, 0x1161, 0x1141, 0x08e1, 0x08a1, 0x2985, 0x4a89, 0x52aa, 0x528a, 0x39c7, 0x0881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5aeb, 0xb596, 0xc618, 0xc638, 0xbdd7, 0x9492, 0x29a5, 0x00a0, 0x5404, 0x8628, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x85e8, 0x8628, 0x2a82, 0x10e2, 0x8410, 0xbdd7, 0xc638, 0xc618, 0xb5b6, 0x7bef, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x9cd3, 0xc638, 0xc638, 0xc618, 0xbdd7, 0x8c51, 0x1943, 0x1982, 0x75a6, 0x8e29, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8e09, 0x8609, 0x8e49, 0x5425, 0x00e0, 0x6b8d, 0xbdd7, 0xc618, 0xc638, 0xc638, 0xad75, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a6, 0xa534, 0xa534, 0x94b2, 0x8c51, 0x8430, 0x5aeb, 0x08e1, 0x3b24, 0x8607, 0x7dc7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75c7, 0x75e7, 0x6526, 0x0921, 0x3a47, 0x8430, 0x8c51, 0x9492, 0xa514, 0xa534, 0x5aca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x7bae, 0x528a, 0x39c7, 0x39c7, 0x41e7, 0x31e6, 0x0921, 0x5c65, 0x8606, 0x6da5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x65a5, 0x6586, 0x2222, 0x1983, 0x4208, 0x39c7, 0x39c7, 0x4a49, 0x736d, 0x632c, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x528a, 0x4a28, 0x41e7, 0x4a28, 0x4a28, 0x4a28, 0x29a4, 0x19c2, 0x7586, 0x7de6, 0x75a5, 0x6585, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x6dc6, 0x3b24, 0x1943, 0x4a48, 0x4a28, 0x4a28, 0x4208, 0x41e7, 0x5acb, 0x2103, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x4a49, 0x4208, 0x4208, 0x41e7, 0x41e7, 0x4208, 0x1163, 0x32a3, 0x7de6, 0x85e6, 0x75a6, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d65, 0x6de7, 0x4c05, 0x1121, 0x3a06, 0x41e8, 0x4207, 0x4208, 0x4207, 0x4a28, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0x5269, 0x4a28, 0x4208, 0x39e7, 0x39c7, 0x4207, 0x1943, 0x4be4, 0x8607, 0x85c7, 0x75a6, 0x5d85, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x65a7, 0x5ca6, 0x1982, 0x31c6, 0x41e7, 0x4208, 0x4208, 0x4208, 0x39e7, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x528a, 0x4a28, 0x41e7, 0x3185, 0x3165, 0x29c5, 0x1162, 0x5ca6, 0x8607, 0x85c7, 0x75a6, 0x5d86, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x5566, 0x65a7, 0x6548, 0x21e3, 0x29a4, 0x39a6, 0x41e7, 0x41e7, 0x41e7, 0x41e7, 0x4228, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x528a, 0x3185, 0x528a, 0x5269, 0x4208, 0x41c7, 0x29a5, 0x19e2, 0x6d46, 0x85e7, 0x85c7, 0x75a5, 0x5564, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4d45, 0x6587, 0x6da8, 0x2a64, 0x1983, 0x4a08, 0x5269, 0x528a, 0x5269, 0x2944, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x5aeb, 0xad55, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0x4a89, 0x2240, 0x75c7, 0x9e2c, 0xae6f, 0x9e2d, 0x8e0c, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x960e, 0x962d, 0x4346, 0x0140, 0xbdf7, 0xe73c, 0xdefb, 0xdefc, 0xc638, 0x632c, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0881, 0xa534, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xe71c, 0x3206, 0x3322, 0x7de8, 0xb690, 0xbed2, 0xb691, 0xae6f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa64f, 0xa650, 0xae71, 0xb6b1, 0x6429, 0x00e0, 0xbdd7, 0xf7be, 0xef5d, 0xef5d, 0xef7d, 0xd69a, 0x2985, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xbdf7, 0xe71c, 0xdefb, 0xdedb, 0xe71c, 0xbdf7, 0x0161, 0x43e4, 0x8609, 0xb691, 0xb6b1, 0xae70, 0xa64e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2e, 0x9e2f, 0xa650, 0xaeb1, 0x74ab, 0x0100, 0x8c91, 0xe73d, 0xdedb, 0xdefb, 0xdefb, 0xdefc, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x31a6, 0xc618, 0xdedb, 0xd6ba, 0xd69a, 0xdedb, 0xa534, 0x0140, 0x4c85, 0x8e2b, 0xb691, 0xb691, 0xae70, 0x9e4e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x960e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x960e, 0x9e2f, 0xa650, 0xae91, 0x852c, 0x0960, 0x636c, 0xdefb, 0xd6ba, 0xd6ba, 0xd6ba, 0xdedb, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0020, 0x0000, 0x4a89, 0xc638, 0xce79, 0xce79, 0xce59, 0xd6ba, 0x8c71, 0x0180, 0x5d06, 0x8e2c, 0xb691, 0xb691, 0xa66f, 0x9e2e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x960e, 0x8e0e, 0x962e, 0xa650, 0xae91, 0x8dae, 0x19c2, 0x4a89, 0xd69a, 0xce59, 0xce79, 0xce59, 0xd69a, 0x6b8d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0020, 0x0000, 0x5aeb, 0xc638, 0xc638, 0xc638, 0xc618, 0xc659, 0x6b6d, 0x11e0, 0x5d46, 0x962d, 0xb691, 0xae71, 0xa64f, 0x962d, 0x8e0d, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x960e, 0x9e50, 0xa671, 0x95ee, 0x2a23, 0x3a07, 0xc618, 0xc618, 0xc618, 0xbe18, 0xc638, 0x8430, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5b0b, 0xbdf7, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0x4a68, 0x1a41, 0x6587, 0x960d, 0xae91, 0xae70, 0x9e4e, 0x960d, 0x8ded, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x85ed, 0x8e0e, 0x9e30, 0xa651, 0x960f, 0x3285, 0x29a4, 0xa534, 0xbdd7, 0xb5b6, 0xb5b6, 0xbdd7, 0x8c71, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xb5b6, 0xb596, 0xb596, 0xad96, 0xad75, 0x31e6, 0x22c3, 0x65a7, 0x960e, 0xae71, 0xa670, 0x9e2e, 0x8dec, 0x8dec, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x85cc, 0x8ded, 0x9e2f, 0x9e30, 0x962f, 0x3ac5, 0x0940, 0x9492, 0xad96, 0xad55, 0xad55, 0xad96, 0x8c71, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0020, 0x6b6d, 0xad55, 0xad55, 0xad55, 0xa534, 0xa514, 0x29a5, 0x2b44, 0x65a8, 0x960e, 0xae70, 0xa64f, 0x962e, 0x8dec, 0x85cc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x7dcc, 0x85ed, 0x960f, 0x9e30, 0x962f, 0x4326, 0x0120, 0x7bef, 0xa534, 0x9d14, 0x9d14, 0xa534, 0x8c51, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x1082, 0x7bef, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x8c72, 0x21a4, 0x33c5, 0x65a8, 0x960e, 0xa650, 0x9e4f, 0x960d, 0x85eb, 0x7dcc, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x7dab, 0x75ab, 0x85cd, 0x960f, 0x960f, 0x962f, 0x4b87, 0x0140, 0x738e, 0x9cf3, 0x94b2, 0x94b2, 0x9cd3, 0x8430, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x10c2, 0x7bef, 0x9492, 0x94b2, 0x9492, 0x9492, 0x7bcf, 0x2183, 0x3c25, 0x6da9, 0x960e, 0x9e4f, 0x9e2f, 0x8ded, 0x85cb, 0x7dab, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x758b, 0x7dcd, 0x8dee, 0x960f, 0x8e0e, 0x4bc7, 0x1141, 0x62eb, 0x9492, 0x8c71, 0x8c71, 0x8c71, 0x8430, 0x2144, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x18e3, 0x8430, 0x8410, 0x8430, 0x8430, 0x8430, 0x6b4d, 0x1983, 0x3c86, 0x6589, 0x8ded, 0x9e2f, 0x960e, 0x8ded, 0x7dcb, 0x75ab, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x6d8b, 0x7dac, 0x8dee, 0x8def, 0x8e0e, 0x5408, 0x1962, 0x4a69, 0x8430, 0x8410, 0x8410, 0x8430, 0x7bef, 0x52aa, 0x2945, 0x1081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x18c3, 0x73ae, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bef, 0x5acb, 0x21c3, 0x3cc7, 0x6589, 0x8ded, 0x9e2f, 0x960e, 0x85ec, 0x75aa, 0x758b, 0x6d6b, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x75ac, 0x85ce, 0x8dee, 0x85ee, 0x5428, 0x1962, 0x4207, 0x7bcf, 0x7bcf, 0x7bcf, 0x7bcf, 0x73ae, 0x8410, 0x738e, 0x630c, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x1903, 0x738e, 0x6b6d, 0x736d, 0x736d, 0x73ae, 0x4a49, 0x09e1, 0x44e7, 0x6589, 0x85ed, 0x960e, 0x8e0e, 0x85cc, 0x6d8a, 0x6d8a, 0x656a, 0x5d6a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x656a, 0x5d4a, 0x758c, 0x85ce, 0x85ce, 0x7ded, 0x5469, 0x2183, 0x31c6, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x632c, 0x4a28, 0x5aaa, 0x528a, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x18e3, 0x632c, 0x632c, 0x632c, 0x632c, 0x6b4d, 0x4208, 0x0221, 0x4508, 0x6589, 0x7dcc, 0x960e, 0x8ded, 0x7dcc, 0x6d8a, 0x656a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x5d4a, 0x6d8b, 0x7dcd, 0x85ce, 0x7dcd, 0x54a9, 0x2183, 0x29a5, 0x630c, 0x6b2c, 0x632c, 0x632c, 0x6b2c, 0x52aa, 0x0000, 0x1881, 0x20e3, 0x39a6, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x2965, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x62eb, 0x39a7, 0x0a42, 0x4528, 0x6569, 0x7dac, 0x8dee, 0x8ded, 0x7dac, 0x656a, 0x656a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x552a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x552a, 0x552a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x552a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x552a, 0x6d6b, 0x7dad, 0x7dae, 0x75cc, 0x54a9, 0x1983, 0x1983, 0x5acb, 0x5acb, 0x5acb, 0x5aeb, 0x528a, 0x8c51, 0xb596, 0xad96, 0xa514, 0x7bae, 0x18e3, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x2965, 0x528a, 0x528a, 0x528a, 0x528a, 0x5aaa, 0x3986, 0x0a63, 0x4d48, 0x656a, 0x75ab, 0x85ed, 0x85cd, 0x75ab, 0x6569, 0x5d49, 0x5549, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x4d29, 0x656b, 0x7dad, 0x7dad, 0x6d8c, 0x54c9, 0x21c3, 0x0962, 0x526a, 0x52aa, 0x528a, 0x5aca, 0x39a6, 0x9cf3, 0xef5d, 0xe71c, 0xe73c, 0xdefb, 0x5acb, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x2985, 0x4a48, 0x4a69, 0x4a49, 0x4a49, 0x5269, 0x3145, 0x12a3, 0x4d48, 0x656a, 0x6d8b, 0x85cd, 0x85cd, 0x6d8b, 0x5d49, 0x5549, 0x4d29, 0x4509, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x654b, 0x758c, 0x758d, 0x658b, 0x54c9, 0x21c3, 0x0961, 0x4a29, 0x4a69, 0x4a49, 0x5289, 0x39a6, 0x8c30, 0xce59, 0xc638, 0xc638, 0xce79, 0x8c71, 0x0841, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4208, 0x4208, 0x4a28, 0x4228, 0x4228, 0x4228, 0x20c4, 0x12c3, 0x4d69, 0x656a, 0x6d6b, 0x7dcc, 0x7dcc, 0x6d8b, 0x5549, 0x4d29, 0x4509, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x3d09, 0x5d4b, 0x758c, 0x758c, 0x656b, 0x54c9, 0x21c3, 0x1162, 0x41e8, 0x4228, 0x4228, 0x4a48, 0x3186, 0x7bcf, 0xb5b6, 0xad75, 0xad96, 0xad96, 0xad55, 0x2945, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4228, 0x3165, 0x31a6, 0x3186, 0x31a6, 0x31a6, 0x2083, 0x12e4, 0x4d69, 0x656a, 0x656a, 0x6d8b, 0x6d8b, 0x5549, 0x3507, 0x2d07, 0x24e7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x24c7, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x24c8, 0x4d2a, 0x654b, 0x654b, 0x5d4b, 0x54ea, 0x2a04, 0x1162, 0x3145, 0x31a6, 0x3186, 0x39a6, 0x20e3, 0x632c, 0x9cf3, 0x94b2, 0x94b2, 0x94b2, 0x9492, 0x39e7, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x3a07, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c4, 0x1ae4, 0x4569, 0x654a, 0x656a, 0x656a, 0x656a, 0x4528, 0x1ce6, 0x1ce6, 0x14c6, 0x0ca6, 0x14a6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca6, 0x0ca7, 0x3508, 0x552a, 0x552a, 0x554a, 0x4cea, 0x2a24, 0x1162, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x528a, 0x8410, 0x7bcf, 0x7bef, 0x7bef, 0x7bef, 0x5aeb, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x39c7, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x20e4, 0x1ae4, 0x4569, 0x5d4a, 0x656a, 0x656a, 0x5d6a, 0x4528, 0x1ce7, 0x1cc6, 0x14c7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x0ca7, 0x34e9, 0x552a, 0x552a, 0x554a, 0x4cea, 0x2a24, 0x1162, 0x0000, 0x0040, 0x0000, 0x0861, 0x0000, 0x4a69, 0x736d, 0x630c, 0x632c, 0x630c, 0x6b2c, 0x5acb, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4228, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2104, 0x1b25, 0x4d69, 0x5d4a, 0x656a, 0x656a, 0x5d6a, 0x4528, 0x1ce7, 0x1cc6, 0x14c7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x34e9, 0x4d2a, 0x552a, 0x554a, 0x4cea, 0x2a24, 0x1162, 0x0000, 0x0020, 0x0000, 0x0841, 0x0000, 0x4208, 0x52aa, 0x4208, 0x4a28, 0x4a28, 0x4a28, 0x4228, 0x0020, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2124, 0x1b65, 0x4d69, 0x5d4a, 0x5d6a, 0x656a, 0x5d4a, 0x4528, 0x1ce7, 0x1cc7, 0x14a7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x34e9, 0x4d2a, 0x552a, 0x552a, 0x4cea, 0x2a24, 0x1162, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x3185, 0x2945, 0x0000, 0x0841, 0x0841, 0x0000, 0x3186, 0x1082, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2124, 0x1b65, 0x4d69, 0x5d4a, 0x5d6a, 0x5d6a, 0x5d4a, 0x4528, 0x1cc7, 0x1cc7, 0x14a7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x34e9, 0x4d2a, 0x552a, 0x552a, 0x4cea, 0x2a24, 0x1162, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x3165, 0x2924, 0x0000, 0x0020, 0x0020, 0x0000, 0x39c7, 0x18e3, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4248, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2124, 0x1b65, 0x4569, 0x5d4a, 0x5d6a, 0x5d6a, 0x5d4a, 0x3d28, 0x14e7, 0x14c7, 0x14a7, 0x0ca7, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0ca7, 0x2ce9, 0x4d2a, 0x552a, 0x4d2a, 0x4cea, 0x2a24, 0x1162, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x2945, 0x2104, 0x0000, 0x0020, 0x0020, 0x0000, 0x3186, 0x2104, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4228, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2104, 0x1b45, 0x4549, 0x5d4a, 0x5d4a, 0x5d4a, 0x554a, 0x3d08, 0x14c7, 0x14c7, 0x0ca7, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0487, 0x2ce9, 0x4d0a, 0x4d0a, 0x4d2a, 0x44ea, 0x2a24, 0x1162, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x2104, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x2104, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4228, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2124, 0x1b45, 0x4549, 0x5d4a, 0x5d4a, 0x5d4a, 0x554a, 0x3d08, 0x14c7, 0x14c7, 0x0ca7, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0487, 0x2ce9, 0x4d0a, 0x4d0a, 0x4d2a, 0x44ea, 0x2a24, 0x1162, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x2103, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x18e3, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4208, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2104, 0x1b45, 0x4549, 0x554a, 0x5d4a, 0x5d4a, 0x554a, 0x3d09, 0x14c7, 0x14c7, 0x0ca7, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0487, 0x2ce9, 0x4d0a, 0x4d0a, 0x4d2a, 0x44ca, 0x2224, 0x1142, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x18e3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x0861, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4208, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2104, 0x1b45, 0x4549, 0x554a, 0x5d4a, 0x5d4a, 0x554a, 0x3d09, 0x14c7, 0x14c7, 0x0ca7, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0487, 0x2ce9, 0x4d0a, 0x4d0a, 0x4d2a, 0x44ca, 0x2224, 0x1142, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x2124, 0x20e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x0020, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x3a07, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2104, 0x1b45, 0x4549, 0x554a, 0x5d4a, 0x5d4a, 0x554a, 0x3d08, 0x14c7, 0x14c7, 0x0ca7, 0x0487, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0487, 0x2ce9, 0x4d0a, 0x4d0a, 0x4d2a, 0x44ca, 0x2203, 0x1142, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x2944, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2104, 0x1305, 0x3d49, 0x554a, 0x554a, 0x554a, 0x554a, 0x3508, 0x0cc7, 0x14c7, 0x0ca7, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0c87, 0x0487, 0x2ce9, 0x4d0a, 0x4d0a, 0x4d2a, 0x44c9, 0x2203, 0x1142, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x2124, 0x20e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x3186, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x20e4, 0x12c4, 0x3d49, 0x554a, 0x5d4a, 0x5d4a, 0x554a, 0x3508, 0x14c7, 0x14c7, 0x0ca7, 0x0487, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0487, 0x2ce9, 0x4d0a, 0x4d0a, 0x4d2a, 0x44a9, 0x21c3, 0x1142, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x2124, 0x20e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2083, 0x12e4, 0x3549, 0x554a, 0x5d4a, 0x5d4a, 0x554a, 0x3508, 0x14c7, 0x14c7, 0x0ca7, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0487, 0x2ce9, 0x4d0a, 0x4d0a, 0x4d2a, 0x4489, 0x19a3, 0x1162, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x18c3, 0x10a2, 0x0000, 0x0000, 0x0000, 0x1082, 0x0841, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x2985, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1802, 0x12e4, 0x3d49, 0x554a, 0x5d4a, 0x5d4a, 0x554a, 0x3508, 0x14c7, 0x14c7, 0x0ca7, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0487, 0x2ce9, 0x4d0a, 0x4d0a, 0x4d2a, 0x4489, 0x19a2, 0x0962, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1802, 0x12c4, 0x3d49, 0x554a, 0x5d6a, 0x5d6a, 0x554a, 0x3508, 0x14c6, 0x14c7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0c87, 0x0c87, 0x0ca7, 0x2ce9, 0x4d2a, 0x552a, 0x4d4a, 0x4489, 0x1162, 0x0140, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x3186, 0x39c7, 0x39a6, 0x39c7, 0x41e7, 0x10a2, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x2103, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1842, 0x1284, 0x3d29, 0x5d4a, 0x5d6a, 0x5d6a, 0x5d4a, 0x3d08, 0x14c6, 0x14c7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x0ca7, 0x0ca7, 0x0ca7, 0x34e9, 0x4d2a, 0x552a, 0x4d4a, 0x4448, 0x1122, 0x0160, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x4a28, 0x6b4d, 0x632c, 0x6b4d, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x18e3, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x12a3, 0x3d28, 0x5d4a, 0x656a, 0x656a, 0x5d4a, 0x3d08, 0x1cc6, 0x1cc7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x0ca7, 0x0ca7, 0x0ca7, 0x34e8, 0x4d2a, 0x552a, 0x4d4a, 0x4448, 0x1121, 0x0161, 0x0000, 0x0020, 0x0000, 0x0841, 0x0000, 0x52aa, 0x8410, 0x7bcf, 0x7bef, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x18c3, 0x1062, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0a63, 0x3d08, 0x5d6a, 0x656a, 0x656a, 0x5d6a, 0x3d28, 0x1ce6, 0x1cc6, 0x14a7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x14a7, 0x14a7, 0x0ca7, 0x34e8, 0x4d2a, 0x552a, 0x554a, 0x3c07, 0x1122, 0x2163, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x4208, 0x4a49, 0x5269, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x10a2, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1a43, 0x3ce8, 0x5d6a, 0x656a, 0x656a, 0x656a, 0x4528, 0x1ce6, 0x1cc6, 0x14c7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x1cc7, 0x14a7, 0x14a7, 0x0ca7, 0x34e8, 0x4d2a, 0x552a, 0x556a, 0x3be7, 0x1122, 0x2144, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x4a28, 0x528a, 0x31a6, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x10a2, 0x2924, 0x0000, 0x0000, 0x0000, 0x0000, 0x1001, 0x2245, 0x34e7, 0x5d6a, 0x656a, 0x656a, 0x656a, 0x4528, 0x1ce6, 0x1cc6, 0x1cc7, 0x24c7, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24c8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24c8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24c8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24c8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24c8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24c8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24c8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24c8, 0x24e8, 0x24e8, 0x24e8, 0x24c8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24e8, 0x24c7, 0x14c7, 0x14c7, 0x14a7, 0x34e8, 0x4d2a, 0x5d2a, 0x556a, 0x3386, 0x1122, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2944, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x1081, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x1001, 0x2204, 0x34c7, 0x656a, 0x6d6a, 0x6d8a, 0x656a, 0x4528, 0x24e6, 0x24e6, 0x1cc7, 0x24e7, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x24e8, 0x1cc7, 0x14c7, 0x14c6, 0x34e8, 0x552a, 0x5d4a, 0x556a, 0x3346, 0x1122, 0x2103, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0881, 0x2945, 0x0000, 0x0000, 0x0000, 0x0020, 0x1001, 0x21e4, 0x34a7, 0x658a, 0x6d8a, 0x6d8a, 0x6569, 0x4527, 0x2506, 0x24e6, 0x1cc7, 0x2ce8, 0x34e8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x2ce8, 0x24c7, 0x1cc6, 0x14c6, 0x3508, 0x554a, 0x5d4a, 0x556a, 0x2ae5, 0x0921, 0x18c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0861, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x1983, 0x3486, 0x6589, 0x6d8a, 0x6d8a, 0x6569, 0x4527, 0x2d06, 0x24e6, 0x1cc7, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x3508, 0x24e7, 0x1cc6, 0x1cc6, 0x3d08, 0x554a, 0x5d4a, 0x556a, 0x2a84, 0x0921, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x1081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0020, 0x2104, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x1162, 0x2c46, 0x6589, 0x758a, 0x75aa, 0x6589, 0x4d47, 0x2d06, 0x24e6, 0x24e7, 0x3508, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x3d08, 0x2ce7, 0x1cc6, 0x1ce6, 0x3d08, 0x5549, 0x5d4a, 0x5549, 0x2223, 0x0141, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0961, 0x2be5, 0x65a9, 0x75aa, 0x75aa, 0x6d89, 0x4d47, 0x3506, 0x24e6, 0x24e7, 0x3d28, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x4528, 0x3507, 0x1ce6, 0x1ce6, 0x3d08, 0x5d49, 0x5d6a, 0x5529, 0x1a03, 0x1963, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x2143, 0x33a5, 0x65a9, 0x75aa, 0x75aa, 0x6d89, 0x4d47, 0x3526, 0x2ce6, 0x2d07, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x4d28, 0x3d07, 0x24e6, 0x24e6, 0x3d08, 0x5d49, 0x5d6a, 0x4ce8, 0x19c2, 0x2163, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x0841, 0x0000, 0x0000, 0x0020, 0x0000, 0x20e4, 0x2b45, 0x65a8, 0x75aa, 0x7daa, 0x6d89, 0x4d46, 0x3d26, 0x2d06, 0x3507, 0x4d48, 0x5549, 0x5548, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5548, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5548, 0x5549, 0x5549, 0x5549, 0x5548, 0x5549, 0x5549, 0x5549, 0x5549, 0x5548, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5548, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5548, 0x5549, 0x4528, 0x24e6, 0x24e6, 0x4528, 0x5d49, 0x5d8a, 0x4c87, 0x1162, 0x1963, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1903, 0x2104, 0x18c2, 0x0861, 0x0020, 0x0040, 0x1803, 0x22e4, 0x65a8, 0x75a9, 0x7dca, 0x6d88, 0x5546, 0x3d26, 0x2d06, 0x3d27, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5549, 0x5548, 0x2d06, 0x2506, 0x4527, 0x5d49, 0x5d89, 0x4447, 0x0921, 0x1142, 0x0801, 0x0020, 0x0841, 0x18a2, 0x18e3, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x10c2, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x39c6, 0x2024, 0x1282, 0x5d88, 0x7da9, 0x7dca, 0x75a9, 0x5d66, 0x4526, 0x3506, 0x4d48, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x6569, 0x5d69, 0x3d27, 0x3506, 0x4d28, 0x5d69, 0x65a9, 0x43e6, 0x0901, 0x1983, 0x3986, 0x31a6, 0x31a6, 0x39a6, 0x39a6, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0881, 0x4208, 0x4a49, 0x4a48, 0x4a48, 0x4a69, 0x3966, 0x2264, 0x5d47, 0x85ea, 0x8deb, 0x85ca, 0x6d88, 0x5d68, 0x5548, 0x6d8a, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x75ab, 0x6569, 0x5548, 0x6569, 0x75aa, 0x75cb, 0x3b86, 0x1122, 0x39c7, 0x4a49, 0x4a49, 0x4a48, 0x4a48, 0x4a49, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x4a49, 0x5acb, 0x5aaa, 0x5aaa, 0x5aca, 0x5249, 0x2a25, 0x5ce7, 0x962c, 0x960c, 0x8e0b, 0x7dca, 0x75a9, 0x6d8a, 0x85cc, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x8ded, 0x7dab, 0x6d89, 0x75aa, 0x85cc, 0x85ec, 0x3ae5, 0x0921, 0x4a49, 0x5acb, 0x5aaa, 0x5aaa, 0x5aaa, 0x52aa, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49, 0x6b4d, 0x632c, 0x632c, 0x632c, 0x630c, 0x29c5, 0x4c85, 0x9e4d, 0xa64e, 0x9e2d, 0x8deb, 0x85cb, 0x85ec, 0x960e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x8e0d, 0x7dcb, 0x85ec, 0x8e0d, 0x8e0d, 0x2a64, 0x0961, 0x5acb, 0x6b2c, 0x632c, 0x632c, 0x6b2c, 0x5acb, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x4208, 0x7bcf, 0x738e, 0x738e, 0x738e, 0x73ae, 0x31e6, 0x4404, 0x9e6d, 0xae6f, 0xa64e, 0x962d, 0x8e0d, 0x962e, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa670, 0xa670, 0xa650, 0xa650, 0xa670, 0xa670, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa650, 0xa670, 0xa670, 0xa650, 0xa650, 0xa670, 0xa650, 0xa650, 0xa650, 0xa670, 0x9e4f, 0x8e0d, 0x960d, 0x9e4f, 0x8ded, 0x19c2, 0x29c5, 0x738e, 0x73ae, 0x738e, 0x738e, 0x7bae, 0x5aaa, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x3186, 0x8430, 0x8410, 0x8410, 0x8410, 0x8430, 0x528a, 0x3b84, 0x9e4c, 0xb690, 0xae90, 0xa66f, 0x9e4f, 0xa670, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae92, 0xae91, 0x9e4f, 0x9e4f, 0xae90, 0x8d6d, 0x1161, 0x4228, 0x8410, 0x8410, 0x8410, 0x7bef, 0x8c51, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1903, 0x8c51, 0x9492, 0x94b2, 0x9492, 0x94d2, 0x738e, 0x2ae2, 0x860a, 0xae6f, 0xae6f, 0x9e4e, 0x9e4e, 0xae70, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb692, 0xb6b2, 0xb6b2, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbed3, 0xbeb3, 0xbeb3, 0xbed3, 0xbed3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbeb3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xbed3, 0xb691, 0xae70, 0xb6d1, 0x74cb, 0x0120, 0x632c, 0x9cd3, 0x9492, 0x94b2, 0x9492, 0x94b2, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x4a49, 0x738e, 0x7bef, 0x7bef, 0x7c0f, 0x6b2d, 0x3285, 0x6d86, 0x7dc7, 0x75a7, 0x6586, 0x5d86, 0x6da8, 0x75a9, 0x75a9, 0x75a9, 0x75a9, 0x75a9, 0x75a9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x75c9, 0x7dca, 0x7dca, 0x7deb, 0x7deb, 0x7deb, 0x7deb, 0x7deb, 0x7deb, 0x7deb, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x85ec, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x860c, 0x8e0c, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x8e0d, 0x960d, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x962e, 0x8e0c, 0x85eb, 0x8e4c, 0x4b86, 0x1122, 0x632c, 0x8410, 0x7bef, 0x7bef, 0x738e, 0x5acb, 0x18c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2965, 0x3986, 0x3185, 0x39a6, 0x39a6, 0x3987, 0x3a67, 0x5ce5, 0x7de6, 0x6d86, 0x5d85, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x5565, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d64, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x4d63, 0x5564, 0x5d85, 0x2262, 0x1963, 0x41e7, 0x3186, 0x39a6, 0x3186, 0x3185, 0x39a6, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x52aa, 0x4a48, 0x4228, 0x4a28, 0x4a28, 0x39c7, 0x4c25, 0x7e06, 0x6585, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d86, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5d85, 0x5da6, 0x6566, 0x1182, 0x29c5, 0x4a28, 0x4a28, 0x4228, 0x4a28, 0x528a, 0x41e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10c2, 0x62eb, 0x630c, 0x5acb, 0x528a, 0x52aa, 0x4a09, 0x4ba6, 0x7de7, 0x7de8, 0x85e9, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x860a, 0x85ea, 0x85e9, 0x7de9, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7dc8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7dc8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7de8, 0x7dc8, 0x7dc8, 0x7dc8, 0x7dc8, 0x75c8, 0x7de8, 0x5ce6, 0x0901, 0x4228, 0x528a, 0x528a, 0x5acb, 0x630c, 0x6b2c, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x528a, 0x7bcf, 0x7bcf, 0x7bcf, 0x73ae, 0x734e, 0x42e6, 0x75a6, 0x8e2a, 0x962c, 0x9e4c, 0x9e4c, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4d, 0x9e4c, 0x9e4c, 0x9e4c, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x962b, 0x8e0a, 0x8e4a, 0x4be5, 0x1102, 0x6b4c, 0x73ae, 0x7bcf, 0x7bcf, 0x7bcf, 0x6b2c, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x4a69, 0x630c, 0x6b6d, 0x6b6d, 0x5acb, 0x21a4, 0x5d04, 0x8648, 0x8628, 0x8629, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8e29, 0x8629, 0x8629, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8628, 0x8608, 0x8648, 0x32a3, 0x08c1, 0x4a89, 0x6b2c, 0x736d, 0x632c, 0x52aa, 0x2945, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0881, 0x08a1, 0x08c1, 0x08a1, 0x00a0, 0x1161, 0x19c1, 0x19e1, 0x19e1, 0x1a01, 0x1a01, 0x1a02, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a22, 0x1a02, 0x1a02, 0x1a02, 0x19e2, 0x19e1, 0x19c1, 0x19a1, 0x08e1, 0x0080, 0x0060, 0x08a1, 0x08a1, 0x0881, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0080, 0x00a0, 0x0080, 0x0080, 0x00a0, 0x00c1, 0x00c1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00e1, 0x00c1, 0x00c1, 0x00a1, 0x00a0, 0x0080, 0x0080, 0x0080, 0x0060, 0x0040, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0040, 0x0040, 0x0060, 0x0060, 0x0080, 0x00a0, 0x00c0, 0x08c1, 0x08c1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08e1, 0x08c1, 0x08c1, 0x08c1, 0x00a0, 0x0080, 0x0080, 0x0060, 0x0060, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4000, 0x4000, 0x6000, 0x6000, 0x8000, 0x8000, 0xa000, 0xa000, 0xa000, 0xa000, 0xa000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xa000, 0xa000, 0xa000, 0xa000, 0x8000, 0x8000, 0x6000, 0x6000, 0x4000, 0x4000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4000, 0x4000, 0x6000, 0x6000, 0x8000, 0x8000, 0xa000, 0xc000, 0xc108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xc108, 0xc100, 0xa000, 0xa000, 0x8000, 0x6000, 0x6000, 0x6000, 0x4000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x8000, 0xa000, 0xa000, 0xa000, 0xc100, 0xe100, 0xe100, 0x0101, 0x0101, 0x0101, 0x0101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x2101, 0x0101, 0x0101, 0x0101, 0x0101, 0xe100, 0xe100, 0xc100, 0xa000, 0xa000, 0x8000, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x8529, 0x894a, 0xaa52, 0x894a, 0xc631, 0xe210, 0xa000, 0x0109, 0x6111, 0x6111, 0x8111, 0xa111, 0xa111, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xc211, 0xa111, 0xa111, 0xa111, 0x8111, 0x6111, 0x4111, 0xe108, 0xa108, 0x8529, 0x894a, 0xaa52, 0x8a52, 0xc739, 0x8108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xeb5a, 0x96b5, 0x18c6, 0x38c6, 0xd7bd, 0x9294, 0xa529, 0xa000, 0x0454, 0x2886, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0xe885, 0x2886, 0x822a, 0xe210, 0x1084, 0xd7bd, 0x38c6, 0x18c6, 0xb6b5, 0xef7b, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0xd39c, 0x38c6, 0x38c6, 0x18c6, 0xd7bd, 0x518c, 0x4319, 0x8219, 0xa675, 0x298e, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x0986, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x0986, 0x0986, 0x098e, 0x098e, 0x098e, 0x0986, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x0986, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x098e, 0x0986, 0x498e, 0x2554, 0xe000, 0x8d6b, 0xd7bd, 0x18c6, 0x38c6, 0x38c6, 0x75ad, 0x8631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa631, 0x34a5, 0x34a5, 0xb294, 0x518c, 0x3084, 0xeb5a, 0xe108, 0x243b, 0x0786, 0xc77d, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xc775, 0xe775, 0x2665, 0x2109, 0x473a, 0x3084, 0x518c, 0x9294, 0x14a5, 0x34a5, 0xca5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xaa52, 0xae7b, 0x8a52, 0xc739, 0xc739, 0xe741, 0xe631, 0x2109, 0x655c, 0x0686, 0xa56d, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0xa565, 0x8665, 0x2222, 0x8319, 0x0842, 0xc739, 0xc739, 0x494a, 0x6d73, 0x2c63, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x8a52, 0x284a, 0xe741, 0x284a, 0x284a, 0x284a, 0xa429, 0xc219, 0x8675, 0xe67d, 0xa575, 0x8565, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0xc66d, 0x243b, 0x4319, 0x484a, 0x284a, 0x284a, 0x0842, 0xe741, 0xcb5a, 0x0321, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x494a, 0x0842, 0x0842, 0xe741, 0xe741, 0x0842, 0x6311, 0xa332, 0xe67d, 0xe685, 0xa675, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x655d, 0xe76d, 0x054c, 0x2111, 0x063a, 0xe841, 0x0742, 0x0842, 0x0742, 0x284a, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8631, 0x6952, 0x284a, 0x0842, 0xe739, 0xc739, 0x0742, 0x4319, 0xe44b, 0x0786, 0xc785, 0xa675, 0x855d, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0xa765, 0xa65c, 0x8219, 0xc631, 0xe741, 0x0842, 0x0842, 0x0842, 0xe739, 0xe739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe739, 0x8a52, 0x284a, 0xe741, 0x8531, 0x6531, 0xc529, 0x6211, 0xa65c, 0x0786, 0xc785, 0xa675, 0x865d, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0x6655, 0xa765, 0x4865, 0xe321, 0xa429, 0xa639, 0xe741, 0xe741, 0xe741, 0xe741, 0x2842, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x8a52, 0x8531, 0x8a52, 0x6952, 0x0842, 0xc741, 0xa529, 0xe219, 0x466d, 0xe785, 0xc785, 0xa575, 0x6455, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x4545, 0x454d, 0x8765, 0xa86d, 0x642a, 0x8319, 0x084a, 0x6952, 0x8a52, 0x6952, 0x4429, 0x4529, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa210, 0xeb5a, 0x55ad, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0x894a, 0x4022, 0xc775, 0x2c9e, 0x6fae, 0x2d9e, 0x0c8e, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0x0e96, 0x2d96, 0x4643, 0x4001, 0xf7bd, 0x3ce7, 0xfbde, 0xfcde, 0x38c6, 0x2c63, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x8108, 0x34a5, 0x7def, 0x5def, 0x5def, 0x5def, 0x1ce7, 0x0632, 0x2233, 0xe87d, 0x90b6, 0xd2be, 0x91b6, 0x6fae, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x4fa6, 0x50a6, 0x71ae, 0xb1b6, 0x2964, 0xe000, 0xd7bd, 0xbef7, 0x5def, 0x5def, 0x7def, 0x9ad6, 0x8529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0xf7bd, 0x1ce7, 0xfbde, 0xdbde, 0x1ce7, 0xf7bd, 0x6101, 0xe443, 0x0986, 0x91b6, 0xb1b6, 0x70ae, 0x4ea6, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2e9e, 0x2f9e, 0x50a6, 0xb1ae, 0xab74, 0x0001, 0x918c, 0x3de7, 0xdbde, 0xfbde, 0xfbde, 0xfcde, 0x2842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa631, 0x18c6, 0xdbde, 0xbad6, 0x9ad6, 0xdbde, 0x34a5, 0x4001, 0x854c, 0x2b8e, 0x91b6, 0x91b6, 0x70ae, 0x4e9e, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x0e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0e96, 0x2f9e, 0x50a6, 0x91ae, 0x2c85, 0x6009, 0x6c63, 0xfbde, 0xbad6, 0xbad6, 0xbad6, 0xdbde, 0xaa52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x2000, 0x0000, 0x894a, 0x38c6, 0x79ce, 0x79ce, 0x59ce, 0xbad6, 0x718c, 0x8001, 0x065d, 0x2c8e, 0x91b6, 0x91b6, 0x6fa6, 0x2e9e, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e96, 0x0e8e, 0x2e96, 0x50a6, 0x91ae, 0xae8d, 0xc219, 0x894a, 0x9ad6, 0x59ce, 0x79ce, 0x59ce, 0x9ad6, 0x8d6b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x2000, 0x0000, 0xeb5a, 0x38c6, 0x38c6, 0x38c6, 0x18c6, 0x59c6, 0x6d6b, 0xe011, 0x465d, 0x2d96, 0x91b6, 0x71ae, 0x4fa6, 0x2d96, 0x0d8e, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0x0e96, 0x509e, 0x71a6, 0xee95, 0x232a, 0x073a, 0x18c6, 0x18c6, 0x18c6, 0x18be, 0x38c6, 0x3084, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0b5b, 0xf7bd, 0xd7bd, 0xd7bd, 0xd7bd, 0xd7bd, 0x684a, 0x411a, 0x8765, 0x0d96, 0x91ae, 0x70ae, 0x4e9e, 0x0d96, 0xed8d, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0xed85, 0x0e8e, 0x309e, 0x51a6, 0x0f96, 0x8532, 0xa429, 0x34a5, 0xd7bd, 0xb6b5, 0xb6b5, 0xd7bd, 0x718c, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0c63, 0xb6b5, 0x96b5, 0x96b5, 0x96ad, 0x75ad, 0xe631, 0xc322, 0xa765, 0x0e96, 0x71ae, 0x70a6, 0x2e9e, 0xec8d, 0xec8d, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xcc85, 0xed8d, 0x2f9e, 0x309e, 0x2f96, 0xc53a, 0x4009, 0x9294, 0x96ad, 0x55ad, 0x55ad, 0x96ad, 0x718c, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x2000, 0x6d6b, 0x55ad, 0x55ad, 0x55ad, 0x34a5, 0x14a5, 0xa529, 0x442b, 0xa865, 0x0e96, 0x70ae, 0x4fa6, 0x2e96, 0xec8d, 0xcc85, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xcc7d, 0xed85, 0x0f96, 0x309e, 0x2f96, 0x2643, 0x2001, 0xef7b, 0x34a5, 0x149d, 0x149d, 0x34a5, 0x518c, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x8210, 0xef7b, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0x728c, 0xa421, 0xc533, 0xa865, 0x0e96, 0x50a6, 0x4f9e, 0x0d96, 0xeb85, 0xcc7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab7d, 0xab75, 0xcd85, 0x0f96, 0x0f96, 0x2f96, 0x874b, 0x4001, 0x8e73, 0xf39c, 0xb294, 0xb294, 0xd39c, 0x3084, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xc210, 0xef7b, 0x9294, 0xb294, 0x9294, 0x9294, 0xcf7b, 0x8321, 0x253c, 0xa96d, 0x0e96, 0x4f9e, 0x2f9e, 0xed8d, 0xcb85, 0xab7d, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0x8b75, 0xcd7d, 0xee8d, 0x0f96, 0x0e8e, 0xc74b, 0x4111, 0xeb62, 0x9294, 0x718c, 0x718c, 0x718c, 0x3084, 0x4421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xe318, 0x3084, 0x1084, 0x3084, 0x3084, 0x3084, 0x4d6b, 0x8319, 0x863c, 0x8965, 0xed8d, 0x2f9e, 0x0e96, 0xed8d, 0xcb7d, 0xab75, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0x8b6d, 0xac7d, 0xee8d, 0xef8d, 0x0e8e, 0x0854, 0x6219, 0x694a, 0x3084, 0x1084, 0x1084, 0x3084, 0xef7b, 0xaa52, 0x4529, 0x8110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xc318, 0xae73, 0xcf7b, 0xcf7b, 0xcf7b, 0xef7b, 0xcb5a, 0xc321, 0xc73c, 0x8965, 0xed8d, 0x2f9e, 0x0e96, 0xec85, 0xaa75, 0x8b75, 0x6b6d, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0xac75, 0xce85, 0xee8d, 0xee85, 0x2854, 0x6219, 0x0742, 0xcf7b, 0xcf7b, 0xcf7b, 0xcf7b, 0xae73, 0x1084, 0x8e73, 0x0c63, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0319, 0x8e73, 0x6d6b, 0x6d73, 0x6d73, 0xae73, 0x494a, 0xe109, 0xe744, 0x8965, 0xed85, 0x0e96, 0x0e8e, 0xcc85, 0x8a6d, 0x8a6d, 0x6a65, 0x6a5d, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x6a65, 0x4a5d, 0x8c75, 0xce85, 0xce85, 0xed7d, 0x6954, 0x8321, 0xc631, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x2c63, 0x284a, 0xaa5a, 0x8a52, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xe318, 0x2c63, 0x2c63, 0x2c63, 0x2c63, 0x4d6b, 0x0842, 0x2102, 0x0845, 0x8965, 0xcc7d, 0x0e96, 0xed8d, 0xcc7d, 0x8a6d, 0x6a65, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a5d, 0x8b6d, 0xcd7d, 0xce85, 0xcd7d, 0xa954, 0x8321, 0xa529, 0x0c63, 0x2c6b, 0x2c63, 0x2c63, 0x2c6b, 0xaa52, 0x0000, 0x8118, 0xe320, 0xa639, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x6529, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xeb62, 0xa739, 0x420a, 0x2845, 0x6965, 0xac7d, 0xee8d, 0xed8d, 0xac7d, 0x6a65, 0x6a65, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x2a55, 0x2a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x2a55, 0x6b6d, 0xad7d, 0xae7d, 0xcc75, 0xa954, 0x8319, 0x8319, 0xcb5a, 0xcb5a, 0xcb5a, 0xeb5a, 0x8a52, 0x518c, 0x96b5, 0x96ad, 0x14a5, 0xae7b, 0xe318, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x6529, 0x8a52, 0x8a52, 0x8a52, 0x8a52, 0xaa5a, 0x8639, 0x630a, 0x484d, 0x6a65, 0xab75, 0xed85, 0xcd85, 0xab75, 0x6965, 0x495d, 0x4955, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x294d, 0x6b65, 0xad7d, 0xad7d, 0x8c6d, 0xc954, 0xc321, 0x6209, 0x6a52, 0xaa52, 0x8a52, 0xca5a, 0xa639, 0xf39c, 0x5def, 0x1ce7, 0x3ce7, 0xfbde, 0xcb5a, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x8529, 0x484a, 0x694a, 0x494a, 0x494a, 0x6952, 0x4531, 0xa312, 0x484d, 0x6a65, 0x8b6d, 0xcd85, 0xcd85, 0x8b6d, 0x495d, 0x4955, 0x294d, 0x0945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x4b65, 0x8c75, 0x8d75, 0x8b65, 0xc954, 0xc321, 0x6109, 0x294a, 0x694a, 0x494a, 0x8952, 0xa639, 0x308c, 0x59ce, 0x38c6, 0x38c6, 0x79ce, 0x718c, 0x4108, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0842, 0x0842, 0x284a, 0x2842, 0x2842, 0x2842, 0xc420, 0xc312, 0x694d, 0x6a65, 0x6b6d, 0xcc7d, 0xcc7d, 0x8b6d, 0x4955, 0x294d, 0x0945, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x093d, 0x4b5d, 0x8c75, 0x8c75, 0x6b65, 0xc954, 0xc321, 0x6211, 0xe841, 0x2842, 0x2842, 0x484a, 0x8631, 0xcf7b, 0xb6b5, 0x75ad, 0x96ad, 0x96ad, 0x55ad, 0x4529, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x2842, 0x6531, 0xa631, 0x8631, 0xa631, 0xa631, 0x8320, 0xe412, 0x694d, 0x6a65, 0x6a65, 0x8b6d, 0x8b6d, 0x4955, 0x0735, 0x072d, 0xe724, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc724, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0xc824, 0x2a4d, 0x4b65, 0x4b65, 0x4b5d, 0xea54, 0x042a, 0x6211, 0x4531, 0xa631, 0x8631, 0xa639, 0xe320, 0x2c63, 0xf39c, 0xb294, 0xb294, 0xb294, 0x9294, 0xe739, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x073a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc420, 0xe41a, 0x6945, 0x4a65, 0x6a65, 0x6a65, 0x6a65, 0x2845, 0xe61c, 0xe61c, 0xc614, 0xa60c, 0xa614, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa60c, 0xa70c, 0x0835, 0x2a55, 0x2a55, 0x4a55, 0xea4c, 0x242a, 0x6211, 0x0000, 0x0000, 0x0000, 0x4108, 0x0000, 0x8a52, 0x1084, 0xcf7b, 0xef7b, 0xef7b, 0xef7b, 0xeb5a, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xc739, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0xe420, 0xe41a, 0x6945, 0x4a5d, 0x6a65, 0x6a65, 0x6a5d, 0x2845, 0xe71c, 0xc61c, 0xc714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa70c, 0xe934, 0x2a55, 0x2a55, 0x4a55, 0xea4c, 0x242a, 0x6211, 0x0000, 0x4000, 0x0000, 0x6108, 0x0000, 0x694a, 0x6d73, 0x0c63, 0x2c63, 0x0c63, 0x2c6b, 0xcb5a, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x2842, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0421, 0x251b, 0x694d, 0x4a5d, 0x6a65, 0x6a65, 0x6a5d, 0x2845, 0xe71c, 0xc61c, 0xc714, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xe934, 0x2a4d, 0x2a55, 0x4a55, 0xea4c, 0x242a, 0x6211, 0x0000, 0x2000, 0x0000, 0x4108, 0x0000, 0x0842, 0xaa52, 0x0842, 0x284a, 0x284a, 0x284a, 0x2842, 0x2000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x694a, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2421, 0x651b, 0x694d, 0x4a5d, 0x6a5d, 0x6a65, 0x4a5d, 0x2845, 0xe71c, 0xc71c, 0xa714, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xe934, 0x2a4d, 0x2a55, 0x2a55, 0xea4c, 0x242a, 0x6211, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x8531, 0x4529, 0x0000, 0x4108, 0x4108, 0x0000, 0x8631, 0x8210, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x494a, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2421, 0x651b, 0x694d, 0x4a5d, 0x6a5d, 0x6a5d, 0x4a5d, 0x2845, 0xc71c, 0xc71c, 0xa714, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xe934, 0x2a4d, 0x2a55, 0x2a55, 0xea4c, 0x242a, 0x6211, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x6531, 0x2429, 0x0000, 0x2000, 0x2000, 0x0000, 0xc739, 0xe318, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x4842, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2421, 0x651b, 0x6945, 0x4a5d, 0x6a5d, 0x6a5d, 0x4a5d, 0x283d, 0xe714, 0xc714, 0xa714, 0xa70c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0xa70c, 0xe92c, 0x2a4d, 0x2a55, 0x2a4d, 0xea4c, 0x242a, 0x6211, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x4529, 0x0421, 0x0000, 0x2000, 0x2000, 0x0000, 0x8631, 0x0421, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x2842, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0421, 0x451b, 0x4945, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a55, 0x083d, 0xc714, 0xc714, 0xa70c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x8704, 0xe92c, 0x0a4d, 0x0a4d, 0x2a4d, 0xea44, 0x242a, 0x6211, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0421, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0x0421, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x2842, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2421, 0x451b, 0x4945, 0x4a5d, 0x4a5d, 0x4a5d, 0x4a55, 0x083d, 0xc714, 0xc714, 0xa70c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x8704, 0xe92c, 0x0a4d, 0x0a4d, 0x2a4d, 0xea44, 0x242a, 0x6211, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0321, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0xe318, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0842, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0421, 0x451b, 0x4945, 0x4a55, 0x4a5d, 0x4a5d, 0x4a55, 0x093d, 0xc714, 0xc714, 0xa70c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x8704, 0xe92c, 0x0a4d, 0x0a4d, 0x2a4d, 0xca44, 0x2422, 0x4211, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0xe318, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x6108, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0842, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0421, 0x451b, 0x4945, 0x4a55, 0x4a5d, 0x4a5d, 0x4a55, 0x093d, 0xc714, 0xc714, 0xa70c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x8704, 0xe92c, 0x0a4d, 0x0a4d, 0x2a4d, 0xca44, 0x2422, 0x4211, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2421, 0xe320, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x2000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x073a, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0421, 0x451b, 0x4945, 0x4a55, 0x4a5d, 0x4a5d, 0x4a55, 0x083d, 0xc714, 0xc714, 0xa70c, 0x8704, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x8704, 0xe92c, 0x0a4d, 0x0a4d, 0x2a4d, 0xca44, 0x0322, 0x4211, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x4429, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xe739, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0421, 0x0513, 0x493d, 0x4a55, 0x4a55, 0x4a55, 0x4a55, 0x0835, 0xc70c, 0xc714, 0xa70c, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x8704, 0x870c, 0x8704, 0xe92c, 0x0a4d, 0x0a4d, 0x2a4d, 0xc944, 0x0322, 0x4211, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2421, 0xe320, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x8631, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0xe420, 0xc412, 0x493d, 0x4a55, 0x4a5d, 0x4a5d, 0x4a55, 0x0835, 0xc714, 0xc714, 0xa70c, 0x8704, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x8704, 0xe92c, 0x0a4d, 0x0a4d, 0x2a4d, 0xa944, 0xc321, 0x4211, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2421, 0xe320, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x6529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8320, 0xe412, 0x4935, 0x4a55, 0x4a5d, 0x4a5d, 0x4a55, 0x0835, 0xc714, 0xc714, 0xa70c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x8704, 0xe92c, 0x0a4d, 0x0a4d, 0x2a4d, 0x8944, 0xa319, 0x6211, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0xc318, 0xa210, 0x0000, 0x0000, 0x0000, 0x8210, 0x4108, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x8529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0218, 0xe412, 0x493d, 0x4a55, 0x4a5d, 0x4a5d, 0x4a55, 0x0835, 0xc714, 0xc714, 0xa70c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x870c, 0x8704, 0xe92c, 0x0a4d, 0x0a4d, 0x2a4d, 0x8944, 0xa219, 0x6209, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x6529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0218, 0xc412, 0x493d, 0x4a55, 0x6a5d, 0x6a5d, 0x4a55, 0x0835, 0xc614, 0xc714, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0xa70c, 0x870c, 0x870c, 0xa70c, 0xe92c, 0x2a4d, 0x2a55, 0x4a4d, 0x8944, 0x6211, 0x4001, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x8631, 0xc739, 0xa639, 0xc739, 0xe741, 0xa210, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0321, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4218, 0x8412, 0x293d, 0x4a5d, 0x6a5d, 0x6a5d, 0x4a5d, 0x083d, 0xc614, 0xc714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa70c, 0xa70c, 0xa70c, 0xe934, 0x2a4d, 0x2a55, 0x4a4d, 0x4844, 0x2211, 0x6001, 0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x284a, 0x4d6b, 0x2c63, 0x4d6b, 0x8a52, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xe318, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0xa312, 0x283d, 0x4a5d, 0x6a65, 0x6a65, 0x4a5d, 0x083d, 0xc61c, 0xc71c, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa714, 0xa70c, 0xa70c, 0xa70c, 0xe834, 0x2a4d, 0x2a55, 0x4a4d, 0x4844, 0x2111, 0x6101, 0x0000, 0x2000, 0x0000, 0x4108, 0x0000, 0xaa52, 0x1084, 0xcf7b, 0xef7b, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xc318, 0x6210, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x630a, 0x083d, 0x6a5d, 0x6a65, 0x6a65, 0x6a5d, 0x283d, 0xe61c, 0xc61c, 0xa714, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xa714, 0xa714, 0xa70c, 0xe834, 0x2a4d, 0x2a55, 0x4a55, 0x073c, 0x2211, 0x6321, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0842, 0x494a, 0x6952, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xa210, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x431a, 0xe83c, 0x6a5d, 0x6a65, 0x6a65, 0x6a65, 0x2845, 0xe61c, 0xc61c, 0xc714, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xc71c, 0xa714, 0xa714, 0xa70c, 0xe834, 0x2a4d, 0x2a55, 0x6a55, 0xe73b, 0x2211, 0x4421, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x284a, 0x8a52, 0xa631, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0xa210, 0x2429, 0x0000, 0x0000, 0x0000, 0x0000, 0x0110, 0x4522, 0xe734, 0x6a5d, 0x6a65, 0x6a65, 0x6a65, 0x2845, 0xe61c, 0xc61c, 0xc71c, 0xc724, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xc824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xc824, 0xe824, 0xe824, 0xe824, 0xe824, 0xc824, 0xe824, 0xe824, 0xe824, 0xe824, 0xc824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xc824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xc824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xc824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xc824, 0xe824, 0xe824, 0xe824, 0xc824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xe824, 0xc724, 0xc714, 0xc714, 0xa714, 0xe834, 0x2a4d, 0x2a5d, 0x6a55, 0x8633, 0x2211, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x4429, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x8110, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0110, 0x0422, 0xc734, 0x6a65, 0x6a6d, 0x8a6d, 0x6a65, 0x2845, 0xe624, 0xe624, 0xc71c, 0xe724, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe824, 0xc71c, 0xc714, 0xc614, 0xe834, 0x2a55, 0x4a5d, 0x6a55, 0x4633, 0x2211, 0x0321, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x8108, 0x4529, 0x0000, 0x0000, 0x0000, 0x2000, 0x0110, 0xe421, 0xa734, 0x8a65, 0x8a6d, 0x8a6d, 0x6965, 0x2745, 0x0625, 0xe624, 0xc71c, 0xe82c, 0xe834, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xe82c, 0xc724, 0xc61c, 0xc614, 0x0835, 0x4a55, 0x4a5d, 0x6a55, 0xe52a, 0x2109, 0xc218, 0x0000, 0x0000, 0x0000, 0x0000, 0x2108, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x6108, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0108, 0x8319, 0x8634, 0x8965, 0x8a6d, 0x8a6d, 0x6965, 0x2745, 0x062d, 0xe624, 0xc71c, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0x0835, 0xe724, 0xc61c, 0xc61c, 0x083d, 0x4a55, 0x4a5d, 0x6a55, 0x842a, 0x2109, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x2108, 0x8110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x2000, 0x0421, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x6211, 0x462c, 0x8965, 0x8a75, 0xaa75, 0x8965, 0x474d, 0x062d, 0xe624, 0xe724, 0x0835, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0x083d, 0xe72c, 0xc61c, 0xe61c, 0x083d, 0x4955, 0x4a5d, 0x4955, 0x2322, 0x4101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x6109, 0xe52b, 0xa965, 0xaa75, 0xaa75, 0x896d, 0x474d, 0x0635, 0xe624, 0xe724, 0x283d, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x2845, 0x0735, 0xe61c, 0xe61c, 0x083d, 0x495d, 0x6a5d, 0x2955, 0x031a, 0x6319, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x4321, 0xa533, 0xa965, 0xaa75, 0xaa75, 0x896d, 0x474d, 0x2635, 0xe62c, 0x072d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x284d, 0x073d, 0xe624, 0xe624, 0x083d, 0x495d, 0x6a5d, 0xe84c, 0xc219, 0x6321, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x4108, 0x0000, 0x0000, 0x2000, 0x0000, 0xe420, 0x452b, 0xa865, 0xaa75, 0xaa7d, 0x896d, 0x464d, 0x263d, 0x062d, 0x0735, 0x484d, 0x4955, 0x4855, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4855, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4855, 0x4955, 0x4955, 0x4955, 0x4855, 0x4955, 0x4955, 0x4955, 0x4955, 0x4855, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4855, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4855, 0x4955, 0x2845, 0xe624, 0xe624, 0x2845, 0x495d, 0x8a5d, 0x874c, 0x6211, 0x6319, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0319, 0x0421, 0xc218, 0x6108, 0x2000, 0x4000, 0x0318, 0xe422, 0xa865, 0xa975, 0xca7d, 0x886d, 0x4655, 0x263d, 0x062d, 0x273d, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4955, 0x4855, 0x062d, 0x0625, 0x2745, 0x495d, 0x895d, 0x4744, 0x2109, 0x4211, 0x0108, 0x2000, 0x4108, 0xa218, 0xe318, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0xc210, 0xa631, 0xa631, 0xa631, 0x8631, 0xc639, 0x2420, 0x8212, 0x885d, 0xa97d, 0xca7d, 0xa975, 0x665d, 0x2645, 0x0635, 0x484d, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x6965, 0x695d, 0x273d, 0x0635, 0x284d, 0x695d, 0xa965, 0xe643, 0x0109, 0x8319, 0x8639, 0xa631, 0xa631, 0xa639, 0xa639, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x8108, 0x0842, 0x494a, 0x484a, 0x484a, 0x694a, 0x6639, 0x6422, 0x475d, 0xea85, 0xeb8d, 0xca85, 0x886d, 0x685d, 0x4855, 0x8a6d, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0xab75, 0x6965, 0x4855, 0x6965, 0xaa75, 0xcb75, 0x863b, 0x2211, 0xc739, 0x494a, 0x494a, 0x484a, 0x484a, 0x494a, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4008, 0x494a, 0xcb5a, 0xaa5a, 0xaa5a, 0xca5a, 0x4952, 0x252a, 0xe75c, 0x2c96, 0x0c96, 0x0b8e, 0xca7d, 0xa975, 0x8a6d, 0xcc85, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xed8d, 0xab7d, 0x896d, 0xaa75, 0xcc85, 0xec85, 0xe53a, 0x2109, 0x494a, 0xcb5a, 0xaa5a, 0xaa5a, 0xaa5a, 0xaa52, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x494a, 0x4d6b, 0x2c63, 0x2c63, 0x2c63, 0x0c63, 0xc529, 0x854c, 0x4d9e, 0x4ea6, 0x2d9e, 0xeb8d, 0xcb85, 0xec85, 0x0e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0d8e, 0xcb7d, 0xec85, 0x0d8e, 0x0d8e, 0x642a, 0x6109, 0xcb5a, 0x2c6b, 0x2c63, 0x2c63, 0x2c6b, 0xcb5a, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0842, 0xcf7b, 0x8e73, 0x8e73, 0x8e73, 0xae73, 0xe631, 0x0444, 0x6d9e, 0x6fae, 0x4ea6, 0x2d96, 0x0d8e, 0x2e96, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x70a6, 0x70a6, 0x50a6, 0x50a6, 0x70a6, 0x70a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x50a6, 0x70a6, 0x70a6, 0x50a6, 0x50a6, 0x70a6, 0x50a6, 0x50a6, 0x50a6, 0x70a6, 0x4f9e, 0x0d8e, 0x0d96, 0x4f9e, 0xed8d, 0xc219, 0xc529, 0x8e73, 0xae73, 0x8e73, 0x8e73, 0xae7b, 0xaa5a, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x8631, 0x3084, 0x1084, 0x1084, 0x1084, 0x3084, 0x8a52, 0x843b, 0x4c9e, 0x90b6, 0x90ae, 0x6fa6, 0x4f9e, 0x70a6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x92ae, 0x91ae, 0x4f9e, 0x4f9e, 0x90ae, 0x6d8d, 0x6111, 0x2842, 0x1084, 0x1084, 0x1084, 0xef7b, 0x518c, 0x8a52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0319, 0x518c, 0x9294, 0xb294, 0x9294, 0xd294, 0x8e73, 0xe22a, 0x0a86, 0x6fae, 0x6fae, 0x4e9e, 0x4e9e, 0x70ae, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0x92b6, 0xb2b6, 0xb2b6, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xd3be, 0xb3be, 0xb3be, 0xd3be, 0xd3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xb3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0xd3be, 0x91b6, 0x70ae, 0xd1b6, 0xcb74, 0x2001, 0x2c63, 0xd39c, 0x9294, 0xb294, 0x9294, 0xb294, 0xe739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x494a, 0x8e73, 0xef7b, 0xef7b, 0x0f7c, 0x2d6b, 0x8532, 0x866d, 0xc77d, 0xa775, 0x8665, 0x865d, 0xa86d, 0xa975, 0xa975, 0xa975, 0xa975, 0xa975, 0xa975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xc975, 0xca7d, 0xca7d, 0xeb7d, 0xeb7d, 0xeb7d, 0xeb7d, 0xeb7d, 0xeb7d, 0xeb7d, 0xec85, 0xec85, 0xec85, 0xec85, 0xec85, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c86, 0x0c8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d8e, 0x0d96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x2e96, 0x0c8e, 0xeb85, 0x4c8e, 0x864b, 0x2211, 0x2c63, 0x1084, 0xef7b, 0xef7b, 0x8e73, 0xcb5a, 0xc218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x6529, 0x8639, 0x8531, 0xa639, 0xa639, 0x8739, 0x673a, 0xe55c, 0xe67d, 0x866d, 0x855d, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x6555, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x644d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x634d, 0x6455, 0x855d, 0x6222, 0x6319, 0xe741, 0x8631, 0xa639, 0x8631, 0x8531, 0xa639, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0xaa52, 0x484a, 0x2842, 0x284a, 0x284a, 0xc739, 0x254c, 0x067e, 0x8565, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x865d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0x855d, 0xa65d, 0x6665, 0x8211, 0xc529, 0x284a, 0x284a, 0x2842, 0x284a, 0x8a52, 0xe741, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc210, 0xeb62, 0x0c63, 0xcb5a, 0x8a52, 0xaa52, 0x094a, 0xa64b, 0xe77d, 0xe87d, 0xe985, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0x0a86, 0xea85, 0xe985, 0xe97d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xc87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xc87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xe87d, 0xc87d, 0xc87d, 0xc87d, 0xc87d, 0xc875, 0xe87d, 0xe65c, 0x0109, 0x2842, 0x8a52, 0x8a52, 0xcb5a, 0x0c63, 0x2c6b, 0x6529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x8a52, 0xcf7b, 0xcf7b, 0xcf7b, 0xae73, 0x4e73, 0xe642, 0xa675, 0x2a8e, 0x2c96, 0x4c9e, 0x4c9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4d9e, 0x4c9e, 0x4c9e, 0x4c9e, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x2b96, 0x0a8e, 0x4a8e, 0xe54b, 0x0211, 0x4c6b, 0xae73, 0xcf7b, 0xcf7b, 0xcf7b, 0x2c6b, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x694a, 0x0c63, 0x6d6b, 0x6d6b, 0xcb5a, 0xa421, 0x045d, 0x4886, 0x2886, 0x2986, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x298e, 0x2986, 0x2986, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x2886, 0x0886, 0x4886, 0xa332, 0xc108, 0x894a, 0x2c6b, 0x6d73, 0x2c63, 0xaa52, 0x4529, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x8108, 0xa108, 0xc108, 0xa108, 0xa000, 0x6111, 0xc119, 0xe119, 0xe119, 0x011a, 0x011a, 0x021a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x221a, 0x021a, 0x021a, 0x021a, 0xe219, 0xe119, 0xc119, 0xa119, 0xe108, 0x8000, 0x6000, 0xa108, 0xa108, 0x8108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x4000, 0x8000, 0xa000, 0x8000, 0x8000, 0xa000, 0xc100, 0xc100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xe100, 0xc100, 0xc100, 0xa100, 0xa000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4000, 0x4000, 0x6000, 0x6000, 0x8000, 0xa000, 0xc000, 0xc108, 0xc108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xe108, 0xc108, 0xc108, 0xc108, 0xa000, 0x8000, 0x8000, 0x6000, 0x6000, 0x4000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
 };
 const tImage_RGB Image_Battery_2 = { image_data_Image_Battery_2, 158, 78,
-    16 };
+    16, IMAGE_RGB_BIG_ENDIAN };
@@ -11,6 +11,7 @@
 * conversion type: Color, not_used not_used
 * split to rows: yes
 * bits per pixel: 16
+* byte order: big-endian (panel wire order)
 *
 * preprocess:
 *  main scan direction: top_to_bottom
@@ -24,7 +25,8 @@
      uint16_t width;
      uint16_t height;
      uint8_t dataSize;
-     } tImage;
+     uint8_t flags;
+     } tImage_RGB;
 */
 #include <stdint.h>
 #include "picts.h"
@@ -91,64 +93,64 @@ static const uint16_t image_data_Image[7308] = {
         // ∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
         // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
         // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-        0x0000, 0x0020, 0x2925, 0x6b2e, 0x734f, 0x734e, 0x632c, 0x2163, 0x4264, 0x3a43, 0x3a43, 0x3a43, 0x3a23, 0x3a43, 0x3a43, 0x3a23, 0x3a23, 0x3a23, 0x3222, 0x3a22, 0x3222, 0x3222, 0x3a22, 0x3a22, 0x3222, 0x3a22, 0x3a22, 0x3a22, 0x3a42, 0x3a23, 0x3a23, 0x3a43, 0x3a43, 0x3a43, 0x3a43, 0x3a43, 0x3a43, 0x3a43, 0x3a43, 0x3a43, 0x3a63, 0x3a43, 0x3a63, 0x3a63, 0x3a63, 0x4263, 0x4263, 0x4263, 0x4263, 0x4263, 0x3a43, 0x3a43, 0x3203, 0x2963, 0x2103, 0x18c3, 0x18c3, 0x18c3, 0x18a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1062, 0x0862, 0x0862, 0x0862, 0x0862, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x18c3, 0x18e3, 0x18c3, 0x630e, 0x6b4f, 0x6b4f, 0x5aac, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0020, 0x62cc, 0x7b8f, 0x7baf, 0x7bcf, 0x4a67, 0x5b66, 0x52e5, 0x4ac4, 0x4ac4, 0x4ac4, 0x4ac4, 0x4aa4, 0x4aa4, 0x42a4, 0x42a4, 0x42a3, 0x42a3, 0x42a3, 0x4283, 0x42a3, 0x4283, 0x4283, 0x42a3, 0x4283, 0x4283, 0x42a3, 0x42a3, 0x42a3, 0x42a3, 0x42a3, 0x42a3, 0x42a4, 0x42a4, 0x42a4, 0x42a4, 0x42a4, 0x4ac4, 0x4aa4, 0x42a4, 0x4ac4, 0x4aa4, 0x4aa4, 0x4ac4, 0x4aa4, 0x4ac4, 0x4ac4, 0x4aa4, 0x4aa4, 0x42a4, 0x4284, 0x4284, 0x18e2, 0x10a2, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x1082, 0x10a2, 0x18e3, 0x18c3, 0x5acd, 0x7b90, 0x7b90, 0x7b90, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0020, 0x0841, 0x4a28, 0x3a07, 0x4247, 0x4a88, 0x3a25, 0xc7e8, 0xc7e7, 0xc7e7, 0xbfa6, 0xbf86, 0xbf86, 0xbf85, 0xb785, 0xb785, 0xb785, 0xb785, 0xb785, 0xb784, 0xb784, 0xb785, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb784, 0xb785, 0xbf84, 0xb784, 0xb785, 0xb784, 0xbf85, 0xb785, 0xb784, 0xb785, 0xb785, 0xb784, 0xb785, 0xb785, 0xb784, 0xb784, 0x3a81, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0841, 0x0841, 0x1082, 0x2104, 0x39c7, 0x4208, 0x4208, 0x4208, 0x528b, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0020, 0x18c3, 0x4207, 0x39e6, 0x4226, 0x4a87, 0x4284, 0xc7e8, 0xbfe7, 0xbfc6, 0xbfa5, 0xb785, 0xb765, 0xb764, 0xb764, 0xb764, 0xb764, 0xb764, 0xb764, 0xb763, 0xb763, 0xb763, 0xb763, 0xaf63, 0xaf63, 0xaf63, 0xaf63, 0xb763, 0xb763, 0xaf63, 0xaf63, 0xaf63, 0xaf63, 0xaf63, 0xaf63, 0xaf63, 0xaf63, 0xb763, 0xaf63, 0xb763, 0xb763, 0xb763, 0xb763, 0xb763, 0xb763, 0xb763, 0xaf63, 0xb763, 0xaf63, 0xaf63, 0xaf63, 0xaf63, 0xaf63, 0x3240, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0841, 0x1082, 0x2965, 0x3186, 0x4208, 0x4208, 0x39e8, 0x5acc, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0841, 0x3186, 0x4248, 0x4a68, 0x4a88, 0x52c8, 0x5b65, 0xc7e8, 0xb766, 0xbfa5, 0xb765, 0xb744, 0xaf24, 0xaf23, 0xaf23, 0xaf03, 0xaf02, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa701, 0x9f01, 0x42c0, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0861, 0x18c3, 0x39e7, 0x39c7, 0x528a, 0x528a, 0x528a, 0x62ec, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0861, 0x4a49, 0x52a9, 0x5aea, 0x632a, 0x5b09, 0x6c06, 0xc7e9, 0xb746, 0xbfa6, 0xb745, 0xb744, 0xaf24, 0xaf03, 0xaf03, 0xaf03, 0xaf03, 0xaf03, 0xaf02, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa702, 0xa6e2, 0xa701, 0x3a80, 0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x2104, 0x4228, 0x4208, 0x632c, 0x632d, 0x6b4d, 0x5aeb, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x1082, 0x4a69, 0x738e, 0x842f, 0x9490, 0x634a, 0x7c88, 0xcfeb, 0xb707, 0xbf88, 0xb727, 0xb706, 0xb706, 0xaf05, 0xaee5, 0xaee5, 0xaee4, 0xaee4, 0xaee5, 0xaee4, 0xaee4, 0xaee4, 0xaee4, 0xaee4, 0xaee4, 0xaee3, 0xaee4, 0xaee4, 0xaee3, 0xaee4, 0xaee4, 0xaee3, 0xaee4, 0xaee4, 0xaee3, 0xaee4, 0xaee4, 0xaee3, 0xaee4, 0xaee3, 0xa6e4, 0xaee4, 0xaee3, 0xaee4, 0xaee4, 0xaee3, 0xaee4, 0xaee4, 0xa6e3, 0xaee4, 0xaec4, 0xa6c3, 0xa6e3, 0x4b22, 0x0881, 0x0861, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0020, 0x0020, 0x0841, 0x0020, 0x0821, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x10a2, 0x10a2, 0x31a7, 0x528a, 0x4a69, 0x9472, 0x9472, 0x8c51, 0x6b6d, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x18c3, 0x5aeb, 0xf77f, 0xf77f, 0xffbf, 0x844f, 0x9d4d, 0xd7b0, 0xcf6e, 0xd76e, 0xcf4d, 0xcf4d, 0xcf4d, 0xcf2c, 0xc72c, 0xc70c, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xc70b, 0xbf0b, 0xbf0b, 0xbf0b, 0xbf0b, 0xbf0a, 0x7c68, 0x31a4, 0x2944, 0x2103, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e4, 0x18e4, 0x2104, 0x2104, 0x2124, 0x2925, 0x2945, 0x2965, 0x39c7, 0x4208, 0x632d, 0x7bcf, 0x630c, 0xe6dd, 0xf77f, 0xf77f, 0xdebc, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x18c2, 0x9cd4, 0xf77f, 0xf77f, 0xffbf, 0x842e, 0xadee, 0xe7f2, 0xdfd0, 0xdfd0, 0xdfcf, 0xdfcf, 0xdfaf, 0xdfaf, 0xdfae, 0xdfae, 0xdfae, 0xdfae, 0xdfae, 0xdfae, 0xdfae, 0xdfae, 0xdfae, 0xdfae, 0xdfad, 0xdfad, 0xdfad, 0xd7ad, 0xdfad, 0xdfad, 0xd7ad, 0xdfad, 0xd7ad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xd7ad, 0xd7ad, 0xdfad, 0xd7ad, 0xdfad, 0xdfad, 0xdfad, 0xd7ad, 0xd7ad, 0xd7ad, 0x7c67, 0x31a4, 0x2944, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18a3, 0x18c3, 0x18a3, 0x18a3, 0x18c3, 0x18a3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e4, 0x20e4, 0x2104, 0x2124, 0x2925, 0x2945, 0x31a7, 0x39e8, 0x632d, 0x7baf, 0x630c, 0xdebc, 0xf77f, 0xf77f, 0xef3e, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x18c3, 0xbdb8, 0xf77f, 0xf75f, 0xf79f, 0x842e, 0xbe6f, 0xe7f1, 0xdfd0, 0xdfcf, 0xdfcf, 0xdfcf, 0xdfaf, 0xdfce, 0xdfce, 0xdfce, 0xdfae, 0xdfae, 0xdfae, 0xdfce, 0xdfce, 0xdfce, 0xdfad, 0xdfad, 0xdfcd, 0xdfcd, 0xdfcd, 0xdfad, 0xdfad, 0xdfcd, 0xdfcd, 0xdfad, 0xdfcd, 0xdfad, 0xdfad, 0xdfcd, 0xdfcd, 0xdfad, 0xdfad, 0xdfcd, 0xdfcd, 0xdfcd, 0xdfcd, 0xdfcd, 0xdfad, 0xdfcd, 0xdfcd, 0xdfcd, 0xdfad, 0xdfad, 0xd7ad, 0xd7ad, 0xd7ac, 0x7c67, 0x3184, 0x2123, 0x18e3, 0x18c3, 0x18c3, 0x18a3, 0x18a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x10a3, 0x18a3, 0x18a3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x20e4, 0x2104, 0x2104, 0x2925, 0x3166, 0x39c7, 0x62ec, 0x738e, 0x62ec, 0xd69c, 0xf77f, 0xf75f, 0xef3f, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x18c3, 0xce1b, 0xef1f, 0xef1f, 0xef1f, 0x7c0d, 0xc6cf, 0xe7f0, 0xdfcf, 0xdfaf, 0xdfce, 0xdfae, 0xdfae, 0xdfae, 0xdfce, 0xdfad, 0xd7ad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xdfad, 0xd7ad, 0xdfad, 0xd7ad, 0xd7ad, 0xd7ad, 0xdfad, 0xd7ad, 0xd7ad, 0xdfad, 0xdfad, 0xd7ad, 0xd7ad, 0xd7ad, 0xd7ad, 0xdfad, 0xdfad, 0xdfad, 0xd7ad, 0xd7ad, 0xd7ad, 0xdfad, 0xdfad, 0xd7ad, 0xdfad, 0xdfad, 0xd7ad, 0xd7ad, 0xd7ac, 0xd7ac, 0xd7ac, 0x7c67, 0x2964, 0x2123, 0x18e3, 0x18c2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a3, 0x10a3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e4, 0x2104, 0x2124, 0x2945, 0x31a6, 0x5aab, 0x632d, 0x52ab, 0xce3b, 0xef3f, 0xef3f, 0xe71f, 0x4a6a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x10a2, 0xce1b, 0xe6de, 0xdebe, 0xdebd, 0x73ca, 0xc6ef, 0xdfef, 0xd7ae, 0xdfae, 0xdfae, 0xd7ad, 0xd78d, 0xd78d, 0xd78d, 0xd78d, 0xd78d, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78c, 0xd78b, 0xd78b, 0x7447, 0x2963, 0x2103, 0x18c2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18a3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2104, 0x2945, 0x3186, 0x526a, 0x632d, 0x4a6a, 0xbdb9, 0xe6fe, 0xe6de, 0xe6de, 0x4209, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x10a2, 0xc5fa, 0xd67d, 0xd67d, 0xd65c, 0x6b89, 0xc6ee, 0xd7ae, 0xd78d, 0xdfce, 0xd7ad, 0xd78d, 0xd76c, 0xd76c, 0xd76c, 0xd76c, 0xd76c, 0xcf6c, 0xd76c, 0xcf6c, 0xd76b, 0xd76b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf6b, 0xcf4b, 0xcf4b, 0xcf4b, 0x7c66, 0x2963, 0x2103, 0x18a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x20e4, 0x2124, 0x2966, 0x4a6a, 0x5aec, 0x4a29, 0xad57, 0xd69d, 0xd67d, 0xd69d, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x18c3, 0xbdb9, 0xc5fb, 0xcdfb, 0xcdd9, 0x6b88, 0xcf0e, 0xd78d, 0xcf4c, 0xd78c, 0xd76c, 0xd78c, 0xcf4c, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4b, 0xcf4a, 0xcf4a, 0xc74a, 0xc72a, 0xc72a, 0xc72a, 0x7466, 0x2143, 0x18e2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1062, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x1062, 0x1062, 0x1062, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x18a3, 0x18c3, 0x18e3, 0x2104, 0x2945, 0x4209, 0x528a, 0x39e8, 0x8c52, 0xc5fb, 0xc5fa, 0xc5fb, 0x526a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x1082, 0xbd79, 0xb579, 0xbd78, 0xbd77, 0x6b88, 0xc72d, 0xcf6c, 0xc72b, 0xd78b, 0xcf6b, 0xcf6b, 0xcf4b, 0xc72b, 0xc72b, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc72a, 0xc709, 0xc709, 0xc709, 0xc709, 0x6c25, 0x2123, 0x18e2, 0x10a2, 0x1081, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x0862, 0x0861, 0x0862, 0x1082, 0x0862, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x18c3, 0x18e3, 0x2124, 0x39e8, 0x4a4a, 0x39c7, 0x6b6e, 0xb578, 0xb578, 0xb579, 0x4a29, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x10a2, 0xad37, 0xad17, 0xb517, 0xa534, 0x6387, 0xcf4c, 0xc74b, 0xc72a, 0xcf6b, 0xcf4a, 0xc74a, 0xc72a, 0xc70a, 0xc70a, 0xc70a, 0xc70a, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xc709, 0xbf09, 0xbf09, 0xbee9, 0xbee9, 0xbee9, 0xbee9, 0x7445, 0x2122, 0x18c2, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0862, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x18a3, 0x18c3, 0x2104, 0x39c7, 0x4209, 0x31a7, 0x62ec, 0xa517, 0xad17, 0xad17, 0x526a, 0x1082, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x18c3, 0xa4b5, 0xa495, 0xa4b4, 0x94b2, 0x6386, 0xc72b, 0xc72a, 0xbee9, 0xcf4a, 0xc709, 0xc729, 0xc709, 0xbee9, 0xbee9, 0xbee9, 0xbee9, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbee8, 0xbec8, 0xb6c8, 0xb6c8, 0xb6c8, 0x7464, 0x1902, 0x18c2, 0x1081, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x10a2, 0x18a3, 0x18e4, 0x31a7, 0x39c8, 0x3186, 0x5aab, 0x9cb5, 0x9cb5, 0x9cd5, 0x6b2e, 0x7390, 0x7bb0, 0x7bb0, 0x528b, 0x0020, 0x0000,
-        0x10a2, 0x9454, 0x9453, 0x9472, 0x8c71, 0x63a6, 0xc70b, 0xbf09, 0xb6c8, 0xc729, 0xbf08, 0xbf08, 0xbee8, 0xbee8, 0xbec8, 0xbee8, 0xb6c8, 0xb6c8, 0xb6c8, 0xb6c8, 0xb6c8, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6a7, 0xb6a7, 0xb6a7, 0x6c24, 0x18e2, 0x10a2, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x10a2, 0x18e3, 0x3186, 0x39a7, 0x3186, 0x4a6a, 0x9454, 0x9474, 0x9474, 0x5acc, 0x526a, 0x528b, 0x4a6a, 0x5aac, 0x0841, 0x0020,
-        0x18c3, 0x8c12, 0x8bf1, 0x8430, 0x8410, 0x6386, 0xc70a, 0xb6c8, 0xb6a7, 0xbf08, 0xbee8, 0xbee8, 0xbee8, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6a7, 0xb6c7, 0xb6c7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xb6a7, 0xaea7, 0xaea7, 0xae86, 0x6c24, 0x18e2, 0x10a1, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x18c3, 0x2966, 0x3186, 0x3166, 0x4a29, 0x8c12, 0x8c33, 0x8c33, 0x5aec, 0x4208, 0x4208, 0x4208, 0x4229, 0x18c3, 0x0841,
-        0x18c3, 0x83b1, 0x7bcf, 0x7bcf, 0x7bed, 0x63a5, 0xbee9, 0xae86, 0xae86, 0xbee7, 0xb6c7, 0xb6e7, 0xb6a7, 0xb6a6, 0xb6a6, 0xb6a6, 0xb6a6, 0xaea6, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae66, 0xae66, 0x6c23, 0x18c1, 0x10a1, 0x0861, 0x0841, 0x0841, 0x0020, 0x0821, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0821, 0x0821, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x18c3, 0x20e4, 0x2945, 0x2945, 0x41e8, 0x83d1, 0x83f2, 0x8412, 0x6b4e, 0xb578, 0xc5da, 0xc61b, 0x83f1, 0x2125, 0x0841,
-        0x10a2, 0x7b70, 0x738e, 0x738e, 0x73ac, 0x63c5, 0xbee8, 0xae86, 0xae65, 0xb6c6, 0xb6c6, 0xb6c6, 0xb6a6, 0xaea6, 0xae86, 0xae86, 0xae86, 0xae86, 0xae86, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae85, 0xae65, 0xae65, 0xa645, 0xae65, 0x63e3, 0x10c1, 0x1081, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0821, 0x0841, 0x0021, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x10a2, 0x18e3, 0x2925, 0x2925, 0x39c7, 0x7bb0, 0x7bd1, 0x83f2, 0x6b2e, 0xc5fa, 0xdebe, 0xe6df, 0xdebe, 0x31a7, 0x0861,
-        0x18c3, 0x734e, 0x6b4d, 0x6b6d, 0x6b6a, 0x63a5, 0xb6e8, 0xa665, 0xa645, 0xb6c6, 0xb6a6, 0xb6a6, 0xae85, 0xae85, 0xae85, 0xae85, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xae65, 0xa665, 0xa665, 0xae65, 0xa665, 0xa645, 0xa645, 0x6403, 0x10a1, 0x1081, 0x0840, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x10a2, 0x18c3, 0x2104, 0x2125, 0x3187, 0x7370, 0x7b90, 0x7bd1, 0x6b4e, 0xb578, 0xc61c, 0xce3d, 0xce3d, 0x4a6a, 0x0861,
-        0x18c2, 0x6b2d, 0x630c, 0x632c, 0x6b29, 0x63c4, 0xb6c7, 0xa644, 0xa644, 0xaea5, 0xaea5, 0xae85, 0xae85, 0xae65, 0xae65, 0xa665, 0xa665, 0xa664, 0xa664, 0xa664, 0xa664, 0xa644, 0xa664, 0xa644, 0xa644, 0xa664, 0xa664, 0xa664, 0xa644, 0xa664, 0xa664, 0xa664, 0xa664, 0xa644, 0xa664, 0xa644, 0xa664, 0xa664, 0xa644, 0xa644, 0xa664, 0xa644, 0xa644, 0xa664, 0xa644, 0xa664, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0x9e24, 0xa644, 0x63e2, 0x10a1, 0x0861, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x1082, 0x10a3, 0x20e4, 0x2104, 0x3166, 0x6b2e, 0x734f, 0x7b90, 0x6b2d, 0x8c53, 0xa4f7, 0xa4f8, 0xad38, 0x630c, 0x0862,
-        0x1082, 0x630c, 0x5aeb, 0x632b, 0x6308, 0x63e4, 0xaec6, 0x9e44, 0x9e24, 0xaea4, 0xae84, 0xae84, 0xa664, 0xa664, 0xa664, 0xa664, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0xa644, 0x9e24, 0x9e24, 0x9e24, 0x5ba2, 0x1081, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0821, 0x0841, 0x1062, 0x1082, 0x18e3, 0x2104, 0x2925, 0x630d, 0x6b2e, 0x6b2e, 0x5acc, 0x736f, 0x8412, 0x8c54, 0x9454, 0x5acc, 0x0861,
-        0x10a2, 0x5aeb, 0x5acb, 0x630a, 0x5ae7, 0x63c3, 0xaea6, 0x9e23, 0x9e03, 0xa684, 0xa664, 0xa684, 0xa664, 0xa664, 0xa644, 0xa644, 0xa644, 0xa644, 0x9e43, 0xa644, 0x9e43, 0x9e43, 0x9e43, 0xa644, 0x9e43, 0xa644, 0x9e43, 0x9e43, 0xa644, 0x9e43, 0xa643, 0x9e43, 0xa643, 0x9e43, 0xa644, 0x9e43, 0x9e43, 0xa644, 0x9e43, 0x9e23, 0xa644, 0x9e43, 0xa644, 0x9e43, 0x9e43, 0xa644, 0x9e23, 0x9e23, 0x9e23, 0x9e23, 0x9e23, 0x9e03, 0x9e04, 0x5bc2, 0x1081, 0x0860, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x18c3, 0x18e3, 0x2125, 0x62cc, 0x62ed, 0x62ed, 0x52ab, 0x5aac, 0x6b2e, 0x6b4f, 0x7370, 0x528b, 0x0841,
-        0x1081, 0x1902, 0x18e1, 0x1921, 0x2161, 0x53a1, 0x8de2, 0x74e0, 0x74c0, 0x8580, 0x8560, 0x8560, 0x8540, 0x7d40, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d00, 0x7d00, 0x7d00, 0x74e0, 0x7d00, 0x4320, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0862, 0x18e4, 0x18c3, 0x18e3, 0x2124, 0x41e8, 0x4a29, 0x526b, 0x526b, 0x526b, 0x4a4b, 0x0841,
-        0x0861, 0x18e2, 0x10c1, 0x1901, 0x2140, 0x5381, 0x8de1, 0x74c0, 0x74c0, 0x8560, 0x7d60, 0x8560, 0x7d40, 0x7d20, 0x7d20, 0x7d20, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7500, 0x74e0, 0x74e0, 0x74e0, 0x4300, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x18c3, 0x10a2, 0x18c3, 0x18e3, 0x39c8, 0x31a7, 0x31a7, 0x39a7, 0x39a7, 0x420a, 0x0020,
-        0x0861, 0x18c1, 0x10a0, 0x18e0, 0x1920, 0x5360, 0x85a1, 0x6ca0, 0x6ca0, 0x7d40, 0x7d60, 0x7d60, 0x7d40, 0x7d20, 0x7d20, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7500, 0x7d00, 0x7d00, 0x7d00, 0x7500, 0x7d00, 0x7d00, 0x7d00, 0x7500, 0x7d00, 0x7500, 0x7d00, 0x7500, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7500, 0x7d00, 0x7500, 0x7d00, 0x7500, 0x7d00, 0x7d00, 0x74e0, 0x74e0, 0x74e0, 0x74c0, 0x4b20, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x1082, 0x10a2, 0x10a3, 0x3186, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x39a8, 0x0020,
-        0x0841, 0x18c1, 0x10a0, 0x10e0, 0x1920, 0x5360, 0x85c1, 0x6ca0, 0x6ca0, 0x7d40, 0x7d40, 0x7d40, 0x7d20, 0x7d20, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7500, 0x7500, 0x7500, 0x7500, 0x7d00, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7d00, 0x7d00, 0x74e0, 0x74e0, 0x7500, 0x74e0, 0x7d00, 0x7d00, 0x74e0, 0x7500, 0x74e0, 0x74e0, 0x74e0, 0x74c0, 0x74c0, 0x4300, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x0861, 0x1082, 0x1082, 0x2946, 0x10a3, 0x10a2, 0x10a2, 0x10a2, 0x3167, 0x0020,
-        0x0840, 0x18c1, 0x10a0, 0x10c0, 0x1920, 0x5360, 0x8dc1, 0x6ca0, 0x6ca0, 0x7d40, 0x7d40, 0x7d40, 0x7d20, 0x7d20, 0x7d00, 0x7d00, 0x7d00, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x74e0, 0x7500, 0x7500, 0x7500, 0x7d00, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x74e0, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x74e0, 0x74e0, 0x7500, 0x74e0, 0x7500, 0x7500, 0x7500, 0x74e0, 0x74e0, 0x74e0, 0x74e0, 0x74e0, 0x74e0, 0x74c0, 0x74c0, 0x4300, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x2945, 0x10a2, 0x1082, 0x1082, 0x1082, 0x2926, 0x0000,
-        0x0861, 0x18c1, 0x0880, 0x10c0, 0x1920, 0x4b40, 0x85a1, 0x6ca0, 0x6ca0, 0x7d40, 0x7d40, 0x7d40, 0x7d20, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7500, 0x7500, 0x7500, 0x74e0, 0x7500, 0x74e0, 0x7500, 0x7500, 0x74e0, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x74e0, 0x74e0, 0x74e0, 0x74e0, 0x7500, 0x7500, 0x74e0, 0x74e0, 0x74e0, 0x7500, 0x7500, 0x7500, 0x74e0, 0x7500, 0x74e0, 0x74e0, 0x74e0, 0x74e0, 0x74e0, 0x74c0, 0x74c0, 0x4b00, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x2104, 0x1082, 0x0861, 0x0861, 0x0861, 0x18c4, 0x0000,
-        0x0840, 0x18c1, 0x0880, 0x10c0, 0x1920, 0x5360, 0x8dc1, 0x6ca0, 0x6ca0, 0x7d40, 0x7d40, 0x7d40, 0x7d20, 0x7d00, 0x7d00, 0x7d00, 0x7d00, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7d00, 0x7500, 0x74e0, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x7d00, 0x74e0, 0x7500, 0x7d00, 0x7500, 0x7500, 0x7500, 0x74e0, 0x74e0, 0x74e0, 0x7500, 0x7500, 0x74e0, 0x7500, 0x74e0, 0x74e0, 0x74e0, 0x74e0, 0x74e0, 0x74c0, 0x4300, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0841, 0x0020, 0x0021, 0x0841, 0x18e4, 0x0861, 0x0841, 0x0841, 0x0841, 0x10a3, 0x0000,
-        0x0840, 0x10a1, 0x0880, 0x10c0, 0x1920, 0x53a0, 0x9621, 0x6cc0, 0x6ca0, 0x8540, 0x7d40, 0x7d40, 0x7d40, 0x7d40, 0x7d20, 0x7d40, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7d20, 0x7500, 0x7d00, 0x4b40, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0841, 0x0862, 0x0841, 0x0020, 0x0020, 0x0021, 0x18c3, 0x0841, 0x0841, 0x0021, 0x0020, 0x1062, 0x0000,
-        0x0840, 0x10a1, 0x0880, 0x10c0, 0x1920, 0x5380, 0x9621, 0x74c0, 0x74c0, 0x8560, 0x7d60, 0x8561, 0x8581, 0x8da1, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8581, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8581, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8581, 0x8581, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8581, 0x8d81, 0x8d81, 0x8d81, 0x8581, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8d81, 0x8581, 0x8581, 0x8561, 0x8561, 0x53a1, 0x0860, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0861, 0x1062, 0x0020, 0x0020, 0x0020, 0x0020, 0x10a2, 0x0020, 0x0020, 0x0020, 0x0020, 0x0862, 0x0000,
-        0x0020, 0x10a1, 0x0880, 0x10c0, 0x1920, 0x5380, 0x9641, 0x6cc0, 0x6cc0, 0x8560, 0x7d60, 0x8581, 0x8d81, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8d81, 0x8d81, 0x8581, 0x8581, 0x8581, 0x5381, 0x0860, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0861, 0x1082, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x0020, 0x0020, 0x0020, 0x0020, 0x1082, 0x0000,
-        0x0020, 0x10a1, 0x0880, 0x10c0, 0x1920, 0x5380, 0x9621, 0x74c0, 0x74c0, 0x8560, 0x7d60, 0x8581, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8d81, 0x8581, 0x8581, 0x8581, 0x5ba1, 0x0860, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0861, 0x1082, 0x0020, 0x0000, 0x0000, 0x0000, 0x0862, 0x0020, 0x0020, 0x0020, 0x0020, 0x1082, 0x0000,
-        0x0020, 0x10a1, 0x0880, 0x10c0, 0x1920, 0x4b20, 0x8e01, 0x74e0, 0x74c0, 0x8560, 0x8560, 0x8581, 0x8dc1, 0x8dc1, 0x8da1, 0x8da1, 0x8dc1, 0x8da1, 0x8da1, 0x8dc1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8dc2, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8dc2, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8da1, 0x8d81, 0x8d81, 0x5bc1, 0x0860, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x0020, 0x0020, 0x0021, 0x0841, 0x1082, 0x0000,
-        0x0020, 0x1081, 0x0880, 0x10c0, 0x1920, 0x4b40, 0x8e01, 0x74e0, 0x74e0, 0x8580, 0x8560, 0x8da1, 0x8dc1, 0x8dc1, 0x8dc1, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8da2, 0x8da2, 0x8da2, 0x8da2, 0x5ba1, 0x0860, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x1082, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x3167, 0x3187, 0x3187, 0x3187, 0x0841, 0x0000,
-        0x0020, 0x1081, 0x0880, 0x10c0, 0x1900, 0x4300, 0x9621, 0x74e0, 0x74e0, 0x8580, 0x8560, 0x8da1, 0x95e2, 0x8dc2, 0x95c2, 0x8dc2, 0x8de2, 0x8de2, 0x95c2, 0x95c2, 0x8dc2, 0x95c2, 0x95c2, 0x95c2, 0x8de2, 0x8de2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x95c2, 0x8dc2, 0x8dc2, 0x8da2, 0x8da2, 0x8da2, 0x5bc1, 0x0860, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x1062, 0x0000, 0x0000, 0x0000, 0x0020, 0x10a3, 0x4a2a, 0x4a4b, 0x4a4b, 0x4a2a, 0x0020, 0x0000,
-        0x0020, 0x0880, 0x0880, 0x10c0, 0x1900, 0x3ac0, 0x9641, 0x7500, 0x74e0, 0x85a0, 0x8580, 0x8dc1, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x8dc2, 0x8dc2, 0x8dc2, 0x8dc2, 0x5be1, 0x0860, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x62ee, 0x630e, 0x6b2e, 0x526b, 0x0000, 0x0000,
-        0x0020, 0x0880, 0x0880, 0x10c0, 0x1900, 0x42c0, 0x9641, 0x7500, 0x7d00, 0x8dc0, 0x85a0, 0x8dc1, 0x9602, 0x95e2, 0x9602, 0x95e2, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x95e2, 0x95e2, 0x95e2, 0x8dc2, 0x95c2, 0x5ba1, 0x0880, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a3, 0x1082, 0x10a3, 0x10a3, 0x10a3, 0x0000, 0x0000,
-        0x0020, 0x0860, 0x0880, 0x10c0, 0x1900, 0x3a80, 0x9661, 0x7500, 0x7d20, 0x8de0, 0x85a0, 0x95e2, 0x9622, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x9602, 0x95e2, 0x95e2, 0x95e2, 0x95e2, 0x5bc1, 0x0880, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a3, 0x2125, 0x2125, 0x2925, 0x10a3, 0x0000, 0x0000,
-        0x0020, 0x0860, 0x0880, 0x10c0, 0x1900, 0x3a60, 0x9e61, 0x7d20, 0x7d20, 0x8e00, 0x8dc0, 0x9602, 0x9e42, 0x9e22, 0x9622, 0x9e22, 0x9e22, 0x9e22, 0x9e22, 0x9e22, 0x9e22, 0x9e22, 0x9e22, 0x9e22, 0x9622, 0x9e22, 0x9622, 0x9622, 0x9e22, 0x9e22, 0x9622, 0x9e22, 0x9e22, 0x9e22, 0x9622, 0x9e22, 0x9622, 0x9e22, 0x9e22, 0x9e22, 0x9e22, 0x9622, 0x9622, 0x9e22, 0x9622, 0x9e22, 0x9e22, 0x9622, 0x9622, 0x9e22, 0x9602, 0x9602, 0x9602, 0x5bc2, 0x0880, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0862, 0x0020, 0x0000, 0x0000, 0x0000, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0020, 0x0860, 0x0880, 0x10c0, 0x1900, 0x3a60, 0x9641, 0x7d40, 0x7d40, 0x9600, 0x8dc0, 0x9e22, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e23, 0x9e22, 0x9602, 0x9602, 0x5ba2, 0x0880, 0x0860, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x0020, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0020, 0x0881, 0x0880, 0x10c0, 0x1920, 0x3240, 0x8e21, 0x7d60, 0x7d60, 0x9600, 0x8de0, 0x9e42, 0xa663, 0xa663, 0x9e43, 0xa663, 0xa663, 0xa663, 0x9e63, 0xa663, 0xa663, 0x9e43, 0x9e43, 0xa663, 0x9e43, 0xa663, 0x9e43, 0xa663, 0x9e43, 0xa663, 0x9e43, 0xa663, 0xa663, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0x9e43, 0xa663, 0xa663, 0xa663, 0xa663, 0x9e43, 0xa663, 0x9e43, 0x9e43, 0xa663, 0x9e43, 0x9e43, 0x9e43, 0x9e23, 0x9e23, 0x9e23, 0x5bc2, 0x0880, 0x0860, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x0020, 0x0841, 0x0021, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0020, 0x18a1, 0x0880, 0x10c0, 0x1920, 0x3221, 0x8dc1, 0x85a0, 0x8de0, 0x9600, 0x9621, 0xa663, 0xa683, 0xa683, 0xa683, 0xa683, 0xa683, 0xa683, 0xa683, 0xa683, 0xa683, 0xa663, 0xa683, 0xa683, 0xa683, 0xa683, 0xa683, 0xa683, 0xa683, 0xa663, 0xa683, 0xa663, 0xa663, 0xa683, 0xa663, 0xa683, 0xa683, 0xa683, 0xa683, 0xa683, 0xa663, 0xa663, 0xa663, 0xa663, 0xa683, 0xa683, 0xa683, 0xa663, 0xa663, 0xa663, 0x9e43, 0x9e43, 0x9e43, 0x63e2, 0x1081, 0x0860, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0020, 0x0821, 0x0841, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0020, 0x18e2, 0x0880, 0x10c0, 0x1920, 0x3201, 0x8581, 0x8de0, 0x9600, 0x9620, 0x9e41, 0xa683, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xa684, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xa684, 0xaea4, 0xaea4, 0xaea4, 0xae84, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xaea4, 0xae84, 0xaea4, 0xae84, 0xaea4, 0xa684, 0xa684, 0xa664, 0xa664, 0xa684, 0x5b82, 0x10a1, 0x0860, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0821, 0x0021, 0x0861, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0020, 0x2124, 0x10a0, 0x18c0, 0x1921, 0x31e2, 0x95e2, 0xa6c1, 0xa6c1, 0xaec1, 0xaec3, 0xb705, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbf05, 0xbee5, 0xb6e5, 0xb6e5, 0x63e3, 0x10a1, 0x0860, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x0841, 0x0020, 0x0861, 0x0000, 0x0000, 0x0020, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x39e7, 0x39e6, 0x4226, 0x4a66, 0x3a23, 0xa5e5, 0xcf86, 0xcf86, 0xcf46, 0xcf67, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0xdf68, 0x7484, 0x18e1, 0x1081, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x18c3, 0x18c3, 0x0841, 0x2104, 0x2104, 0x2104, 0x2104, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x41e7, 0x4228, 0x4a68, 0x5ac8, 0x3a03, 0x9d45, 0xe7e8, 0xe7c8, 0xdf87, 0xe788, 0xef89, 0xef89, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xf789, 0xef89, 0xef89, 0xf789, 0x7485, 0x18e2, 0x10a1, 0x0861, 0x0841, 0x0841, 0x0821, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0821, 0x0841, 0x0841, 0x18e3, 0x3186, 0x0862, 0x2946, 0x2946, 0x2946, 0x2946, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x39a6, 0x526a, 0x528a, 0x5aea, 0x4204, 0x94e6, 0xefea, 0xefc9, 0xefa8, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xef89, 0xef89, 0xefa9, 0xefa9, 0xef89, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xef89, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xefa9, 0xef89, 0xefa9, 0xefa9, 0xefa9, 0xef89, 0xef89, 0xefa9, 0x84c5, 0x2102, 0x10c1, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x18e4, 0x39c7, 0x1082, 0x31a7, 0x3187, 0x3187, 0x3187, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x2945, 0x62ac, 0x5aeb, 0x630c, 0x4225, 0x7be5, 0xffeb, 0xf7ca, 0xefaa, 0xf7ab, 0xf7ab, 0xf7aa, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78b, 0xf78a, 0xf76a, 0xf78a, 0xf78a, 0x7c86, 0x2102, 0x18c2, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x18e4, 0x39c7, 0x10a2, 0x420a, 0x4209, 0x4209, 0x39c8, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x18c3, 0x6aed, 0x6b0d, 0x6b4d, 0x4246, 0x6324, 0xffec, 0xf7eb, 0xf7ca, 0xf78b, 0xf7ab, 0xf78b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf76b, 0xf78b, 0x7446, 0x2123, 0x18e2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1062, 0x18c3, 0x39c7, 0x18a3, 0x5aad, 0x5aac, 0x52ac, 0x39e8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0841, 0x62cc, 0x6b0d, 0x6b4d, 0x5287, 0x4ac3, 0xdfeb, 0xd7ca, 0xd7c9, 0xd7a9, 0xd789, 0xd789, 0xdf89, 0xdfa9, 0xdfa9, 0xdf89, 0xdf89, 0xdf89, 0xdf89, 0xdfa9, 0xdfa9, 0xdfa9, 0xdf89, 0xdf89, 0xdf89, 0xdf89, 0xdf89, 0xdf89, 0xdfa9, 0xdf89, 0xdf89, 0xdf89, 0xdf89, 0xdf89, 0xdfa9, 0xdfa9, 0xdfa9, 0xdf89, 0xdfa9, 0xdfa9, 0xdfa9, 0xdf89, 0xdfa9, 0xdfa9, 0xdf89, 0xdfa9, 0xdf89, 0xdfa9, 0xdfa9, 0xdf89, 0xd789, 0xd789, 0x7405, 0x2102, 0x18c2, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x18e4, 0x39a7, 0x18e4, 0x6b4f, 0x6b4f, 0x6b2f, 0x39e8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0020, 0x2965, 0x39c7, 0x4227, 0x39c4, 0x31c2, 0xd7cb, 0xcfca, 0xcfaa, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xd78a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xcf8a, 0xd78a, 0xd78a, 0xcf8a, 0xcf8a, 0xd78a, 0xcf8a, 0xcf6a, 0xcf6a, 0xcf8a, 0x6ba6, 0x2943, 0x18e2, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a3, 0x18a3, 0x18e4, 0x2945, 0x1082, 0x4a2a, 0x4209, 0x41e9, 0x18c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x1081, 0x1081, 0x18c1, 0x1901, 0x1921, 0xbfc5, 0xbfc4, 0xb783, 0xb763, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf64, 0xbf65, 0xbf65, 0xbf65, 0xbf65, 0xbf65, 0xbf65, 0xbf65, 0xbf65, 0xbf65, 0xbf64, 0xbf64, 0xbf64, 0x3201, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0020, 0x0021, 0x0841, 0x0021, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x10a2, 0x10a1, 0x18c2, 0x1902, 0x2102, 0x1921, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10c0, 0x10e0, 0x10e0, 0x10e0, 0x10e0, 0x10e0, 0x10e0, 0x18e0, 0x18e0, 0x18e0, 0x18e1, 0x18e1, 0x18e1, 0x18e1, 0x18e1, 0x18e1, 0x18e1, 0x18e1, 0x18e1, 0x18e1, 0x10e1, 0x10c0, 0x10c0, 0x10a0, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x1062, 0x1062, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0841, 0x2104, 0x2144, 0x2944, 0x2944, 0x0880, 0x2161, 0x2141, 0x2141, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2161, 0x2181, 0x2161, 0x2181, 0x2181, 0x2181, 0x2181, 0x2181, 0x2981, 0x2981, 0x2981, 0x2981, 0x2981, 0x2982, 0x2182, 0x2981, 0x2982, 0x2982, 0x2981, 0x2981, 0x2181, 0x2181, 0x2141, 0x10c1, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0821, 0x0021, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x20e4, 0x2105, 0x2105, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+        0x0000, 0x2000, 0x2529, 0x2e6b, 0x4f73, 0x4e73, 0x2c63, 0x6321, 0x6442, 0x433a, 0x433a, 0x433a, 0x233a, 0x433a, 0x433a, 0x233a, 0x233a, 0x233a, 0x2232, 0x223a, 0x2232, 0x2232, 0x223a, 0x223a, 0x2232, 0x223a, 0x223a, 0x223a, 0x423a, 0x233a, 0x233a, 0x433a, 0x433a, 0x433a, 0x433a, 0x433a, 0x433a, 0x433a, 0x433a, 0x433a, 0x633a, 0x433a, 0x633a, 0x633a, 0x633a, 0x6342, 0x6342, 0x6342, 0x6342, 0x6342, 0x433a, 0x433a, 0x0332, 0x6329, 0x0321, 0xc318, 0xc318, 0xc318, 0xa318, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x6210, 0x6208, 0x6208, 0x6208, 0x6208, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6208, 0x6208, 0x6208, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa210, 0xc318, 0xe318, 0xc318, 0x0e63, 0x4f6b, 0x4f6b, 0xac5a, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x2000, 0xcc62, 0x8f7b, 0xaf7b, 0xcf7b, 0x674a, 0x665b, 0xe552, 0xc44a, 0xc44a, 0xc44a, 0xc44a, 0xa44a, 0xa44a, 0xa442, 0xa442, 0xa342, 0xa342, 0xa342, 0x8342, 0xa342, 0x8342, 0x8342, 0xa342, 0x8342, 0x8342, 0xa342, 0xa342, 0xa342, 0xa342, 0xa342, 0xa342, 0xa442, 0xa442, 0xa442, 0xa442, 0xa442, 0xc44a, 0xa44a, 0xa442, 0xc44a, 0xa44a, 0xa44a, 0xc44a, 0xa44a, 0xc44a, 0xc44a, 0xa44a, 0xa44a, 0xa442, 0x8442, 0x8442, 0xe218, 0xa210, 0x8110, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6208, 0x8210, 0xa210, 0xe318, 0xc318, 0xcd5a, 0x907b, 0x907b, 0x907b, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2000, 0x4108, 0x284a, 0x073a, 0x4742, 0x884a, 0x253a, 0xe8c7, 0xe7c7, 0xe7c7, 0xa6bf, 0x86bf, 0x86bf, 0x85bf, 0x85b7, 0x85b7, 0x85b7, 0x85b7, 0x85b7, 0x84b7, 0x84b7, 0x85b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x84b7, 0x85b7, 0x84bf, 0x84b7, 0x85b7, 0x84b7, 0x85bf, 0x85b7, 0x84b7, 0x85b7, 0x85b7, 0x84b7, 0x85b7, 0x85b7, 0x84b7, 0x84b7, 0x813a, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x4108, 0x4108, 0x8210, 0x0421, 0xc739, 0x0842, 0x0842, 0x0842, 0x8b52, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2000, 0xc318, 0x0742, 0xe639, 0x2642, 0x874a, 0x8442, 0xe8c7, 0xe7bf, 0xc6bf, 0xa5bf, 0x85b7, 0x65b7, 0x64b7, 0x64b7, 0x64b7, 0x64b7, 0x64b7, 0x64b7, 0x63b7, 0x63b7, 0x63b7, 0x63b7, 0x63af, 0x63af, 0x63af, 0x63af, 0x63b7, 0x63b7, 0x63af, 0x63af, 0x63af, 0x63af, 0x63af, 0x63af, 0x63af, 0x63af, 0x63b7, 0x63af, 0x63b7, 0x63b7, 0x63b7, 0x63b7, 0x63b7, 0x63b7, 0x63b7, 0x63af, 0x63b7, 0x63af, 0x63af, 0x63af, 0x63af, 0x63af, 0x4032, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0x4108, 0x8210, 0x6529, 0x8631, 0x0842, 0x0842, 0xe839, 0xcc5a, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x4108, 0x8631, 0x4842, 0x684a, 0x884a, 0xc852, 0x655b, 0xe8c7, 0x66b7, 0xa5bf, 0x65b7, 0x44b7, 0x24af, 0x23af, 0x23af, 0x03af, 0x02af, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x01a7, 0x019f, 0xc042, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x6108, 0xc318, 0xe739, 0xc739, 0x8a52, 0x8a52, 0x8a52, 0xec62, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x6108, 0x494a, 0xa952, 0xea5a, 0x2a63, 0x095b, 0x066c, 0xe9c7, 0x46b7, 0xa6bf, 0x45b7, 0x44b7, 0x24af, 0x03af, 0x03af, 0x03af, 0x03af, 0x03af, 0x02af, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0xe2a6, 0x01a7, 0x803a, 0x4000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x4108, 0x6108, 0x0421, 0x2842, 0x0842, 0x2c63, 0x2d63, 0x4d6b, 0xeb5a, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x8210, 0x694a, 0x8e73, 0x2f84, 0x9094, 0x4a63, 0x887c, 0xebcf, 0x07b7, 0x88bf, 0x27b7, 0x06b7, 0x06b7, 0x05af, 0xe5ae, 0xe5ae, 0xe4ae, 0xe4ae, 0xe5ae, 0xe4ae, 0xe4ae, 0xe4ae, 0xe4ae, 0xe4ae, 0xe4ae, 0xe3ae, 0xe4ae, 0xe4ae, 0xe3ae, 0xe4ae, 0xe4ae, 0xe3ae, 0xe4ae, 0xe4ae, 0xe3ae, 0xe4ae, 0xe4ae, 0xe3ae, 0xe4ae, 0xe3ae, 0xe4a6, 0xe4ae, 0xe3ae, 0xe4ae, 0xe4ae, 0xe3ae, 0xe4ae, 0xe4ae, 0xe3a6, 0xe4ae, 0xc4ae, 0xc3a6, 0xe3a6, 0x224b, 0x8108, 0x6108, 0x4008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2100, 0x2000, 0x2000, 0x4108, 0x2000, 0x2108, 0x4108, 0x2000, 0x4108, 0x4108, 0x4108, 0x6108, 0xa210, 0xa210, 0xa731, 0x8a52, 0x694a, 0x7294, 0x7294, 0x518c, 0x6d6b, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xc318, 0xeb5a, 0x7ff7, 0x7ff7, 0xbfff, 0x4f84, 0x4d9d, 0xb0d7, 0x6ecf, 0x6ed7, 0x4dcf, 0x4dcf, 0x4dcf, 0x2ccf, 0x2cc7, 0x0cc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bc7, 0x0bbf, 0x0bbf, 0x0bbf, 0x0bbf, 0x0abf, 0x687c, 0xa431, 0x4429, 0x0321, 0xe318, 0xe318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xe318, 0xe318, 0xe318, 0xe418, 0xe418, 0x0421, 0x0421, 0x2421, 0x2529, 0x4529, 0x6529, 0xc739, 0x0842, 0x2d63, 0xcf7b, 0x0c63, 0xdde6, 0x7ff7, 0x7ff7, 0xbcde, 0xa631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xc218, 0xd49c, 0x7ff7, 0x7ff7, 0xbfff, 0x2e84, 0xeead, 0xf2e7, 0xd0df, 0xd0df, 0xcfdf, 0xcfdf, 0xafdf, 0xafdf, 0xaedf, 0xaedf, 0xaedf, 0xaedf, 0xaedf, 0xaedf, 0xaedf, 0xaedf, 0xaedf, 0xaedf, 0xaddf, 0xaddf, 0xaddf, 0xadd7, 0xaddf, 0xaddf, 0xadd7, 0xaddf, 0xadd7, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xadd7, 0xadd7, 0xaddf, 0xadd7, 0xaddf, 0xaddf, 0xaddf, 0xadd7, 0xadd7, 0xadd7, 0x677c, 0xa431, 0x4429, 0xe318, 0xe318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xa318, 0xc318, 0xa318, 0xa318, 0xc318, 0xa318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xe318, 0xe318, 0xe418, 0xe420, 0x0421, 0x2421, 0x2529, 0x4529, 0xa731, 0xe839, 0x2d63, 0xaf7b, 0x0c63, 0xbcde, 0x7ff7, 0x7ff7, 0x3eef, 0xe739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xc318, 0xb8bd, 0x7ff7, 0x5ff7, 0x9ff7, 0x2e84, 0x6fbe, 0xf1e7, 0xd0df, 0xcfdf, 0xcfdf, 0xcfdf, 0xafdf, 0xcedf, 0xcedf, 0xcedf, 0xaedf, 0xaedf, 0xaedf, 0xcedf, 0xcedf, 0xcedf, 0xaddf, 0xaddf, 0xcddf, 0xcddf, 0xcddf, 0xaddf, 0xaddf, 0xcddf, 0xcddf, 0xaddf, 0xcddf, 0xaddf, 0xaddf, 0xcddf, 0xcddf, 0xaddf, 0xaddf, 0xcddf, 0xcddf, 0xcddf, 0xcddf, 0xcddf, 0xaddf, 0xcddf, 0xcddf, 0xcddf, 0xaddf, 0xaddf, 0xadd7, 0xadd7, 0xacd7, 0x677c, 0x8431, 0x2321, 0xe318, 0xc318, 0xc318, 0xa318, 0xa318, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa310, 0xa318, 0xa318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xe318, 0xe318, 0xe420, 0x0421, 0x0421, 0x2529, 0x6631, 0xc739, 0xec62, 0x8e73, 0xec62, 0x9cd6, 0x7ff7, 0x5ff7, 0x3fef, 0x2842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xc318, 0x1bce, 0x1fef, 0x1fef, 0x1fef, 0x0d7c, 0xcfc6, 0xf0e7, 0xcfdf, 0xafdf, 0xcedf, 0xaedf, 0xaedf, 0xaedf, 0xcedf, 0xaddf, 0xadd7, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xaddf, 0xadd7, 0xaddf, 0xadd7, 0xadd7, 0xadd7, 0xaddf, 0xadd7, 0xadd7, 0xaddf, 0xaddf, 0xadd7, 0xadd7, 0xadd7, 0xadd7, 0xaddf, 0xaddf, 0xaddf, 0xadd7, 0xadd7, 0xadd7, 0xaddf, 0xaddf, 0xadd7, 0xaddf, 0xaddf, 0xadd7, 0xadd7, 0xacd7, 0xacd7, 0xacd7, 0x677c, 0x6429, 0x2321, 0xe318, 0xc218, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa310, 0xa310, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xe318, 0xe418, 0x0421, 0x2421, 0x4529, 0xa631, 0xab5a, 0x2d63, 0xab52, 0x3bce, 0x3fef, 0x3fef, 0x1fe7, 0x6a4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xa210, 0x1bce, 0xdee6, 0xbede, 0xbdde, 0xca73, 0xefc6, 0xefdf, 0xaed7, 0xaedf, 0xaedf, 0xadd7, 0x8dd7, 0x8dd7, 0x8dd7, 0x8dd7, 0x8dd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8cd7, 0x8bd7, 0x8bd7, 0x4774, 0x6329, 0x0321, 0xc218, 0xa210, 0xa210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa318, 0xc318, 0xc318, 0xc318, 0xe318, 0xe318, 0x0421, 0x4529, 0x8631, 0x6a52, 0x2d63, 0x6a4a, 0xb9bd, 0xfee6, 0xdee6, 0xdee6, 0x0942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xa210, 0xfac5, 0x7dd6, 0x7dd6, 0x5cd6, 0x896b, 0xeec6, 0xaed7, 0x8dd7, 0xcedf, 0xadd7, 0x8dd7, 0x6cd7, 0x6cd7, 0x6cd7, 0x6cd7, 0x6cd7, 0x6ccf, 0x6cd7, 0x6ccf, 0x6bd7, 0x6bd7, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x6bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x667c, 0x6329, 0x0321, 0xa218, 0xa210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa210, 0xa210, 0xa310, 0xc318, 0xc318, 0xc318, 0xc318, 0xe420, 0x2421, 0x6629, 0x6a4a, 0xec5a, 0x294a, 0x57ad, 0x9dd6, 0x7dd6, 0x9dd6, 0x494a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xc318, 0xb9bd, 0xfbc5, 0xfbcd, 0xd9cd, 0x886b, 0x0ecf, 0x8dd7, 0x4ccf, 0x8cd7, 0x6cd7, 0x8cd7, 0x4ccf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4bcf, 0x4acf, 0x4acf, 0x4ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x6674, 0x4321, 0xe218, 0xa210, 0x8210, 0x8210, 0x8210, 0x6210, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6210, 0x6210, 0x6210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa210, 0xa210, 0xa210, 0xa318, 0xc318, 0xe318, 0x0421, 0x4529, 0x0942, 0x8a52, 0xe839, 0x528c, 0xfbc5, 0xfac5, 0xfbc5, 0x6a52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x8210, 0x79bd, 0x79b5, 0x78bd, 0x77bd, 0x886b, 0x2dc7, 0x6ccf, 0x2bc7, 0x8bd7, 0x6bcf, 0x6bcf, 0x4bcf, 0x2bc7, 0x2bc7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x2ac7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x256c, 0x2321, 0xe218, 0xa210, 0x8110, 0x8210, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6208, 0x6208, 0x6208, 0x6108, 0x6208, 0x8210, 0x6208, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa210, 0xa210, 0xc318, 0xe318, 0x2421, 0xe839, 0x4a4a, 0xc739, 0x6e6b, 0x78b5, 0x78b5, 0x79b5, 0x294a, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xa210, 0x37ad, 0x17ad, 0x17b5, 0x34a5, 0x8763, 0x4ccf, 0x4bc7, 0x2ac7, 0x6bcf, 0x4acf, 0x4ac7, 0x2ac7, 0x0ac7, 0x0ac7, 0x0ac7, 0x0ac7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09c7, 0x09bf, 0x09bf, 0xe9be, 0xe9be, 0xe9be, 0xe9be, 0x4574, 0x2221, 0xc218, 0x8110, 0x8110, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6208, 0x6208, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa318, 0xc318, 0x0421, 0xc739, 0x0942, 0xa731, 0xec62, 0x17a5, 0x17ad, 0x17ad, 0x6a52, 0x8210, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xc318, 0xb5a4, 0x95a4, 0xb4a4, 0xb294, 0x8663, 0x2bc7, 0x2ac7, 0xe9be, 0x4acf, 0x09c7, 0x29c7, 0x09c7, 0xe9be, 0xe9be, 0xe9be, 0xe9be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xe8be, 0xc8be, 0xc8b6, 0xc8b6, 0xc8b6, 0x6474, 0x0219, 0xc218, 0x8110, 0x6108, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x8210, 0x8210, 0xa210, 0xa318, 0xe418, 0xa731, 0xc839, 0x8631, 0xab5a, 0xb59c, 0xb59c, 0xd59c, 0x2e6b, 0x9073, 0xb07b, 0xb07b, 0x8b52, 0x2000, 0x0000,
+        0xa210, 0x5494, 0x5394, 0x7294, 0x718c, 0xa663, 0x0bc7, 0x09bf, 0xc8b6, 0x29c7, 0x08bf, 0x08bf, 0xe8be, 0xe8be, 0xc8be, 0xe8be, 0xc8b6, 0xc8b6, 0xc8b6, 0xc8b6, 0xc8b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0x246c, 0xe218, 0xa210, 0x6108, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x6108, 0x6108, 0x6108, 0x8210, 0xa210, 0xe318, 0x8631, 0xa739, 0x8631, 0x6a4a, 0x5494, 0x7494, 0x7494, 0xcc5a, 0x6a52, 0x8b52, 0x6a4a, 0xac5a, 0x4108, 0x2000,
+        0xc318, 0x128c, 0xf18b, 0x3084, 0x1084, 0x8663, 0x0ac7, 0xc8b6, 0xa7b6, 0x08bf, 0xe8be, 0xe8be, 0xe8be, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xc7b6, 0xa7b6, 0xc7b6, 0xc7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7b6, 0xa7ae, 0xa7ae, 0x86ae, 0x246c, 0xe218, 0xa110, 0x6108, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x6108, 0x8210, 0x8210, 0xc318, 0x6629, 0x8631, 0x6631, 0x294a, 0x128c, 0x338c, 0x338c, 0xec5a, 0x0842, 0x0842, 0x0842, 0x2942, 0xc318, 0x4108,
+        0xc318, 0xb183, 0xcf7b, 0xcf7b, 0xed7b, 0xa563, 0xe9be, 0x86ae, 0x86ae, 0xe7be, 0xc7b6, 0xe7b6, 0xa7b6, 0xa6b6, 0xa6b6, 0xa6b6, 0xa6b6, 0xa6ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x66ae, 0x66ae, 0x236c, 0xc118, 0xa110, 0x6108, 0x4108, 0x4108, 0x2000, 0x2108, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2108, 0x2108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x6108, 0xc318, 0xe420, 0x4529, 0x4529, 0xe841, 0xd183, 0xf283, 0x1284, 0x4e6b, 0x78b5, 0xdac5, 0x1bc6, 0xf183, 0x2521, 0x4108,
+        0xa210, 0x707b, 0x8e73, 0x8e73, 0xac73, 0xc563, 0xe8be, 0x86ae, 0x65ae, 0xc6b6, 0xc6b6, 0xc6b6, 0xa6b6, 0xa6ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x86ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x65ae, 0x65ae, 0x45a6, 0x65ae, 0xe363, 0xc110, 0x8110, 0x4108, 0x4008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2100, 0x2108, 0x4108, 0x2100, 0x4108, 0x4108, 0x4108, 0x6108, 0x6108, 0xa210, 0xe318, 0x2529, 0x2529, 0xc739, 0xb07b, 0xd17b, 0xf283, 0x2e6b, 0xfac5, 0xbede, 0xdfe6, 0xbede, 0xa731, 0x6108,
+        0xc318, 0x4e73, 0x4d6b, 0x6d6b, 0x6a6b, 0xa563, 0xe8b6, 0x65a6, 0x45a6, 0xc6b6, 0xa6b6, 0xa6b6, 0x85ae, 0x85ae, 0x85ae, 0x85ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65ae, 0x65a6, 0x65a6, 0x65ae, 0x65a6, 0x45a6, 0x45a6, 0x0364, 0xa110, 0x8110, 0x4008, 0x4008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0xa210, 0xc318, 0x0421, 0x2521, 0x8731, 0x7073, 0x907b, 0xd17b, 0x4e6b, 0x78b5, 0x1cc6, 0x3dce, 0x3dce, 0x6a4a, 0x6108,
+        0xc218, 0x2d6b, 0x0c63, 0x2c63, 0x296b, 0xc463, 0xc7b6, 0x44a6, 0x44a6, 0xa5ae, 0xa5ae, 0x85ae, 0x85ae, 0x65ae, 0x65ae, 0x65a6, 0x65a6, 0x64a6, 0x64a6, 0x64a6, 0x64a6, 0x44a6, 0x64a6, 0x44a6, 0x44a6, 0x64a6, 0x64a6, 0x64a6, 0x44a6, 0x64a6, 0x64a6, 0x64a6, 0x64a6, 0x44a6, 0x64a6, 0x44a6, 0x64a6, 0x64a6, 0x44a6, 0x44a6, 0x64a6, 0x44a6, 0x44a6, 0x64a6, 0x44a6, 0x64a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x249e, 0x44a6, 0xe263, 0xa110, 0x6108, 0x4008, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 0x8210, 0xa310, 0xe420, 0x0421, 0x6631, 0x2e6b, 0x4f73, 0x907b, 0x2d6b, 0x538c, 0xf7a4, 0xf8a4, 0x38ad, 0x0c63, 0x6208,
+        0x8210, 0x0c63, 0xeb5a, 0x2b63, 0x0863, 0xe463, 0xc6ae, 0x449e, 0x249e, 0xa4ae, 0x84ae, 0x84ae, 0x64a6, 0x64a6, 0x64a6, 0x64a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x249e, 0x249e, 0x249e, 0xa25b, 0x8110, 0x6108, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2108, 0x4108, 0x6210, 0x8210, 0xe318, 0x0421, 0x2529, 0x0d63, 0x2e6b, 0x2e6b, 0xcc5a, 0x6f73, 0x1284, 0x548c, 0x5494, 0xcc5a, 0x6108,
+        0xa210, 0xeb5a, 0xcb5a, 0x0a63, 0xe75a, 0xc363, 0xa6ae, 0x239e, 0x039e, 0x84a6, 0x64a6, 0x84a6, 0x64a6, 0x64a6, 0x44a6, 0x44a6, 0x44a6, 0x44a6, 0x439e, 0x44a6, 0x439e, 0x439e, 0x439e, 0x44a6, 0x439e, 0x44a6, 0x439e, 0x439e, 0x44a6, 0x439e, 0x43a6, 0x439e, 0x43a6, 0x439e, 0x44a6, 0x439e, 0x439e, 0x44a6, 0x439e, 0x239e, 0x44a6, 0x439e, 0x44a6, 0x439e, 0x439e, 0x44a6, 0x239e, 0x239e, 0x239e, 0x239e, 0x239e, 0x039e, 0x049e, 0xc25b, 0x8110, 0x6008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x6108, 0x8210, 0xc318, 0xe318, 0x2521, 0xcc62, 0xed62, 0xed62, 0xab52, 0xac5a, 0x2e6b, 0x4f6b, 0x7073, 0x8b52, 0x4108,
+        0x8110, 0x0219, 0xe118, 0x2119, 0x6121, 0xa153, 0xe28d, 0xe074, 0xc074, 0x8085, 0x6085, 0x6085, 0x4085, 0x407d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x007d, 0x007d, 0x007d, 0xe074, 0x007d, 0x2043, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4108, 0x6208, 0xe418, 0xc318, 0xe318, 0x2421, 0xe841, 0x294a, 0x6b52, 0x6b52, 0x6b52, 0x4b4a, 0x4108,
+        0x6108, 0xe218, 0xc110, 0x0119, 0x4021, 0x8153, 0xe18d, 0xc074, 0xc074, 0x6085, 0x607d, 0x6085, 0x407d, 0x207d, 0x207d, 0x207d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x0075, 0xe074, 0xe074, 0xe074, 0x0043, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4108, 0x6108, 0xc318, 0xa210, 0xc318, 0xe318, 0xc839, 0xa731, 0xa731, 0xa739, 0xa739, 0x0a42, 0x2000,
+        0x6108, 0xc118, 0xa010, 0xe018, 0x2019, 0x6053, 0xa185, 0xa06c, 0xa06c, 0x407d, 0x607d, 0x607d, 0x407d, 0x207d, 0x207d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x0075, 0x007d, 0x007d, 0x007d, 0x0075, 0x007d, 0x007d, 0x007d, 0x0075, 0x007d, 0x0075, 0x007d, 0x0075, 0x007d, 0x007d, 0x007d, 0x007d, 0x0075, 0x007d, 0x0075, 0x007d, 0x0075, 0x007d, 0x007d, 0xe074, 0xe074, 0xe074, 0xc074, 0x204b, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x6108, 0x8210, 0x8210, 0xa210, 0xa310, 0x8631, 0xe318, 0xe318, 0xe318, 0xe318, 0xa839, 0x2000,
+        0x4108, 0xc118, 0xa010, 0xe010, 0x2019, 0x6053, 0xc185, 0xa06c, 0xa06c, 0x407d, 0x407d, 0x407d, 0x207d, 0x207d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x0075, 0x0075, 0x0075, 0x0075, 0x007d, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x007d, 0x007d, 0xe074, 0xe074, 0x0075, 0xe074, 0x007d, 0x007d, 0xe074, 0x0075, 0xe074, 0xe074, 0xe074, 0xc074, 0xc074, 0x0043, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x6108, 0x8210, 0x6108, 0x8210, 0x8210, 0x4629, 0xa310, 0xa210, 0xa210, 0xa210, 0x6731, 0x2000,
+        0x4008, 0xc118, 0xa010, 0xc010, 0x2019, 0x6053, 0xc18d, 0xa06c, 0xa06c, 0x407d, 0x407d, 0x407d, 0x207d, 0x207d, 0x007d, 0x007d, 0x007d, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0xe074, 0x0075, 0x0075, 0x0075, 0x007d, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0xe074, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0xe074, 0xe074, 0x0075, 0xe074, 0x0075, 0x0075, 0x0075, 0xe074, 0xe074, 0xe074, 0xe074, 0xe074, 0xe074, 0xc074, 0xc074, 0x0043, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x2000, 0x6108, 0x6108, 0x4108, 0x6108, 0x6108, 0x4529, 0xa210, 0x8210, 0x8210, 0x8210, 0x2629, 0x0000,
+        0x6108, 0xc118, 0x8008, 0xc010, 0x2019, 0x404b, 0xa185, 0xa06c, 0xa06c, 0x407d, 0x407d, 0x407d, 0x207d, 0x007d, 0x007d, 0x007d, 0x007d, 0x0075, 0x0075, 0x0075, 0xe074, 0x0075, 0xe074, 0x0075, 0x0075, 0xe074, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0xe074, 0xe074, 0xe074, 0xe074, 0x0075, 0x0075, 0xe074, 0xe074, 0xe074, 0x0075, 0x0075, 0x0075, 0xe074, 0x0075, 0xe074, 0xe074, 0xe074, 0xe074, 0xe074, 0xc074, 0xc074, 0x004b, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x0421, 0x8210, 0x6108, 0x6108, 0x6108, 0xc418, 0x0000,
+        0x4008, 0xc118, 0x8008, 0xc010, 0x2019, 0x6053, 0xc18d, 0xa06c, 0xa06c, 0x407d, 0x407d, 0x407d, 0x207d, 0x007d, 0x007d, 0x007d, 0x007d, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x007d, 0x0075, 0xe074, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x007d, 0xe074, 0x0075, 0x007d, 0x0075, 0x0075, 0x0075, 0xe074, 0xe074, 0xe074, 0x0075, 0x0075, 0xe074, 0x0075, 0xe074, 0xe074, 0xe074, 0xe074, 0xe074, 0xc074, 0x0043, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x6108, 0x4108, 0x2000, 0x2100, 0x4108, 0xe418, 0x6108, 0x4108, 0x4108, 0x4108, 0xa310, 0x0000,
+        0x4008, 0xa110, 0x8008, 0xc010, 0x2019, 0xa053, 0x2196, 0xc06c, 0xa06c, 0x4085, 0x407d, 0x407d, 0x407d, 0x407d, 0x207d, 0x407d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x207d, 0x0075, 0x007d, 0x404b, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x4108, 0x6208, 0x4108, 0x2000, 0x2000, 0x2100, 0xc318, 0x4108, 0x4108, 0x2100, 0x2000, 0x6210, 0x0000,
+        0x4008, 0xa110, 0x8008, 0xc010, 0x2019, 0x8053, 0x2196, 0xc074, 0xc074, 0x6085, 0x607d, 0x6185, 0x8185, 0xa18d, 0x818d, 0x818d, 0x818d, 0x818d, 0x818d, 0x818d, 0x8185, 0x818d, 0x818d, 0x818d, 0x818d, 0x818d, 0x8185, 0x818d, 0x818d, 0x818d, 0x818d, 0x818d, 0x818d, 0x8185, 0x8185, 0x818d, 0x818d, 0x818d, 0x818d, 0x8185, 0x818d, 0x818d, 0x818d, 0x8185, 0x818d, 0x818d, 0x818d, 0x818d, 0x818d, 0x8185, 0x8185, 0x6185, 0x6185, 0xa153, 0x6008, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x6108, 0x6210, 0x2000, 0x2000, 0x2000, 0x2000, 0xa210, 0x2000, 0x2000, 0x2000, 0x2000, 0x6208, 0x0000,
+        0x2000, 0xa110, 0x8008, 0xc010, 0x2019, 0x8053, 0x4196, 0xc06c, 0xc06c, 0x6085, 0x607d, 0x8185, 0x818d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0x818d, 0x818d, 0x8185, 0x8185, 0x8185, 0x8153, 0x6008, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x6108, 0x8210, 0x0000, 0x0000, 0x0000, 0x2000, 0x8210, 0x2000, 0x2000, 0x2000, 0x2000, 0x8210, 0x0000,
+        0x2000, 0xa110, 0x8008, 0xc010, 0x2019, 0x8053, 0x2196, 0xc074, 0xc074, 0x6085, 0x607d, 0x8185, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0x818d, 0x8185, 0x8185, 0x8185, 0xa15b, 0x6008, 0x4008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x6108, 0x8210, 0x2000, 0x0000, 0x0000, 0x0000, 0x6208, 0x2000, 0x2000, 0x2000, 0x2000, 0x8210, 0x0000,
+        0x2000, 0xa110, 0x8008, 0xc010, 0x2019, 0x204b, 0x018e, 0xe074, 0xc074, 0x6085, 0x6085, 0x8185, 0xc18d, 0xc18d, 0xa18d, 0xa18d, 0xc18d, 0xa18d, 0xa18d, 0xc18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xc28d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xc28d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0xa18d, 0x818d, 0x818d, 0xc15b, 0x6008, 0x4008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4108, 0x6210, 0x0000, 0x0000, 0x0000, 0x0000, 0x6208, 0x2000, 0x2000, 0x2100, 0x4108, 0x8210, 0x0000,
+        0x2000, 0x8110, 0x8008, 0xc010, 0x2019, 0x404b, 0x018e, 0xe074, 0xe074, 0x8085, 0x6085, 0xa18d, 0xc18d, 0xc18d, 0xc18d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xa28d, 0xa28d, 0xa28d, 0xa28d, 0xa15b, 0x6008, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4108, 0x8210, 0x0000, 0x0000, 0x0000, 0x2000, 0x8210, 0x6731, 0x8731, 0x8731, 0x8731, 0x4108, 0x0000,
+        0x2000, 0x8110, 0x8008, 0xc010, 0x0019, 0x0043, 0x2196, 0xe074, 0xe074, 0x8085, 0x6085, 0xa18d, 0xe295, 0xc28d, 0xc295, 0xc28d, 0xe28d, 0xe28d, 0xc295, 0xc295, 0xc28d, 0xc295, 0xc295, 0xc295, 0xe28d, 0xe28d, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc295, 0xc28d, 0xc28d, 0xa28d, 0xa28d, 0xa28d, 0xc15b, 0x6008, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4108, 0x6210, 0x0000, 0x0000, 0x0000, 0x2000, 0xa310, 0x2a4a, 0x4b4a, 0x4b4a, 0x2a4a, 0x2000, 0x0000,
+        0x2000, 0x8008, 0x8008, 0xc010, 0x0019, 0xc03a, 0x4196, 0x0075, 0xe074, 0xa085, 0x8085, 0xc18d, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xe295, 0xc28d, 0xc28d, 0xc28d, 0xc28d, 0xe15b, 0x6008, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0xee62, 0x0e63, 0x2e6b, 0x6b52, 0x0000, 0x0000,
+        0x2000, 0x8008, 0x8008, 0xc010, 0x0019, 0xc042, 0x4196, 0x0075, 0x007d, 0xc08d, 0xa085, 0xc18d, 0x0296, 0xe295, 0x0296, 0xe295, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0xe295, 0xe295, 0xe295, 0xc28d, 0xc295, 0xa15b, 0x8008, 0x4008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0xa310, 0x8210, 0xa310, 0xa310, 0xa310, 0x0000, 0x0000,
+        0x2000, 0x6008, 0x8008, 0xc010, 0x0019, 0x803a, 0x6196, 0x0075, 0x207d, 0xe08d, 0xa085, 0xe295, 0x2296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0xe295, 0xe295, 0xe295, 0xe295, 0xc15b, 0x8008, 0x4008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000, 0x6210, 0x0000, 0x0000, 0x0000, 0x0000, 0xa318, 0x2521, 0x2521, 0x2529, 0xa310, 0x0000, 0x0000,
+        0x2000, 0x6008, 0x8008, 0xc010, 0x0019, 0x603a, 0x619e, 0x207d, 0x207d, 0x008e, 0xc08d, 0x0296, 0x429e, 0x229e, 0x2296, 0x229e, 0x229e, 0x229e, 0x229e, 0x229e, 0x229e, 0x229e, 0x229e, 0x229e, 0x2296, 0x229e, 0x2296, 0x2296, 0x229e, 0x229e, 0x2296, 0x229e, 0x229e, 0x229e, 0x2296, 0x229e, 0x2296, 0x229e, 0x229e, 0x229e, 0x229e, 0x2296, 0x2296, 0x229e, 0x2296, 0x229e, 0x229e, 0x2296, 0x2296, 0x229e, 0x0296, 0x0296, 0x0296, 0xc25b, 0x8008, 0x4008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x6208, 0x2000, 0x0000, 0x0000, 0x0000, 0x6208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2000, 0x6008, 0x8008, 0xc010, 0x0019, 0x603a, 0x4196, 0x407d, 0x407d, 0x0096, 0xc08d, 0x229e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x239e, 0x229e, 0x0296, 0x0296, 0xa25b, 0x8008, 0x6008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2108, 0x2000, 0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2000, 0x8108, 0x8008, 0xc010, 0x2019, 0x4032, 0x218e, 0x607d, 0x607d, 0x0096, 0xe08d, 0x429e, 0x63a6, 0x63a6, 0x439e, 0x63a6, 0x63a6, 0x63a6, 0x639e, 0x63a6, 0x63a6, 0x439e, 0x439e, 0x63a6, 0x439e, 0x63a6, 0x439e, 0x63a6, 0x439e, 0x63a6, 0x439e, 0x63a6, 0x63a6, 0x439e, 0x439e, 0x439e, 0x439e, 0x439e, 0x63a6, 0x63a6, 0x63a6, 0x63a6, 0x439e, 0x63a6, 0x439e, 0x439e, 0x63a6, 0x439e, 0x439e, 0x439e, 0x239e, 0x239e, 0x239e, 0xc25b, 0x8008, 0x6008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2108, 0x2000, 0x4108, 0x2100, 0x0000, 0x0000, 0x0000, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2000, 0xa118, 0x8008, 0xc010, 0x2019, 0x2132, 0xc18d, 0xa085, 0xe08d, 0x0096, 0x2196, 0x63a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x63a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x63a6, 0x83a6, 0x63a6, 0x63a6, 0x83a6, 0x63a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x83a6, 0x63a6, 0x63a6, 0x63a6, 0x63a6, 0x83a6, 0x83a6, 0x83a6, 0x63a6, 0x63a6, 0x63a6, 0x439e, 0x439e, 0x439e, 0xe263, 0x8110, 0x6008, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x2000, 0x2108, 0x4108, 0x0000, 0x0000, 0x0000, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2000, 0xe218, 0x8008, 0xc010, 0x2019, 0x0132, 0x8185, 0xe08d, 0x0096, 0x2096, 0x419e, 0x83a6, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0x84a6, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0x84a6, 0xa4ae, 0xa4ae, 0xa4ae, 0x84ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0xa4ae, 0x84ae, 0xa4ae, 0x84ae, 0xa4ae, 0x84a6, 0x84a6, 0x64a6, 0x64a6, 0x84a6, 0x825b, 0xa110, 0x6008, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x2108, 0x2100, 0x6108, 0x0000, 0x0000, 0x0000, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2000, 0x2421, 0xa010, 0xc018, 0x2119, 0xe231, 0xe295, 0xc1a6, 0xc1a6, 0xc1ae, 0xc3ae, 0x05b7, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0x05bf, 0xe5be, 0xe5b6, 0xe5b6, 0xe363, 0xa110, 0x6008, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6210, 0x4108, 0x2000, 0x6108, 0x0000, 0x0000, 0x2000, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xe739, 0xe639, 0x2642, 0x664a, 0x233a, 0xe5a5, 0x86cf, 0x86cf, 0x46cf, 0x67cf, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x68df, 0x8474, 0xe118, 0x8110, 0x4108, 0x4108, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0xc318, 0xc318, 0x4108, 0x0421, 0x0421, 0x0421, 0x0421, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xe741, 0x2842, 0x684a, 0xc85a, 0x033a, 0x459d, 0xe8e7, 0xc8e7, 0x87df, 0x88e7, 0x89ef, 0x89ef, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89f7, 0x89ef, 0x89ef, 0x89f7, 0x8574, 0xe218, 0xa110, 0x6108, 0x4108, 0x4108, 0x2108, 0x2000, 0x2000, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2108, 0x4108, 0x4108, 0xe318, 0x8631, 0x6208, 0x4629, 0x4629, 0x4629, 0x4629, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xa639, 0x6a52, 0x8a52, 0xea5a, 0x0442, 0xe694, 0xeaef, 0xc9ef, 0xa8ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0x89ef, 0x89ef, 0xa9ef, 0xa9ef, 0x89ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0x89ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0xa9ef, 0x89ef, 0xa9ef, 0xa9ef, 0xa9ef, 0x89ef, 0x89ef, 0xa9ef, 0xc584, 0x0221, 0xc110, 0x6108, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0xe418, 0xc739, 0x8210, 0xa731, 0x8731, 0x8731, 0x8731, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x4529, 0xac62, 0xeb5a, 0x0c63, 0x2542, 0xe57b, 0xebff, 0xcaf7, 0xaaef, 0xabf7, 0xabf7, 0xaaf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8bf7, 0x8af7, 0x6af7, 0x8af7, 0x8af7, 0x867c, 0x0221, 0xc218, 0x8110, 0x6108, 0x6108, 0x6108, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x6108, 0xe418, 0xc739, 0xa210, 0x0a42, 0x0942, 0x0942, 0xc839, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xc318, 0xed6a, 0x0d6b, 0x4d6b, 0x4642, 0x2463, 0xecff, 0xebf7, 0xcaf7, 0x8bf7, 0xabf7, 0x8bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x6bf7, 0x8bf7, 0x4674, 0x2321, 0xe218, 0x8210, 0x8210, 0x8210, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x8210, 0x6210, 0xc318, 0xc739, 0xa318, 0xad5a, 0xac5a, 0xac52, 0xe839, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x4108, 0xcc62, 0x0d6b, 0x4d6b, 0x8752, 0xc34a, 0xebdf, 0xcad7, 0xc9d7, 0xa9d7, 0x89d7, 0x89d7, 0x89df, 0xa9df, 0xa9df, 0x89df, 0x89df, 0x89df, 0x89df, 0xa9df, 0xa9df, 0xa9df, 0x89df, 0x89df, 0x89df, 0x89df, 0x89df, 0x89df, 0xa9df, 0x89df, 0x89df, 0x89df, 0x89df, 0x89df, 0xa9df, 0xa9df, 0xa9df, 0x89df, 0xa9df, 0xa9df, 0xa9df, 0x89df, 0xa9df, 0xa9df, 0x89df, 0xa9df, 0x89df, 0xa9df, 0xa9df, 0x89df, 0x89d7, 0x89d7, 0x0574, 0x0221, 0xc218, 0x8110, 0x8110, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x8210, 0x8210, 0xe418, 0xa739, 0xe418, 0x4f6b, 0x4f6b, 0x2f6b, 0xe839, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x2000, 0x6529, 0xc739, 0x2742, 0xc439, 0xc231, 0xcbd7, 0xcacf, 0xaacf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8ad7, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8acf, 0x8ad7, 0x8ad7, 0x8acf, 0x8acf, 0x8ad7, 0x8acf, 0x6acf, 0x6acf, 0x8acf, 0xa66b, 0x4329, 0xe218, 0xa210, 0xa210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa310, 0xa318, 0xe418, 0x4529, 0x8210, 0x2a4a, 0x0942, 0xe941, 0xc418, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x8110, 0x8110, 0xc118, 0x0119, 0x2119, 0xc5bf, 0xc4bf, 0x83b7, 0x63b7, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x64bf, 0x65bf, 0x65bf, 0x65bf, 0x65bf, 0x65bf, 0x65bf, 0x65bf, 0x65bf, 0x65bf, 0x64bf, 0x64bf, 0x64bf, 0x0132, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x2000, 0x2100, 0x4108, 0x2100, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xa210, 0xa110, 0xc218, 0x0219, 0x0221, 0x2119, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xc010, 0xe010, 0xe010, 0xe010, 0xe010, 0xe010, 0xe010, 0xe018, 0xe018, 0xe018, 0xe118, 0xe118, 0xe118, 0xe118, 0xe118, 0xe118, 0xe118, 0xe118, 0xe118, 0xe118, 0xe110, 0xc010, 0xc010, 0xa010, 0x4008, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x6210, 0x6210, 0x8210, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x4108, 0x0421, 0x4421, 0x4429, 0x4429, 0x8008, 0x6121, 0x4121, 0x4121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x8121, 0x6121, 0x8121, 0x8121, 0x8121, 0x8121, 0x8121, 0x8129, 0x8129, 0x8129, 0x8129, 0x8129, 0x8229, 0x8221, 0x8129, 0x8229, 0x8229, 0x8129, 0x8129, 0x8121, 0x8121, 0x4121, 0xc110, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2108, 0x2100, 0x2100, 0x2100, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0xe420, 0x0521, 0x0521, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
 };
 const tImage_RGB Image = { image_data_Image, 126, 58,
-                       16 };
+                       16, IMAGE_RGB_BIG_ENDIAN };
@@ -11,6 +11,7 @@
 * conversion type: Color, not_used not_used
 * split to rows: yes
 * bits per pixel: 16
+* byte order: big-endian (panel wire order)
 *
 * preprocess:
 *  main scan direction: top_to_bottom
@@ -24,7 +25,8 @@
      uint16_t width;
      uint16_t height;
      uint8_t dataSize;
-     } tImage;
+     uint8_t flags;
+     } tImage_RGB;
 */
 #include <stdint.h>
 #include "picts.h"
@@ -90,64 +92,64 @@ static const uint16_t image_data_battery_big[7308] = {
     // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
     // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
     // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    0x0861, 0x1082, 0x4a48, 0x7bed, 0x840e, 0x7bed, 0x738c, 0x3186, 0x4208, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3185, 0x3185, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x3185, 0x3185, 0x3185, 0x31a5, 0x31a5, 0x3186, 0x31a5, 0x31a5, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31c6, 0x39c6, 0x31a6, 0x31c6, 0x39c6, 0x39c6, 0x39e6, 0x39c6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x31a6, 0x31a6, 0x31c6, 0x31c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a5, 0x3186, 0x31a6, 0x31a5, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x31a6, 0x3186, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x39c6, 0x39c6, 0x39c6, 0x4228, 0x4a48, 0x2945, 0x7bcd, 0x840e, 0x840e, 0x738c, 0x18e3, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x0841, 0x0861, 0x0861, 
-    0x1082, 0x10a2, 0x73ac, 0x7bed, 0x7bed, 0x7c0d, 0x4248, 0x4a69, 0x39e6, 0x2985, 0x2965, 0x2965, 0x2944, 0x2945, 0x2144, 0x2144, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2985, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2144, 0x2144, 0x2944, 0x2944, 0x2965, 0x2985, 0x3185, 0x31a6, 0x31a6, 0x39e7, 0x4a48, 0x39c6, 0x6b6b, 0x840e, 0x840e, 0x840e, 0x39e6, 0x18e3, 0x18c3, 0x1082, 0x0861, 0x1082, 0x0841, 0x0861, 
-    0x10a2, 0x2104, 0x4a48, 0x39c6, 0x39e7, 0x39e7, 0x3185, 0x4a68, 0x2124, 0x18c3, 0x10a2, 0x1082, 0x10a2, 0x1082, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x1081, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x18c3, 0x1082, 0x10a2, 0x2104, 0x2124, 0x2965, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x632b, 0x2944, 0x18e3, 0x10a2, 0x1082, 0x1082, 0x1082, 0x0841, 
-    0x18e3, 0x31a6, 0x39c7, 0x31a6, 0x31a6, 0x39c6, 0x39c7, 0x52ca, 0x2104, 0x18c3, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861, 0x0841, 0x1082, 0x0861, 0x1082, 0x2103, 0x2124, 0x2965, 0x5acb, 0x4208, 0x4208, 0x4208, 0x39e7, 0x630b, 0x2965, 0x18e3, 0x18c3, 0x1082, 0x0861, 0x1082, 0x0841, 
-    0x2124, 0x4a48, 0x4208, 0x4208, 0x39e7, 0x4207, 0x3a07, 0x5aea, 0x2945, 0x18c3, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x1082, 0x2104, 0x2945, 0x39c7, 0x6b4d, 0x4a69, 0x528a, 0x528a, 0x528a, 0x630b, 0x39c7, 0x2124, 0x18e3, 0x10a2, 0x1082, 0x1082, 0x0841, 
-    0x2965, 0x5aca, 0x4a69, 0x528a, 0x528a, 0x4a49, 0x4228, 0x630b, 0x3185, 0x18e3, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0861, 0x0861, 0x0841, 0x1082, 0x1082, 0x1082, 0x10a2, 0x2944, 0x2965, 0x4228, 0x73ae, 0x5aeb, 0x632c, 0x6b4c, 0x6b4d, 0x5aeb, 0x4228, 0x3185, 0x2124, 0x18c3, 0x10a2, 0x0861, 0x0861, 
-    0x3185, 0x52aa, 0x6b6d, 0x7bef, 0x8410, 0x52aa, 0x52aa, 0x6b6c, 0x3a07, 0x31a6, 0x2965, 0x2944, 0x2945, 0x2965, 0x2944, 0x2945, 0x2944, 0x2124, 0x2964, 0x2124, 0x2144, 0x2945, 0x2124, 0x2944, 0x2945, 0x2124, 0x2945, 0x2965, 0x2124, 0x2964, 0x2964, 0x2124, 0x2965, 0x2945, 0x2124, 0x2965, 0x2944, 0x2124, 0x2965, 0x2124, 0x2124, 0x2965, 0x2124, 0x2944, 0x2965, 0x2124, 0x2945, 0x2965, 0x2124, 0x2964, 0x2964, 0x2124, 0x2965, 0x2945, 0x2124, 0x2965, 0x2944, 0x2124, 0x2965, 0x2124, 0x2124, 0x2965, 0x2124, 0x2944, 0x2965, 0x2124, 0x2945, 0x2965, 0x2124, 0x2964, 0x2964, 0x2124, 0x2965, 0x2945, 0x2124, 0x2965, 0x2944, 0x2124, 0x2965, 0x2124, 0x2124, 0x2965, 0x2124, 0x2944, 0x2965, 0x2124, 0x2945, 0x2965, 0x2124, 0x2964, 0x2964, 0x2124, 0x2965, 0x2945, 0x2124, 0x2945, 0x2944, 0x2104, 0x2965, 0x2124, 0x2124, 0x2945, 0x2103, 0x2944, 0x2945, 0x2124, 0x2965, 0x2965, 0x2945, 0x31a6, 0x39e7, 0x39e7, 0x5b0b, 0x7bef, 0x6b4d, 0x9491, 0x9491, 0x8c71, 0x6b6d, 0x4a69, 0x31a6, 0x2124, 0x18e3, 0x10a2, 0x0861, 0x0861, 
-    0x39e7, 0x632c, 0xf7dd, 0xfffd, 0xfffe, 0x8c70, 0x7bce, 0x844f, 0x73ad, 0x5b0b, 0x5aca, 0x52aa, 0x5289, 0x5289, 0x4a69, 0x4a69, 0x4a48, 0x4a48, 0x4a48, 0x4a48, 0x4a48, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a48, 0x4a48, 0x4a48, 0x4a48, 0x4a69, 0x4a69, 0x5289, 0x5289, 0x52aa, 0x5aca, 0x5acb, 0x630b, 0x6b6d, 0x73ae, 0x9491, 0xa513, 0x8430, 0xef5b, 0xfffd, 0xfffd, 0xe71a, 0x5acb, 0x39e7, 0x2124, 0x18e3, 0x18c3, 0x1082, 0x1082, 
-    0x39e7, 0xa533, 0xfffd, 0xfffd, 0xfffe, 0x8c50, 0x7bee, 0x7bee, 0x6b8d, 0x5aeb, 0x52aa, 0x4a89, 0x4a69, 0x4a49, 0x4a48, 0x4a48, 0x4248, 0x4228, 0x4228, 0x4228, 0x4228, 0x4227, 0x4227, 0x4207, 0x4207, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4207, 0x4208, 0x4208, 0x4207, 0x4208, 0x4208, 0x4207, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4207, 0x4208, 0x4207, 0x4207, 0x4208, 0x4207, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4207, 0x4208, 0x4207, 0x4227, 0x4228, 0x4228, 0x4228, 0x4228, 0x4248, 0x4a48, 0x4a48, 0x4a69, 0x4a69, 0x5289, 0x52aa, 0x5aca, 0x5aeb, 0x6b4c, 0x738d, 0x9491, 0x9cf3, 0x8c50, 0xe73a, 0xfffd, 0xfffd, 0xf7bc, 0x632c, 0x4208, 0x2965, 0x18e3, 0x10a2, 0x1082, 0x1082, 
-    0x39e7, 0xc636, 0xfffd, 0xfffd, 0xf7dd, 0x8c50, 0x7bef, 0x73ae, 0x6b6c, 0x5aca, 0x5289, 0x4a69, 0x4a69, 0x4a48, 0x4a48, 0x4228, 0x4228, 0x4228, 0x4228, 0x4227, 0x4208, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4207, 0x4208, 0x4227, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a48, 0x4a48, 0x4a48, 0x4a69, 0x5289, 0x52aa, 0x5aca, 0x630b, 0x6b6c, 0x8c70, 0x9cd2, 0x8430, 0xe71a, 0xfffd, 0xfffd, 0xf7dc, 0x6b6d, 0x4207, 0x2945, 0x18e3, 0x18c3, 0x1082, 0x0861, 
-    0x39e7, 0xd6b8, 0xffdc, 0xffdc, 0xf7dc, 0x7bef, 0x7bce, 0x6b6c, 0x632c, 0x52aa, 0x4a69, 0x4a48, 0x4a48, 0x4228, 0x4228, 0x4227, 0x4208, 0x4207, 0x4207, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x4207, 0x4207, 0x4208, 0x4227, 0x4228, 0x4228, 0x4a48, 0x4a48, 0x4a69, 0x5289, 0x52aa, 0x5aca, 0x632c, 0x840f, 0x8c71, 0x7bef, 0xded8, 0xffdc, 0xffdc, 0xffdc, 0x73ad, 0x39c7, 0x2124, 0x18e3, 0x10a2, 0x1082, 0x0861, 
-    0x31a6, 0xd6d8, 0xf79a, 0xf79a, 0xef7a, 0x6b6c, 0x7bee, 0x73cd, 0x6b4c, 0x5289, 0x4a48, 0x4228, 0x4227, 0x4208, 0x4207, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39e6, 0x39c6, 0x39c6, 0x39c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31c6, 0x39c6, 0x39c6, 0x39c6, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x39e7, 0x4207, 0x4207, 0x4228, 0x4228, 0x4a48, 0x4a49, 0x5289, 0x5aca, 0x630b, 0x7bee, 0x8c91, 0x7bce, 0xce56, 0xf7bb, 0xf7bb, 0xf7bb, 0x6b4c, 0x31a6, 0x2124, 0x18e3, 0x10a2, 0x1082, 0x0861, 
-    0x39c6, 0xd697, 0xef59, 0xe739, 0xe718, 0x632b, 0x7bce, 0x73cd, 0x634b, 0x4a69, 0x4228, 0x4208, 0x4207, 0x39e7, 0x39e7, 0x39e7, 0x39c7, 0x39e6, 0x39c6, 0x31c6, 0x31c6, 0x39c6, 0x31c6, 0x31c6, 0x31c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31c6, 0x31c6, 0x31c6, 0x39c6, 0x39c6, 0x31c6, 0x39c6, 0x39c6, 0x39e6, 0x39e7, 0x39e7, 0x4207, 0x4208, 0x4227, 0x4228, 0x4a48, 0x4a69, 0x52aa, 0x5aeb, 0x7bee, 0x8c70, 0x738d, 0xbdd5, 0xef7a, 0xef5a, 0xef59, 0x6b4c, 0x3186, 0x2104, 0x18e3, 0x10a2, 0x1082, 0x0861, 
-    0x39c6, 0xce76, 0xd6b7, 0xd6b7, 0xce76, 0x5aca, 0x73ad, 0x738c, 0x630b, 0x4248, 0x4228, 0x39e7, 0x39c7, 0x39e7, 0x39c6, 0x39c6, 0x31c6, 0x39c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a5, 0x31a5, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31a5, 0x31a5, 0x31a5, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31c6, 0x31c6, 0x39c6, 0x39e7, 0x39e7, 0x39e7, 0x4207, 0x4227, 0x4228, 0x4a69, 0x52aa, 0x738d, 0x7c0f, 0x6b4c, 0x9cd1, 0xded7, 0xd6b7, 0xd6b7, 0x6b4c, 0x3185, 0x2104, 0x18c3, 0x18c3, 0x1082, 0x0861, 
-    0x3186, 0xce55, 0xc635, 0xc655, 0xbdf4, 0x52a9, 0x6b6c, 0x6b6c, 0x5aea, 0x4207, 0x39e7, 0x39c6, 0x39c6, 0x31a6, 0x31a6, 0x31a6, 0x39c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3185, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3185, 0x3185, 0x3186, 0x3185, 0x31a6, 0x31a6, 0x3186, 0x39c6, 0x31a6, 0x31a6, 0x39c6, 0x39c6, 0x39c6, 0x39e7, 0x39e7, 0x4208, 0x4a48, 0x5289, 0x6b4c, 0x7bce, 0x632b, 0x7bee, 0xc635, 0xc635, 0xce56, 0x5aea, 0x3185, 0x2124, 0x18e3, 0x18c3, 0x10a2, 0x1082, 
-    0x39c6, 0xbdf4, 0xbdd3, 0xbdd3, 0xad93, 0x5289, 0x6b6c, 0x632b, 0x5aca, 0x4207, 0x39c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x3186, 0x3185, 0x3185, 0x3185, 0x2965, 0x2965, 0x3185, 0x3185, 0x3185, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3185, 0x3185, 0x3185, 0x3185, 0x2965, 0x3185, 0x3185, 0x3185, 0x3186, 0x3186, 0x31a6, 0x31a6, 0x39c6, 0x39c6, 0x39c6, 0x3a07, 0x4228, 0x4a69, 0x634b, 0x738d, 0x630b, 0x6b8c, 0xbdd4, 0xbdd4, 0xbdd4, 0x632b, 0x3186, 0x2945, 0x2104, 0x18c3, 0x18c3, 0x1082, 
-    0x31a6, 0xad72, 0xa552, 0xad52, 0x9d11, 0x4a48, 0x632b, 0x5aea, 0x52a9, 0x39e7, 0x31a6, 0x31a6, 0x3185, 0x2965, 0x2965, 0x3185, 0x2965, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2965, 0x3185, 0x3185, 0x2965, 0x2985, 0x3186, 0x31a6, 0x31a6, 0x39c6, 0x3a07, 0x4a48, 0x630b, 0x6b4c, 0x5aea, 0x632b, 0xad52, 0xad72, 0xad73, 0x6b8c, 0x840e, 0x842e, 0x842e, 0x6b4b, 0x18e3, 0x10a2, 
-    0x3185, 0xa511, 0x9cf0, 0x9cf0, 0x94af, 0x4207, 0x630b, 0x52a9, 0x4a69, 0x31a6, 0x3185, 0x2965, 0x2965, 0x2944, 0x2945, 0x2124, 0x2944, 0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2144, 0x2124, 0x2944, 0x2944, 0x2944, 0x2144, 0x2944, 0x2944, 0x2965, 0x2965, 0x2965, 0x3185, 0x31a6, 0x39e6, 0x4207, 0x5aca, 0x5b0b, 0x5aea, 0x630a, 0x9d11, 0xa511, 0xa531, 0x632b, 0x52a9, 0x52ca, 0x5289, 0x630a, 0x2104, 0x18c3, 
-    0x31a6, 0x94af, 0x8c8f, 0x8c8f, 0x842e, 0x39e7, 0x5aea, 0x5288, 0x4a48, 0x31a5, 0x3185, 0x2944, 0x2945, 0x2144, 0x2144, 0x2144, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2124, 0x2124, 0x2124, 0x2144, 0x2144, 0x2144, 0x2945, 0x2944, 0x2965, 0x3185, 0x2985, 0x31c6, 0x4207, 0x52c9, 0x52aa, 0x52ca, 0x5aea, 0x94b0, 0x9cd0, 0x9cf0, 0x632b, 0x4228, 0x4228, 0x4208, 0x4a48, 0x39c6, 0x18e3, 
-    0x3185, 0x844e, 0x842d, 0x842d, 0x73ac, 0x39c6, 0x52c9, 0x31a5, 0x31a6, 0x2945, 0x2944, 0x2124, 0x2104, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2124, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x39c7, 0x39e7, 0x4a49, 0x5289, 0x5289, 0x8c6f, 0x8c8f, 0x94b0, 0x738d, 0xc615, 0xd697, 0xded8, 0x8c6f, 0x4207, 0x2124, 
-    0x2944, 0x840d, 0x7bed, 0x7bec, 0x6b6b, 0x3185, 0x5289, 0x2965, 0x31a6, 0x2944, 0x2144, 0x2104, 0x2104, 0x2103, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x1903, 0x2103, 0x2104, 0x1903, 0x2124, 0x2124, 0x2104, 0x2945, 0x2965, 0x31a6, 0x31c6, 0x4a48, 0x4a68, 0x4a68, 0x842e, 0x8c4f, 0x8c8f, 0x6b8c, 0xd6b7, 0xf7ba, 0xffdb, 0xf79a, 0x4a69, 0x2945, 
-    0x2985, 0x73cc, 0x73ac, 0x73ac, 0x5b0a, 0x2985, 0x4a48, 0x2944, 0x3185, 0x2124, 0x2104, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x2104, 0x2124, 0x2124, 0x3186, 0x31a6, 0x4207, 0x4248, 0x4247, 0x7c0d, 0x842e, 0x8c4f, 0x738d, 0xc635, 0xe718, 0xef38, 0xef38, 0x630c, 0x2965, 
-    0x2944, 0x6b8c, 0x6b4b, 0x634b, 0x52a9, 0x2944, 0x4a48, 0x2124, 0x2945, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10c2, 0x10a2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10c2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10c2, 0x10c2, 0x10a2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x18c2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x2103, 0x2103, 0x2965, 0x2965, 0x39c7, 0x4228, 0x4207, 0x73ac, 0x7bcd, 0x840e, 0x6b6c, 0x9cf1, 0xbdd3, 0xc613, 0xc634, 0x738e, 0x3185, 
-    0x2103, 0x6b4b, 0x632a, 0x630a, 0x4a88, 0x2124, 0x4248, 0x2103, 0x2144, 0x18e3, 0x18c3, 0x18c2, 0x18c2, 0x18c2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10c2, 0x18c2, 0x18c3, 0x18c3, 0x18c3, 0x2103, 0x18e3, 0x2944, 0x2944, 0x31a6, 0x4207, 0x39c6, 0x6b6c, 0x738c, 0x73ac, 0x630b, 0x7bed, 0x94b0, 0xa511, 0xa531, 0x6b6c, 0x2965, 
-    0x2124, 0x632a, 0x5ae9, 0x5ae9, 0x4247, 0x2103, 0x4207, 0x18e3, 0x2124, 0x18e3, 0x18c3, 0x10a2, 0x18c2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0x18c3, 0x2144, 0x2124, 0x3185, 0x39e6, 0x31a6, 0x634b, 0x6b4b, 0x6b4b, 0x5aea, 0x630a, 0x73ac, 0x7bcd, 0x7c0d, 0x630b, 0x2124, 
-    0x10a2, 0x10a2, 0x0861, 0x0861, 0x0841, 0x1081, 0x2144, 0x0020, 0x0841, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x1082, 0x0861, 0x1082, 0x2123, 0x2965, 0x18c3, 0x18e3, 0x2124, 0x4227, 0x4a68, 0x5ac9, 0x5ac9, 0x5ac9, 0x5ae9, 0x18e3, 
-    0x1082, 0x10a2, 0x0841, 0x0840, 0x0020, 0x0861, 0x2944, 0x0020, 0x0841, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x1082, 0x0841, 0x1082, 0x1903, 0x2144, 0x10a2, 0x18c3, 0x18e3, 0x4207, 0x39c6, 0x39e6, 0x39e6, 0x39e6, 0x52a9, 0x10a2, 
-    0x1082, 0x1082, 0x0020, 0x0020, 0x0020, 0x0861, 0x2124, 0x0020, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x1082, 0x0841, 0x1082, 0x18e3, 0x2103, 0x1082, 0x10a2, 0x18c2, 0x31c6, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x4a47, 0x10a2, 
-    0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0x0841, 0x2124, 0x0000, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x1082, 0x0020, 0x0861, 0x18e3, 0x18c3, 0x0861, 0x1082, 0x1082, 0x3185, 0x18c2, 0x10a2, 0x10a2, 0x10a2, 0x39e6, 0x1082, 
-    0x0861, 0x0861, 0x0000, 0x0000, 0x0000, 0x0840, 0x2124, 0x0000, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x1082, 0x0020, 0x0861, 0x18e3, 0x10a2, 0x0841, 0x0861, 0x0861, 0x2964, 0x10a2, 0x1082, 0x1082, 0x1082, 0x31a5, 0x0861, 
-    0x0861, 0x0861, 0x0000, 0x0000, 0x0000, 0x0020, 0x2124, 0x0000, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0861, 0x0020, 0x0841, 0x18c2, 0x1081, 0x0841, 0x0841, 0x0861, 0x2124, 0x1082, 0x0861, 0x0861, 0x0861, 0x2123, 0x0841, 
-    0x0841, 0x0861, 0x0000, 0x0000, 0x0000, 0x0840, 0x2944, 0x0000, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0861, 0x0020, 0x0841, 0x18e3, 0x0861, 0x0020, 0x0841, 0x0841, 0x2103, 0x0861, 0x0841, 0x0841, 0x0841, 0x18e2, 0x0020, 
-    0x0841, 0x0861, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2964, 0x0861, 0x0861, 0x0840, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x10a2, 0x0841, 0x18c3, 0x2124, 0x0841, 0x0020, 0x0020, 0x0020, 0x18e3, 0x0841, 0x0841, 0x0840, 0x0020, 0x10a2, 0x0841, 
-    0x0841, 0x0861, 0x0000, 0x0000, 0x0000, 0x18c2, 0x2964, 0x1081, 0x0861, 0x0840, 0x0020, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x0020, 0x10c2, 0x0841, 0x1903, 0x2124, 0x0841, 0x0020, 0x0020, 0x0020, 0x10a2, 0x0020, 0x0020, 0x0020, 0x0020, 0x1082, 0x0020, 
-    0x0841, 0x0861, 0x0000, 0x0000, 0x0000, 0x18c2, 0x2985, 0x0861, 0x1081, 0x0841, 0x0020, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x10a2, 0x0841, 0x2103, 0x2944, 0x0840, 0x0000, 0x0000, 0x0020, 0x10a2, 0x0020, 0x0020, 0x0020, 0x0020, 0x18c2, 0x0020, 
-    0x0020, 0x0841, 0x0000, 0x0000, 0x0000, 0x18c2, 0x3185, 0x0861, 0x1082, 0x0840, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0020, 0x10a2, 0x0841, 0x2103, 0x2944, 0x0020, 0x0000, 0x0000, 0x0000, 0x0881, 0x0020, 0x0020, 0x0020, 0x0020, 0x18c2, 0x0020, 
-    0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2965, 0x10a1, 0x10a2, 0x0020, 0x0020, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0020, 0x10a2, 0x0861, 0x18c3, 0x2124, 0x0020, 0x0000, 0x0000, 0x0000, 0x0861, 0x0020, 0x0840, 0x0840, 0x0841, 0x18e3, 0x0020, 
-    0x0020, 0x0841, 0x0000, 0x0000, 0x0000, 0x10a2, 0x31a5, 0x0861, 0x10a2, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0020, 0x10a2, 0x0861, 0x18e2, 0x2944, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x39c6, 0x39c6, 0x39e6, 0x39e6, 0x10a2, 0x0020, 
-    0x0020, 0x0841, 0x0000, 0x0000, 0x0000, 0x1082, 0x3185, 0x0861, 0x10a2, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0020, 0x10a2, 0x0861, 0x10c2, 0x2944, 0x0000, 0x0000, 0x0000, 0x0020, 0x10c2, 0x5288, 0x5ac9, 0x52c9, 0x52a8, 0x0861, 0x0020, 
-    0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x1082, 0x31a5, 0x0861, 0x18a2, 0x0020, 0x0020, 0x0841, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x0020, 0x10a2, 0x0861, 0x1081, 0x2965, 0x0000, 0x0000, 0x0000, 0x0020, 0x18e3, 0x738b, 0x73ac, 0x73ac, 0x5ae9, 0x0841, 0x0020, 
-    0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x1082, 0x39c6, 0x0841, 0x10c2, 0x0020, 0x0020, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0020, 0x10a2, 0x0861, 0x0861, 0x2964, 0x0000, 0x0000, 0x0000, 0x0020, 0x18c2, 0x10a2, 0x18c2, 0x10a2, 0x18c2, 0x0841, 0x0020, 
-    0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x1081, 0x39c6, 0x0841, 0x10a2, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x0020, 0x10a2, 0x0861, 0x0861, 0x2944, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x2985, 0x2985, 0x3185, 0x2123, 0x0020, 0x0020, 
-    0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0861, 0x39c6, 0x0841, 0x10a2, 0x0020, 0x0020, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0020, 0x10a2, 0x1081, 0x0861, 0x2123, 0x0020, 0x0000, 0x0000, 0x0000, 0x1081, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 
-    0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0861, 0x31c5, 0x0841, 0x10a2, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x10a2, 0x0020, 0x1082, 0x10a2, 0x0861, 0x2103, 0x0020, 0x0000, 0x0000, 0x0000, 0x10a2, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 
-    0x1081, 0x0841, 0x0000, 0x0000, 0x0000, 0x0861, 0x2964, 0x0841, 0x10a2, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x10a2, 0x0020, 0x1082, 0x10c2, 0x0861, 0x18e3, 0x0840, 0x0000, 0x0000, 0x0000, 0x1082, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 
-    0x0861, 0x1081, 0x0000, 0x0000, 0x0000, 0x0861, 0x2944, 0x0841, 0x18c2, 0x0020, 0x0841, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x10a2, 0x0020, 0x0861, 0x1903, 0x1081, 0x10a2, 0x0861, 0x0000, 0x0000, 0x0000, 0x10a2, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0861, 0x10c2, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2103, 0x0861, 0x10a2, 0x0020, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x0020, 0x0841, 0x2103, 0x1082, 0x1082, 0x0861, 0x0000, 0x0000, 0x0000, 0x1082, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0861, 0x2124, 0x0020, 0x0020, 0x0020, 0x10a2, 0x18c2, 0x0861, 0x10a2, 0x0020, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10a2, 0x0020, 0x0841, 0x2944, 0x1082, 0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0x1081, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0020, 0x4207, 0x39c6, 0x39c6, 0x31a5, 0x2124, 0x2123, 0x31a5, 0x2985, 0x10a2, 0x18e3, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x18e3, 0x1903, 0x1903, 0x18e3, 0x18e3, 0x18c2, 0x18c2, 0x39e7, 0x31a5, 0x1082, 0x2124, 0x2123, 0x2124, 0x2124, 0x1082, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0841, 0x4227, 0x4a47, 0x4a47, 0x4a47, 0x2944, 0x31c6, 0x5aea, 0x31c6, 0x2104, 0x18e3, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x2103, 0x1903, 0x1903, 0x2103, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x2103, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x2103, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x2103, 0x1903, 0x2103, 0x2103, 0x2124, 0x2124, 0x39e7, 0x5b0b, 0x2103, 0x3185, 0x3185, 0x3185, 0x3185, 0x1081, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0841, 0x39e6, 0x52a8, 0x52a8, 0x52a8, 0x2964, 0x4227, 0x632c, 0x39e6, 0x2944, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2944, 0x2144, 0x4227, 0x6b4c, 0x2103, 0x39e6, 0x39c6, 0x39c6, 0x39c6, 0x1081, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0840, 0x3185, 0x632a, 0x632a, 0x632a, 0x31a5, 0x4207, 0x6b6d, 0x4207, 0x2965, 0x2144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2965, 0x4227, 0x6b6d, 0x2124, 0x4a88, 0x4a68, 0x4a68, 0x4207, 0x1081, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0840, 0x2103, 0x6b6b, 0x6b6b, 0x6b6b, 0x39c6, 0x39c6, 0x738d, 0x3a07, 0x3186, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x31a6, 0x3185, 0x4207, 0x6b6c, 0x2964, 0x6b4a, 0x632a, 0x632a, 0x4247, 0x0861, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0020, 0x1081, 0x630a, 0x6b6b, 0x6b6b, 0x4207, 0x3185, 0x73ad, 0x3a07, 0x31a6, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x31a6, 0x31c6, 0x4227, 0x634c, 0x3185, 0x7bcd, 0x7bcd, 0x7bcc, 0x4227, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0020, 0x0841, 0x2965, 0x39c6, 0x39e6, 0x2103, 0x18e3, 0x73ad, 0x4207, 0x3a07, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31c6, 0x31a6, 0x31a6, 0x31c6, 0x31a6, 0x31a6, 0x31c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x39c6, 0x31c6, 0x31c6, 0x39c6, 0x31a6, 0x31a6, 0x39c6, 0x31a6, 0x31c6, 0x39c6, 0x31c6, 0x31c6, 0x31c6, 0x31a6, 0x39c6, 0x31a6, 0x31c6, 0x39c6, 0x31a6, 0x31a6, 0x39c6, 0x31c6, 0x31a6, 0x39c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31c6, 0x31a6, 0x31a6, 0x31c6, 0x31a6, 0x31a6, 0x31c6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x31a6, 0x3a07, 0x4207, 0x4228, 0x5aca, 0x18c3, 0x5288, 0x4a68, 0x4a47, 0x2103, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0020, 0x0020, 0x0841, 0x0840, 0x0020, 0x0020, 0x0841, 0x2965, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x2945, 0x0020, 0x0841, 0x0841, 0x0841, 0x18c2, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0020, 0x0020, 0x10c2, 0x0861, 0x0881, 0x1081, 0x1081, 0x1082, 0x0841, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0861, 0x0841, 0x10a2, 0x1081, 0x1081, 0x10a2, 0x1082, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-    0x0020, 0x0020, 0x10a2, 0x2944, 0x2965, 0x2964, 0x2144, 0x1082, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x10c2, 0x18c2, 0x18c2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x1903, 0x1903, 0x2103, 0x1903, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2103, 0x1903, 0x2103, 0x1903, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18e3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c2, 0x18c2, 0x18c2, 0x10c2, 0x10c2, 0x10c2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x18c2, 0x18e3, 0x0840, 0x2944, 0x2985, 0x2965, 0x2144, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841
+    0x6108, 0x8210, 0x484a, 0xed7b, 0x0e84, 0xed7b, 0x8c73, 0x8631, 0x0842, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0x8631, 0x8531, 0x8531, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8531, 0x8531, 0x8531, 0xa531, 0xa531, 0x8631, 0xa531, 0xa531, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xc631, 0xc639, 0xa631, 0xc631, 0xc639, 0xc639, 0xe639, 0xc639, 0xc739, 0xc739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xc739, 0xc739, 0xc639, 0xc639, 0xc639, 0xc639, 0xa631, 0xa631, 0xc631, 0xc631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa531, 0x8631, 0xa631, 0xa531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0xa631, 0x8631, 0xa631, 0xa631, 0xa631, 0xa631, 0xc639, 0xc639, 0xc639, 0x2842, 0x484a, 0x4529, 0xcd7b, 0x0e84, 0x0e84, 0x8c73, 0xe318, 0xa210, 0xa210, 0x8210, 0x8210, 0x4108, 0x6108, 0x6108, 
+    0x8210, 0xa210, 0xac73, 0xed7b, 0xed7b, 0x0d7c, 0x4842, 0x694a, 0xe639, 0x8529, 0x6529, 0x6529, 0x4429, 0x4529, 0x4421, 0x4421, 0x2421, 0x2421, 0x2421, 0x0421, 0x0421, 0x0421, 0x2421, 0x2421, 0x2421, 0x0421, 0x0421, 0x0421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4529, 0x4529, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4529, 0x4529, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x2421, 0x2421, 0x2421, 0x4421, 0x4421, 0x4429, 0x4429, 0x6529, 0x8529, 0x8531, 0xa631, 0xa631, 0xe739, 0x484a, 0xc639, 0x6b6b, 0x0e84, 0x0e84, 0x0e84, 0xe639, 0xe318, 0xc318, 0x8210, 0x6108, 0x8210, 0x4108, 0x6108, 
+    0xa210, 0x0421, 0x484a, 0xc639, 0xe739, 0xe739, 0x8531, 0x684a, 0x2421, 0xc318, 0xa210, 0x8210, 0xa210, 0x8210, 0x6108, 0x4108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x8108, 0x6108, 0x6108, 0x8108, 0x6108, 0x6108, 0x8108, 0x6108, 0x6108, 0x8110, 0x6108, 0x6108, 0x8108, 0x6108, 0x6108, 0x8108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x8210, 0x8210, 0x8210, 0xc318, 0x8210, 0xa210, 0x0421, 0x2421, 0x6529, 0x694a, 0x2842, 0x2842, 0x2842, 0x2842, 0x2b63, 0x4429, 0xe318, 0xa210, 0x8210, 0x8210, 0x8210, 0x4108, 
+    0xe318, 0xa631, 0xc739, 0xa631, 0xa631, 0xc639, 0xc739, 0xca52, 0x0421, 0xc318, 0x4108, 0x4108, 0x6108, 0x6108, 0x6108, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x2000, 0x6108, 0x6108, 0x4108, 0x8210, 0x6108, 0x8210, 0x0321, 0x2421, 0x6529, 0xcb5a, 0x0842, 0x0842, 0x0842, 0xe739, 0x0b63, 0x6529, 0xe318, 0xc318, 0x8210, 0x6108, 0x8210, 0x4108, 
+    0x2421, 0x484a, 0x0842, 0x0842, 0xe739, 0x0742, 0x073a, 0xea5a, 0x4529, 0xc318, 0x6108, 0x4108, 0x6108, 0x6108, 0x6108, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x2000, 0x6108, 0x6108, 0x4108, 0x6108, 0x6108, 0x8210, 0x0421, 0x4529, 0xc739, 0x4d6b, 0x694a, 0x8a52, 0x8a52, 0x8a52, 0x0b63, 0xc739, 0x2421, 0xe318, 0xa210, 0x8210, 0x8210, 0x4108, 
+    0x6529, 0xca5a, 0x694a, 0x8a52, 0x8a52, 0x494a, 0x2842, 0x0b63, 0x8531, 0xe318, 0x8210, 0x8210, 0x6108, 0x6108, 0x6108, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x6108, 0x6108, 0x4108, 0x8210, 0x8210, 0x8210, 0xa210, 0x4429, 0x6529, 0x2842, 0xae73, 0xeb5a, 0x2c63, 0x4c6b, 0x4d6b, 0xeb5a, 0x2842, 0x8531, 0x2421, 0xc318, 0xa210, 0x6108, 0x6108, 
+    0x8531, 0xaa52, 0x6d6b, 0xef7b, 0x1084, 0xaa52, 0xaa52, 0x6c6b, 0x073a, 0xa631, 0x6529, 0x4429, 0x4529, 0x6529, 0x4429, 0x4529, 0x4429, 0x2421, 0x6429, 0x2421, 0x4421, 0x4529, 0x2421, 0x4429, 0x4529, 0x2421, 0x4529, 0x6529, 0x2421, 0x6429, 0x6429, 0x2421, 0x6529, 0x4529, 0x2421, 0x6529, 0x4429, 0x2421, 0x6529, 0x2421, 0x2421, 0x6529, 0x2421, 0x4429, 0x6529, 0x2421, 0x4529, 0x6529, 0x2421, 0x6429, 0x6429, 0x2421, 0x6529, 0x4529, 0x2421, 0x6529, 0x4429, 0x2421, 0x6529, 0x2421, 0x2421, 0x6529, 0x2421, 0x4429, 0x6529, 0x2421, 0x4529, 0x6529, 0x2421, 0x6429, 0x6429, 0x2421, 0x6529, 0x4529, 0x2421, 0x6529, 0x4429, 0x2421, 0x6529, 0x2421, 0x2421, 0x6529, 0x2421, 0x4429, 0x6529, 0x2421, 0x4529, 0x6529, 0x2421, 0x6429, 0x6429, 0x2421, 0x6529, 0x4529, 0x2421, 0x4529, 0x4429, 0x0421, 0x6529, 0x2421, 0x2421, 0x4529, 0x0321, 0x4429, 0x4529, 0x2421, 0x6529, 0x6529, 0x4529, 0xa631, 0xe739, 0xe739, 0x0b5b, 0xef7b, 0x4d6b, 0x9194, 0x9194, 0x718c, 0x6d6b, 0x694a, 0xa631, 0x2421, 0xe318, 0xa210, 0x6108, 0x6108, 
+    0xe739, 0x2c63, 0xddf7, 0xfdff, 0xfeff, 0x708c, 0xce7b, 0x4f84, 0xad73, 0x0b5b, 0xca5a, 0xaa52, 0x8952, 0x8952, 0x694a, 0x694a, 0x484a, 0x484a, 0x484a, 0x484a, 0x484a, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2842, 0x484a, 0x484a, 0x484a, 0x484a, 0x694a, 0x694a, 0x8952, 0x8952, 0xaa52, 0xca5a, 0xcb5a, 0x0b63, 0x6d6b, 0xae73, 0x9194, 0x13a5, 0x3084, 0x5bef, 0xfdff, 0xfdff, 0x1ae7, 0xcb5a, 0xe739, 0x2421, 0xe318, 0xc318, 0x8210, 0x8210, 
+    0xe739, 0x33a5, 0xfdff, 0xfdff, 0xfeff, 0x508c, 0xee7b, 0xee7b, 0x8d6b, 0xeb5a, 0xaa52, 0x894a, 0x694a, 0x494a, 0x484a, 0x484a, 0x4842, 0x2842, 0x2842, 0x2842, 0x2842, 0x2742, 0x2742, 0x0742, 0x0742, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0742, 0x0842, 0x0842, 0x0742, 0x0842, 0x0842, 0x0742, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0742, 0x0842, 0x0742, 0x0742, 0x0842, 0x0742, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0742, 0x0842, 0x0742, 0x2742, 0x2842, 0x2842, 0x2842, 0x2842, 0x4842, 0x484a, 0x484a, 0x694a, 0x694a, 0x8952, 0xaa52, 0xca5a, 0xeb5a, 0x4c6b, 0x8d73, 0x9194, 0xf39c, 0x508c, 0x3ae7, 0xfdff, 0xfdff, 0xbcf7, 0x2c63, 0x0842, 0x6529, 0xe318, 0xa210, 0x8210, 0x8210, 
+    0xe739, 0x36c6, 0xfdff, 0xfdff, 0xddf7, 0x508c, 0xef7b, 0xae73, 0x6c6b, 0xca5a, 0x8952, 0x694a, 0x694a, 0x484a, 0x484a, 0x2842, 0x2842, 0x2842, 0x2842, 0x2742, 0x0842, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0742, 0x0842, 0x2742, 0x2842, 0x2842, 0x2842, 0x2842, 0x484a, 0x484a, 0x484a, 0x694a, 0x8952, 0xaa52, 0xca5a, 0x0b63, 0x6c6b, 0x708c, 0xd29c, 0x3084, 0x1ae7, 0xfdff, 0xfdff, 0xdcf7, 0x6d6b, 0x0742, 0x4529, 0xe318, 0xc318, 0x8210, 0x6108, 
+    0xe739, 0xb8d6, 0xdcff, 0xdcff, 0xdcf7, 0xef7b, 0xce7b, 0x6c6b, 0x2c63, 0xaa52, 0x694a, 0x484a, 0x484a, 0x2842, 0x2842, 0x2742, 0x0842, 0x0742, 0x0742, 0xe739, 0xe739, 0xe739, 0xe739, 0xe739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xc739, 0xe739, 0xe739, 0xe739, 0xe739, 0x0742, 0x0742, 0x0842, 0x2742, 0x2842, 0x2842, 0x484a, 0x484a, 0x694a, 0x8952, 0xaa52, 0xca5a, 0x2c63, 0x0f84, 0x718c, 0xef7b, 0xd8de, 0xdcff, 0xdcff, 0xdcff, 0xad73, 0xc739, 0x2421, 0xe318, 0xa210, 0x8210, 0x6108, 
+    0xa631, 0xd8d6, 0x9af7, 0x9af7, 0x7aef, 0x6c6b, 0xee7b, 0xcd73, 0x4c6b, 0x8952, 0x484a, 0x2842, 0x2742, 0x0842, 0x0742, 0xe739, 0xe739, 0xe739, 0xe739, 0xc739, 0xe639, 0xc639, 0xc639, 0xc639, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xc631, 0xc639, 0xc639, 0xc639, 0xc739, 0xc739, 0xe739, 0xe739, 0xe739, 0x0742, 0x0742, 0x2842, 0x2842, 0x484a, 0x494a, 0x8952, 0xca5a, 0x0b63, 0xee7b, 0x918c, 0xce7b, 0x56ce, 0xbbf7, 0xbbf7, 0xbbf7, 0x4c6b, 0xa631, 0x2421, 0xe318, 0xa210, 0x8210, 0x6108, 
+    0xc639, 0x97d6, 0x59ef, 0x39e7, 0x18e7, 0x2b63, 0xce7b, 0xcd73, 0x4b63, 0x694a, 0x2842, 0x0842, 0x0742, 0xe739, 0xe739, 0xe739, 0xc739, 0xe639, 0xc639, 0xc631, 0xc631, 0xc639, 0xc631, 0xc631, 0xc631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xc631, 0xc631, 0xc631, 0xc639, 0xc639, 0xc631, 0xc639, 0xc639, 0xe639, 0xe739, 0xe739, 0x0742, 0x0842, 0x2742, 0x2842, 0x484a, 0x694a, 0xaa52, 0xeb5a, 0xee7b, 0x708c, 0x8d73, 0xd5bd, 0x7aef, 0x5aef, 0x59ef, 0x4c6b, 0x8631, 0x0421, 0xe318, 0xa210, 0x8210, 0x6108, 
+    0xc639, 0x76ce, 0xb7d6, 0xb7d6, 0x76ce, 0xca5a, 0xad73, 0x8c73, 0x0b63, 0x4842, 0x2842, 0xe739, 0xc739, 0xe739, 0xc639, 0xc639, 0xc631, 0xc639, 0xa631, 0xa631, 0xa631, 0xa631, 0xa531, 0xa531, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0xa531, 0xa531, 0xa531, 0xa631, 0xa631, 0xa631, 0xa631, 0xc631, 0xc631, 0xc639, 0xe739, 0xe739, 0xe739, 0x0742, 0x2742, 0x2842, 0x694a, 0xaa52, 0x8d73, 0x0f7c, 0x4c6b, 0xd19c, 0xd7de, 0xb7d6, 0xb7d6, 0x4c6b, 0x8531, 0x0421, 0xc318, 0xc318, 0x8210, 0x6108, 
+    0x8631, 0x55ce, 0x35c6, 0x55c6, 0xf4bd, 0xa952, 0x6c6b, 0x6c6b, 0xea5a, 0x0742, 0xe739, 0xc639, 0xc639, 0xa631, 0xa631, 0xa631, 0xc639, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0x8631, 0x8531, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x8531, 0x8531, 0x8631, 0x8531, 0xa631, 0xa631, 0x8631, 0xc639, 0xa631, 0xa631, 0xc639, 0xc639, 0xc639, 0xe739, 0xe739, 0x0842, 0x484a, 0x8952, 0x4c6b, 0xce7b, 0x2b63, 0xee7b, 0x35c6, 0x35c6, 0x56ce, 0xea5a, 0x8531, 0x2421, 0xe318, 0xc318, 0xa210, 0x8210, 
+    0xc639, 0xf4bd, 0xd3bd, 0xd3bd, 0x93ad, 0x8952, 0x6c6b, 0x2b63, 0xca5a, 0x0742, 0xc639, 0xa631, 0xa631, 0xa631, 0xa631, 0x8631, 0x8531, 0x8531, 0x8531, 0x6529, 0x6529, 0x8531, 0x8531, 0x8531, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x8531, 0x8531, 0x8531, 0x8531, 0x6529, 0x8531, 0x8531, 0x8531, 0x8631, 0x8631, 0xa631, 0xa631, 0xc639, 0xc639, 0xc639, 0x073a, 0x2842, 0x694a, 0x4b63, 0x8d73, 0x0b63, 0x8c6b, 0xd4bd, 0xd4bd, 0xd4bd, 0x2b63, 0x8631, 0x4529, 0x0421, 0xc318, 0xc318, 0x8210, 
+    0xa631, 0x72ad, 0x52a5, 0x52ad, 0x119d, 0x484a, 0x2b63, 0xea5a, 0xa952, 0xe739, 0xa631, 0xa631, 0x8531, 0x6529, 0x6529, 0x8531, 0x6529, 0x6529, 0x4429, 0x4429, 0x4429, 0x4429, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4529, 0x4429, 0x4429, 0x4429, 0x4429, 0x6529, 0x6529, 0x8531, 0x8531, 0x6529, 0x8529, 0x8631, 0xa631, 0xa631, 0xc639, 0x073a, 0x484a, 0x0b63, 0x4c6b, 0xea5a, 0x2b63, 0x52ad, 0x72ad, 0x73ad, 0x8c6b, 0x0e84, 0x2e84, 0x2e84, 0x4b6b, 0xe318, 0xa210, 
+    0x8531, 0x11a5, 0xf09c, 0xf09c, 0xaf94, 0x0742, 0x0b63, 0xa952, 0x694a, 0xa631, 0x8531, 0x6529, 0x6529, 0x4429, 0x4529, 0x2421, 0x4429, 0x4529, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x0421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x4421, 0x2421, 0x4429, 0x4429, 0x4429, 0x4421, 0x4429, 0x4429, 0x6529, 0x6529, 0x6529, 0x8531, 0xa631, 0xe639, 0x0742, 0xca5a, 0x0b5b, 0xea5a, 0x0a63, 0x119d, 0x11a5, 0x31a5, 0x2b63, 0xa952, 0xca52, 0x8952, 0x0a63, 0x0421, 0xc318, 
+    0xa631, 0xaf94, 0x8f8c, 0x8f8c, 0x2e84, 0xe739, 0xea5a, 0x8852, 0x484a, 0xa531, 0x8531, 0x4429, 0x4529, 0x4421, 0x4421, 0x4421, 0x2421, 0x2421, 0x2421, 0x0421, 0x0421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x0421, 0x2421, 0x2421, 0x2421, 0x4421, 0x4421, 0x4421, 0x4529, 0x4429, 0x6529, 0x8531, 0x8529, 0xc631, 0x0742, 0xc952, 0xaa52, 0xca52, 0xea5a, 0xb094, 0xd09c, 0xf09c, 0x2b63, 0x2842, 0x2842, 0x0842, 0x484a, 0xc639, 0xe318, 
+    0x8531, 0x4e84, 0x2d84, 0x2d84, 0xac73, 0xc639, 0xc952, 0xa531, 0xa631, 0x4529, 0x4429, 0x2421, 0x0421, 0x2421, 0x2421, 0x2421, 0x0421, 0x0421, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0321, 0x0421, 0x2421, 0x2421, 0x2421, 0x0421, 0x2421, 0x2421, 0x4529, 0x6529, 0x6529, 0xc739, 0xe739, 0x494a, 0x8952, 0x8952, 0x6f8c, 0x8f8c, 0xb094, 0x8d73, 0x15c6, 0x97d6, 0xd8de, 0x6f8c, 0x0742, 0x2421, 
+    0x4429, 0x0d84, 0xed7b, 0xec7b, 0x6b6b, 0x8531, 0x8952, 0x6529, 0xa631, 0x4429, 0x4421, 0x0421, 0x0421, 0x0321, 0xe318, 0x0319, 0x0319, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x0319, 0x0321, 0x0421, 0x0319, 0x2421, 0x2421, 0x0421, 0x4529, 0x6529, 0xa631, 0xc631, 0x484a, 0x684a, 0x684a, 0x2e84, 0x4f8c, 0x8f8c, 0x8c6b, 0xb7d6, 0xbaf7, 0xdbff, 0x9af7, 0x694a, 0x4529, 
+    0x8529, 0xcc73, 0xac73, 0xac73, 0x0a5b, 0x8529, 0x484a, 0x4429, 0x8531, 0x2421, 0x0421, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x0421, 0x2421, 0x2421, 0x8631, 0xa631, 0x0742, 0x4842, 0x4742, 0x0d7c, 0x2e84, 0x4f8c, 0x8d73, 0x35c6, 0x18e7, 0x38ef, 0x38ef, 0x0c63, 0x6529, 
+    0x4429, 0x8c6b, 0x4b6b, 0x4b63, 0xa952, 0x4429, 0x484a, 0x2421, 0x4529, 0xe318, 0xe318, 0xe318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc218, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xc210, 0xa210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xc210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xc210, 0xc210, 0xa210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc218, 0xc318, 0xc318, 0xc318, 0xc318, 0xe318, 0xe318, 0x0321, 0x0321, 0x6529, 0x6529, 0xc739, 0x2842, 0x0742, 0xac73, 0xcd7b, 0x0e84, 0x6c6b, 0xf19c, 0xd3bd, 0x13c6, 0x34c6, 0x8e73, 0x8531, 
+    0x0321, 0x4b6b, 0x2a63, 0x0a63, 0x884a, 0x2421, 0x4842, 0x0321, 0x4421, 0xe318, 0xc318, 0xc218, 0xc218, 0xc218, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xc210, 0xc218, 0xc318, 0xc318, 0xc318, 0x0321, 0xe318, 0x4429, 0x4429, 0xa631, 0x0742, 0xc639, 0x6c6b, 0x8c73, 0xac73, 0x0b63, 0xed7b, 0xb094, 0x11a5, 0x31a5, 0x6c6b, 0x6529, 
+    0x2421, 0x2a63, 0xe95a, 0xe95a, 0x4742, 0x0321, 0x0742, 0xe318, 0x2421, 0xe318, 0xc318, 0xa210, 0xc218, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa210, 0xa210, 0xa210, 0xa210, 0xc318, 0xc318, 0x4421, 0x2421, 0x8531, 0xe639, 0xa631, 0x4b63, 0x4b6b, 0x4b6b, 0xea5a, 0x0a63, 0xac73, 0xcd7b, 0x0d7c, 0x0b63, 0x2421, 
+    0xa210, 0xa210, 0x6108, 0x6108, 0x4108, 0x8110, 0x4421, 0x2000, 0x4108, 0x4108, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x8210, 0x6108, 0x8210, 0x2321, 0x6529, 0xc318, 0xe318, 0x2421, 0x2742, 0x684a, 0xc95a, 0xc95a, 0xc95a, 0xe95a, 0xe318, 
+    0x8210, 0xa210, 0x4108, 0x4008, 0x2000, 0x6108, 0x4429, 0x2000, 0x4108, 0x4108, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x8210, 0x4108, 0x8210, 0x0319, 0x4421, 0xa210, 0xc318, 0xe318, 0x0742, 0xc639, 0xe639, 0xe639, 0xe639, 0xa952, 0xa210, 
+    0x8210, 0x8210, 0x2000, 0x2000, 0x2000, 0x6108, 0x2421, 0x2000, 0x4108, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x8210, 0x4108, 0x8210, 0xe318, 0x0321, 0x8210, 0xa210, 0xc218, 0xc631, 0xe318, 0xe318, 0xe318, 0xe318, 0x474a, 0xa210, 
+    0x6108, 0x6108, 0x2000, 0x0000, 0x0000, 0x4108, 0x2421, 0x0000, 0x4108, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x8210, 0x2000, 0x6108, 0xe318, 0xc318, 0x6108, 0x8210, 0x8210, 0x8531, 0xc218, 0xa210, 0xa210, 0xa210, 0xe639, 0x8210, 
+    0x6108, 0x6108, 0x0000, 0x0000, 0x0000, 0x4008, 0x2421, 0x0000, 0x4108, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x8210, 0x2000, 0x6108, 0xe318, 0xa210, 0x4108, 0x6108, 0x6108, 0x6429, 0xa210, 0x8210, 0x8210, 0x8210, 0xa531, 0x6108, 
+    0x6108, 0x6108, 0x0000, 0x0000, 0x0000, 0x2000, 0x2421, 0x0000, 0x4108, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x6108, 0x2000, 0x4108, 0xc218, 0x8110, 0x4108, 0x4108, 0x6108, 0x2421, 0x8210, 0x6108, 0x6108, 0x6108, 0x2321, 0x4108, 
+    0x4108, 0x6108, 0x0000, 0x0000, 0x0000, 0x4008, 0x4429, 0x0000, 0x4108, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x6108, 0x2000, 0x4108, 0xe318, 0x6108, 0x2000, 0x4108, 0x4108, 0x0321, 0x6108, 0x4108, 0x4108, 0x4108, 0xe218, 0x2000, 
+    0x4108, 0x6108, 0x0000, 0x0000, 0x0000, 0xa210, 0x6429, 0x6108, 0x6108, 0x4008, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0xa210, 0x4108, 0xc318, 0x2421, 0x4108, 0x2000, 0x2000, 0x2000, 0xe318, 0x4108, 0x4108, 0x4008, 0x2000, 0xa210, 0x4108, 
+    0x4108, 0x6108, 0x0000, 0x0000, 0x0000, 0xc218, 0x6429, 0x8110, 0x6108, 0x4008, 0x2000, 0x2000, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x8110, 0x2000, 0xc210, 0x4108, 0x0319, 0x2421, 0x4108, 0x2000, 0x2000, 0x2000, 0xa210, 0x2000, 0x2000, 0x2000, 0x2000, 0x8210, 0x2000, 
+    0x4108, 0x6108, 0x0000, 0x0000, 0x0000, 0xc218, 0x8529, 0x6108, 0x8110, 0x4108, 0x2000, 0x2000, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x2000, 0xa210, 0x4108, 0x0321, 0x4429, 0x4008, 0x0000, 0x0000, 0x2000, 0xa210, 0x2000, 0x2000, 0x2000, 0x2000, 0xc218, 0x2000, 
+    0x2000, 0x4108, 0x0000, 0x0000, 0x0000, 0xc218, 0x8531, 0x6108, 0x8210, 0x4008, 0x2000, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x4108, 0x6108, 0x2000, 0xa210, 0x4108, 0x0321, 0x4429, 0x2000, 0x0000, 0x0000, 0x0000, 0x8108, 0x2000, 0x2000, 0x2000, 0x2000, 0xc218, 0x2000, 
+    0x4108, 0x4108, 0x0000, 0x0000, 0x0000, 0xa210, 0x6529, 0xa110, 0xa210, 0x2000, 0x2000, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x2000, 0xa210, 0x6108, 0xc318, 0x2421, 0x2000, 0x0000, 0x0000, 0x0000, 0x6108, 0x2000, 0x4008, 0x4008, 0x4108, 0xe318, 0x2000, 
+    0x2000, 0x4108, 0x0000, 0x0000, 0x0000, 0xa210, 0xa531, 0x6108, 0xa210, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x2000, 0xa210, 0x6108, 0xe218, 0x4429, 0x0000, 0x0000, 0x0000, 0x0000, 0xa210, 0xc639, 0xc639, 0xe639, 0xe639, 0xa210, 0x2000, 
+    0x2000, 0x4108, 0x0000, 0x0000, 0x0000, 0x8210, 0x8531, 0x6108, 0xa210, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x2000, 0xa210, 0x6108, 0xc210, 0x4429, 0x0000, 0x0000, 0x0000, 0x2000, 0xc210, 0x8852, 0xc95a, 0xc952, 0xa852, 0x6108, 0x2000, 
+    0x4108, 0x2000, 0x0000, 0x0000, 0x0000, 0x8210, 0xa531, 0x6108, 0xa218, 0x2000, 0x2000, 0x4108, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8210, 0x2000, 0xa210, 0x6108, 0x8110, 0x6529, 0x0000, 0x0000, 0x0000, 0x2000, 0xe318, 0x8b73, 0xac73, 0xac73, 0xe95a, 0x4108, 0x2000, 
+    0x4108, 0x2000, 0x0000, 0x0000, 0x0000, 0x8210, 0xc639, 0x4108, 0xc210, 0x2000, 0x2000, 0x4108, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x2000, 0xa210, 0x6108, 0x6108, 0x6429, 0x0000, 0x0000, 0x0000, 0x2000, 0xc218, 0xa210, 0xc218, 0xa210, 0xc218, 0x4108, 0x2000, 
+    0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x8110, 0xc639, 0x4108, 0xa210, 0x2000, 0x2000, 0x4108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x8210, 0x2000, 0xa210, 0x6108, 0x6108, 0x4429, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x8529, 0x8529, 0x8531, 0x2321, 0x2000, 0x2000, 
+    0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x6108, 0xc639, 0x4108, 0xa210, 0x2000, 0x2000, 0x6108, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x2000, 0xa210, 0x8110, 0x6108, 0x2321, 0x2000, 0x0000, 0x0000, 0x0000, 0x8110, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x4108, 
+    0x6108, 0x2000, 0x0000, 0x0000, 0x0000, 0x6108, 0xc531, 0x4108, 0xa210, 0x2000, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0xa210, 0x2000, 0x8210, 0xa210, 0x6108, 0x0321, 0x2000, 0x0000, 0x0000, 0x0000, 0xa210, 0x2000, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 
+    0x8110, 0x4108, 0x0000, 0x0000, 0x0000, 0x6108, 0x6429, 0x4108, 0xa210, 0x2000, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0xa210, 0x2000, 0x8210, 0xc210, 0x6108, 0xe318, 0x4008, 0x0000, 0x0000, 0x0000, 0x8210, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 
+    0x6108, 0x8110, 0x0000, 0x0000, 0x0000, 0x6108, 0x4429, 0x4108, 0xc218, 0x2000, 0x4108, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0x8110, 0xa210, 0x2000, 0x6108, 0x0319, 0x8110, 0xa210, 0x6108, 0x0000, 0x0000, 0x0000, 0xa210, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x6108, 0xc210, 0x0000, 0x0000, 0x0000, 0xa210, 0x0321, 0x6108, 0xa210, 0x2000, 0x4108, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa210, 0x2000, 0x4108, 0x0321, 0x8210, 0x8210, 0x6108, 0x0000, 0x0000, 0x0000, 0x8210, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x6108, 0x2421, 0x2000, 0x2000, 0x2000, 0xa210, 0xc218, 0x6108, 0xa210, 0x2000, 0x4108, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0xa210, 0x2000, 0x4108, 0x4429, 0x8210, 0x6108, 0x6108, 0x2000, 0x0000, 0x0000, 0x8110, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x2000, 0x0742, 0xc639, 0xc639, 0xa531, 0x2421, 0x2321, 0xa531, 0x8529, 0xa210, 0xe318, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0xe318, 0x0319, 0x0319, 0xe318, 0xe318, 0xc218, 0xc218, 0xe739, 0xa531, 0x8210, 0x2421, 0x2321, 0x2421, 0x2421, 0x8210, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x4108, 0x2742, 0x474a, 0x474a, 0x474a, 0x4429, 0xc631, 0xea5a, 0xc631, 0x0421, 0xe318, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0321, 0x0319, 0x0319, 0x0321, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0321, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0321, 0x0319, 0x0319, 0x0319, 0x0319, 0x0319, 0x0321, 0x0319, 0x0321, 0x0321, 0x2421, 0x2421, 0xe739, 0x0b5b, 0x0321, 0x8531, 0x8531, 0x8531, 0x8531, 0x8110, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x4108, 0xe639, 0xa852, 0xa852, 0xa852, 0x6429, 0x2742, 0x2c63, 0xe639, 0x4429, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4429, 0x4421, 0x2742, 0x4c6b, 0x0321, 0xe639, 0xc639, 0xc639, 0xc639, 0x8110, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x4008, 0x8531, 0x2a63, 0x2a63, 0x2a63, 0xa531, 0x0742, 0x6d6b, 0x0742, 0x6529, 0x4421, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x4429, 0x6529, 0x6529, 0x2742, 0x6d6b, 0x2421, 0x884a, 0x684a, 0x684a, 0x0742, 0x8110, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x4008, 0x0321, 0x6b6b, 0x6b6b, 0x6b6b, 0xc639, 0xc639, 0x8d73, 0x073a, 0x8631, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0x8531, 0xa631, 0x8531, 0x0742, 0x6c6b, 0x6429, 0x4a6b, 0x2a63, 0x2a63, 0x4742, 0x6108, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x2000, 0x8110, 0x0a63, 0x6b6b, 0x6b6b, 0x0742, 0x8531, 0xad73, 0x073a, 0xa631, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0x6529, 0xa631, 0xc631, 0x2742, 0x4c63, 0x8531, 0xcd7b, 0xcd7b, 0xcc7b, 0x2742, 0x4108, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x2000, 0x4108, 0x6529, 0xc639, 0xe639, 0x0321, 0xe318, 0xad73, 0x0742, 0x073a, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xc631, 0xa631, 0xa631, 0xc631, 0xa631, 0xa631, 0xc631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xc639, 0xc631, 0xc631, 0xc639, 0xa631, 0xa631, 0xc639, 0xa631, 0xc631, 0xc639, 0xc631, 0xc631, 0xc631, 0xa631, 0xc639, 0xa631, 0xc631, 0xc639, 0xa631, 0xa631, 0xc639, 0xc631, 0xa631, 0xc639, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xc631, 0xa631, 0xa631, 0xc631, 0xa631, 0xa631, 0xc631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0xa631, 0x073a, 0x0742, 0x2842, 0xca5a, 0xc318, 0x8852, 0x684a, 0x474a, 0x0321, 0x4108, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x2000, 0x2000, 0x4108, 0x4008, 0x2000, 0x2000, 0x4108, 0x6529, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x4108, 0x4108, 0x4529, 0x2000, 0x4108, 0x4108, 0x4108, 0xc218, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x2000, 0x2000, 0xc210, 0x6108, 0x8108, 0x8110, 0x8110, 0x8210, 0x4108, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x6108, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x2000, 0x2000, 0x6108, 0x4108, 0xa210, 0x8110, 0x8110, 0xa210, 0x8210, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 
+    0x2000, 0x2000, 0xa210, 0x4429, 0x6529, 0x6429, 0x4421, 0x8210, 0xc318, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xc218, 0xc210, 0xc210, 0xc210, 0xc210, 0xc210, 0xc218, 0xc218, 0xc318, 0xc318, 0xc318, 0xc318, 0xc318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0x0319, 0x0319, 0x0321, 0x0319, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x2421, 0x2421, 0x2421, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0321, 0x0319, 0x0321, 0x0319, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xe318, 0xc318, 0xc318, 0xc318, 0xc318, 0xc218, 0xc218, 0xc218, 0xc210, 0xc210, 0xc210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xa210, 0xc218, 0xe318, 0x4008, 0x4429, 0x8529, 0x6529, 0x4421, 0x2000, 0x2000, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108, 0x4108
 };
 const tImage_RGB battery_big = { image_data_battery_big, 126, 58,
-    16 };
+    16, IMAGE_RGB_BIG_ENDIAN };
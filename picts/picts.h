@@ -7,17 +7,36 @@ typedef struct {
     uint16_t width;
     uint16_t height;
     uint8_t dataSize;
+    uint8_t flags;
 } tImage;
 
 
 
+/** tImage_RGB flags */
+#define IMAGE_RGB_BIG_ENDIAN  0x01  /** pixels are stored in panel (wire) byte order */
+/** tImage and tImage_RGB flags */
+#define IMAGE_RLE             0x02  /** data is RLE packets, see LCD_ST7735S_Draw_RGB_Bitmap */
+
 typedef struct {
     const uint16_t *data;
     uint16_t width;
     uint16_t height;
     uint8_t dataSize;
+    uint8_t flags;
 } tImage_RGB;
 
+/** Opaque runs of color keyed tImage_RGB, see LCD_ST7735S_Build_RGB_Runs */
+typedef struct {
+    uint16_t start;
+    uint16_t length;
+} tImage_RGB_Run;
+
+typedef struct {
+    const tImage_RGB *image;
+    const uint16_t *rows;       /** height + 1 entries, runs of row j are runs[rows[j]] .. runs[rows[j + 1] - 1] */
+    const tImage_RGB_Run *runs;
+} tImage_RGB_Runs;
+
 extern const tImage_RGB Image;
 extern const tImage_RGB battery_big;
 extern const tImage_RGB Image_Battery;
@@ -11,6 +11,7 @@
 * conversion type: Color, not_used not_used
 * split to rows: yes
 * bits per pixel: 16
+* byte order: big-endian (panel wire order)
 *
 * preprocess:
 *  main scan direction: top_to_bottom
@@ -24,7 +25,8 @@
      uint16_t width;
      uint16_t height;
      uint8_t dataSize;
-     } tImage;
+     uint8_t flags;
+     } tImage_RGB;
 */
 #include <stdint.h>
 #include "picts.h"
@@ -112,78 +114,78 @@ static const uint16_t image_data_usb_ico[12800] = {
         // ████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████
         0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
         0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c51, 0x0000, 0xbdf7, 0xef5d, 0xef5d, 0xef5d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xef7d, 0xce59, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xad75, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xd6ba, 0xffff, 0xffdf, 0xdefb, 0xc618, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc618, 0xd6ba, 0xf7be, 0xffff, 0xe71c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xd6ba, 0xffff, 0xc638, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbdd7, 0xffff, 0xe73c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdefb, 0xf7be, 0x0000, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xf7be, 0x0000, 0xef5d, 0xef5d, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdefb, 0xef7d, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xb596, 0xe71c, 0xef5d, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0x0000, 0xe73c, 0xf7be, 0xbdf7, 0xf79e, 0xe71c, 0xef5d, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x0000, 0xe73c, 0xef5d, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb5b6, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x07e0, 0xffff, 0xb596, 0xe73c, 0xef5d, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xef7d, 0x0000, 0x738e, 0x94b2, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cd3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0xa534, 0xad75, 0xad55, 0xad55, 0x0000, 0x0000, 0x0000, 0xce79, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0x0000, 0xef5d, 0xef5d, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xef7d, 0x0000, 0xbdf7, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xdefb, 0x0000, 0x0000, 0xd6ba, 0xef7d, 0xef5d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xffff, 0xef5d, 0xe73c, 0xe73c, 0xdedb, 0xb596, 0xf79e, 0xef5d, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x0000, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef5d, 0x0000, 0x0000, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xd69a, 0xffff, 0xe73c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x9492, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf7bf, 0xdefb, 0x0000, 0xad55, 0xd69a, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0x0000, 0xbdd7, 0xffff, 0xe73c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xce79, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xf7df, 0xffdf, 0xf79e, 0x0000, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0x0000, 0xffff, 0xef5d, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdedb, 0xffff, 0xffdf, 0xffff, 0xffff, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xffbe, 0xffdf, 0xf7df, 0xffbf, 0xf7be, 0x0000, 0xad75, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xffdf, 0xffdf, 0xad75, 0xe71c, 0xef5d, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdedb, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x326f, 0x42d1, 0x4291, 0x4b33, 0x53b4, 0x53b4, 0x53d4, 0x53d5, 0x5bf5, 0x5bf5, 0x5c16, 0x5c36, 0x6436, 0x6456, 0x6456, 0x6476, 0x6c77, 0x6c97, 0x6c97, 0x6cb7, 0x6cb7, 0x6cd7, 0x74d7, 0x6cd7, 0x6cd7, 0x6cb7, 0x6cb7, 0x6c97, 0x6c77, 0x6476, 0x6476, 0x6456, 0x6436, 0x6436, 0x5c15, 0x5c15, 0x5bf5, 0x5bf5, 0x53d5, 0x53d5, 0x53b4, 0x5394, 0x5394, 0x4b74, 0x42f2, 0x42b1, 0x2230, 0x0000, 0xf7bf, 0xffdf, 0xffbf, 0xffbe, 0xf7be, 0x0000, 0xad75, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf79e, 0xef7d, 0xef7d, 0x0000, 0xe71c, 0xef5d, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdefb, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x00d2, 0x00f4, 0x01f4, 0x2359, 0x2bba, 0x33ba, 0x33fa, 0x3c1a, 0x3c3a, 0x445b, 0x447b, 0x4c9c, 0x4cbc, 0x54dc, 0x54fc, 0x551d, 0x5d3d, 0x5d5e, 0x657e, 0x657e, 0x659e, 0x6d9e, 0x6dbe, 0x6dbe, 0x6d9e, 0x659e, 0x657e, 0x655e, 0x5d3d, 0x5d1d, 0x551d, 0x54fc, 0x4cbc, 0x4cbc, 0x449b, 0x447b, 0x3c3a, 0x3c1a, 0x33fa, 0x33d9, 0x2bb9, 0x2b99, 0x2378, 0x2378, 0x12b6, 0x0173, 0x0012, 0x0000, 0xf7bf, 0xf7bf, 0xf7be, 0xf7be, 0xf7be, 0x0000, 0xad55, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe73c, 0xb596, 0xe71c, 0xe73c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xa514, 0x73ae, 0x6b6d, 0x9492, 0xce59, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdefb, 0xffff, 0xffdf, 0xffff, 0xffde, 0x0000, 0x0112, 0x09b4, 0x2b18, 0x3399, 0x3399, 0x33b9, 0x3bda, 0x3bfa, 0x3c1a, 0x443a, 0x445b, 0x4c7b, 0x4c9c, 0x4cbc, 0x54bc, 0x54fc, 0x5cfc, 0x5d1c, 0x5d3d, 0x653d, 0x655d, 0x655d, 0x655d, 0x655d, 0x655d, 0x655d, 0x5d3d, 0x5d1d, 0x5d1c, 0x54fc, 0x54dc, 0x54bc, 0x4c9c, 0x4c7b, 0x447b, 0x445a, 0x443a, 0x3c1a, 0x3bfa, 0x33d9, 0x33b9, 0x3399, 0x2b79, 0x2b58, 0x2b38, 0x2297, 0x0012, 0x0000, 0xf7bf, 0xf7be, 0xf79e, 0xf7be, 0xf7be, 0x0000, 0xa534, 0xef7d, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0x0000, 0xe71c, 0xe73c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd6ba, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0xb5b6, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdefb, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x00f1, 0x1276, 0x2b58, 0x2b78, 0x2b99, 0x33b9, 0x33d9, 0x33fa, 0x3c1a, 0x3c3b, 0x445b, 0x445b, 0x4c7b, 0x4c9b, 0x4cbc, 0x54dc, 0x54fc, 0x54fd, 0x5d1d, 0x5d3d, 0x5d3d, 0x5d3d, 0x5d3d, 0x5d3d, 0x5d3d, 0x5d3d, 0x5d1d, 0x551d, 0x54fd, 0x54dc, 0x54dc, 0x4cbc, 0x4c9c, 0x447b, 0x445b, 0x3c3a, 0x3c1a, 0x3bfa, 0x33da, 0x33b9, 0x2b99, 0x2b79, 0x2359, 0x2338, 0x2337, 0x2318, 0x00d4, 0x0000, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xf79e, 0x0000, 0xa514, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xdefb, 0xe71c, 0x0000, 0xb5b6, 0xef7d, 0xe73c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x73ae, 0x0000, 0x1082, 0x1082, 0x1082, 0x18e3, 0x0000, 0x2124, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdefb, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x0152, 0x1af8, 0x2b58, 0x2358, 0x2b79, 0x2b99, 0x33b9, 0x33da, 0x3bfa, 0x3c1a, 0x443a, 0x445b, 0x447b, 0x4c7b, 0x4c9b, 0x4cbc, 0x54dc, 0x54dc, 0x54fc, 0x54fc, 0x5d1d, 0x5d1c, 0x5d1c, 0x5d1c, 0x5d1c, 0x5d1d, 0x54fc, 0x54fc, 0x54dc, 0x54bc, 0x4cbc, 0x4c9b, 0x4c7b, 0x445b, 0x443b, 0x3c3a, 0x3c1a, 0x3bfa, 0x33d9, 0x33b9, 0x2b99, 0x2b79, 0x2358, 0x2338, 0x2317, 0x2318, 0x0195, 0x0000, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xef7d, 0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xce79, 0xffff, 0xe71c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xdedb, 0xa534, 0x7bcf, 0x6b4d, 0x6b4d, 0x5aeb, 0x0000, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 0x2104, 0x0000, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdefb, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x01d4, 0x1b18, 0x2338, 0x2358, 0x2b79, 0x2b99, 0x33b9, 0x33b9, 0x33da, 0x3bfa, 0x3c1a, 0x3c3b, 0x445b, 0x447b, 0x4c7b, 0x4c9c, 0x4cbc, 0x4cbc, 0x54dc, 0x54dc, 0x54fc, 0x54fc, 0x54fc, 0x54fc, 0x54fc, 0x54fc, 0x54dc, 0x54dc, 0x4cbc, 0x4c9c, 0x4c9b, 0x447b, 0x445b, 0x445b, 0x3c3a, 0x3c1a, 0x3bfa, 0x33da, 0x33b9, 0x2b99, 0x2b79, 0x2b59, 0x2338, 0x2338, 0x1b17, 0x22f7, 0x01f6, 0x0000, 0xf7be, 0xf7be, 0xf77e, 0xef7d, 0xef7d, 0x0000, 0x9cd3, 0xdedb, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0x0000, 0xb5b6, 0xf7be, 0xe71c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xa534, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x0000, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdefb, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x01f4, 0x1b17, 0x2337, 0x2338, 0x2b58, 0x2b79, 0x2b99, 0x33b9, 0x33da, 0x3bfa, 0x3bfa, 0x3c1a, 0x443a, 0x445b, 0x447b, 0x4c7b, 0x4c9b, 0x4c9c, 0x4cbc, 0x54bc, 0x54dc, 0x54dc, 0x54dc, 0x54dc, 0x54dc, 0x54bc, 0x4cbc, 0x4cbc, 0x4c9b, 0x4c9b, 0x447b, 0x445b, 0x445b, 0x3c3b, 0x3c1a, 0x3bfa, 0x33da, 0x33b9, 0x3399, 0x2b99, 0x2b79, 0x2359, 0x2338, 0x2318, 0x1af7, 0x22f7, 0x01f5, 0x0000, 0xef9e, 0xe75d, 0xe71c, 0xdf1c, 0xe73c, 0x0000, 0xbdd7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0x0000, 0xdefb, 0xe73c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xef5d, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x0000, 0x8c71, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe71c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x01f4, 0x1af7, 0x2317, 0x2338, 0x2358, 0x2b78, 0x2b99, 0x2b99, 0x33b9, 0x33da, 0x3bfa, 0x3bfa, 0x3c1a, 0x443b, 0x445b, 0x445b, 0x447b, 0x4c7b, 0x4c9b, 0x4c9b, 0x4c9c, 0x4cbc, 0x4cbc, 0x4cbc, 0x4c9c, 0x4c9c, 0x4c9b, 0x4c9b, 0x447b, 0x445b, 0x445b, 0x443b, 0x3c3a, 0x3c1a, 0x3bfa, 0x33fa, 0x33d9, 0x33b9, 0x2b99, 0x2b79, 0x2b58, 0x2338, 0x2338, 0x1b18, 0x1af7, 0x22f7, 0x01d5, 0x0000, 0xe75d, 0xdedb, 0xdedb, 0xd6ba, 0xdefb, 0x0000, 0xb596, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xffdf, 0xf7be, 0xffdf, 0xffdf, 0xb596, 0xdedb, 0xe71c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x8430, 0x0000, 0x0020, 0x0000, 0x4a49, 0x9cd3, 0xb5b6, 0xbdf7, 0xb596, 0x31a6, 0x0000, 0x1082, 0x0020, 0x0020, 0x1082, 0x0841, 0x0000, 0xbdd7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe71c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x01d3, 0x1ad7, 0x2317, 0x1b18, 0x2338, 0x2358, 0x2b79, 0x2b99, 0x2b99, 0x33b9, 0x33da, 0x3bfa, 0x3bfa, 0x3c1a, 0x3c3a, 0x443a, 0x445b, 0x445b, 0x445b, 0x447b, 0x4c7b, 0x4c7b, 0x4c7b, 0x4c7b, 0x4c7b, 0x447b, 0x447b, 0x445b, 0x445b, 0x443b, 0x443b, 0x3c1a, 0x3c1a, 0x3bfa, 0x33fa, 0x33d9, 0x33b9, 0x2b99, 0x2b79, 0x2b78, 0x2358, 0x2338, 0x1b18, 0x1af7, 0x1ad7, 0x1ad7, 0x01b6, 0x0000, 0xef5d, 0xdedb, 0xdedb, 0xd6ba, 0xe71c, 0x0000, 0xb596, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0x0000, 0xdedb, 0xe71c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x8c71, 0x0000, 0x10a2, 0x0000, 0x73ae, 0xe71c, 0xf7be, 0xf79e, 0xf79e, 0xf7be, 0xb596, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe71c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x0172, 0x1297, 0x22f7, 0x1b17, 0x2318, 0x2338, 0x2b58, 0x2b79, 0x2b99, 0x3399, 0x33b9, 0x33da, 0x33fa, 0x3bfa, 0x3c1a, 0x3c1a, 0x3c3a, 0x443b, 0x445b, 0x445b, 0x445b, 0x445b, 0x445b, 0x445b, 0x445b, 0x445b, 0x443b, 0x443b, 0x443b, 0x3c1b, 0x3c1a, 0x3c1a, 0x3bfa, 0x33d9, 0x33d9, 0x33b9, 0x2b99, 0x2b79, 0x2b78, 0x2358, 0x2338, 0x2318, 0x1af7, 0x1ad7, 0x1ad7, 0x1ad7, 0x0155, 0x0000, 0xe75d, 0xdedb, 0xdedb, 0xd6ba, 0xdefb, 0x0000, 0xad75, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe73c, 0xb596, 0xdedb, 0xe71c, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0x9cf3, 0x0000, 0x18c3, 0x0000, 0x738e, 0xef5d, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb596, 0x4a49, 0x0000, 0x0000, 0x2965, 0x8c71, 0xe71c, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe71c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x0132, 0x0a36, 0x1af7, 0x1af7, 0x1b18, 0x2338, 0x2358, 0x2358, 0x2b79, 0x2b99, 0x2b99, 0x33b9, 0x33d9, 0x33da, 0x33fa, 0x3bfa, 0x3c1a, 0x3c1a, 0x3c1a, 0x3c3a, 0x3c3a, 0x443b, 0x443b, 0x443b, 0x443b, 0x3c3a, 0x3c3a, 0x3c1a, 0x3c1a, 0x3bfa, 0x3bfa, 0x33fa, 0x33d9, 0x33b9, 0x33b9, 0x2b99, 0x2b79, 0x2b78, 0x2358, 0x2338, 0x2318, 0x1af7, 0x1af7, 0x1ad7, 0x12b7, 0x1a97, 0x0094, 0x0000, 0xe75d, 0xdedb, 0xd6ba, 0xd6ba, 0xdefb, 0x0000, 0xad55, 0xef7d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0x0000, 0xdedb, 0xdefb, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x9cf3, 0x0000, 0x18c3, 0x0000, 0x632c, 0xe71c, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xef7d, 0xf7be, 0xdefb, 0xbdf7, 0xbdd7, 0xd69a, 0xef7d, 0xef7d, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe71c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x0132, 0x0173, 0x1a97, 0x1af7, 0x1af7, 0x1b18, 0x2338, 0x2338, 0x2358, 0x2b79, 0x2b79, 0x2b99, 0x33b9, 0x33b9, 0x33d9, 0x33d9, 0x33fa, 0x3bfa, 0x3bfa, 0x3c1a, 0x3c1a, 0x3c1a, 0x3c1a, 0x3c1a, 0x3c1a, 0x3c1a, 0x3c1a, 0x3bfa, 0x3bfa, 0x33da, 0x33d9, 0x33b9, 0x33b9, 0x2b99, 0x2b99, 0x2b79, 0x2b58, 0x2358, 0x2338, 0x2318, 0x1b17, 0x1af7, 0x1ad7, 0x12b6, 0x12b7, 0x1236, 0x0012, 0x0000, 0xe75d, 0xdeba, 0xd6ba, 0xd69a, 0xdefb, 0x0000, 0xa534, 0xe71c, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xdefb, 0xd69a, 0xb596, 0xe73c, 0xdefb, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xef5d, 0xd69a, 0xb596, 0xa514, 0xa534, 0xbdf7, 0xdefb, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x0000, 0x2104, 0x0000, 0x5aeb, 0xdefb, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe71c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x0152, 0x0133, 0x09d4, 0x12b7, 0x1af7, 0x1af7, 0x1b17, 0x2338, 0x2338, 0x2358, 0x2b78, 0x2b79, 0x2b99, 0x2b99, 0x33b9, 0x33b9, 0x33da, 0x33da, 0x33da, 0x33d9, 0x33fa, 0x33fa, 0x33fa, 0x3bfa, 0x3bfa, 0x33fa, 0x33da, 0x33da, 0x33da, 0x33ba, 0x33b9, 0x33b9, 0x2b99, 0x2b79, 0x2b79, 0x2b58, 0x2358, 0x2338, 0x2318, 0x1b18, 0x1af7, 0x1ad7, 0x12b6, 0x12b6, 0x0a56, 0x0993, 0x0012, 0x0000, 0xe73d, 0xd6ba, 0xd69a, 0xd69a, 0xdedb, 0x0000, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd69a, 0xf79e, 0xdedb, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xce79, 0x8410, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0841, 0x52aa, 0xa534, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb596, 0x0000, 0x18e3, 0x0000, 0x528a, 0xdefb, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe73c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x0152, 0x0153, 0x0173, 0x01f4, 0x12b7, 0x1ad8, 0x1af7, 0x1b17, 0x2318, 0x2338, 0x2338, 0x2358, 0x2b78, 0x2b79, 0x2b79, 0x2b99, 0x2b99, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x33d9, 0x33d9, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x2b99, 0x2b99, 0x2b79, 0x2b79, 0x2b78, 0x2358, 0x2338, 0x2338, 0x2318, 0x1af7, 0x1af7, 0x1ad7, 0x12b7, 0x12b7, 0x0a56, 0x0193, 0x0973, 0x0012, 0x0000, 0xe73d, 0xd6ba, 0xd69a, 0xd69a, 0xdedb, 0x0000, 0xad75, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xe73c, 0xef7d, 0xef7d, 0xd6ba, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xef7d, 0xbdd7, 0x2965, 0x0000, 0x0000, 0x0000, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 0x738e, 0xdefb, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x0000, 0x0861, 0x0000, 0x4228, 0xd6ba, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe73c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x0172, 0x0153, 0x0193, 0x0153, 0x01b4, 0x1297, 0x1ad8, 0x1af7, 0x1af7, 0x1b18, 0x2318, 0x2338, 0x2358, 0x2358, 0x2b58, 0x2b79, 0x2b79, 0x2b79, 0x2b99, 0x2b99, 0x2b99, 0x3399, 0x3399, 0x2b99, 0x2b99, 0x2b99, 0x2b99, 0x2b99, 0x2b79, 0x2b79, 0x2b79, 0x2b59, 0x2358, 0x2338, 0x2338, 0x2318, 0x1b18, 0x1af7, 0x1ad7, 0x1ad7, 0x12b7, 0x1297, 0x0a35, 0x0193, 0x0153, 0x0993, 0x0012, 0x0000, 0xe73d, 0xd69a, 0xd69a, 0xce79, 0xdedb, 0x0000, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xf7be, 0xf7be, 0xf79e, 0xef7d, 0xe73c, 0xef5d, 0xd6ba, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xef7d, 0xce59, 0x18c3, 0x0000, 0x10a2, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0861, 0x10a2, 0x0020, 0x0000, 0x73ae, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xbdf7, 0x0000, 0x0020, 0x0000, 0x39e7, 0xd6ba, 0xf7be, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe73c, 0xffff, 0xffdf, 0xffff, 0xffdf, 0x0000, 0x0172, 0x0133, 0x0173, 0x0173, 0x0153, 0x0193, 0x0a35, 0x12b7, 0x1af7, 0x1af8, 0x1af8, 0x2318, 0x2338, 0x2338, 0x2338, 0x2358, 0x2358, 0x2b59, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2358, 0x2359, 0x2359, 0x2338, 0x2338, 0x2318, 0x2317, 0x1af7, 0x1af7, 0x1ad7, 0x1ad7, 0x12b7, 0x1276, 0x01f4, 0x0173, 0x0153, 0x0174, 0x0993, 0x0012, 0x0000, 0xe73d, 0xd69a, 0xd69a, 0xce79, 0xdedb, 0x0000, 0xbdd7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xd6ba, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xe71c, 0x632c, 0x0000, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0861, 0x0000, 0xb596, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xc638, 0x0861, 0x0000, 0x0000, 0x18e3, 0xce79, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x0000, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe73c, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x0172, 0x0133, 0x0193, 0x0173, 0x0173, 0x0173, 0x0193, 0x01f5, 0x0a76, 0x1ad7, 0x1af8, 0x1af7, 0x1b17, 0x2318, 0x2317, 0x2338, 0x2338, 0x2338, 0x2358, 0x2358, 0x2358, 0x2358, 0x2b58, 0x2b58, 0x2358, 0x2358, 0x2358, 0x2338, 0x2338, 0x2338, 0x2338, 0x2318, 0x1b18, 0x1b17, 0x1af7, 0x1af7, 0x1ad7, 0x12b7, 0x1296, 0x0a15, 0x0193, 0x0153, 0x0153, 0x0173, 0x0173, 0x0993, 0x0012, 0x0000, 0xe73d, 0xd69a, 0xd67a, 0xce79, 0xd6ba, 0x0000, 0xbdd7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xd6ba, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xbdd7, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x5aeb, 0xf79e, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xef7d, 0xbdd7, 0x2104, 0x0000, 0x0000, 0x4a49, 0xd6ba, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe73c, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x0192, 0x0133, 0x0193, 0x0173, 0x0194, 0x01b4, 0x01b4, 0x01b4, 0x01d4, 0x0a15, 0x0a76, 0x12b7, 0x1ad7, 0x1af7, 0x1af7, 0x1b17, 0x2317, 0x2318, 0x2318, 0x2338, 0x2338, 0x2338, 0x2338, 0x2338, 0x2338, 0x2338, 0x2318, 0x2318, 0x2318, 0x1b17, 0x1b17, 0x1af7, 0x1af7, 0x1af7, 0x1ad7, 0x12b7, 0x1276, 0x0a35, 0x01d4, 0x0194, 0x0173, 0x0174, 0x0174, 0x0173, 0x0173, 0x0993, 0x0012, 0x0000, 0xe73c, 0xd679, 0xd67a, 0xce59, 0xd6ba, 0x0000, 0xbdd7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xe73c, 0xe71c, 0xe71c, 0xd69a, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x9cd3, 0xad55, 0xa534, 0xa534, 0xad55, 0xa534, 0x738e, 0x0000, 0x0000, 0x0841, 0x0000, 0x738e, 0xb596, 0xa534, 0xa534, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xa534, 0xa534, 0xa534, 0xa534, 0xa534, 0xa534, 0xa534, 0xa514, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xffff, 0xffff, 0x0000, 0xe73c, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x0192, 0x0133, 0x0194, 0x0194, 0x01b4, 0x01b4, 0x01d4, 0x01f5, 0x01f5, 0x01f5, 0x0215, 0x0a35, 0x0a56, 0x1296, 0x12b7, 0x1ad7, 0x1af7, 0x1af7, 0x1af7, 0x1b18, 0x1b18, 0x1b18, 0x1b18, 0x1b18, 0x1b18, 0x1b18, 0x1af7, 0x1af7, 0x1af7, 0x1af7, 0x1ad7, 0x1ad7, 0x12b7, 0x1296, 0x0a56, 0x0a35, 0x01f5, 0x01d4, 0x01b4, 0x01b4, 0x0194, 0x0174, 0x0174, 0x0173, 0x0173, 0x0993, 0x0012, 0x0000, 0xe73c, 0xce79, 0xce79, 0xce59, 0xd6ba, 0x0000, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xe73c, 0xe71c, 0xdefb, 0xdefb, 0xd69a, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0x7bef, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0020, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x2104, 0x0000, 0xef7d, 0xffff, 0x0000, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x0192, 0x0154, 0x09b4, 0x01b4, 0x01d4, 0x01d5, 0x01f5, 0x01f5, 0x0a15, 0x0a35, 0x0a35, 0x0a36, 0x0a56, 0x0a56, 0x0a76, 0x1276, 0x1296, 0x12b6, 0x12b7, 0x12d7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x12b7, 0x12b6, 0x12b6, 0x1296, 0x0a76, 0x0a56, 0x0a35, 0x0a15, 0x0215, 0x01f5, 0x01f5, 0x01d5, 0x01d5, 0x01b4, 0x0194, 0x0194, 0x0174, 0x0173, 0x0993, 0x0012, 0x0000, 0xe73c, 0xce79, 0xce79, 0xce59, 0xd6ba, 0x0000, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xe73c, 0xe71c, 0xe71c, 0xdefb, 0xdedb, 0xce79, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0x7bcf, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x18e3, 0x1082, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xffff, 0x0000, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x01b3, 0x0174, 0x09d4, 0x01d4, 0x01f5, 0x01f5, 0x0215, 0x0a35, 0x0a35, 0x0a56, 0x0a56, 0x0a76, 0x0a76, 0x1276, 0x1296, 0x1296, 0x1296, 0x12b6, 0x12b6, 0x12b7, 0x12b7, 0x12b6, 0x12b6, 0x12b7, 0x12b6, 0x12b6, 0x12b6, 0x1296, 0x1296, 0x1296, 0x1276, 0x0a76, 0x0a56, 0x0a56, 0x0a55, 0x0a35, 0x0a35, 0x0a15, 0x01f5, 0x01f5, 0x01d4, 0x01b4, 0x01b4, 0x0194, 0x0173, 0x0993, 0x0012, 0x0000, 0xe71c, 0xce59, 0xce59, 0xc659, 0xd69a, 0x0000, 0xa534, 0xdedb, 0xd6ba, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce59, 0xce59, 0xce59, 0xbdf7, 0xbdd7, 0xb5b6, 0xb5b6, 0xce79, 0xdefb, 0xce79, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x73ae, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x630c, 0x0000, 0x0000, 0x1082, 0x0000, 0x528a, 0x8c71, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x0000, 0x0000, 0x18c3, 0x0020, 0x0000, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xffff, 0xffff, 0x0000, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x01d3, 0x0194, 0x09f5, 0x01f5, 0x0215, 0x0a15, 0x0a35, 0x0a56, 0x0a56, 0x0a76, 0x1276, 0x1296, 0x1296, 0x1296, 0x12b7, 0x12b7, 0x12d7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x1ad7, 0x12d7, 0x12d7, 0x12b7, 0x12b6, 0x12b7, 0x1296, 0x1296, 0x0a76, 0x0a76, 0x0a56, 0x0a55, 0x0a35, 0x0a15, 0x0215, 0x01f5, 0x01d5, 0x01d4, 0x01b4, 0x0194, 0x0994, 0x0012, 0x0000, 0xe71c, 0xce59, 0xce59, 0xc638, 0xd69a, 0x0000, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb5b6, 0xd69a, 0xce79, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xb5b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x52aa, 0xef5d, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xef7d, 0xb596, 0x10a2, 0x0000, 0x0000, 0x4208, 0xce79, 0xffdf, 0xf79e, 0xf7be, 0xf7be, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x01f4, 0x01b5, 0x0a15, 0x0215, 0x0a15, 0x0a35, 0x0a56, 0x0a56, 0x0a76, 0x1296, 0x1296, 0x12b6, 0x12b7, 0x12d7, 0x1ad7, 0x1ad7, 0x1af7, 0x1af7, 0x1af7, 0x1af8, 0x1af7, 0x1af7, 0x1af7, 0x1af7, 0x1af7, 0x1af7, 0x1af7, 0x1af7, 0x1ad7, 0x1ad7, 0x12d7, 0x12b7, 0x12b7, 0x1296, 0x1296, 0x0a76, 0x0a56, 0x0a56, 0x0a35, 0x0a15, 0x0215, 0x01f5, 0x01d5, 0x01b4, 0x01b4, 0x09b4, 0x0012, 0x0000, 0xe71c, 0xce59, 0xce59, 0xc638, 0xd69a, 0x0000, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc638, 0xce79, 0xce79, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xe71c, 0x5acb, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0000, 0xad55, 0xffdf, 0xef7d, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffdf, 0xffff, 0xc638, 0x0841, 0x0000, 0x0000, 0x39c7, 0xd6ba, 0xffdf, 0xf79e, 0xf7be, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x0000, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x0234, 0x01b5, 0x0a35, 0x0235, 0x0a35, 0x0a56, 0x0a76, 0x1276, 0x1296, 0x12b7, 0x12b7, 0x12d7, 0x1ad7, 0x1af7, 0x1af7, 0x1af7, 0x1b18, 0x2318, 0x2318, 0x2318, 0x2338, 0x2318, 0x2318, 0x2318, 0x2318, 0x2318, 0x2318, 0x1b18, 0x1af7, 0x1af7, 0x1af7, 0x1ad7, 0x1ad7, 0x12b7, 0x12b7, 0x1296, 0x1276, 0x0a76, 0x0a56, 0x0a36, 0x0a35, 0x0215, 0x01f5, 0x01d5, 0x01b4, 0x09b4, 0x0033, 0x0000, 0xdf1c, 0xce59, 0xce59, 0xc638, 0xd69a, 0x0000, 0xad75, 0xdefb, 0xdedb, 0xdefb, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xdedb, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xdedb, 0xd6ba, 0xce79, 0xd6ba, 0xce59, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xf79e, 0xc618, 0x0000, 0x0000, 0x18e3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2104, 0x0000, 0x632c, 0xef5d, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x0000, 0x0861, 0x0000, 0x4228, 0xdedb, 0xffdf, 0xf79e, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x0000, 0x0000, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x0a54, 0x01d5, 0x1236, 0x0a55, 0x0a56, 0x0a76, 0x1296, 0x1296, 0x12b7, 0x1ad7, 0x1ad7, 0x1af7, 0x1af8, 0x1b18, 0x2318, 0x2318, 0x2338, 0x2338, 0x2338, 0x2358, 0x2358, 0x2358, 0x2358, 0x2358, 0x2358, 0x2358, 0x2338, 0x2338, 0x2338, 0x2318, 0x1b17, 0x1af7, 0x1af7, 0x1ad7, 0x1ad7, 0x12b7, 0x1297, 0x1296, 0x0a76, 0x0a56, 0x0a36, 0x0a35, 0x0215, 0x01f5, 0x01d5, 0x09d5, 0x0053, 0x0000, 0xdf1c, 0xc638, 0xce39, 0xc618, 0xce79, 0x0000, 0xbdf7, 0xffdf, 0xef5d, 0xef5d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0x0000, 0x0000, 0xd69a, 0xd69a, 0xd69a, 0xce59, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xef5d, 0xf79e, 0xad75, 0x0000, 0x0000, 0x0020, 0x1082, 0x10a2, 0x10a2, 0x1082, 0x0000, 0x0000, 0x5aeb, 0xdedb, 0xf7be, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xffdf, 0xb5b6, 0x0000, 0x10a2, 0x0000, 0x528a, 0xdefb, 0xffdf, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xef7d, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x0a54, 0x01f5, 0x1256, 0x0a56, 0x0a76, 0x1296, 0x12b7, 0x12b7, 0x1ad7, 0x1ad7, 0x1af7, 0x1b17, 0x2317, 0x2338, 0x2338, 0x2358, 0x2358, 0x2b58, 0x2b78, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b79, 0x2b59, 0x2358, 0x2358, 0x2338, 0x2338, 0x2318, 0x1b17, 0x1af7, 0x1af7, 0x1ad7, 0x12b7, 0x12b7, 0x1296, 0x0a76, 0x0a56, 0x0a36, 0x0a35, 0x0215, 0x01f5, 0x09f5, 0x0093, 0x0000, 0xdf1c, 0xc638, 0xc638, 0xc618, 0xce79, 0x0000, 0xc618, 0xffff, 0xf7be, 0xf79e, 0xf7be, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xe73c, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xce59, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xc638, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x9cd3, 0xe73c, 0xf7be, 0xf79e, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xb596, 0x0000, 0x18e3, 0x0000, 0x5aeb, 0xef5d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x0a75, 0x0215, 0x1276, 0x0a76, 0x1296, 0x12b7, 0x12b7, 0x1ad7, 0x1af7, 0x1af7, 0x2318, 0x2338, 0x2338, 0x2358, 0x2b58, 0x2b79, 0x2b79, 0x2b79, 0x2b99, 0x2b99, 0x2b99, 0x2b99, 0x2b99, 0x2b99, 0x2b99, 0x2b99, 0x2b79, 0x2b79, 0x2b79, 0x2b58, 0x2358, 0x2338, 0x2338, 0x2318, 0x1b18, 0x1af7, 0x1ad7, 0x12b7, 0x12b7, 0x1296, 0x0a76, 0x0a56, 0x0a36, 0x0a35, 0x0a15, 0x0a15, 0x00b4, 0x0000, 0xdf1c, 0xc638, 0xc638, 0xc618, 0xce79, 0x0000, 0xc618, 0xffff, 0xffdf, 0xf7be, 0xf7be, 0xffdf, 0xffff, 0xffdf, 0xf7be, 0xef5d, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xce79, 0xd69a, 0xce59, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xef5d, 0xce59, 0xad55, 0x8430, 0x9492, 0xbdd7, 0xdedb, 0xf79e, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa514, 0x0000, 0x18e3, 0x0000, 0x6b6d, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef7d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x1275, 0x0235, 0x1296, 0x1296, 0x12b7, 0x12b7, 0x1ad7, 0x1af7, 0x1b17, 0x2318, 0x2338, 0x2358, 0x2b58, 0x2b78, 0x2b79, 0x2b99, 0x2b99, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x33b9, 0x2b99, 0x2b99, 0x2b79, 0x2b79, 0x2b59, 0x2358, 0x2338, 0x2338, 0x1b17, 0x1af7, 0x1ad7, 0x12b7, 0x12b7, 0x1296, 0x0a76, 0x0a56, 0x0a36, 0x0a15, 0x0a15, 0x00d4, 0x0000, 0xdf1c, 0xc618, 0xc618, 0xbdf7, 0xce79, 0x0000, 0xc618, 0xffff, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xf79e, 0xef7d, 0xef5d, 0xe73c, 0xe71c, 0xe71c, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xce79, 0xce79, 0xc638, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xef7d, 0xf79e, 0xf7be, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0x9cd3, 0x0000, 0x10a2, 0x0000, 0x738e, 0xef7d, 0xffdf, 0xf79e, 0xf7be, 0xf7be, 0xef7d, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x1295, 0x0236, 0x1296, 0x12b6, 0x12b7, 0x1ad7, 0x1af7, 0x1b18, 0x2338, 0x2338, 0x2358, 0x2b79, 0x2b79, 0x2b99, 0x3399, 0x33b9, 0x33ba, 0x33da, 0x33da, 0x33da, 0x33da, 0x33fa, 0x3bfa, 0x33fa, 0x33da, 0x33da, 0x33da, 0x33d9, 0x33b9, 0x33b9, 0x2b99, 0x2b99, 0x2b79, 0x2358, 0x2338, 0x2338, 0x2318, 0x1af7, 0x1ad7, 0x12d7, 0x12b7, 0x1296, 0x0a76, 0x0a56, 0x0a36, 0x0a35, 0x00f4, 0x0000, 0xdf1c, 0xc618, 0xc618, 0xbdf7, 0xce59, 0x0000, 0xc618, 0xffdf, 0xf7be, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xe73c, 0xe71c, 0xe71c, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xce79, 0xce79, 0xce79, 0xc638, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0x9cd3, 0x0000, 0x10a2, 0x0000, 0x7bef, 0xf7be, 0xffdf, 0xf7be, 0xf7be, 0xce79, 0x0000, 0x10a2, 0x10a2, 0x1082, 0x1082, 0x1082, 0x2945, 0x0000, 0x8c51, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef7d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x1295, 0x0256, 0x1ab7, 0x12b7, 0x12d7, 0x1af8, 0x1b18, 0x2338, 0x2358, 0x2359, 0x2b79, 0x2b99, 0x2b99, 0x33b9, 0x33da, 0x33da, 0x33fa, 0x33fa, 0x3bfa, 0x3c1a, 0x3c1a, 0x3c1a, 0x3c1a, 0x3c1a, 0x3c1a, 0x3bfa, 0x33fa, 0x33fa, 0x33da, 0x33da, 0x33b9, 0x2b99, 0x2b99, 0x2b79, 0x2359, 0x2358, 0x2338, 0x1b18, 0x1af8, 0x1ad7, 0x12b7, 0x1297, 0x0a96, 0x0a76, 0x0a56, 0x1235, 0x0134, 0x0000, 0xdefc, 0xc617, 0xc617, 0xbdf7, 0xce59, 0x0000, 0xc618, 0xffdf, 0xf79e, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xe73c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce59, 0xce59, 0xc638, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xffdf, 0xf7be, 0x8c51, 0x0000, 0x10a2, 0x0000, 0x8410, 0xef7d, 0xffff, 0xffdf, 0xd69a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x8410, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef7d, 0xffff, 0xffdf, 0xffff, 0xffff, 0x0000, 0x1ad5, 0x0276, 0x1ad7, 0x1ad7, 0x1af7, 0x2317, 0x2338, 0x2338, 0x2b58, 0x2b78, 0x3398, 0x33b9, 0x33b9, 0x3bd9, 0x3bf9, 0x3bf9, 0x3c1a, 0x3c1a, 0x441a, 0x441a, 0x443a, 0x443a, 0x443a, 0x443a, 0x443a, 0x441a, 0x3c1a, 0x3c1a, 0x3bfa, 0x3bf9, 0x3bd9, 0x33b9, 0x33b9, 0x3399, 0x2b78, 0x2b58, 0x2b58, 0x2338, 0x2317, 0x1af7, 0x1ad7, 0x1ab6, 0x1296, 0x1276, 0x1256, 0x1235, 0x0134, 0x0000, 0xdefc, 0xbe17, 0xc617, 0xbdf7, 0xce39, 0x0000, 0xc618, 0xffdf, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xe73c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xce79, 0xce79, 0xce59, 0xce59, 0xc638, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xffdf, 0xf79e, 0x8410, 0x0000, 0x1082, 0x0000, 0x632c, 0xbdf7, 0xce79, 0xad75, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x18c3, 0x0000, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef7d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0x0000, 0x1ad6, 0x0a96, 0x22d7, 0x1af7, 0x2318, 0x2338, 0x2b58, 0x2b79, 0x2b79, 0x3399, 0x33b9, 0x33d9, 0x3bda, 0x3bfa, 0x3c1a, 0x3c1a, 0x443b, 0x443b, 0x443b, 0x445b, 0x445b, 0x445b, 0x445b, 0x445b, 0x445b, 0x445b, 0x443b, 0x443b, 0x3c3a, 0x3c1a, 0x3bfa, 0x33da, 0x33d9, 0x33b9, 0x3399, 0x2b79, 0x2b78, 0x2358, 0x2338, 0x2317, 0x1af7, 0x1ad7, 0x1ab7, 0x1297, 0x1276, 0x1256, 0x0175, 0x0000, 0xdefc, 0xbdf7, 0xbdf7, 0xbdd7, 0xc638, 0x0000, 0xc618, 0xf7be, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xe71c, 0xe71c, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce59, 0xce59, 0xc638, 0xc638, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xf7be, 0xffff, 0xf79e, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0000, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef5d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0x0000, 0x0255, 0x01d5, 0x0256, 0x0277, 0x0297, 0x02b7, 0x02f8, 0x0318, 0x0338, 0x0b59, 0x0b79, 0x1399, 0x1bba, 0x23da, 0x23da, 0x23fa, 0x2c1a, 0x2c1a, 0x2c3b, 0x343b, 0x343b, 0x343b, 0x343b, 0x343b, 0x343b, 0x343b, 0x2c1a, 0x2c1a, 0x2bfa, 0x23da, 0x1bda, 0x1bb9, 0x1399, 0x1379, 0x0b59, 0x0338, 0x0318, 0x02f8, 0x02d7, 0x0297, 0x0277, 0x0256, 0x0236, 0x01f6, 0x01d5, 0x01b5, 0x0014, 0x0000, 0xdefc, 0xbdf7, 0xbdf7, 0xbdd7, 0xc638, 0x0000, 0xc618, 0xf7be, 0xf79e, 0xef7d, 0xef5d, 0xef5d, 0xe73c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce59, 0xc638, 0xc638, 0xc638, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xf7be, 0xffdf, 0xf79e, 0xa514, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0000, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef5d, 0xffff, 0xf7be, 0xffdf, 0xffde, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xdefb, 0xbdd7, 0xbdf7, 0xbdd7, 0xc638, 0x0000, 0xc618, 0xf79e, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xe73c, 0xe71c, 0xe71c, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce59, 0xce59, 0xc638, 0xc618, 0xc618, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xffdf, 0xffdf, 0xdedb, 0xa514, 0x6b6d, 0x5aeb, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x0000, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xef5d, 0xffff, 0xf7be, 0xffbe, 0xf7bf, 0xf7df, 0xf7ff, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7bf, 0xf7be, 0xf7be, 0xefbe, 0xefbe, 0xef9e, 0xef9e, 0xef9e, 0xef9e, 0xef9e, 0xef9e, 0xef9e, 0xef9e, 0xef7e, 0xef7e, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe73d, 0xe73d, 0xe73d, 0xe73c, 0xe73c, 0xdf3c, 0xdf1c, 0xdf1c, 0xdf1c, 0xdf1c, 0xdf1c, 0xdf1c, 0xdefb, 0xce79, 0xbdd7, 0xbdf7, 0xb5d6, 0xc618, 0x0000, 0xbdf7, 0xef7d, 0xef7d, 0xef7d, 0xe73c, 0xd69a, 0xc638, 0xce59, 0xd69a, 0xdefb, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce79, 0xce59, 0xc638, 0xc618, 0xc618, 0xc618, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xffdf, 0xffff, 0xffff, 0xf79e, 0xef7d, 0xc618, 0x0000, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0x2945, 0x0000, 0x8c51, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xe71c, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xf79e, 0xef7e, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xe75d, 0xe73c, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xdf1c, 0xdf1c, 0xdefc, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xdedb, 0xd6db, 0xd6ba, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xd69a, 0xce7a, 0xce79, 0xce79, 0xce59, 0xce59, 0xc659, 0xc659, 0xc638, 0xc638, 0xc638, 0xc618, 0xc618, 0xbe18, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdf7, 0xbdf7, 0xb5b6, 0xc638, 0x0000, 0xc638, 0xf7be, 0xef7d, 0xd69a, 0xad55, 0x8410, 0x738e, 0x7bef, 0x9492, 0xbdd7, 0xd6ba, 0xdedb, 0xd6ba, 0xd69a, 0xce59, 0xce59, 0xc638, 0xc638, 0xc618, 0xc618, 0xc618, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xffdf, 0xffff, 0xffff, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xbdf7, 0xffff, 0xf79e, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xf79e, 0xf77d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xef5c, 0xe73c, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71b, 0xe6fb, 0xe6fb, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xdeda, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xd69a, 0xd679, 0xd679, 0xce79, 0xce79, 0xce59, 0xce59, 0xce59, 0xce58, 0xc638, 0xc638, 0xc638, 0xc638, 0xc618, 0xc618, 0xc617, 0xc617, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xad75, 0x0000, 0xc618, 0xc638, 0xe71c, 0xce79, 0x94b2, 0x738e, 0x7bcf, 0x8c71, 0x7bef, 0x6b4d, 0x73ae, 0xad55, 0xc618, 0xc618, 0xc638, 0xce79, 0xce59, 0xc638, 0xc618, 0xc618, 0xbdf7, 0xbdf7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xf7be, 0xd6ba, 0x52aa, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x632c, 0x4228, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xf7be, 0xffff, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xe75d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xdf1c, 0xdefc, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xdedb, 0xd6da, 0xd6ba, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce79, 0xce79, 0xce59, 0xce59, 0xce59, 0xc638, 0xc638, 0xc638, 0xc618, 0xc618, 0xbe18, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb596, 0x0000, 0xdedb, 0x9cd3, 0x8c71, 0x94b2, 0x8c71, 0x73ae, 0x94b2, 0xce79, 0xdedb, 0xce79, 0x9cf3, 0x738e, 0x73ae, 0x7bcf, 0x738e, 0x7bef, 0xa514, 0xc638, 0xc618, 0xc618, 0xbdf7, 0xbdf7, 0xbdf7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8430, 0x0000, 0xef7d, 0xef7d, 0xef7d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xef9e, 0xef5d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xdedb, 0xd6bb, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xd69a, 0xce7a, 0xce79, 0xce79, 0xce79, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce79, 0xce79, 0xce59, 0xce59, 0xce59, 0xc638, 0xc618, 0xc618, 0xbdf7, 0xc618, 0x0000, 0xdefb, 0xad55, 0x73ed, 0x642d, 0x7c0f, 0x7bef, 0x8410, 0xc638, 0xe71c, 0xdefb, 0xe71c, 0xce79, 0x8c51, 0x738e, 0x73ae, 0x8430, 0x6b6d, 0x632c, 0xa514, 0xc638, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdf7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9492, 0x0000, 0xad55, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc638, 0xc618, 0xc618, 0xc618, 0xc618, 0xd69a, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xc618, 0xb596, 0xb596, 0xb596, 0xb596, 0xb596, 0xb596, 0xb596, 0xb596, 0xb596, 0xc618, 0xce59, 0xc638, 0xc638, 0x0000, 0x0000, 0x9d14, 0x7bae, 0x4528, 0x35e6, 0x640c, 0x736e, 0x9cd3, 0xce79, 0xd69a, 0xd69a, 0xd69a, 0xce79, 0xa514, 0x6b4d, 0xa514, 0xf800, 0xf800, 0x5aeb, 0x8430, 0xc618, 0xbdf7, 0xbdd7, 0xbdd7, 0xbdf7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xb596, 0xb596, 0xb596, 0xb596, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xa534, 0xad55, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd6ba, 0xa534, 0x736e, 0x552a, 0x3d86, 0x63cc, 0x6b2d, 0x9cf3, 0xce79, 0xd69a, 0xd6ba, 0xd69a, 0xce79, 0xad55, 0x632c, 0x9492, 0xf800, 0xf800, 0x52aa, 0x8c51, 0xc618, 0xbdf7, 0xbdd7, 0xbdd7, 0xbdf7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 0x0000, 0xc638, 0xdefb, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce59, 0xce59, 0xc638, 0xc638, 0xc638, 0xc618, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb596, 0xbdd7, 0x8c71, 0x0000, 0x94b2, 0xb5b6, 0xc638, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0xef5d, 0xffdf, 0xf79e, 0xf79e, 0xf7be, 0xd6da, 0x8410, 0x5aec, 0x5b2c, 0x5aeb, 0x5acb, 0x8c51, 0xd69a, 0xe73c, 0xe73c, 0xe71c, 0xd6ba, 0x94b2, 0x5aeb, 0x5aeb, 0x5aeb, 0x52aa, 0x632c, 0xad75, 0xc618, 0xbdd7, 0xbdd7, 0xb5b6, 0xbdf7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad55, 0x6b6d, 0x0000, 0x0000, 0xb596, 0xe71c, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd69a, 0xd6ba, 0xd69a, 0xd6ba, 0xd69a, 0x9cd3, 0xa514, 0x0000, 0x0000, 0x0000, 0xad55, 0xc638, 0xffff, 0xffff, 0xffff, 0xb596, 0x0000, 0xef5d, 0xffdf, 0xf79e, 0xf79e, 0xef5d, 0xef7d, 0xd69a, 0xa514, 0x8c51, 0x8c51, 0x738e, 0x0000, 0x9cf3, 0xdefb, 0xef7d, 0xe71c, 0xad75, 0x5aeb, 0x630c, 0x7bef, 0x7bcf, 0x8c51, 0xb596, 0xc618, 0xbdd7, 0xbdd7, 0xb5b6, 0xb5b6, 0xbdd7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x0000, 0x0000, 0x0000, 0xef7d, 0xf7be, 0xad55, 0xce59, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xef5d, 0xbdd7, 0xbdd7, 0xffff, 0xffdf, 0xdefb, 0xa514, 0x0000, 0x0000, 0xa534, 0xc638, 0xffff, 0xad75, 0x0000, 0xe73c, 0xf7be, 0xef7d, 0xef7d, 0xef5d, 0xe73c, 0xef5d, 0xe73c, 0xdefb, 0xdefb, 0xce79, 0x7bcf, 0x0000, 0x6b6d, 0x8430, 0x73ae, 0x0000, 0x632c, 0xb596, 0xce59, 0xc618, 0xc618, 0xc618, 0xbdd7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb596, 0xbdd7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xad75, 0xdedb, 0xef7d, 0xef5d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xef5d, 0xef7d, 0xce79, 0xb5b6, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xb5b6, 0x0000, 0x8c51, 0xce59, 0xb596, 0x0000, 0xe73c, 0xf79e, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xdefb, 0xce79, 0x9cf3, 0x738e, 0x0000, 0x6b4d, 0x8c71, 0xbdd7, 0xce59, 0xc638, 0xc618, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xbdd7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x94b2, 0xffdf, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xef5d, 0xbdd7, 0xd6ba, 0xef7d, 0xf7be, 0xf79e, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xf79e, 0xf79e, 0xf7be, 0xef7d, 0xce59, 0xb596, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xe73c, 0x0000, 0x8410, 0xb596, 0x0000, 0xe73c, 0xf79e, 0xef5d, 0xef5d, 0xe73c, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xd6ba, 0xdedb, 0xdedb, 0xce79, 0xc618, 0xc638, 0xce79, 0xce59, 0xc618, 0xc618, 0xc618, 0xbdf7, 0xbdf7, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xb596, 0xbdd7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xef5d, 0xce59, 0xce79, 0xdefb, 0xf79e, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xdedb, 0xc618, 0xb5b6, 0xce79, 0xd6ba, 0xdefb, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xf79e, 0x0000, 0x8410, 0x0000, 0xe73c, 0xef7d, 0xef5d, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xce79, 0xc638, 0xc618, 0xc618, 0xc618, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb596, 0xb596, 0xad75, 0xb5b6, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xf79e, 0xffff, 0xf7be, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xf79e, 0xef7d, 0xf79e, 0xef7d, 0xdefb, 0xce79, 0xce79, 0xd6ba, 0xe71c, 0xef5d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xdefb, 0xd69a, 0xc638, 0xbdf7, 0xc638, 0xce79, 0xce59, 0xc618, 0xbdf7, 0xdedb, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf7be, 0xffff, 0xce59, 0x0000, 0x0000, 0xe71c, 0xef7d, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce59, 0xc638, 0xc638, 0xc638, 0xc618, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xb596, 0xad55, 0xb5b6, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x7bef, 0xffdf, 0xf79e, 0xf7be, 0xf79e, 0xf7be, 0xf7be, 0xf7be, 0xf79e, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xe73c, 0xdedb, 0xd69a, 0xce79, 0xce59, 0xce59, 0xce59, 0xce59, 0xc638, 0xc618, 0xc618, 0xc638, 0xce59, 0xce59, 0xc618, 0xc618, 0xc638, 0xd69a, 0xef5d, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf79e, 0xffdf, 0xe71c, 0x0000, 0x0000, 0xe73c, 0xef5d, 0xe73c, 0xe73c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce59, 0xc638, 0xc638, 0xc618, 0xc618, 0xbdf7, 0xbdf7, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xb596, 0xad75, 0xad55, 0xb5b6, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x0000, 0xef5d, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xdefb, 0xdedb, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xd69a, 0xd6ba, 0xdefb, 0xe73c, 0xef7d, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xffdf, 0xc638, 0x0000, 0x0000, 0xe71c, 0xef5d, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xce79, 0xce79, 0xce59, 0xce59, 0xc638, 0xc638, 0xc618, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb596, 0xb596, 0xad75, 0xad75, 0xad55, 0xb5b6, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x94b2, 0xf79e, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe73c, 0xe73c, 0xe73c, 0xef5d, 0xef7d, 0xef7d, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef7d, 0xef5d, 0x0000, 0x6b6d, 0x0000, 0xe71c, 0xef5d, 0xe71c, 0xe71c, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce59, 0xce59, 0xc638, 0xc638, 0xc618, 0xc618, 0xbdf7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xad75, 0xad75, 0xad55, 0xad55, 0xb5b6, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0x0000, 0x94b2, 0xe73c, 0xef5d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xef5d, 0xe73c, 0xef5d, 0xef5d, 0xef5d, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xe73c, 0xef5d, 0xd6ba, 0x0000, 0x0000, 0xad75, 0x0000, 0xe71c, 0xe73c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce59, 0xc638, 0xc638, 0xc618, 0xc618, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xb5b6, 0xb596, 0xb596, 0xad75, 0xad55, 0xad55, 0xa534, 0xb5b6, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xc618, 0x0000, 0x0000, 0xbdf7, 0xdefb, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe73c, 0xe73c, 0xdedb, 0xad55, 0x0000, 0x0000, 0xc618, 0xef7d, 0x0000, 0xe71c, 0xe73c, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xd6ba, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce59, 0xc638, 0xc638, 0xc618, 0xc618, 0xbdf7, 0xbdf7, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xb596, 0xad75, 0xad55, 0xad55, 0xad55, 0xa514, 0xbdd7, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x8430, 0x0000, 0x0000, 0xb596, 0xd69a, 0xdefb, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdedb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xe71c, 0xdefb, 0xdedb, 0xc638, 0xa514, 0x0000, 0x0000, 0x0000, 0xc638, 0xef7d, 0xffff, 0x0000, 0xd69a, 0xef7d, 0xdefb, 0xdefb, 0xdedb, 0xd6ba, 0xd6ba, 0xd69a, 0xce79, 0xce79, 0xce59, 0xc638, 0xc638, 0xc618, 0xc618, 0xbdf7, 0xbdf7, 0xbdd7, 0xb5b6, 0xb5b6, 0xb596, 0xad75, 0xad75, 0xad55, 0xa534, 0xa534, 0xa514, 0xb596, 0xce59, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xc618, 0x7bcf, 0x0000, 0x0000, 0x7bef, 0xa514, 0xbdd7, 0xce59, 0xd6ba, 0xdedb, 0xdedb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdedb, 0xdefb, 0xdefb, 0xdedb, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xdedb, 0xd6ba, 0xd69a, 0xc638, 0xb5b6, 0x9cd3, 0x0000, 0x0000, 0x0000, 0x0000, 0xbdd7, 0xce59, 0xffff, 0xffff, 0xffff, 0x0000, 0x8c51, 0xdefb, 0xe73c, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xdefb, 0xdefb, 0xdedb, 0xdedb, 0xdedb, 0xd6ba, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xd69a, 0xce79, 0xce79, 0xce79, 0xce59, 0xce59, 0xce59, 0xc638, 0xc638, 0xc638, 0xd69a, 0x9cf3, 0x0000, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xdefb, 0xce59, 0xa514, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0x94b2, 0xa534, 0xb596, 0xb5b6, 0xbdd7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdd7, 0xbdd7, 0xb5b6, 0xad75, 0xa514, 0x9492, 0x7bef, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0xa514, 0xc618, 0xce79, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x0000, 0x8410, 0xa534, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad75, 0xad75, 0xad55, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad75, 0xad55, 0xad75, 0x9492, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0xce79, 0xb5b6, 0x9cd3, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9cd3, 0xb596, 0xc638, 0xce79, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x518c, 0x0000, 0xf7bd, 0x5def, 0x5def, 0x5def, 0x7def, 0x7def, 0x7def, 0x5def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x5def, 0x7def, 0x59ce, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x18c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xbad6, 0xffff, 0xdfff, 0xfbde, 0x18c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x18c6, 0xbad6, 0xbef7, 0xffff, 0x1ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xbad6, 0xffff, 0x38c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd7bd, 0xffff, 0x3ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xfbde, 0xbef7, 0x0000, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xffff, 0xbef7, 0x0000, 0x5def, 0x5def, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xfbde, 0x7def, 0xb6b5, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef7, 0x96b5, 0x1ce7, 0x5def, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0x0000, 0x3ce7, 0xbef7, 0xf7bd, 0x9ef7, 0x1ce7, 0x5def, 0x9ef7, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x5def, 0xffff, 0xffff, 0xffff, 0xffff, 0x3ce7, 0x0000, 0x3ce7, 0x5def, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x7def, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb6b5, 0x18c6, 0x79ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xe007, 0xffff, 0x96b5, 0x3ce7, 0x5def, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x7def, 0x0000, 0x8e73, 0xb294, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xd39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xf39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xd39c, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0x34a5, 0x75ad, 0x55ad, 0x55ad, 0x0000, 0x0000, 0x0000, 0x79ce, 0x3ce7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1ce7, 0x0000, 0x5def, 0x5def, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x7def, 0x0000, 0xf7bd, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0x7def, 0xfbde, 0x0000, 0x0000, 0xbad6, 0x7def, 0x5def, 0x7def, 0x7def, 0x7def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0xffff, 0x5def, 0x3ce7, 0x3ce7, 0xdbde, 0x96b5, 0x9ef7, 0x5def, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x0000, 0x79ce, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0x5def, 0x0000, 0x0000, 0x55ad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0x9ad6, 0xffff, 0x3ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x9294, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xbff7, 0xfbde, 0x0000, 0x55ad, 0x9ad6, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x0000, 0xd7bd, 0xffff, 0x3ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x79ce, 0xffff, 0xdfff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdff7, 0xdfff, 0x9ef7, 0x0000, 0xf7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef7, 0x0000, 0xffff, 0x5def, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdbde, 0xffff, 0xdfff, 0xffff, 0xffff, 0x7def, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0xbeff, 0xdfff, 0xdff7, 0xbfff, 0xbef7, 0x0000, 0x75ad, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0xdfff, 0xdfff, 0x75ad, 0x1ce7, 0x5def, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdbde, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0x6f32, 0xd142, 0x9142, 0x334b, 0xb453, 0xb453, 0xd453, 0xd553, 0xf55b, 0xf55b, 0x165c, 0x365c, 0x3664, 0x5664, 0x5664, 0x7664, 0x776c, 0x976c, 0x976c, 0xb76c, 0xb76c, 0xd76c, 0xd774, 0xd76c, 0xd76c, 0xb76c, 0xb76c, 0x976c, 0x776c, 0x7664, 0x7664, 0x5664, 0x3664, 0x3664, 0x155c, 0x155c, 0xf55b, 0xf55b, 0xd553, 0xd553, 0xb453, 0x9453, 0x9453, 0x744b, 0xf242, 0xb142, 0x3022, 0x0000, 0xbff7, 0xdfff, 0xbfff, 0xbeff, 0xbef7, 0x0000, 0x75ad, 0xdfff, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x9ef7, 0x7def, 0x7def, 0x0000, 0x1ce7, 0x5def, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xfbde, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0xd200, 0xf400, 0xf401, 0x5923, 0xba2b, 0xba33, 0xfa33, 0x1a3c, 0x3a3c, 0x5b44, 0x7b44, 0x9c4c, 0xbc4c, 0xdc54, 0xfc54, 0x1d55, 0x3d5d, 0x5e5d, 0x7e65, 0x7e65, 0x9e65, 0x9e6d, 0xbe6d, 0xbe6d, 0x9e6d, 0x9e65, 0x7e65, 0x5e65, 0x3d5d, 0x1d5d, 0x1d55, 0xfc54, 0xbc4c, 0xbc4c, 0x9b44, 0x7b44, 0x3a3c, 0x1a3c, 0xfa33, 0xd933, 0xb92b, 0x992b, 0x7823, 0x7823, 0xb612, 0x7301, 0x1200, 0x0000, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbef7, 0x0000, 0x55ad, 0x9ef7, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x3ce7, 0x96b5, 0x1ce7, 0x3ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdbde, 0x14a5, 0xae73, 0x6d6b, 0x9294, 0x59ce, 0x5def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xfbde, 0xffff, 0xdfff, 0xffff, 0xdeff, 0x0000, 0x1201, 0xb409, 0x182b, 0x9933, 0x9933, 0xb933, 0xda3b, 0xfa3b, 0x1a3c, 0x3a44, 0x5b44, 0x7b4c, 0x9c4c, 0xbc4c, 0xbc54, 0xfc54, 0xfc5c, 0x1c5d, 0x3d5d, 0x3d65, 0x5d65, 0x5d65, 0x5d65, 0x5d65, 0x5d65, 0x5d65, 0x3d5d, 0x1d5d, 0x1c5d, 0xfc54, 0xdc54, 0xbc54, 0x9c4c, 0x7b4c, 0x7b44, 0x5a44, 0x3a44, 0x1a3c, 0xfa3b, 0xd933, 0xb933, 0x9933, 0x792b, 0x582b, 0x382b, 0x9722, 0x1200, 0x0000, 0xbff7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x0000, 0x34a5, 0x7def, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x0000, 0x1ce7, 0x3ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbad6, 0xcb5a, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0xb6b5, 0x5def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xfbde, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0xf100, 0x7612, 0x582b, 0x782b, 0x992b, 0xb933, 0xd933, 0xfa33, 0x1a3c, 0x3b3c, 0x5b44, 0x5b44, 0x7b4c, 0x9b4c, 0xbc4c, 0xdc54, 0xfc54, 0xfd54, 0x1d5d, 0x3d5d, 0x3d5d, 0x3d5d, 0x3d5d, 0x3d5d, 0x3d5d, 0x3d5d, 0x1d5d, 0x1d55, 0xfd54, 0xdc54, 0xdc54, 0xbc4c, 0x9c4c, 0x7b44, 0x5b44, 0x3a3c, 0x1a3c, 0xfa3b, 0xda33, 0xb933, 0x992b, 0x792b, 0x5923, 0x3823, 0x3723, 0x1823, 0xd400, 0x0000, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x0000, 0x14a5, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xfbde, 0x1ce7, 0x0000, 0xb6b5, 0x7def, 0x3ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3ce7, 0xae73, 0x0000, 0x8210, 0x8210, 0x8210, 0xe318, 0x0000, 0x2421, 0xbad6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xfbde, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0x5201, 0xf81a, 0x582b, 0x5823, 0x792b, 0x992b, 0xb933, 0xda33, 0xfa3b, 0x1a3c, 0x3a44, 0x5b44, 0x7b44, 0x7b4c, 0x9b4c, 0xbc4c, 0xdc54, 0xdc54, 0xfc54, 0xfc54, 0x1d5d, 0x1c5d, 0x1c5d, 0x1c5d, 0x1c5d, 0x1d5d, 0xfc54, 0xfc54, 0xdc54, 0xbc54, 0xbc4c, 0x9b4c, 0x7b4c, 0x5b44, 0x3b44, 0x3a3c, 0x1a3c, 0xfa3b, 0xd933, 0xb933, 0x992b, 0x792b, 0x5823, 0x3823, 0x1723, 0x1823, 0x9501, 0x0000, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x7def, 0x0000, 0xef7b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x79ce, 0xffff, 0x1ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9ef7, 0xdbde, 0x34a5, 0xcf7b, 0x4d6b, 0x4d6b, 0xeb5a, 0x0000, 0x4108, 0x4108, 0x0000, 0x0000, 0x0000, 0x0421, 0x0000, 0xf39c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xfbde, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0xd401, 0x181b, 0x3823, 0x5823, 0x792b, 0x992b, 0xb933, 0xb933, 0xda33, 0xfa3b, 0x1a3c, 0x3b3c, 0x5b44, 0x7b44, 0x7b4c, 0x9c4c, 0xbc4c, 0xbc4c, 0xdc54, 0xdc54, 0xfc54, 0xfc54, 0xfc54, 0xfc54, 0xfc54, 0xfc54, 0xdc54, 0xdc54, 0xbc4c, 0x9c4c, 0x9b4c, 0x7b44, 0x5b44, 0x5b44, 0x3a3c, 0x1a3c, 0xfa3b, 0xda33, 0xb933, 0x992b, 0x792b, 0x592b, 0x3823, 0x3823, 0x171b, 0xf722, 0xf601, 0x0000, 0xbef7, 0xbef7, 0x7ef7, 0x7def, 0x7def, 0x0000, 0xd39c, 0xdbde, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0x0000, 0xb6b5, 0xbef7, 0x1ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5def, 0x34a5, 0x8631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x0000, 0x3084, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xfbde, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0xf401, 0x171b, 0x3723, 0x3823, 0x582b, 0x792b, 0x992b, 0xb933, 0xda33, 0xfa3b, 0xfa3b, 0x1a3c, 0x3a44, 0x5b44, 0x7b44, 0x7b4c, 0x9b4c, 0x9c4c, 0xbc4c, 0xbc54, 0xdc54, 0xdc54, 0xdc54, 0xdc54, 0xdc54, 0xbc54, 0xbc4c, 0xbc4c, 0x9b4c, 0x9b4c, 0x7b44, 0x5b44, 0x5b44, 0x3b3c, 0x1a3c, 0xfa3b, 0xda33, 0xb933, 0x9933, 0x992b, 0x792b, 0x5923, 0x3823, 0x1823, 0xf71a, 0xf722, 0xf501, 0x0000, 0x9eef, 0x5de7, 0x1ce7, 0x1cdf, 0x3ce7, 0x0000, 0xd7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef7, 0x0000, 0xfbde, 0x3ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x5def, 0x3084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe318, 0x0000, 0x718c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x1ce7, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0xf401, 0xf71a, 0x1723, 0x3823, 0x5823, 0x782b, 0x992b, 0x992b, 0xb933, 0xda33, 0xfa3b, 0xfa3b, 0x1a3c, 0x3b44, 0x5b44, 0x5b44, 0x7b44, 0x7b4c, 0x9b4c, 0x9b4c, 0x9c4c, 0xbc4c, 0xbc4c, 0xbc4c, 0x9c4c, 0x9c4c, 0x9b4c, 0x9b4c, 0x7b44, 0x5b44, 0x5b44, 0x3b44, 0x3a3c, 0x1a3c, 0xfa3b, 0xfa33, 0xd933, 0xb933, 0x992b, 0x792b, 0x582b, 0x3823, 0x3823, 0x181b, 0xf71a, 0xf722, 0xd501, 0x0000, 0x5de7, 0xdbde, 0xdbde, 0xbad6, 0xfbde, 0x0000, 0x96b5, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0xbef7, 0xdfff, 0xbef7, 0xdfff, 0xdfff, 0x96b5, 0xdbde, 0x1ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5def, 0x3084, 0x0000, 0x2000, 0x0000, 0x494a, 0xd39c, 0xb6b5, 0xf7bd, 0x96b5, 0xa631, 0x0000, 0x8210, 0x2000, 0x2000, 0x8210, 0x4108, 0x0000, 0xd7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x1ce7, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0xd301, 0xd71a, 0x1723, 0x181b, 0x3823, 0x5823, 0x792b, 0x992b, 0x992b, 0xb933, 0xda33, 0xfa3b, 0xfa3b, 0x1a3c, 0x3a3c, 0x3a44, 0x5b44, 0x5b44, 0x5b44, 0x7b44, 0x7b4c, 0x7b4c, 0x7b4c, 0x7b4c, 0x7b4c, 0x7b44, 0x7b44, 0x5b44, 0x5b44, 0x3b44, 0x3b44, 0x1a3c, 0x1a3c, 0xfa3b, 0xfa33, 0xd933, 0xb933, 0x992b, 0x792b, 0x782b, 0x5823, 0x3823, 0x181b, 0xf71a, 0xd71a, 0xd71a, 0xb601, 0x0000, 0x5def, 0xdbde, 0xdbde, 0xbad6, 0x1ce7, 0x0000, 0x96b5, 0xdfff, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x0000, 0xdbde, 0x1ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x718c, 0x0000, 0xa210, 0x0000, 0xae73, 0x1ce7, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x96b5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7b, 0x5def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x1ce7, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0x7201, 0x9712, 0xf722, 0x171b, 0x1823, 0x3823, 0x582b, 0x792b, 0x992b, 0x9933, 0xb933, 0xda33, 0xfa33, 0xfa3b, 0x1a3c, 0x1a3c, 0x3a3c, 0x3b44, 0x5b44, 0x5b44, 0x5b44, 0x5b44, 0x5b44, 0x5b44, 0x5b44, 0x5b44, 0x3b44, 0x3b44, 0x3b44, 0x1b3c, 0x1a3c, 0x1a3c, 0xfa3b, 0xd933, 0xd933, 0xb933, 0x992b, 0x792b, 0x782b, 0x5823, 0x3823, 0x1823, 0xf71a, 0xd71a, 0xd71a, 0xd71a, 0x5501, 0x0000, 0x5de7, 0xdbde, 0xdbde, 0xbad6, 0xfbde, 0x0000, 0x75ad, 0x9ef7, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x5def, 0x5def, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x3ce7, 0x96b5, 0xdbde, 0x1ce7, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9ef7, 0xf39c, 0x0000, 0xc318, 0x0000, 0x8e73, 0x5def, 0x9ef7, 0xffff, 0xffff, 0xffff, 0xffff, 0x9ef7, 0x96b5, 0x494a, 0x0000, 0x0000, 0x6529, 0x718c, 0x1ce7, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x1ce7, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0x3201, 0x360a, 0xf71a, 0xf71a, 0x181b, 0x3823, 0x5823, 0x5823, 0x792b, 0x992b, 0x992b, 0xb933, 0xd933, 0xda33, 0xfa33, 0xfa3b, 0x1a3c, 0x1a3c, 0x1a3c, 0x3a3c, 0x3a3c, 0x3b44, 0x3b44, 0x3b44, 0x3b44, 0x3a3c, 0x3a3c, 0x1a3c, 0x1a3c, 0xfa3b, 0xfa3b, 0xfa33, 0xd933, 0xb933, 0xb933, 0x992b, 0x792b, 0x782b, 0x5823, 0x3823, 0x1823, 0xf71a, 0xf71a, 0xd71a, 0xb712, 0x971a, 0x9400, 0x0000, 0x5de7, 0xdbde, 0xbad6, 0xbad6, 0xfbde, 0x0000, 0x55ad, 0x7def, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x0000, 0xdbde, 0xfbde, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0xf39c, 0x0000, 0xc318, 0x0000, 0x2c63, 0x1ce7, 0x9ef7, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x7def, 0xbef7, 0xfbde, 0xf7bd, 0xd7bd, 0x9ad6, 0x7def, 0x7def, 0x5def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x1ce7, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0x3201, 0x7301, 0x971a, 0xf71a, 0xf71a, 0x181b, 0x3823, 0x3823, 0x5823, 0x792b, 0x792b, 0x992b, 0xb933, 0xb933, 0xd933, 0xd933, 0xfa33, 0xfa3b, 0xfa3b, 0x1a3c, 0x1a3c, 0x1a3c, 0x1a3c, 0x1a3c, 0x1a3c, 0x1a3c, 0x1a3c, 0xfa3b, 0xfa3b, 0xda33, 0xd933, 0xb933, 0xb933, 0x992b, 0x992b, 0x792b, 0x582b, 0x5823, 0x3823, 0x1823, 0x171b, 0xf71a, 0xd71a, 0xb612, 0xb712, 0x3612, 0x1200, 0x0000, 0x5de7, 0xbade, 0xbad6, 0x9ad6, 0xfbde, 0x0000, 0x34a5, 0x1ce7, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xfbde, 0x9ad6, 0x96b5, 0x3ce7, 0xfbde, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x5def, 0x9ad6, 0x96b5, 0x14a5, 0x34a5, 0xf7bd, 0xfbde, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x34a5, 0x0000, 0x0421, 0x0000, 0xeb5a, 0xfbde, 0x9ef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x1ce7, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0x5201, 0x3301, 0xd409, 0xb712, 0xf71a, 0xf71a, 0x171b, 0x3823, 0x3823, 0x5823, 0x782b, 0x792b, 0x992b, 0x992b, 0xb933, 0xb933, 0xda33, 0xda33, 0xda33, 0xd933, 0xfa33, 0xfa33, 0xfa33, 0xfa3b, 0xfa3b, 0xfa33, 0xda33, 0xda33, 0xda33, 0xba33, 0xb933, 0xb933, 0x992b, 0x792b, 0x792b, 0x582b, 0x5823, 0x3823, 0x1823, 0x181b, 0xf71a, 0xd71a, 0xb612, 0xb612, 0x560a, 0x9309, 0x1200, 0x0000, 0x3de7, 0xbad6, 0x9ad6, 0x9ad6, 0xdbde, 0x0000, 0xb294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9ad6, 0x9ef7, 0xdbde, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x79ce, 0x1084, 0xa631, 0x0000, 0x0000, 0x0000, 0x4108, 0xaa52, 0x34a5, 0x3ce7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9ef7, 0x96b5, 0x0000, 0xe318, 0x0000, 0x8a52, 0xfbde, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x3ce7, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0x5201, 0x5301, 0x7301, 0xf401, 0xb712, 0xd81a, 0xf71a, 0x171b, 0x1823, 0x3823, 0x3823, 0x5823, 0x782b, 0x792b, 0x792b, 0x992b, 0x992b, 0xb933, 0xb933, 0xb933, 0xb933, 0xd933, 0xd933, 0xb933, 0xb933, 0xb933, 0xb933, 0xb933, 0xb933, 0x992b, 0x992b, 0x792b, 0x792b, 0x782b, 0x5823, 0x3823, 0x3823, 0x1823, 0xf71a, 0xf71a, 0xd71a, 0xb712, 0xb712, 0x560a, 0x9301, 0x7309, 0x1200, 0x0000, 0x3de7, 0xbad6, 0x9ad6, 0x9ad6, 0xdbde, 0x0000, 0x75ad, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0x3ce7, 0x7def, 0x7def, 0xbad6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0x7def, 0xd7bd, 0x6529, 0x0000, 0x0000, 0x0000, 0x4108, 0x4108, 0x0000, 0x0000, 0x0000, 0x8e73, 0xfbde, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6b5, 0x0000, 0x6108, 0x0000, 0x2842, 0xbad6, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x7def, 0x7def, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x3ce7, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0x7201, 0x5301, 0x9301, 0x5301, 0xb401, 0x9712, 0xd81a, 0xf71a, 0xf71a, 0x181b, 0x1823, 0x3823, 0x5823, 0x5823, 0x582b, 0x792b, 0x792b, 0x792b, 0x992b, 0x992b, 0x992b, 0x9933, 0x9933, 0x992b, 0x992b, 0x992b, 0x992b, 0x992b, 0x792b, 0x792b, 0x792b, 0x592b, 0x5823, 0x3823, 0x3823, 0x1823, 0x181b, 0xf71a, 0xd71a, 0xd71a, 0xb712, 0x9712, 0x350a, 0x9301, 0x5301, 0x9309, 0x1200, 0x0000, 0x3de7, 0x9ad6, 0x9ad6, 0x79ce, 0xdbde, 0x0000, 0xf7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0x9ef7, 0x7def, 0x3ce7, 0x5def, 0xbad6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0x7def, 0x59ce, 0xc318, 0x0000, 0xa210, 0xa210, 0x4108, 0x2000, 0x2000, 0x6108, 0xa210, 0x2000, 0x0000, 0xae73, 0x5def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef7, 0xf7bd, 0x0000, 0x2000, 0x0000, 0xe739, 0xbad6, 0xbef7, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x0000, 0x0000, 0x7def, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x3ce7, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x0000, 0x7201, 0x3301, 0x7301, 0x7301, 0x5301, 0x9301, 0x350a, 0xb712, 0xf71a, 0xf81a, 0xf81a, 0x1823, 0x3823, 0x3823, 0x3823, 0x5823, 0x5823, 0x592b, 0x792b, 0x792b, 0x792b, 0x792b, 0x792b, 0x792b, 0x792b, 0x792b, 0x792b, 0x792b, 0x5823, 0x5923, 0x5923, 0x3823, 0x3823, 0x1823, 0x1723, 0xf71a, 0xf71a, 0xd71a, 0xd71a, 0xb712, 0x7612, 0xf401, 0x7301, 0x5301, 0x7401, 0x9309, 0x1200, 0x0000, 0x3de7, 0x9ad6, 0x9ad6, 0x79ce, 0xdbde, 0x0000, 0xd7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0xbad6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0x1ce7, 0x2c63, 0x0000, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x6108, 0x0000, 0x96b5, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef7, 0x38c6, 0x6108, 0x0000, 0x0000, 0xe318, 0x79ce, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x0000, 0x0000, 0x0000, 0x7def, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x3ce7, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x7201, 0x3301, 0x9301, 0x7301, 0x7301, 0x7301, 0x9301, 0xf501, 0x760a, 0xd71a, 0xf81a, 0xf71a, 0x171b, 0x1823, 0x1723, 0x3823, 0x3823, 0x3823, 0x5823, 0x5823, 0x5823, 0x5823, 0x582b, 0x582b, 0x5823, 0x5823, 0x5823, 0x3823, 0x3823, 0x3823, 0x3823, 0x1823, 0x181b, 0x171b, 0xf71a, 0xf71a, 0xd71a, 0xb712, 0x9612, 0x150a, 0x9301, 0x5301, 0x5301, 0x7301, 0x7301, 0x9309, 0x1200, 0x0000, 0x3de7, 0x9ad6, 0x7ad6, 0x79ce, 0xbad6, 0x0000, 0xd7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0xbad6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xd7bd, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x0000, 0xeb5a, 0x9ef7, 0xdfff, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x7def, 0xd7bd, 0x0421, 0x0000, 0x0000, 0x494a, 0xbad6, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x7def, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x3ce7, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x9201, 0x3301, 0x9301, 0x7301, 0x9401, 0xb401, 0xb401, 0xb401, 0xd401, 0x150a, 0x760a, 0xb712, 0xd71a, 0xf71a, 0xf71a, 0x171b, 0x1723, 0x1823, 0x1823, 0x3823, 0x3823, 0x3823, 0x3823, 0x3823, 0x3823, 0x3823, 0x1823, 0x1823, 0x1823, 0x171b, 0x171b, 0xf71a, 0xf71a, 0xf71a, 0xd71a, 0xb712, 0x7612, 0x350a, 0xd401, 0x9401, 0x7301, 0x7401, 0x7401, 0x7301, 0x7301, 0x9309, 0x1200, 0x0000, 0x3ce7, 0x79d6, 0x7ad6, 0x59ce, 0xbad6, 0x0000, 0xd7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x5def, 0x3ce7, 0x1ce7, 0x1ce7, 0x9ad6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0x9294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0xd39c, 0x55ad, 0x34a5, 0x34a5, 0x55ad, 0x34a5, 0x8e73, 0x0000, 0x0000, 0x4108, 0x0000, 0x8e73, 0x96b5, 0x34a5, 0x34a5, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x34a5, 0x34a5, 0x34a5, 0x34a5, 0x34a5, 0x34a5, 0x34a5, 0x14a5, 0x0000, 0x0000, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0x7def, 0xffff, 0xffff, 0x0000, 0x3ce7, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x9201, 0x3301, 0x9401, 0x9401, 0xb401, 0xb401, 0xd401, 0xf501, 0xf501, 0xf501, 0x1502, 0x350a, 0x560a, 0x9612, 0xb712, 0xd71a, 0xf71a, 0xf71a, 0xf71a, 0x181b, 0x181b, 0x181b, 0x181b, 0x181b, 0x181b, 0x181b, 0xf71a, 0xf71a, 0xf71a, 0xf71a, 0xd71a, 0xd71a, 0xb712, 0x9612, 0x560a, 0x350a, 0xf501, 0xd401, 0xb401, 0xb401, 0x9401, 0x7401, 0x7401, 0x7301, 0x7301, 0x9309, 0x1200, 0x0000, 0x3ce7, 0x79ce, 0x79ce, 0x59ce, 0xbad6, 0x0000, 0xf7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x3ce7, 0x1ce7, 0xfbde, 0xfbde, 0x9ad6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xef7b, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x6108, 0x2000, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x4108, 0x0000, 0x0000, 0x0421, 0x0000, 0x7def, 0xffff, 0x0000, 0x5def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x9201, 0x5401, 0xb409, 0xb401, 0xd401, 0xd501, 0xf501, 0xf501, 0x150a, 0x350a, 0x350a, 0x360a, 0x560a, 0x560a, 0x760a, 0x7612, 0x9612, 0xb612, 0xb712, 0xd712, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xb712, 0xb612, 0xb612, 0x9612, 0x760a, 0x560a, 0x350a, 0x150a, 0x1502, 0xf501, 0xf501, 0xd501, 0xd501, 0xb401, 0x9401, 0x9401, 0x7401, 0x7301, 0x9309, 0x1200, 0x0000, 0x3ce7, 0x79ce, 0x79ce, 0x59ce, 0xbad6, 0x0000, 0xf7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x3ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xdbde, 0x79ce, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xcf7b, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0xe318, 0x8210, 0xa210, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0xffff, 0x0000, 0x5def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0xb301, 0x7401, 0xd409, 0xd401, 0xf501, 0xf501, 0x1502, 0x350a, 0x350a, 0x560a, 0x560a, 0x760a, 0x760a, 0x7612, 0x9612, 0x9612, 0x9612, 0xb612, 0xb612, 0xb712, 0xb712, 0xb612, 0xb612, 0xb712, 0xb612, 0xb612, 0xb612, 0x9612, 0x9612, 0x9612, 0x7612, 0x760a, 0x560a, 0x560a, 0x550a, 0x350a, 0x350a, 0x150a, 0xf501, 0xf501, 0xd401, 0xb401, 0xb401, 0x9401, 0x7301, 0x9309, 0x1200, 0x0000, 0x1ce7, 0x59ce, 0x59ce, 0x59c6, 0x9ad6, 0x0000, 0x34a5, 0xdbde, 0xbad6, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x59ce, 0xf7bd, 0xd7bd, 0xb6b5, 0xb6b5, 0x79ce, 0xfbde, 0x79ce, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0x9294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0xae73, 0x3084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x0c63, 0x0000, 0x0000, 0x8210, 0x0000, 0x8a52, 0x718c, 0x1084, 0x1084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x3084, 0x1084, 0x1084, 0x3084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0xef7b, 0x0000, 0x0000, 0xc318, 0x2000, 0x0000, 0x0000, 0x0000, 0x7def, 0x7def, 0xffff, 0xffff, 0x0000, 0x5def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0xd301, 0x9401, 0xf509, 0xf501, 0x1502, 0x150a, 0x350a, 0x560a, 0x560a, 0x760a, 0x7612, 0x9612, 0x9612, 0x9612, 0xb712, 0xb712, 0xd712, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xd71a, 0xd712, 0xd712, 0xb712, 0xb612, 0xb712, 0x9612, 0x9612, 0x760a, 0x760a, 0x560a, 0x550a, 0x350a, 0x150a, 0x1502, 0xf501, 0xd501, 0xd401, 0xb401, 0x9401, 0x9409, 0x1200, 0x0000, 0x1ce7, 0x59ce, 0x59ce, 0x38c6, 0x9ad6, 0x0000, 0x9294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb6b5, 0x9ad6, 0x79ce, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xb6b5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0xaa52, 0x5def, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x7def, 0x96b5, 0xa210, 0x0000, 0x0000, 0x0842, 0x79ce, 0xdfff, 0x9ef7, 0xbef7, 0xbef7, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x5def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0xf401, 0xb501, 0x150a, 0x1502, 0x150a, 0x350a, 0x560a, 0x560a, 0x760a, 0x9612, 0x9612, 0xb612, 0xb712, 0xd712, 0xd71a, 0xd71a, 0xf71a, 0xf71a, 0xf71a, 0xf81a, 0xf71a, 0xf71a, 0xf71a, 0xf71a, 0xf71a, 0xf71a, 0xf71a, 0xf71a, 0xd71a, 0xd71a, 0xd712, 0xb712, 0xb712, 0x9612, 0x9612, 0x760a, 0x560a, 0x560a, 0x350a, 0x150a, 0x1502, 0xf501, 0xd501, 0xb401, 0xb401, 0xb409, 0x1200, 0x0000, 0x1ce7, 0x59ce, 0x59ce, 0x38c6, 0x9ad6, 0x0000, 0x9294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38c6, 0x79ce, 0x79ce, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0x1ce7, 0xcb5a, 0x0000, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x0000, 0x55ad, 0xdfff, 0x7def, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xdfff, 0xffff, 0x38c6, 0x4108, 0x0000, 0x0000, 0xc739, 0xbad6, 0xdfff, 0x9ef7, 0xbef7, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x0000, 0x0000, 0x0000, 0x7def, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x5def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x3402, 0xb501, 0x350a, 0x3502, 0x350a, 0x560a, 0x760a, 0x7612, 0x9612, 0xb712, 0xb712, 0xd712, 0xd71a, 0xf71a, 0xf71a, 0xf71a, 0x181b, 0x1823, 0x1823, 0x1823, 0x3823, 0x1823, 0x1823, 0x1823, 0x1823, 0x1823, 0x1823, 0x181b, 0xf71a, 0xf71a, 0xf71a, 0xd71a, 0xd71a, 0xb712, 0xb712, 0x9612, 0x7612, 0x760a, 0x560a, 0x360a, 0x350a, 0x1502, 0xf501, 0xd501, 0xb401, 0xb409, 0x3300, 0x0000, 0x1cdf, 0x59ce, 0x59ce, 0x38c6, 0x9ad6, 0x0000, 0x75ad, 0xfbde, 0xdbde, 0xfbde, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xdbde, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xdbde, 0xbad6, 0x79ce, 0xbad6, 0x59ce, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0x9ef7, 0x18c6, 0x0000, 0x0000, 0xe318, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x0421, 0x0000, 0x2c63, 0x5def, 0x9ef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7bd, 0x0000, 0x6108, 0x0000, 0x2842, 0xdbde, 0xdfff, 0x9ef7, 0x9ef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x0000, 0x0000, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x5def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x540a, 0xd501, 0x3612, 0x550a, 0x560a, 0x760a, 0x9612, 0x9612, 0xb712, 0xd71a, 0xd71a, 0xf71a, 0xf81a, 0x181b, 0x1823, 0x1823, 0x3823, 0x3823, 0x3823, 0x5823, 0x5823, 0x5823, 0x5823, 0x5823, 0x5823, 0x5823, 0x3823, 0x3823, 0x3823, 0x1823, 0x171b, 0xf71a, 0xf71a, 0xd71a, 0xd71a, 0xb712, 0x9712, 0x9612, 0x760a, 0x560a, 0x360a, 0x350a, 0x1502, 0xf501, 0xd501, 0xd509, 0x5300, 0x0000, 0x1cdf, 0x38c6, 0x39ce, 0x18c6, 0x79ce, 0x0000, 0xf7bd, 0xdfff, 0x5def, 0x5def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0x0000, 0x0000, 0x9ad6, 0x9ad6, 0x9ad6, 0x59ce, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0x5def, 0x9ef7, 0x75ad, 0x0000, 0x0000, 0x2000, 0x8210, 0xa210, 0xa210, 0x8210, 0x0000, 0x0000, 0xeb5a, 0xdbde, 0xbef7, 0x9ef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9ef7, 0xdfff, 0xb6b5, 0x0000, 0xa210, 0x0000, 0x8a52, 0xfbde, 0xdfff, 0x9ef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x7def, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x5def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x540a, 0xf501, 0x5612, 0x560a, 0x760a, 0x9612, 0xb712, 0xb712, 0xd71a, 0xd71a, 0xf71a, 0x171b, 0x1723, 0x3823, 0x3823, 0x5823, 0x5823, 0x582b, 0x782b, 0x792b, 0x792b, 0x792b, 0x792b, 0x792b, 0x792b, 0x792b, 0x592b, 0x5823, 0x5823, 0x3823, 0x3823, 0x1823, 0x171b, 0xf71a, 0xf71a, 0xd71a, 0xb712, 0xb712, 0x9612, 0x760a, 0x560a, 0x360a, 0x350a, 0x1502, 0xf501, 0xf509, 0x9300, 0x0000, 0x1cdf, 0x38c6, 0x38c6, 0x18c6, 0x79ce, 0x0000, 0x18c6, 0xffff, 0xbef7, 0x9ef7, 0xbef7, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0x7def, 0x3ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x59ce, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x38c6, 0x6d6b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0xd39c, 0x3ce7, 0xbef7, 0x9ef7, 0x9ef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0x96b5, 0x0000, 0xe318, 0x0000, 0xeb5a, 0x5def, 0xdfff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x5def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x750a, 0x1502, 0x7612, 0x760a, 0x9612, 0xb712, 0xb712, 0xd71a, 0xf71a, 0xf71a, 0x1823, 0x3823, 0x3823, 0x5823, 0x582b, 0x792b, 0x792b, 0x792b, 0x992b, 0x992b, 0x992b, 0x992b, 0x992b, 0x992b, 0x992b, 0x992b, 0x792b, 0x792b, 0x792b, 0x582b, 0x5823, 0x3823, 0x3823, 0x1823, 0x181b, 0xf71a, 0xd71a, 0xb712, 0xb712, 0x9612, 0x760a, 0x560a, 0x360a, 0x350a, 0x150a, 0x150a, 0xb400, 0x0000, 0x1cdf, 0x38c6, 0x38c6, 0x18c6, 0x79ce, 0x0000, 0x18c6, 0xffff, 0xdfff, 0xbef7, 0xbef7, 0xdfff, 0xffff, 0xdfff, 0xbef7, 0x5def, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x79ce, 0x9ad6, 0x59ce, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9ef7, 0x5def, 0x59ce, 0x55ad, 0x3084, 0x9294, 0xd7bd, 0xdbde, 0x9ef7, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x14a5, 0x0000, 0xe318, 0x0000, 0x6d6b, 0x5def, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x7def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x7512, 0x3502, 0x9612, 0x9612, 0xb712, 0xb712, 0xd71a, 0xf71a, 0x171b, 0x1823, 0x3823, 0x5823, 0x582b, 0x782b, 0x792b, 0x992b, 0x992b, 0xb933, 0xb933, 0xb933, 0xb933, 0xb933, 0xb933, 0xb933, 0xb933, 0xb933, 0xb933, 0x992b, 0x992b, 0x792b, 0x792b, 0x592b, 0x5823, 0x3823, 0x3823, 0x171b, 0xf71a, 0xd71a, 0xb712, 0xb712, 0x9612, 0x760a, 0x560a, 0x360a, 0x150a, 0x150a, 0xd400, 0x0000, 0x1cdf, 0x18c6, 0x18c6, 0xf7bd, 0x79ce, 0x0000, 0x18c6, 0xffff, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x7def, 0x5def, 0x3ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x79ce, 0x79ce, 0x38c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9ef7, 0x7def, 0x9ef7, 0xbef7, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef7, 0xd39c, 0x0000, 0xa210, 0x0000, 0x8e73, 0x7def, 0xdfff, 0x9ef7, 0xbef7, 0xbef7, 0x7def, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0x1ce7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x9512, 0x3602, 0x9612, 0xb612, 0xb712, 0xd71a, 0xf71a, 0x181b, 0x3823, 0x3823, 0x5823, 0x792b, 0x792b, 0x992b, 0x9933, 0xb933, 0xba33, 0xda33, 0xda33, 0xda33, 0xda33, 0xfa33, 0xfa3b, 0xfa33, 0xda33, 0xda33, 0xda33, 0xd933, 0xb933, 0xb933, 0x992b, 0x992b, 0x792b, 0x5823, 0x3823, 0x3823, 0x1823, 0xf71a, 0xd71a, 0xd712, 0xb712, 0x9612, 0x760a, 0x560a, 0x360a, 0x350a, 0xf400, 0x0000, 0x1cdf, 0x18c6, 0x18c6, 0xf7bd, 0x59ce, 0x0000, 0x18c6, 0xdfff, 0xbef7, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x3ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x79ce, 0x79ce, 0x79ce, 0x38c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xd39c, 0x0000, 0xa210, 0x0000, 0xef7b, 0xbef7, 0xdfff, 0xbef7, 0xbef7, 0x79ce, 0x0000, 0xa210, 0xa210, 0x8210, 0x8210, 0x8210, 0x4529, 0x0000, 0x518c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x7def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0x9512, 0x5602, 0xb71a, 0xb712, 0xd712, 0xf81a, 0x181b, 0x3823, 0x5823, 0x5923, 0x792b, 0x992b, 0x992b, 0xb933, 0xda33, 0xda33, 0xfa33, 0xfa33, 0xfa3b, 0x1a3c, 0x1a3c, 0x1a3c, 0x1a3c, 0x1a3c, 0x1a3c, 0xfa3b, 0xfa33, 0xfa33, 0xda33, 0xda33, 0xb933, 0x992b, 0x992b, 0x792b, 0x5923, 0x5823, 0x3823, 0x181b, 0xf81a, 0xd71a, 0xb712, 0x9712, 0x960a, 0x760a, 0x560a, 0x3512, 0x3401, 0x0000, 0xfcde, 0x17c6, 0x17c6, 0xf7bd, 0x59ce, 0x0000, 0x18c6, 0xdfff, 0x9ef7, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x3ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x59ce, 0x59ce, 0x38c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef7, 0xdfff, 0xbef7, 0x518c, 0x0000, 0xa210, 0x0000, 0x1084, 0x7def, 0xffff, 0xdfff, 0x9ad6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x0000, 0x1084, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x7def, 0xffff, 0xdfff, 0xffff, 0xffff, 0x0000, 0xd51a, 0x7602, 0xd71a, 0xd71a, 0xf71a, 0x1723, 0x3823, 0x3823, 0x582b, 0x782b, 0x9833, 0xb933, 0xb933, 0xd93b, 0xf93b, 0xf93b, 0x1a3c, 0x1a3c, 0x1a44, 0x1a44, 0x3a44, 0x3a44, 0x3a44, 0x3a44, 0x3a44, 0x1a44, 0x1a3c, 0x1a3c, 0xfa3b, 0xf93b, 0xd93b, 0xb933, 0xb933, 0x9933, 0x782b, 0x582b, 0x582b, 0x3823, 0x1723, 0xf71a, 0xd71a, 0xb61a, 0x9612, 0x7612, 0x5612, 0x3512, 0x3401, 0x0000, 0xfcde, 0x17be, 0x17c6, 0xf7bd, 0x39ce, 0x0000, 0x18c6, 0xdfff, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x3ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x38c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef7, 0xdfff, 0x9ef7, 0x1084, 0x0000, 0x8210, 0x0000, 0x2c63, 0xf7bd, 0x79ce, 0x75ad, 0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0xc318, 0x0000, 0x3084, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x7def, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0x0000, 0xd61a, 0x960a, 0xd722, 0xf71a, 0x1823, 0x3823, 0x582b, 0x792b, 0x792b, 0x9933, 0xb933, 0xd933, 0xda3b, 0xfa3b, 0x1a3c, 0x1a3c, 0x3b44, 0x3b44, 0x3b44, 0x5b44, 0x5b44, 0x5b44, 0x5b44, 0x5b44, 0x5b44, 0x5b44, 0x3b44, 0x3b44, 0x3a3c, 0x1a3c, 0xfa3b, 0xda33, 0xd933, 0xb933, 0x9933, 0x792b, 0x782b, 0x5823, 0x3823, 0x1723, 0xf71a, 0xd71a, 0xb71a, 0x9712, 0x7612, 0x5612, 0x7501, 0x0000, 0xfcde, 0xf7bd, 0xf7bd, 0xd7bd, 0x38c6, 0x0000, 0x18c6, 0xbef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x5def, 0x1ce7, 0x1ce7, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x59ce, 0x59ce, 0x38c6, 0x38c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xbef7, 0xffff, 0x9ef7, 0xef7b, 0x0000, 0x0000, 0x0000, 0x0000, 0xa210, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x0000, 0x3084, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x5def, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0x0000, 0x5502, 0xd501, 0x5602, 0x7702, 0x9702, 0xb702, 0xf802, 0x1803, 0x3803, 0x590b, 0x790b, 0x9913, 0xba1b, 0xda23, 0xda23, 0xfa23, 0x1a2c, 0x1a2c, 0x3b2c, 0x3b34, 0x3b34, 0x3b34, 0x3b34, 0x3b34, 0x3b34, 0x3b34, 0x1a2c, 0x1a2c, 0xfa2b, 0xda23, 0xda1b, 0xb91b, 0x9913, 0x7913, 0x590b, 0x3803, 0x1803, 0xf802, 0xd702, 0x9702, 0x7702, 0x5602, 0x3602, 0xf601, 0xd501, 0xb501, 0x1400, 0x0000, 0xfcde, 0xf7bd, 0xf7bd, 0xd7bd, 0x38c6, 0x0000, 0x18c6, 0xbef7, 0x9ef7, 0x7def, 0x5def, 0x5def, 0x3ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x38c6, 0x38c6, 0x38c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xbef7, 0xdfff, 0x9ef7, 0x14a5, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc318, 0x0000, 0x3084, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x5def, 0xffff, 0xbef7, 0xdfff, 0xdeff, 0x7def, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0xfbde, 0xd7bd, 0xf7bd, 0xd7bd, 0x38c6, 0x0000, 0x18c6, 0x9ef7, 0x7def, 0x5def, 0x5def, 0x5def, 0x3ce7, 0x1ce7, 0x1ce7, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x38c6, 0x18c6, 0x18c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0xdfff, 0xdfff, 0xdbde, 0x14a5, 0x6d6b, 0xeb5a, 0x494a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa210, 0x0000, 0x3084, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x5def, 0xffff, 0xbef7, 0xbeff, 0xbff7, 0xdff7, 0xfff7, 0xdff7, 0xdff7, 0xdff7, 0xdff7, 0xdff7, 0xbff7, 0xbff7, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbeef, 0xbeef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x9eef, 0x7eef, 0x7eef, 0x7def, 0x7def, 0x7def, 0x5def, 0x5de7, 0x5de7, 0x5de7, 0x5de7, 0x5de7, 0x5de7, 0x5de7, 0x3de7, 0x3de7, 0x3de7, 0x3ce7, 0x3ce7, 0x3cdf, 0x1cdf, 0x1cdf, 0x1cdf, 0x1cdf, 0x1cdf, 0x1cdf, 0xfbde, 0x79ce, 0xd7bd, 0xf7bd, 0xd6b5, 0x18c6, 0x0000, 0xf7bd, 0x7def, 0x7def, 0x7def, 0x3ce7, 0x9ad6, 0x38c6, 0x59ce, 0x9ad6, 0xfbde, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x79ce, 0x59ce, 0x38c6, 0x18c6, 0x18c6, 0x18c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0xdfff, 0xffff, 0xffff, 0x9ef7, 0x7def, 0x18c6, 0x0000, 0xc318, 0xa210, 0xa210, 0xa210, 0x8210, 0x4529, 0x0000, 0x518c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x1ce7, 0xffff, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x7eef, 0x7def, 0x7def, 0x5def, 0x5def, 0x5de7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1cdf, 0x1cdf, 0xfcde, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xdbde, 0xdbd6, 0xbad6, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x7ace, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x59c6, 0x59c6, 0x38c6, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0x18be, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xd7bd, 0xd7bd, 0xd7bd, 0xf7bd, 0xf7bd, 0xb6b5, 0x38c6, 0x0000, 0x38c6, 0xbef7, 0x7def, 0x9ad6, 0x55ad, 0x1084, 0x8e73, 0xef7b, 0x9294, 0xd7bd, 0xbad6, 0xdbde, 0xbad6, 0x9ad6, 0x59ce, 0x59ce, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0x18c6, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0xdfff, 0xffff, 0xffff, 0x79ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xf7bd, 0xffff, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x7df7, 0x7def, 0x7def, 0x7def, 0x5def, 0x5def, 0x5def, 0x5cef, 0x3ce7, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1be7, 0xfbe6, 0xfbe6, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xdade, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x79d6, 0x79d6, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x59ce, 0x58ce, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0x17c6, 0x17c6, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0x75ad, 0x0000, 0x18c6, 0x38c6, 0x1ce7, 0x79ce, 0xb294, 0x8e73, 0xcf7b, 0x718c, 0xef7b, 0x4d6b, 0xae73, 0x55ad, 0x18c6, 0x18c6, 0x38c6, 0x79ce, 0x59ce, 0x38c6, 0x18c6, 0x18c6, 0xf7bd, 0xf7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xffff, 0xbef7, 0xbad6, 0xaa52, 0xeb5a, 0xeb5a, 0xeb5a, 0xeb5a, 0xeb5a, 0x2c63, 0x2842, 0xf39c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xbef7, 0xffff, 0x7def, 0x7def, 0x7def, 0x7def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5de7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1cdf, 0xfcde, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xdbde, 0xdad6, 0xbad6, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x59ce, 0x38c6, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0x18be, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0x96b5, 0x0000, 0xdbde, 0xd39c, 0x718c, 0xb294, 0x718c, 0xae73, 0xb294, 0x79ce, 0xdbde, 0x79ce, 0xf39c, 0x8e73, 0xae73, 0xcf7b, 0x8e73, 0xef7b, 0x14a5, 0x38c6, 0x18c6, 0x18c6, 0xf7bd, 0xf7bd, 0xf7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3084, 0x0000, 0x7def, 0x7def, 0x7def, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9ef7, 0x9eef, 0x5def, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xdbde, 0xbbd6, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x7ace, 0x79ce, 0x79ce, 0x79ce, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x59ce, 0x38c6, 0x18c6, 0x18c6, 0xf7bd, 0x18c6, 0x0000, 0xfbde, 0x55ad, 0xed73, 0x2d64, 0x0f7c, 0xef7b, 0x1084, 0x38c6, 0x1ce7, 0xfbde, 0x1ce7, 0x79ce, 0x518c, 0x8e73, 0xae73, 0x3084, 0x6d6b, 0x2c63, 0x14a5, 0x38c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xf7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9294, 0x0000, 0x55ad, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0x18c6, 0x18c6, 0x9ad6, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x18c6, 0x96b5, 0x96b5, 0x96b5, 0x96b5, 0x96b5, 0x96b5, 0x96b5, 0x96b5, 0x96b5, 0x18c6, 0x59ce, 0x38c6, 0x38c6, 0x0000, 0x0000, 0x149d, 0xae7b, 0x2845, 0xe635, 0x0c64, 0x6e73, 0xd39c, 0x79ce, 0x9ad6, 0x9ad6, 0x9ad6, 0x79ce, 0x14a5, 0x4d6b, 0x14a5, 0x00f8, 0x00f8, 0xeb5a, 0x3084, 0x18c6, 0xf7bd, 0xd7bd, 0xd7bd, 0xf7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x18c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96b5, 0xd7bd, 0xb6b5, 0xb6b5, 0x96b5, 0x96b5, 0x96b5, 0x96b5, 0x96b5, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x34a5, 0x55ad, 0xb294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbad6, 0x34a5, 0x6e73, 0x2a55, 0x863d, 0xcc63, 0x2d6b, 0xf39c, 0x79ce, 0x9ad6, 0xbad6, 0x9ad6, 0x79ce, 0x55ad, 0x2c63, 0x9294, 0x00f8, 0x00f8, 0xaa52, 0x518c, 0x18c6, 0xf7bd, 0xd7bd, 0xd7bd, 0xf7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x96b5, 0x0000, 0x38c6, 0xfbde, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x38c6, 0x38c6, 0x38c6, 0x18c6, 0xf7bd, 0xf7bd, 0xf7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0x96b5, 0xd7bd, 0x718c, 0x0000, 0xb294, 0xb6b5, 0x38c6, 0x59ce, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x0000, 0x5def, 0xdfff, 0x9ef7, 0x9ef7, 0xbef7, 0xdad6, 0x1084, 0xec5a, 0x2c5b, 0xeb5a, 0xcb5a, 0x518c, 0x9ad6, 0x3ce7, 0x3ce7, 0x1ce7, 0xbad6, 0xb294, 0xeb5a, 0xeb5a, 0xeb5a, 0xaa52, 0x2c63, 0x75ad, 0x18c6, 0xd7bd, 0xd7bd, 0xb6b5, 0xf7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x55ad, 0x6d6b, 0x0000, 0x0000, 0x96b5, 0x1ce7, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0xbad6, 0x9ad6, 0xbad6, 0x9ad6, 0xbad6, 0x9ad6, 0xd39c, 0x14a5, 0x0000, 0x0000, 0x0000, 0x55ad, 0x38c6, 0xffff, 0xffff, 0xffff, 0x96b5, 0x0000, 0x5def, 0xdfff, 0x9ef7, 0x9ef7, 0x5def, 0x7def, 0x9ad6, 0x14a5, 0x518c, 0x518c, 0x8e73, 0x0000, 0xf39c, 0xfbde, 0x7def, 0x1ce7, 0x75ad, 0xeb5a, 0x0c63, 0xef7b, 0xcf7b, 0x518c, 0x96b5, 0x18c6, 0xd7bd, 0xd7bd, 0xb6b5, 0xb6b5, 0xd7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x34a5, 0x0000, 0x0000, 0x0000, 0x7def, 0xbef7, 0x55ad, 0x59ce, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x5def, 0xd7bd, 0xd7bd, 0xffff, 0xdfff, 0xfbde, 0x14a5, 0x0000, 0x0000, 0x34a5, 0x38c6, 0xffff, 0x75ad, 0x0000, 0x3ce7, 0xbef7, 0x7def, 0x7def, 0x5def, 0x3ce7, 0x5def, 0x3ce7, 0xfbde, 0xfbde, 0x79ce, 0xcf7b, 0x0000, 0x6d6b, 0x3084, 0xae73, 0x0000, 0x2c63, 0x96b5, 0x59ce, 0x18c6, 0x18c6, 0x18c6, 0xd7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0x96b5, 0xd7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x79ce, 0xffff, 0xffff, 0xffff, 0xffff, 0x5def, 0x75ad, 0xdbde, 0x7def, 0x5def, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5def, 0x5def, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5def, 0x7def, 0x79ce, 0xb6b5, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0x9ef7, 0xb6b5, 0x0000, 0x518c, 0x59ce, 0x96b5, 0x0000, 0x3ce7, 0x9ef7, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0xfbde, 0x79ce, 0xf39c, 0x8e73, 0x0000, 0x4d6b, 0x718c, 0xd7bd, 0x59ce, 0x38c6, 0x18c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0xb6b5, 0x96b5, 0xd7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xb294, 0xdfff, 0xffff, 0xffff, 0xdfff, 0xffff, 0xffff, 0xffff, 0x5def, 0xd7bd, 0xbad6, 0x7def, 0xbef7, 0x9ef7, 0x9ef7, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x9ef7, 0x9ef7, 0xbef7, 0x7def, 0x59ce, 0x96b5, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xffff, 0xffff, 0x3ce7, 0x0000, 0x1084, 0x96b5, 0x0000, 0x3ce7, 0x9ef7, 0x5def, 0x5def, 0x3ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xbad6, 0xdbde, 0xdbde, 0x79ce, 0x18c6, 0x38c6, 0x79ce, 0x59ce, 0x18c6, 0x18c6, 0x18c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xb6b5, 0xb6b5, 0x96b5, 0x96b5, 0xd7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xb294, 0xffff, 0xffff, 0xdfff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0x5def, 0x59ce, 0x79ce, 0xfbde, 0x9ef7, 0xdfff, 0xdfff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0x7def, 0xdbde, 0x18c6, 0xb6b5, 0x79ce, 0xbad6, 0xfbde, 0xbef7, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x9ef7, 0x0000, 0x1084, 0x0000, 0x3ce7, 0x7def, 0x5def, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x79ce, 0x38c6, 0x18c6, 0x18c6, 0x18c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0x96b5, 0x96b5, 0x75ad, 0xb6b5, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x9ef7, 0xffff, 0xbef7, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0x9ef7, 0x7def, 0x9ef7, 0x7def, 0xfbde, 0x79ce, 0x79ce, 0xbad6, 0x1ce7, 0x5def, 0x7def, 0x7def, 0x7def, 0x5def, 0xfbde, 0x9ad6, 0x38c6, 0xf7bd, 0x38c6, 0x79ce, 0x59ce, 0x18c6, 0xf7bd, 0xdbde, 0xffff, 0xdfff, 0xdfff, 0xdfff, 0xdfff, 0xbef7, 0xffff, 0x59ce, 0x0000, 0x0000, 0x1ce7, 0x7def, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x59ce, 0x38c6, 0x38c6, 0x38c6, 0x18c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0xb6b5, 0x96b5, 0x96b5, 0x55ad, 0xb6b5, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0xef7b, 0xdfff, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0xbef7, 0x9ef7, 0x7def, 0x7def, 0x5def, 0x5def, 0x5def, 0x3ce7, 0xdbde, 0x9ad6, 0x79ce, 0x59ce, 0x59ce, 0x59ce, 0x59ce, 0x38c6, 0x18c6, 0x18c6, 0x38c6, 0x59ce, 0x59ce, 0x18c6, 0x18c6, 0x38c6, 0x9ad6, 0x5def, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0xbef7, 0x9ef7, 0xdfff, 0x1ce7, 0x0000, 0x0000, 0x3ce7, 0x5def, 0x3ce7, 0x3ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xb6b5, 0xb6b5, 0x96b5, 0x96b5, 0x75ad, 0x55ad, 0xb6b5, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7bd, 0x0000, 0x5def, 0x9ef7, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x5def, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xdbde, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x79ce, 0x9ad6, 0xbad6, 0xfbde, 0x3ce7, 0x7def, 0x9ef7, 0x7def, 0x7def, 0x7def, 0x7def, 0x7def, 0x5def, 0xdfff, 0x38c6, 0x0000, 0x0000, 0x1ce7, 0x5def, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x38c6, 0x38c6, 0x18c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0x96b5, 0x96b5, 0x75ad, 0x75ad, 0x55ad, 0xb6b5, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xb294, 0x9ef7, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5def, 0x7def, 0x7def, 0x7def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x5def, 0x7def, 0x5def, 0x0000, 0x6d6b, 0x0000, 0x1ce7, 0x5def, 0x1ce7, 0x1ce7, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x59ce, 0x59ce, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0xf7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0xb6b5, 0x96b5, 0x75ad, 0x75ad, 0x55ad, 0x55ad, 0xb6b5, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x38c6, 0x0000, 0xb294, 0x3ce7, 0x5def, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5def, 0x3ce7, 0x5def, 0x5def, 0x5def, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x3ce7, 0x5def, 0xbad6, 0x0000, 0x0000, 0x75ad, 0x0000, 0x1ce7, 0x3ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0x96b5, 0x96b5, 0x75ad, 0x55ad, 0x55ad, 0x34a5, 0xb6b5, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1ce7, 0x18c6, 0x0000, 0x0000, 0xf7bd, 0xfbde, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3ce7, 0x3ce7, 0xdbde, 0x55ad, 0x0000, 0x0000, 0x18c6, 0x7def, 0x0000, 0x1ce7, 0x3ce7, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xbad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xb6b5, 0xb6b5, 0x96b5, 0x96b5, 0x75ad, 0x55ad, 0x55ad, 0x55ad, 0x14a5, 0xd7bd, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x3084, 0x0000, 0x0000, 0x96b5, 0x9ad6, 0xfbde, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xdbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0x1ce7, 0xfbde, 0xdbde, 0x38c6, 0x14a5, 0x0000, 0x0000, 0x0000, 0x38c6, 0x7def, 0xffff, 0x0000, 0x9ad6, 0x7def, 0xfbde, 0xfbde, 0xdbde, 0xbad6, 0xbad6, 0x9ad6, 0x79ce, 0x79ce, 0x59ce, 0x38c6, 0x38c6, 0x18c6, 0x18c6, 0xf7bd, 0xf7bd, 0xd7bd, 0xb6b5, 0xb6b5, 0x96b5, 0x75ad, 0x75ad, 0x55ad, 0x34a5, 0x34a5, 0x14a5, 0x96b5, 0x59ce, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x18c6, 0xcf7b, 0x0000, 0x0000, 0xef7b, 0x14a5, 0xd7bd, 0x59ce, 0xbad6, 0xdbde, 0xdbde, 0xfbde, 0xfbde, 0xfbde, 0xfbde, 0xdbde, 0xfbde, 0xfbde, 0xdbde, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xdbde, 0xbad6, 0x9ad6, 0x38c6, 0xb6b5, 0xd39c, 0x0000, 0x0000, 0x0000, 0x0000, 0xd7bd, 0x59ce, 0xffff, 0xffff, 0xffff, 0x0000, 0x518c, 0xfbde, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xfbde, 0xfbde, 0xdbde, 0xdbde, 0xdbde, 0xbad6, 0xbad6, 0xbad6, 0x9ad6, 0x9ad6, 0x9ad6, 0x79ce, 0x79ce, 0x79ce, 0x59ce, 0x59ce, 0x59ce, 0x38c6, 0x38c6, 0x38c6, 0x9ad6, 0xf39c, 0x0000, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfbde, 0xfbde, 0x59ce, 0x14a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084, 0xb294, 0x34a5, 0x96b5, 0xb6b5, 0xd7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xd7bd, 0xd7bd, 0xb6b5, 0x75ad, 0x14a5, 0x9294, 0xef7b, 0x4d6b, 0x0000, 0x0000, 0x0000, 0x0000, 0x14a5, 0x18c6, 0x79ce, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x0000, 0x1084, 0x34a5, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x55ad, 0x75ad, 0x75ad, 0x55ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x55ad, 0x75ad, 0x9294, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
+        0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfbde, 0x79ce, 0xb6b5, 0xd39c, 0xcf7b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd39c, 0x96b5, 0x38c6, 0x79ce, 0x79ce, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7def, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7def, 0xffff, 0xffff, 0xffff, 0xffff,
         0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
         0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
         0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
@@ -193,5 +195,5 @@ static const uint16_t image_data_usb_ico[12800] = {
 };
 const tImage_RGB usb_to_pc = {image_data_usb_ico, 160, 80,
 
-                              16 };
+                              16, IMAGE_RGB_BIG_ENDIAN };
 
@@ -18,28 +18,114 @@
 #include "st7735s.h"
 #include "st7735s_settings.h"
 #include "delay.h"
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 #define DELAY 0x80
 
+#define ST7735S_BUFFER_INDEXED ((ST7735S_BUFFER_BPP != 16) && (ST7735S_BUFFER_BPP != 0))
+#define LINE_SIZE ((ST7735_WIDTH > ST7735_HEIGHT) ? ST7735_WIDTH : ST7735_HEIGHT)
+/** Frame memory lines along the scroll axis, the ST7735_WIDTH panel lines are centered in them */
+#define ST7735S_FRAME_LINES (ST7735_WIDTH + 2 * ST7735_XSTART)
+
+#if (ST7735S_BUFFER_BPP == 16)
 static uint16_t ScreenBuff[ST7735_WIDTH * ST7735_HEIGHT] = {0};
+#define SCREEN_TARGET ScreenBuff
+#elif (ST7735S_BUFFER_BPP == 0)
+#define SCREEN_TARGET NULL
+
+/** Span being drawn, and fill pattern */
+static uint16_t LineBuff[2][LINE_SIZE];
+/** Address window of the running memory write, spans which continue it are sent without a new window */
+static struct {
+    bool open;
+    int16_t x;
+    int16_t width;
+    int16_t next_y;
+    /** LineBuff[1] is filled with fill_color, when fill_size != 0 */
+    uint16_t fill_color;
+    uint16_t fill_size;
+} Stream;
+#else
+/** Palette indexed screen buffer, expanded through the palette on update */
+static uint8_t ScreenBuff[ST7735_WIDTH * ST7735_HEIGHT * ST7735S_BUFFER_BPP / 8] = {0};
+#define SCREEN_TARGET NULL
+#define PALETTE_SIZE (1 << ST7735S_BUFFER_BPP)
+#define INDEX_CACHE_SIZE 32
+
+/** Palette colors in panel byte order */
+static uint16_t Palette[PALETTE_SIZE];
+/** RGB565 span of the indexed buffer while drawing, ping-pong lines while updating */
+static uint16_t LineBuff[2][LINE_SIZE];
+/** Recently mapped colors, key is color | 0x10000 */
+static uint32_t IndexCacheKey[INDEX_CACHE_SIZE];
+static uint8_t IndexCacheValue[INDEX_CACHE_SIZE];
+#endif
+#if (ST7735S_BUFFER_BPP == 1)
+/** Two expanded pixels for each 2 bit combination of the mono buffer, high bit first */
+static uint32_t MonoPairs[4];
+#endif
 
 static LCD_ST7735_ctx_t LCD_ST7735_ctx = {0};
 
+/** Clip rectangle in screen coordinates, x1 and y1 are exclusive */
+typedef struct {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+} LCD_ST7735_rect_t;
+
+typedef struct {
+    LCD_ST7735_rect_t clip;
+    int16_t offset_x;
+    int16_t offset_y;
+} LCD_ST7735_clip_t;
+
 typedef struct ST7735s{
     uint8_t width;
     uint8_t height;
     uint8_t xstart;
     uint8_t ystart;
+    /** drawing target, user canvas or SCREEN_TARGET (NULL for indexed screen buffer) */
+    uint16_t *target;
+    int16_t target_width;
+    int16_t target_height;
+    /** drawing state: clip rectangle and translate offset, saved by LCD_ST7735S_PushClip */
+    LCD_ST7735_clip_t state;
+    uint8_t clip_depth;
+    LCD_ST7735_clip_t clip_stack[ST7735S_CLIP_DEPTH];
+    /** optional cache of opaque text glyphs */
+    LCD_ST7735S_GlyphCache_t *glyph_cache;
+    /** hardware scroll: the panel lines run along x in LCD_R0 and LCD_R180, along y otherwise */
+    bool scroll_vertical;
+    bool scroll_reverse;        /** first panel line is at the right or bottom edge */
+    uint8_t scroll_first;       /** panel line of the scroll area start (top fixed area) */
+    uint8_t scroll_lines;       /** lines of the scroll area */
 } LCD_ST7735_t;
 
 static LCD_ST7735_t LCD_ST7735 = {
         .width = ST7735_WIDTH,
         .height = ST7735_HEIGHT,
         .xstart = ST7735_XSTART,
-        .ystart = ST7735_YSTART
+        .ystart = ST7735_YSTART,
+        .target = SCREEN_TARGET,
+        .target_width = ST7735_WIDTH,
+        .target_height = ST7735_HEIGHT,
+        .state.clip = { 0, 0, ST7735_WIDTH, ST7735_HEIGHT },
+        .scroll_reverse = true,
+        .scroll_first = ST7735_XSTART,
+        .scroll_lines = ST7735_WIDTH
 };
 
 static void SwapBytes(uint16_t *color);
+#if ST7735S_BUFFER_INDEXED
+static void ST7735S_DefaultPalette(void);
+#endif
+static void ST7735_SetAddressWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
 
 static const uint8_t init_cmds1[] = {            // Init for 7735R, part 1 (red or green tab)
         15,                       // 15 commands in list:
@@ -180,6 +266,10 @@ void LCD_ST7735S_Backlight(bool enable)
 
 void ST7735_WriteCommand(uint8_t cmd)
 {
+#if (ST7735S_BUFFER_BPP == 0)
+    /** any command ends the memory write */
+    Stream.open = false;
+#endif
     LCD_ST7735S_DC_Unselect();
     ST7735S_SPI_Transmit(&cmd, sizeof(cmd));
 }
@@ -207,6 +297,9 @@ void LCD_ST7735S_Init(LCD_ST7735_ctx_t *data)
     ST7735_ExecuteCommandList(init_cmds3);
     LCD_ST7735S_Unselect();
     LCD_ST7735S_Backlight(true);
+#if ST7735S_BUFFER_INDEXED
+    ST7735S_DefaultPalette();
+#endif
 }
 
 
@@ -249,315 +342,3186 @@ static void SwapBytes(uint16_t *color)
 }
 
 
-void LCD_ST7735S_DrawPixel(int16_t x, int16_t y, uint16_t color)
+static inline uint16_t *ST7735S_PixelPtr(int16_t x, int16_t y)
 {
-    if ((x < 0) || (x >= LCD_ST7735.width) || (y < 0) || (y >= LCD_ST7735.height))
-        return;
+    return &LCD_ST7735.target[y * LCD_ST7735.target_width + x];
+}
 
-    SwapBytes(&color);
 
-    ScreenBuff[y * LCD_ST7735.width + x] = color;
+/** n (1..8) bits of a mono bit stream from bit, aligned to the top of the byte, lower bits undefined */
+static inline uint8_t ST7735S_MonoBits(const uint8_t *src, uint32_t bit, uint8_t n)
+{
+    const uint8_t *byte = &src[bit >> 3];
+    uint8_t offset = bit & 7;
+    uint8_t bits = (uint8_t)(byte[0] << offset);
+
+    /** next byte only when the bits cross it, never reads past the image */
+    if (offset + n > 8)
+        bits |= byte[1] >> (8 - offset);
+    return bits;
 }
 
 
-static void ST7735_SetAddressWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+#if ST7735S_BUFFER_INDEXED
+static inline uint16_t ST7735S_Swap(uint16_t color)
 {
-    // column address set
-    ST7735_WriteCommand(ST7735_CASET);
-    uint8_t data[] = { 0x00, x0 + LCD_ST7735.xstart, 0x00, x1 + LCD_ST7735.xstart };
-    ST7735_WriteData(data, sizeof(data));
+    return (uint16_t)((color << 8) | (color >> 8));
+}
 
-    // row address set
-    ST7735_WriteCommand(ST7735_RASET);
-    data[1] = y0 + LCD_ST7735.ystart;
-    data[3] = y1 + LCD_ST7735.ystart;
-    ST7735_WriteData(data, sizeof(data));
 
-    // write to RAM
-    ST7735_WriteCommand(ST7735_RAMWR);
+/** Black and white for 1 bpp, 16 colors for 4 bpp, RGB332 cube for 8 bpp */
+static void ST7735S_DefaultPalette(void)
+{
+#if (ST7735S_BUFFER_BPP == 1)
+    static const uint16_t colors[2] = { ST7735_BLACK, ST7735_WHITE };
+    LCD_ST7735S_SetPalette(colors, 2);
+#elif (ST7735S_BUFFER_BPP == 4)
+    static const uint16_t colors[16] = {
+            ST7735_BLACK, ST7735_WHITE, ST7735_RED, ST7735_GREEN,
+            ST7735_BLUE, ST7735_CYAN, ST7735_MAGENTA, ST7735_YELLOW,
+            0x8410, 0xC618, 0x8000, 0x0400,
+            0x0010, 0x0410, 0x8010, 0x8400
+    };
+    LCD_ST7735S_SetPalette(colors, 16);
+#else
+    for (uint16_t i = 0; i < PALETTE_SIZE; i++) {
+        uint16_t r = (i >> 5) & 0x07;
+        uint16_t g = (i >> 2) & 0x07;
+        uint16_t b = i & 0x03;
+        LCD_ST7735S_SetPaletteColor((uint8_t)i, (uint16_t)(((r * 31 / 7) << 11) | ((g * 63 / 7) << 5) | (b * 31 / 3)));
+    }
+#endif
 }
 
 
-void LCD_ST7735_FastDrawPixel(uint16_t x, uint16_t y, uint16_t color)
+/** Nearest palette entry of color in panel byte order, cached */
+static uint8_t ST7735S_ColorIndex(uint16_t color_be)
 {
-    if((x >= LCD_ST7735.width) || (y >= LCD_ST7735.height))
-        return;
+    uint8_t slot = (uint8_t)((color_be ^ (color_be >> 5) ^ (color_be >> 11)) & (INDEX_CACHE_SIZE - 1));
+
+    if (IndexCacheKey[slot] == (0x10000UL | color_be))
+        return IndexCacheValue[slot];
+
+    uint16_t color = ST7735S_Swap(color_be);
+    int16_t r = color >> 11;
+    int16_t g = (color >> 5) & 0x3F;
+    int16_t b = color & 0x1F;
+    uint32_t best_dist = UINT32_MAX;
+    uint8_t best = 0;
+
+    for (uint16_t i = 0; i < PALETTE_SIZE; i++) {
+        uint16_t entry = ST7735S_Swap(Palette[i]);
+        /** red and blue doubled to weigh like 6 bit green */
+        int32_t dr = 2 * (r - (entry >> 11));
+        int32_t dg = g - ((entry >> 5) & 0x3F);
+        int32_t db = 2 * (b - (entry & 0x1F));
+        uint32_t dist = (uint32_t)(dr * dr + dg * dg + db * db);
+
+        if (dist < best_dist) {
+            best_dist = dist;
+            best = (uint8_t)i;
+            if (dist == 0)
+                break;
+        }
+    }
 
-    LCD_ST7735S_Select();
+    IndexCacheKey[slot] = 0x10000UL | color_be;
+    IndexCacheValue[slot] = best;
+    return best;
+}
 
-    ST7735_SetAddressWindow(x, y, x+1, y+1);
-    uint8_t data[] = { color >> 8, color & 0xFF };
-    ST7735_WriteData(data, sizeof(data));
 
-    LCD_ST7735S_Unselect();
+static inline uint8_t ST7735S_GetIndex(int16_t x, int16_t y)
+{
+    uint32_t pos = (uint32_t)y * LCD_ST7735.width + x;
+#if (ST7735S_BUFFER_BPP == 8)
+    return ScreenBuff[pos];
+#elif (ST7735S_BUFFER_BPP == 1)
+    /** first pixel in the most significant bit, like mono images */
+    return (ScreenBuff[pos >> 3] >> (7 - (pos & 7))) & 0x01;
+#else
+    /** even pixel in the high nibble */
+    return (pos & 1) ? (ScreenBuff[pos >> 1] & 0x0F) : (ScreenBuff[pos >> 1] >> 4);
+#endif
 }
 
 
-void LCD_ST7735S_Update(void)
+static inline void ST7735S_SetIndex(int16_t x, int16_t y, uint8_t index)
 {
-    LCD_ST7735S_Select();
-    ST7735_SetAddressWindow(0, 0, LCD_ST7735.width-1, LCD_ST7735.height - 1);
+    uint32_t pos = (uint32_t)y * LCD_ST7735.width + x;
+#if (ST7735S_BUFFER_BPP == 8)
+    ScreenBuff[pos] = index;
+#elif (ST7735S_BUFFER_BPP == 1)
+    uint8_t bit = (uint8_t)(0x80 >> (pos & 7));
+    if (index)
+        ScreenBuff[pos >> 3] |= bit;
+    else
+        ScreenBuff[pos >> 3] &= (uint8_t)~bit;
+#else
+    uint8_t *byte = &ScreenBuff[pos >> 1];
+    *byte = (pos & 1) ? ((*byte & 0xF0) | index) : ((*byte & 0x0F) | (uint8_t)(index << 4));
+#endif
+}
 
-    ST7735_WriteData((uint8_t*)ScreenBuff, sizeof(ScreenBuff));
 
-    LCD_ST7735S_Unselect();
+static void ST7735S_FillIndex(int16_t x, int16_t y, int16_t count, uint8_t index)
+{
+#if (ST7735S_BUFFER_BPP == 8)
+    memset(&ScreenBuff[(uint32_t)y * LCD_ST7735.width + x], index, count);
+#elif (ST7735S_BUFFER_BPP == 1)
+    for (; (count > 0) && (((uint32_t)y * LCD_ST7735.width + x) & 7); count--)
+        ST7735S_SetIndex(x++, y, index);
+    memset(&ScreenBuff[((uint32_t)y * LCD_ST7735.width + x) >> 3], index ? 0xFF : 0x00, count >> 3);
+    x += count & ~7;
+    for (count &= 7; count > 0; count--)
+        ST7735S_SetIndex(x++, y, index);
+#else
+    if ((count > 0) && (x & 1)) {
+        ST7735S_SetIndex(x++, y, index);
+        count--;
+    }
+    memset(&ScreenBuff[((uint32_t)y * LCD_ST7735.width + x) >> 1], index | (index << 4), count >> 1);
+    if (count & 1)
+        ST7735S_SetIndex(x + count - 1, y, index);
+#endif
 }
 
 
-void Draw_Bitmap_Mono(int x, int y, const tImage *image, uint16_t color565)
+/** Expand indices of the span to panel byte order RGB565 */
+static void ST7735S_ExpandSpan(uint16_t *dst, int16_t x, int16_t y, int16_t count)
 {
-    uint8_t value = 0;
-    int16_t x0, y0;
-    int16_t counter = 0;
-    const uint8_t *pdata = (const uint8_t *) image->data;
-    // rows
-    for (y0 = 0; y0 < image->height; y0++) {
-        // columns
-        for (x0 = 0; x0 < image->width; x0++) {
-            // load new data
-            if (counter == 0) {
-                value = *pdata++;
-                counter = image->dataSize;
-            }
-            counter--;
+#if (ST7735S_BUFFER_BPP == 8)
+    const uint8_t *src = &ScreenBuff[(uint32_t)y * LCD_ST7735.width + x];
+    for (int16_t i = 0; i < count; i++)
+        dst[i] = Palette[src[i]];
+#elif (ST7735S_BUFFER_BPP == 1)
+    for (; (count > 0) && (((uint32_t)y * LCD_ST7735.width + x) & 7); count--)
+        *dst++ = Palette[ST7735S_GetIndex(x++, y)];
+
+    const uint8_t *src = &ScreenBuff[((uint32_t)y * LCD_ST7735.width + x) >> 3];
+    /** byte of 8 pixels is four pair stores */
+    for (; count >= 8; count -= 8, src++, dst += 8) {
+        memcpy(dst, &MonoPairs[*src >> 6], sizeof(uint32_t));
+        memcpy(dst + 2, &MonoPairs[(*src >> 4) & 0x03], sizeof(uint32_t));
+        memcpy(dst + 4, &MonoPairs[(*src >> 2) & 0x03], sizeof(uint32_t));
+        memcpy(dst + 6, &MonoPairs[*src & 0x03], sizeof(uint32_t));
+    }
+    for (int16_t i = 0; i < count; i++)
+        dst[i] = Palette[(*src >> (7 - i)) & 0x01];
+#else
+    if ((count > 0) && (x & 1)) {
+        *dst++ = Palette[ST7735S_GetIndex(x++, y)];
+        count--;
+    }
+    const uint8_t *src = &ScreenBuff[((uint32_t)y * LCD_ST7735.width + x) >> 1];
+    for (; count >= 2; count -= 2, src++) {
+        *dst++ = Palette[*src >> 4];
+        *dst++ = Palette[*src & 0x0F];
+    }
+    if (count)
+        *dst = Palette[*src >> 4];
+#endif
+}
 
-            // set pixel
-            if ((value & 0x80) != 0) {
-                LCD_ST7735S_DrawPixel(x + x0, y + y0, color565);
-            } else
-                LCD_ST7735S_DrawPixel(x + x0, y + y0, 0x0000);
 
-            value = value << 1;
+/** Map span of panel byte order RGB565 back to palette indices */
+static void ST7735S_PackSpan(const uint16_t *src, int16_t x, int16_t y, int16_t count)
+{
+    uint16_t last = src[0];
+    uint8_t index = ST7735S_ColorIndex(last);
+
+    for (int16_t i = 0; i < count; i++) {
+        if (src[i] != last) {
+            last = src[i];
+            index = ST7735S_ColorIndex(last);
         }
+        ST7735S_SetIndex(x + i, y, index);
     }
 }
 
 
-const tChar *find_char_by_code(int code, const tFont *font)
+#if (ST7735S_BUFFER_BPP == 1)
+/**
+ * Write count bits of a mono image, starting from bit src_bit, to the mono buffer a byte at a time.
+ * Transparent leaves buffer bits of zero image bits as they are.
+ */
+static void ST7735S_MonoRow(int16_t x, int16_t y, const uint8_t *src, uint32_t src_bit, int16_t count,
+                            uint8_t fg, uint8_t bg, bool transparent)
 {
-    int16_t count = font->length;
-    int16_t first = 0;
-    int16_t last = count - 1;
-    int16_t mid = 0;
-
-    if (count > 0) {
-        if ((code >= font->chars[0].code) && (code <= font->chars[count - 1].code)) {
-            while (last >= first) {
-                mid = first + ((last - first) / 2);
+    uint32_t pos = (uint32_t)y * LCD_ST7735.width + x;
+    uint8_t *dst = &ScreenBuff[pos >> 3];
+    uint8_t shift = pos & 7;
+    uint8_t fg_bits = fg ? 0xFF : 0x00;
+    uint8_t bg_bits = bg ? 0xFF : 0x00;
+
+    while (count > 0) {
+        uint8_t n = (uint8_t)((count < 8 - shift) ? count : 8 - shift);
+        uint8_t bits = ST7735S_MonoBits(src, src_bit, n) >> shift;
+        uint8_t mask = (uint8_t)((uint8_t)(0xFF00 >> n) >> shift);
+
+        if (transparent)
+            mask &= bits;
+        *dst = (uint8_t)((*dst & ~mask) | (((bits & fg_bits) | (~bits & bg_bits)) & mask));
+
+        dst++;
+        src_bit += n;
+        count -= n;
+        shift = 0;
+    }
+}
+#endif
 
-                if (font->chars[mid].code < code)
-                    first = mid + 1;
-                else if (font->chars[mid].code > code)
-                    last = mid - 1;
-                else
-                    break;
-            }
 
-            if (font->chars[mid].code == code)
-                return (&font->chars[mid]);
-        }
+static void ST7735S_PaletteChanged(void)
+{
+    memset(IndexCacheKey, 0, sizeof(IndexCacheKey));
+#if (ST7735S_BUFFER_BPP == 1)
+    for (uint8_t bits = 0; bits < 4; bits++) {
+        uint16_t pair[2] = { Palette[bits >> 1], Palette[bits & 0x01] };
+        memcpy(&MonoPairs[bits], pair, sizeof(pair));
     }
-
-    return (0);
+#endif
 }
 
 
-int utf8_next_char(const char *str, int16_t start, int16_t *resultCode, int16_t *nextIndex)
+/** Set palette colors (native RGB565) starting from index 0 */
+void LCD_ST7735S_SetPalette(const uint16_t *colors, uint16_t count)
 {
-    uint16_t len = 0;
-    uint16_t index = 0;
-    *resultCode = 0;
+    if (count > PALETTE_SIZE)
+        count = PALETTE_SIZE;
 
-    while (*(str + index) != 0) {
-        len++;
-        index++;
-    }
+    for (uint16_t i = 0; i < count; i++)
+        Palette[i] = ST7735S_Swap(colors[i]);
+    ST7735S_PaletteChanged();
+}
 
-    uint8_t c;
-    uint8_t code = 0;
-    int8_t result = 0;
-    uint8_t skip = 0;
 
-    *resultCode = 0;
-    *nextIndex = -1;
+void LCD_ST7735S_SetPaletteColor(uint8_t index, uint16_t color)
+{
+#if (PALETTE_SIZE < 256)
+    if (index >= PALETTE_SIZE)
+        return;
+#endif
 
-    if (start >= 0 && start < len) {
-        index = start;
+    Palette[index] = ST7735S_Swap(color);
+    ST7735S_PaletteChanged();
+}
+#endif
 
-        while (index < len) {
-            c = *(str + index);
-            index++;
 
-            // msb
-            if (skip == 0) {
-                // if range 0x00010000-0x001fffff
-                if ((c & 0xf8) == 0xf0) {
-                    skip = 3;
-                    code = c;
-                }
-                    // if range 0x00000800-0x0000ffff
-                else if ((c & 0xf0) == 0xe0) {
-                    skip = 2;
-                    code = c;
-                }
-                    // if range 0x00000080-0x000007ff
-                else if ((c & 0xe0) == 0xc0) {
-                    skip = 1;
-                    code = c;
-                }
-                    // if range 0x00-0x7f
-                else {//if ((c & 0x80) == 0x00)
-                    skip = 0;
-                    code = c;
-                }
-            } else { // not msb
-                code = code << 8;
-                code |= c;
-                skip--;
-            }
-            if (skip == 0) {
-                // completed
-                *resultCode = code;
-                *nextIndex = index;
-                result = 1;
-                break;
-            }
-        }
+#if (ST7735S_BUFFER_BPP == 0)
+/**
+ * Open memory write for count pixels per row from (x, y) down to the last panel row.
+ * Nothing is sent when the span is the next row of the running window,
+ * so a glyph or an image costs one window program.
+ */
+static void ST7735S_StreamWindow(int16_t x, int16_t y, int16_t count, int16_t rows)
+{
+    if (Stream.open && (x == Stream.x) && (count == Stream.width) && (y == Stream.next_y)) {
+        Stream.next_y += rows;
+        return;
     }
-    return (result);
+
+    LCD_ST7735S_Select();
+    ST7735_SetAddressWindow(x, y, x + count - 1, LCD_ST7735.height - 1);
+    LCD_ST7735S_Unselect();
+
+    Stream.open = true;
+    Stream.x = x;
+    Stream.width = count;
+    Stream.next_y = y + rows;
 }
 
 
-void LCD_ST7735_DrawString(const char *str, int x, int y, const tFont *font, uint32_t color)
+/** Send span of panel byte order pixels */
+static void ST7735S_StreamSpan(int16_t x, int16_t y, int16_t count, const uint16_t *data)
 {
-    int16_t len = strlen(str);
-    int16_t index = 0;
-    int16_t code = 0;
-    int16_t x1 = x;
-    int16_t nextIndex;
-
-    while (index < len) {
-        if (utf8_next_char(str, index, &code, &nextIndex) != 0) {
-            const tChar *ch = find_char_by_code(code, font);
-            if (ch != 0) {
-                Draw_Bitmap_Mono(x1, y, ch->image, color);
-                x1 += ch->image->width;
-            }
-        }
-        index = nextIndex;
-        if (nextIndex < 0)
-            break;
-    }
+    ST7735S_StreamWindow(x, y, count, 1);
+
+    LCD_ST7735S_Select();
+    ST7735_WriteData((uint8_t *)data, (size_t)count * sizeof(uint16_t));
+    LCD_ST7735S_Unselect();
 }
 
 
-void LCD_ST7735S_SetOrientation(LCD_ST7735S_rotation_t rotation)
+/**
+ * Fill rectangle on the panel with the transport spi_fill_color callback,
+ * or by sending a line of the color repeatedly, the line is kept for the next fill
+ */
+static void ST7735S_StreamFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color_be)
 {
-    uint8_t madctl;
+    uint32_t count = (uint32_t)w * h;
+    uint16_t chunk = (count < LINE_SIZE) ? (uint16_t)count : LINE_SIZE;
 
-    switch ((uint8_t)rotation) {
-        case   LCD_R0: { madctl = 0b01100000;
-            LCD_ST7735.width = ST7735_WIDTH;
-            LCD_ST7735.height = ST7735_HEIGHT;
-            LCD_ST7735.xstart = ST7735_XSTART;
-            LCD_ST7735.ystart = ST7735_YSTART;
-            break;
-        }
-        case  LCD_R90: { madctl = 0b11000000;
-            LCD_ST7735.width = ST7735_HEIGHT;
-            LCD_ST7735.height = ST7735_WIDTH;
-            LCD_ST7735.xstart = ST7735_YSTART;
-            LCD_ST7735.ystart = ST7735_XSTART;
-            break;
-        }
-        case LCD_R180: { madctl = 0b10100000;
-            LCD_ST7735.width = ST7735_WIDTH;
-            LCD_ST7735.height = ST7735_HEIGHT;
-            LCD_ST7735.xstart = ST7735_XSTART;
-            LCD_ST7735.ystart = ST7735_YSTART;
+    ST7735S_StreamWindow(x, y, w, h);
 
-            break;
-        }
-        case LCD_R270: { madctl = 0b01000000;
-            LCD_ST7735.width = ST7735_HEIGHT;
-            LCD_ST7735.height = ST7735_WIDTH;
-            LCD_ST7735.xstart = ST7735_YSTART;
-            LCD_ST7735.ystart = ST7735_XSTART;
-            break;
-        }
+    if (LCD_ST7735_ctx.spi_fill_color != NULL) {
+        LCD_ST7735S_Select();
+        LCD_ST7735S_DC_Select();
+        LCD_ST7735_ctx.spi_fill_color(color_be, count);
+        LCD_ST7735S_Unselect();
+        return;
+    }
+
+    if ((Stream.fill_color != color_be) || (Stream.fill_size < chunk)) {
+        for (uint16_t i = 0; i < chunk; i++)
+            LineBuff[1][i] = color_be;
+        Stream.fill_color = color_be;
+        Stream.fill_size = chunk;
     }
+
     LCD_ST7735S_Select();
-    ST7735_WriteCommand(ST7735_MADCTL);
-    ST7735_WriteData(&madctl, sizeof(madctl));
+    for (; count > 0; count -= chunk) {
+        if (count < chunk)
+            chunk = (uint16_t)count;
+        ST7735_WriteData((uint8_t *)LineBuff[1], chunk * sizeof(uint16_t));
+    }
     LCD_ST7735S_Unselect();
 }
+#endif
 
 
+/**
+ * Span of count pixels at (x, y) of the target as panel byte order RGB565.
+ * Points directly to the target, or to a line buffer for the indexed screen buffer,
+ * where load fills it with the current pixels. Every span ends with ST7735S_SpanEnd.
+ * Without screen buffer the span is sent to the panel, load is not possible.
+ */
+static inline uint16_t *ST7735S_SpanBegin(int16_t x, int16_t y, int16_t count, bool load)
+{
+#if (ST7735S_BUFFER_BPP == 0)
+    if (LCD_ST7735.target == NULL)
+        return LineBuff[0];
+#endif
+#if ST7735S_BUFFER_INDEXED
+    if (LCD_ST7735.target == NULL) {
+        if (load)
+            ST7735S_ExpandSpan(LineBuff[0], x, y, count);
+        return LineBuff[0];
+    }
+#endif
+    (void)count;
+    (void)load;
+    return ST7735S_PixelPtr(x, y);
+}
 
-void LCD_ST7735S_Scroll(uint8_t line) {
 
-    if (line < 160) {
-        LCD_ST7735S_Select();
-        ST7735_WriteCommand(ST7735_VSCSAD);
-        uint8_t data[] = {line >> 8, line & 0xFF};
-        ST7735_WriteData(data, 2);
-        LCD_ST7735S_Unselect();
+static inline void ST7735S_SpanEnd(const uint16_t *span, int16_t x, int16_t y, int16_t count)
+{
+#if ST7735S_BUFFER_INDEXED
+    if (LCD_ST7735.target == NULL)
+        ST7735S_PackSpan(span, x, y, count);
+#elif (ST7735S_BUFFER_BPP == 0)
+    if (LCD_ST7735.target == NULL)
+        ST7735S_StreamSpan(x, y, count, span);
+#endif
+    (void)span;
+    (void)x;
+    (void)y;
+    (void)count;
+}
+
+
+/** Apply translate offset, primitives call it once for their coordinates */
+static inline void ST7735S_Translate(int16_t *x, int16_t *y)
+{
+    *x += LCD_ST7735.state.offset_x;
+    *y += LCD_ST7735.state.offset_y;
+}
+
+
+static inline bool ST7735S_InClip(int16_t x, int16_t y)
+{
+    const LCD_ST7735_rect_t *clip = &LCD_ST7735.state.clip;
+    return (x >= clip->x0) && (x < clip->x1) && (y >= clip->y0) && (y < clip->y1);
+}
+
+
+/** Reset clip to the whole target, drop translate and the clip stack */
+static void ST7735S_ResetClip(void)
+{
+    LCD_ST7735.clip_depth = 0;
+    LCD_ST7735.state.offset_x = 0;
+    LCD_ST7735.state.offset_y = 0;
+    LCD_ST7735.state.clip.x0 = 0;
+    LCD_ST7735.state.clip.y0 = 0;
+    LCD_ST7735.state.clip.x1 = LCD_ST7735.target_width;
+    LCD_ST7735.state.clip.y1 = LCD_ST7735.target_height;
+}
+
+
+/**
+ * Save clip rectangle and translate offset, then narrow the clip to the rectangle
+ * (in current, translated coordinates). Returns false if the clip stack is full.
+ */
+bool LCD_ST7735S_PushClip(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    if (LCD_ST7735.clip_depth >= ST7735S_CLIP_DEPTH)
+        return false;
+
+    LCD_ST7735.clip_stack[LCD_ST7735.clip_depth++] = LCD_ST7735.state;
+
+    LCD_ST7735_rect_t *clip = &LCD_ST7735.state.clip;
+
+    /** empty clip is kept as an empty rectangle */
+    if ((w <= 0) || (h <= 0)) {
+        clip->x1 = clip->x0;
+        clip->y1 = clip->y0;
+        return true;
     }
 
+    /** intersect in int32, the stored clip stays inside the current one */
+    int32_t x0 = (int32_t)x + LCD_ST7735.state.offset_x;
+    int32_t y0 = (int32_t)y + LCD_ST7735.state.offset_y;
+    int32_t x1 = x0 + w;
+    int32_t y1 = y0 + h;
+
+    if (x0 < clip->x0)
+        x0 = clip->x0;
+    if (y0 < clip->y0)
+        y0 = clip->y0;
+    if (x1 > clip->x1)
+        x1 = clip->x1;
+    if (y1 > clip->y1)
+        y1 = clip->y1;
+    if ((x0 >= x1) || (y0 >= y1)) {
+        clip->x1 = clip->x0;
+        clip->y1 = clip->y0;
+        return true;
+    }
+
+    clip->x0 = (int16_t)x0;
+    clip->y0 = (int16_t)y0;
+    clip->x1 = (int16_t)x1;
+    clip->y1 = (int16_t)y1;
+    return true;
 }
 
 
-void LCD_ST7735S_ScrollArea(uint8_t x_start, uint8_t x_stop)
+/** Restore clip rectangle and translate offset saved by LCD_ST7735S_PushClip */
+void LCD_ST7735S_PopClip(void)
 {
-    /** tfa: top fixed area: nr of line from top of the frame mem and display) */
-    uint16_t tfa = LCD_ST7735.width - x_stop + LCD_ST7735.xstart;
-    /** vsa: height of the vertical scrolling area in nr of line of the frame mem
-       (not the display) from the vertical scrolling address. the first line appears
-       immediately after the bottom most line of the top fixed area. */
-    uint16_t vsa = x_stop - x_start + LCD_ST7735.xstart;
-    /** bfa: bottom fixed are in nr of lines from bottom of the frame memory and display */
-    uint16_t bfa = x_start + LCD_ST7735.xstart;
+    if (LCD_ST7735.clip_depth > 0)
+        LCD_ST7735.state = LCD_ST7735.clip_stack[--LCD_ST7735.clip_depth];
+}
 
-    if (tfa+vsa+bfa < 160)
-        return;
 
-    uint8_t CMD[] = { tfa >> 8, tfa & 0xFF,
-                      vsa >> 8, vsa & 0xFF,
-                      bfa >> 8, bfa & 0xFF };
+/** Move the origin of all drawing by (dx, dy), restored by LCD_ST7735S_PopClip */
+void LCD_ST7735S_Translate(int16_t dx, int16_t dy)
+{
+    LCD_ST7735.state.offset_x += dx;
+    LCD_ST7735.state.offset_y += dy;
+}
 
-    LCD_ST7735S_Select();
-    ST7735_WriteCommand(ST7735_SCRLAR);
-    ST7735_WriteData(CMD, sizeof(CMD));
-    LCD_ST7735S_Unselect();
 
+void LCD_ST7735S_Canvas_Init(LCD_ST7735S_Canvas_t *canvas, uint16_t *buffer, int16_t width, int16_t height)
+{
+    canvas->buffer = buffer;
+    canvas->width = width;
+    canvas->height = height;
 }
 
-#define pgm_read_word(addr) (*(const unsigned short *)(addr))
-/**************************************************************************/
-/*!
-   @brief   Draw a PROGMEM-resident 16-bit image (RGB 5/6/5) at the specified
-   (x,y) position. For 16-bit display devices; no color reduction performed.
-    @param    x   Top left corner x coordinate
-    @param    y   Top left corner y coordinate
-    @param    bitmap  byte array with 16-bit color bitmap
-    @param    w   Width of bitmap in pixels
-    @param    h   Height of bitmap in pixels
-*/
-/**************************************************************************/
-void LCD_ST7735S_Draw_RGB_Bitmap(int16_t x, int16_t y, const tImage_RGB *image)
+
+/**
+ * Direct all drawing to the canvas, NULL selects the screen buffer.
+ * Clip is reset to the whole target, translate to zero.
+ */
+void LCD_ST7735S_SetTarget(LCD_ST7735S_Canvas_t *canvas)
 {
-    uint16_t w = image->width;
-    uint16_t h = image->height;
-    for (int16_t j = 0; j < h; j++, y++) {
-        for (int16_t i = 0; i < w; i++) {
-            //LCD_ST7735S_DrawPixel(x + i, y, pgm_read_word(&image[j * w + i]));
-            LCD_ST7735S_DrawPixel(x + i, y, image->data[j * w + i]);
-        }
+    if (canvas == NULL) {
+        LCD_ST7735.target = SCREEN_TARGET;
+        LCD_ST7735.target_width = LCD_ST7735.width;
+        LCD_ST7735.target_height = LCD_ST7735.height;
+    } else {
+        LCD_ST7735.target = canvas->buffer;
+        LCD_ST7735.target_width = canvas->width;
+        LCD_ST7735.target_height = canvas->height;
     }
+    ST7735S_ResetClip();
 }
 
-void LCD_ST7735S_Clear(void)
+
+void LCD_ST7735S_DrawPixel(int16_t x, int16_t y, uint16_t color)
 {
-    memset(ScreenBuff, 0, sizeof(ScreenBuff));
+    ST7735S_Translate(&x, &y);
+    if (!ST7735S_InClip(x, y))
+        return;
+
+    SwapBytes(&color);
+
+#if ST7735S_BUFFER_INDEXED
+    if (LCD_ST7735.target == NULL) {
+        ST7735S_SetIndex(x, y, ST7735S_ColorIndex(color));
+        return;
+    }
+#elif (ST7735S_BUFFER_BPP == 0)
+    if (LCD_ST7735.target == NULL) {
+        ST7735S_StreamSpan(x, y, 1, &color);
+        return;
+    }
+#endif
+    LCD_ST7735.target[y * LCD_ST7735.target_width + x] = color;
+}
+
+
+/** Clip translated rectangle to the clip rectangle once per call, false if nothing is visible */
+static bool ST7735S_ClipRect(int16_t *x, int16_t *y, int16_t *w, int16_t *h)
+{
+    const LCD_ST7735_rect_t *clip = &LCD_ST7735.state.clip;
+    /** int32, x + w doesn't fit int16 for far off rectangles */
+    int32_t x0 = *x;
+    int32_t y0 = *y;
+    int32_t x1 = x0 + *w;
+    int32_t y1 = y0 + *h;
+
+    if (x0 < clip->x0)
+        x0 = clip->x0;
+    if (y0 < clip->y0)
+        y0 = clip->y0;
+    if (x1 > clip->x1)
+        x1 = clip->x1;
+    if (y1 > clip->y1)
+        y1 = clip->y1;
+
+    if ((x1 <= x0) || (y1 <= y0))
+        return false;
+
+    *x = (int16_t)x0;
+    *y = (int16_t)y0;
+    *w = (int16_t)(x1 - x0);
+    *h = (int16_t)(y1 - y0);
+    return true;
+}
+
+
+/** Fill span with already swapped color, two pixels per store */
+static void ST7735S_FillSpan(uint16_t *dst, uint16_t color_be, int16_t count)
+{
+    if (count <= 0)
+        return;
+
+    if (((uintptr_t)dst & 0x02) != 0) {
+        *dst++ = color_be;
+        count--;
+    }
+
+    uint32_t pair = color_be | ((uint32_t)color_be << 16);
+    uint32_t *dst32 = (uint32_t *)dst;
+
+    for (; count >= 8; count -= 8) {
+        dst32[0] = pair;
+        dst32[1] = pair;
+        dst32[2] = pair;
+        dst32[3] = pair;
+        dst32 += 4;
+    }
+    for (; count >= 2; count -= 2)
+        *dst32++ = pair;
+
+    if (count)
+        *(uint16_t *)dst32 = color_be;
+}
+
+
+/** Swap bytes of both pixels in a word, GCC and Clang emit a single REV16 on ARMv6+ */
+static inline uint32_t ST7735S_Rev16(uint32_t value)
+{
+    return ((value & 0x00FF00FFUL) << 8) | ((value >> 8) & 0x00FF00FFUL);
+}
+
+
+/** Copy span converting little endian RGB565 to the panel byte order */
+static void ST7735S_CopySwapSpan(uint16_t *dst, const uint16_t *src, int16_t count)
+{
+#if defined(__SSSE3__)
+    const __m128i shuffle = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+    for (; count >= 8; count -= 8, src += 8, dst += 8)
+        _mm_storeu_si128((__m128i *)dst, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), shuffle));
+#elif defined(__ARM_NEON)
+    for (; count >= 8; count -= 8, src += 8, dst += 8)
+        vst1q_u8((uint8_t *)dst, vrev16q_u8(vld1q_u8((const uint8_t *)src)));
+#endif
+
+    if ((count > 0) && (((uintptr_t)dst & 0x02) != 0)) {
+        uint16_t color = *src++;
+        SwapBytes(&color);
+        *dst++ = color;
+        count--;
+    }
+
+    if (((uintptr_t)src & 0x02) == 0) {
+        /** both pointers word aligned, two pixels per load and store */
+        uint32_t *dst32 = (uint32_t *)dst;
+        const uint32_t *src32 = (const uint32_t *)src;
+
+        for (; count >= 8; count -= 8) {
+            dst32[0] = ST7735S_Rev16(src32[0]);
+            dst32[1] = ST7735S_Rev16(src32[1]);
+            dst32[2] = ST7735S_Rev16(src32[2]);
+            dst32[3] = ST7735S_Rev16(src32[3]);
+            dst32 += 4;
+            src32 += 4;
+        }
+        for (; count >= 2; count -= 2)
+            *dst32++ = ST7735S_Rev16(*src32++);
+
+        dst = (uint16_t *)dst32;
+        src = (const uint16_t *)src32;
+    }
+
+    while (count-- > 0) {
+        uint16_t color = *src++;
+        SwapBytes(&color);
+        *dst++ = color;
+    }
+}
+
+
+/** Copy span of image pixels, images in panel byte order are a plain memcpy */
+static inline void ST7735S_CopyImageSpan(uint16_t *dst, const uint16_t *src, int16_t count, uint8_t flags)
+{
+    if (flags & IMAGE_RGB_BIG_ENDIAN)
+        memcpy(dst, src, count * sizeof(uint16_t));
+    else
+        ST7735S_CopySwapSpan(dst, src, count);
+}
+
+
+void LCD_ST7735S_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    ST7735S_Translate(&x, &y);
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    SwapBytes(&color);
+
+#if ST7735S_BUFFER_INDEXED
+    if (LCD_ST7735.target == NULL) {
+        uint8_t index = ST7735S_ColorIndex(color);
+        for (int16_t j = 0; j < h; j++)
+            ST7735S_FillIndex(x, y + j, w, index);
+        return;
+    }
+#elif (ST7735S_BUFFER_BPP == 0)
+    if (LCD_ST7735.target == NULL) {
+        ST7735S_StreamFill(x, y, w, h, color);
+        return;
+    }
+#endif
+    for (int16_t j = 0; j < h; j++)
+        ST7735S_FillSpan(ST7735S_PixelPtr(x, y + j), color, w);
+}
+
+
+/** Blend two RGB565 colors, alpha 0..32 (32 - only fg, 0 - only bg) */
+static inline uint16_t ST7735S_Blend565(uint16_t fg, uint16_t bg, uint8_t alpha)
+{
+    /** spread to 0b00000gggggg00000rrrrr000000bbbbb, one multiply for all channels */
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t r = ((((f - b) * alpha) >> 5) + b) & 0x07E0F81F;
+
+    return (uint16_t)(r | (r >> 16));
+}
+
+
+/** Blend pixel at translated coordinates */
+static void ST7735S_BlendPixel(int16_t x, int16_t y, uint16_t color, uint8_t alpha)
+{
+    if (!ST7735S_InClip(x, y) || (alpha == 0))
+        return;
+
+#if (ST7735S_BUFFER_BPP == 0)
+    /** panel can't be read back, pixels at least half covered are drawn solid */
+    if (LCD_ST7735.target == NULL) {
+        if (alpha >= 16) {
+            SwapBytes(&color);
+            ST7735S_StreamSpan(x, y, 1, &color);
+        }
+        return;
+    }
+#endif
+    uint16_t *pixel = ST7735S_SpanBegin(x, y, 1, true);
+    uint16_t bg = *pixel;
+
+    SwapBytes(&bg);
+    color = ST7735S_Blend565(color, bg, alpha);
+    SwapBytes(&color);
+
+    *pixel = color;
+    ST7735S_SpanEnd(pixel, x, y, 1);
+}
+
+
+/** Plot pixel of Wu line, steep line has swapped x and y */
+static inline void ST7735S_PlotAA(bool steep, int16_t x, int16_t y, uint16_t color, uint8_t alpha)
+{
+    if (steep)
+        ST7735S_BlendPixel(y, x, color, alpha);
+    else
+        ST7735S_BlendPixel(x, y, color, alpha);
+}
+
+
+void LCD_ST7735S_DrawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+    int16_t tmp;
+
+    ST7735S_Translate(&x0, &y0);
+    ST7735S_Translate(&x1, &y1);
+
+    bool steep = ((y1 > y0) ? (y1 - y0) : (y0 - y1)) > ((x1 > x0) ? (x1 - x0) : (x0 - x1));
+
+    if (steep) {
+        tmp = x0; x0 = y0; y0 = tmp;
+        tmp = x1; x1 = y1; y1 = tmp;
+    }
+    if (x0 > x1) {
+        tmp = x0; x0 = x1; x1 = tmp;
+        tmp = y0; y0 = y1; y1 = tmp;
+    }
+
+    int32_t dx = x1 - x0;
+    int32_t dy = y1 - y0;
+    /** 16.16 fixed point, the only division per line, int64 as dy * 65536 overflows for long lines */
+    int32_t gradient = (dx == 0) ? 0 : (int32_t)((int64_t)dy * 65536 / dx);
+
+    /** endpoints lay on the pixel grid */
+    ST7735S_PlotAA(steep, x0, y0, color, 32);
+    ST7735S_PlotAA(steep, x1, y1, color, 32);
+
+    /** only the part of the major axis inside the clip is walked */
+    const LCD_ST7735_rect_t *clip = &LCD_ST7735.state.clip;
+    int16_t from = steep ? clip->y0 : clip->x0;
+    int16_t to = steep ? clip->y1 : clip->x1;
+
+    if (from < x0 + 1)
+        from = x0 + 1;
+    if (to > x1)
+        to = x1;
+
+    /** stays between y0 and y1 in 16.16, so the loop needs no int64 */
+    int32_t intery = (int32_t)((int64_t)y0 * 65536 + (int64_t)gradient * (from - x0));
+
+    for (int16_t x = from; x < to; x++) {
+        int16_t y = (int16_t)(intery >> 16);
+        uint8_t alpha = (uint8_t)((intery >> 11) & 0x1F);
+
+        ST7735S_PlotAA(steep, x, y, color, 32 - alpha);
+        ST7735S_PlotAA(steep, x, y + 1, color, alpha);
+        intery += gradient;
+    }
+}
+
+
+/** Plot 8 symmetric pixels of circle octant */
+static void ST7735S_PlotCircleAA(int16_t x0, int16_t y0, int16_t x, int16_t y, uint16_t color, uint8_t alpha)
+{
+    ST7735S_BlendPixel(x0 + x, y0 + y, color, alpha);
+    ST7735S_BlendPixel(x0 - x, y0 + y, color, alpha);
+    ST7735S_BlendPixel(x0 + x, y0 - y, color, alpha);
+    ST7735S_BlendPixel(x0 - x, y0 - y, color, alpha);
+    if (x == y)
+        return;
+    ST7735S_BlendPixel(x0 + y, y0 + x, color, alpha);
+    ST7735S_BlendPixel(x0 - y, y0 + x, color, alpha);
+    ST7735S_BlendPixel(x0 + y, y0 - x, color, alpha);
+    ST7735S_BlendPixel(x0 - y, y0 - x, color, alpha);
+}
+
+
+void LCD_ST7735S_DrawCircleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    if ((r <= 0) || (r > 1023))
+        return;
+
+    ST7735S_Translate(&x0, &y0);
+
+    /** exact edge y = sqrt(r^2 - x^2) kept in 27.5 fixed point, tracked with
+        additions only: target drops by 2x+1, root follows it down */
+    uint32_t target = (uint32_t)r * r << 10;
+    uint32_t root = (uint32_t)r << 5;
+    uint32_t root_sq = root * root;
+
+    for (int16_t x = 0; ; x++) {
+        while (root_sq > target) {
+            root_sq -= (root << 1) - 1;
+            root--;
+        }
+
+        int16_t y = (int16_t)(root >> 5);
+        uint8_t alpha = (uint8_t)(root & 0x1F);
+
+        if (x > y)
+            break;
+
+        ST7735S_PlotCircleAA(x0, y0, x, y, color, 32 - alpha);
+        if (x < y)
+            ST7735S_PlotCircleAA(x0, y0, x, y + 1, color, alpha);
+
+        target -= ((uint32_t)x << 11) + (1 << 10);
+    }
+}
+
+
+/** Ordered dither thresholds, in 1/16 of the channel LSB */
+static const uint8_t bayer4x4[4][4] = {
+        {  0,  8,  2, 10 },
+        { 12,  4, 14,  6 },
+        {  3, 11,  1,  9 },
+        { 15,  7, 13,  5 }
+};
+
+/** RGB565 channels in 16.16 fixed point */
+typedef struct {
+    int32_t r;
+    int32_t g;
+    int32_t b;
+} ST7735S_color_fp_t;
+
+
+static void ST7735S_ColorToFp(uint16_t color, ST7735S_color_fp_t *fp)
+{
+    fp->r = (int32_t)(color >> 11) << 16;
+    fp->g = (int32_t)((color >> 5) & 0x3F) << 16;
+    fp->b = (int32_t)(color & 0x1F) << 16;
+}
+
+
+/** Per step increment to go from c0 to c1 in steps, one division per channel */
+static void ST7735S_ColorStepFp(uint16_t c0, uint16_t c1, int16_t steps, ST7735S_color_fp_t *step)
+{
+    ST7735S_color_fp_t a, b;
+
+    ST7735S_ColorToFp(c0, &a);
+    ST7735S_ColorToFp(c1, &b);
+    if (steps <= 0)
+        steps = 1;
+    step->r = (b.r - a.r) / steps;
+    step->g = (b.g - a.g) / steps;
+    step->b = (b.b - a.b) / steps;
+}
+
+
+/** Add n steps, the product is taken in int64 as a step times a long distance overflows int32 */
+static inline void ST7735S_ColorAddFp(ST7735S_color_fp_t *c, const ST7735S_color_fp_t *step, int32_t n)
+{
+    c->r += (int32_t)((int64_t)step->r * n);
+    c->g += (int32_t)((int64_t)step->g * n);
+    c->b += (int32_t)((int64_t)step->b * n);
+}
+
+
+/** Truncate to swapped RGB565, threshold is the fraction added before truncation */
+static inline uint16_t ST7735S_FpToColor(const ST7735S_color_fp_t *c, int32_t threshold)
+{
+    uint16_t color = (uint16_t)((((c->r + threshold) >> 16) << 11) |
+                                (((c->g + threshold) >> 16) << 5) |
+                                ((c->b + threshold) >> 16));
+    SwapBytes(&color);
+    return color;
+}
+
+
+static inline int32_t ST7735S_Threshold(bool dither, int16_t x, int16_t y)
+{
+    if (!dither)
+        return 1 << 15;
+    return ((int32_t)bayer4x4[y & 3][x & 3] << 12) + (1 << 11);
+}
+
+
+/** Repeat first `period` pixels of the span to the full span with memcpy */
+static void ST7735S_RepeatSpan(uint16_t *dst, int16_t period, int16_t count)
+{
+    int16_t done = period;
+
+    while (done < count) {
+        int16_t chunk = (count - done < done) ? (count - done) : done;
+        memcpy(dst + done, dst, chunk * sizeof(uint16_t));
+        done += chunk;
+    }
+}
+
+
+/** Horizontal gradient, color goes from left to right edge of the rectangle */
+void LCD_ST7735S_FillRectGradientH(int16_t x, int16_t y, int16_t w, int16_t h,
+                                   uint16_t color_left, uint16_t color_right, bool dither)
+{
+    ST7735S_Translate(&x, &y);
+
+    int16_t x0 = x;
+    ST7735S_color_fp_t start, step;
+
+    ST7735S_ColorToFp(color_left, &start);
+    ST7735S_ColorStepFp(color_left, color_right, w - 1, &step);
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    ST7735S_ColorAddFp(&start, &step, x - x0);
+
+    /** without dither all rows are equal, with dither rows repeat every 4 lines */
+    int16_t rows = dither ? 4 : 1;
+    for (int16_t j = 0; j < h; j++) {
+        uint16_t *row = ST7735S_SpanBegin(x, y + j, w, false);
+
+        if ((j >= rows) && (LCD_ST7735.target != NULL)) {
+            memcpy(row, ST7735S_PixelPtr(x, y + j - rows), w * sizeof(uint16_t));
+            continue;
+        }
+
+        ST7735S_color_fp_t c = start;
+        for (int16_t i = 0; i < w; i++) {
+            row[i] = ST7735S_FpToColor(&c, ST7735S_Threshold(dither, x + i, y + j));
+            ST7735S_ColorAddFp(&c, &step, 1);
+        }
+        ST7735S_SpanEnd(row, x, y + j, w);
+    }
+}
+
+
+/** Vertical gradient, color goes from top to bottom edge of the rectangle */
+void LCD_ST7735S_FillRectGradientV(int16_t x, int16_t y, int16_t w, int16_t h,
+                                   uint16_t color_top, uint16_t color_bottom, bool dither)
+{
+    ST7735S_Translate(&x, &y);
+
+    int16_t y0 = y;
+    ST7735S_color_fp_t c, step;
+
+    ST7735S_ColorToFp(color_top, &c);
+    ST7735S_ColorStepFp(color_top, color_bottom, h - 1, &step);
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    ST7735S_ColorAddFp(&c, &step, y - y0);
+
+    for (int16_t j = 0; j < h; j++) {
+        uint16_t *row = ST7735S_SpanBegin(x, y + j, w, false);
+
+        if (!dither) {
+            ST7735S_FillSpan(row, ST7735S_FpToColor(&c, 1 << 15), w);
+        } else {
+            /** dither pattern has 4 pixels period along the row */
+            for (int16_t i = 0; (i < 4) && (i < w); i++)
+                row[i] = ST7735S_FpToColor(&c, ST7735S_Threshold(true, x + i, y + j));
+            ST7735S_RepeatSpan(row, 4, w);
+        }
+        ST7735S_SpanEnd(row, x, y + j, w);
+        ST7735S_ColorAddFp(&c, &step, 1);
+    }
+}
+
+
+static uint32_t ST7735S_Sqrt(uint32_t value)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > value)
+        bit >>= 2;
+
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+
+/** Span [from, to) of a radial gradient row outside the radius */
+static void ST7735S_RadialEdge(uint16_t *row, int32_t from, int32_t to, int16_t x, int16_t y,
+                               const ST7735S_color_fp_t *edge, uint16_t edge_be, bool dither)
+{
+    for (int32_t i = from; i < to; i++)
+        row[i] = dither ? ST7735S_FpToColor(edge, ST7735S_Threshold(true, x + i, y)) : edge_be;
+}
+
+
+/** Radial gradient around (cx, cy), color_edge is used from radius and outside */
+void LCD_ST7735S_FillRectGradientRadial(int16_t x, int16_t y, int16_t w, int16_t h,
+                                        int16_t cx, int16_t cy, int16_t radius,
+                                        uint16_t color_center, uint16_t color_edge, bool dither)
+{
+    ST7735S_color_fp_t center, step, edge;
+
+    ST7735S_Translate(&x, &y);
+    ST7735S_Translate(&cx, &cy);
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    ST7735S_ColorToFp(color_center, &center);
+    ST7735S_ColorToFp(color_edge, &edge);
+    ST7735S_ColorStepFp(color_center, color_edge, radius, &step);
+    uint16_t edge_be = ST7735S_FpToColor(&edge, 1 << 15);
+
+    for (int16_t j = 0; j < h; j++) {
+        uint16_t *row = ST7735S_SpanBegin(x, y + j, w, false);
+        int32_t dy = y + j - cy;
+        /**
+         * only columns with |dx| < radius of rows with |dy| < radius can be inside the radius,
+         * the squared distance of them fits 31 bits, the rest of the row is edge color
+         */
+        int32_t from = 0;
+        int32_t to = 0;
+
+        if ((dy > -radius) && (dy < radius)) {
+            from = (int32_t)cx - radius + 1 - x;
+            to = (int32_t)cx + radius - x;
+            if (from < 0)
+                from = 0;
+            if (from > w)
+                from = w;
+            if (to > w)
+                to = w;
+            if (to < from)
+                to = from;
+        }
+        ST7735S_RadialEdge(row, 0, from, x, y + j, &edge, edge_be, dither);
+        ST7735S_RadialEdge(row, to, w, x, y + j, &edge, edge_be, dither);
+
+        int32_t dx = x + from - cx;
+        /** distance is tracked incrementally along the span, the root is taken once per row */
+        uint32_t dist_sq = (uint32_t)(dx * dx) + (uint32_t)(dy * dy);
+        int32_t dist = (int32_t)ST7735S_Sqrt(dist_sq);
+        uint32_t floor_sq = (uint32_t)dist * (uint32_t)dist;
+        ST7735S_color_fp_t c = center;
+
+        /** the color follows the distance clamped to radius, so it never leaves center..edge */
+        ST7735S_ColorAddFp(&c, &step, (dist < radius) ? dist : radius);
+
+        for (int32_t i = from; i < to; i++) {
+            if (dist >= radius && !dither)
+                row[i] = edge_be;
+            else if (dist >= radius)
+                row[i] = ST7735S_FpToColor(&edge, ST7735S_Threshold(true, x + i, y + j));
+            else
+                row[i] = ST7735S_FpToColor(&c, ST7735S_Threshold(dither, x + i, y + j));
+
+            dist_sq += (uint32_t)(2 * dx + 1);
+            dx++;
+            while (floor_sq + 2 * dist + 1 <= dist_sq) {
+                floor_sq += 2 * dist + 1;
+                if (dist < radius)
+                    ST7735S_ColorAddFp(&c, &step, 1);
+                dist++;
+            }
+            while (floor_sq > dist_sq) {
+                dist--;
+                floor_sq -= 2 * dist + 1;
+                if (dist < radius)
+                    ST7735S_ColorAddFp(&c, &step, -1);
+            }
+        }
+        ST7735S_SpanEnd(row, x, y + j, w);
+    }
+}
+
+
+static void ST7735_SetAddressWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+    // column address set
+    ST7735_WriteCommand(ST7735_CASET);
+    uint8_t data[] = { 0x00, x0 + LCD_ST7735.xstart, 0x00, x1 + LCD_ST7735.xstart };
+    ST7735_WriteData(data, sizeof(data));
+
+    // row address set
+    ST7735_WriteCommand(ST7735_RASET);
+    data[1] = y0 + LCD_ST7735.ystart;
+    data[3] = y1 + LCD_ST7735.ystart;
+    ST7735_WriteData(data, sizeof(data));
+
+    // write to RAM
+    ST7735_WriteCommand(ST7735_RAMWR);
+}
+
+
+void LCD_ST7735_FastDrawPixel(uint16_t x, uint16_t y, uint16_t color)
+{
+    if((x >= LCD_ST7735.width) || (y >= LCD_ST7735.height))
+        return;
+
+    LCD_ST7735S_Select();
+
+    ST7735_SetAddressWindow(x, y, x+1, y+1);
+    uint8_t data[] = { color >> 8, color & 0xFF };
+    ST7735_WriteData(data, sizeof(data));
+
+    LCD_ST7735S_Unselect();
+}
+
+
+void LCD_ST7735S_Update(void)
+{
+#if ST7735S_BUFFER_INDEXED
+    LCD_ST7735S_UpdateRect(0, 0, LCD_ST7735.width, LCD_ST7735.height);
+#elif (ST7735S_BUFFER_BPP == 16)
+    LCD_ST7735S_Select();
+    ST7735_SetAddressWindow(0, 0, LCD_ST7735.width-1, LCD_ST7735.height - 1);
+
+    ST7735_WriteData((uint8_t*)ScreenBuff, sizeof(ScreenBuff));
+
+    LCD_ST7735S_Unselect();
+#endif
+    /** without screen buffer everything is already on the panel */
+}
+
+
+/** Send only the rectangle of the screen buffer to the panel */
+void LCD_ST7735S_UpdateRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    int16_t x1 = x + w;
+    int16_t y1 = y + h;
+
+    if (x < 0)
+        x = 0;
+    if (y < 0)
+        y = 0;
+    if (x1 > LCD_ST7735.width)
+        x1 = LCD_ST7735.width;
+    if (y1 > LCD_ST7735.height)
+        y1 = LCD_ST7735.height;
+    if ((x1 <= x) || (y1 <= y))
+        return;
+
+#if (ST7735S_BUFFER_BPP != 0)
+    LCD_ST7735S_Select();
+    ST7735_SetAddressWindow(x, y, x1 - 1, y1 - 1);
+
+#if ST7735S_BUFFER_INDEXED
+    /** lines alternate, so one can be expanded while a DMA transmit function sends the other */
+    for (int16_t j = y; j < y1; j++) {
+        uint16_t *line = LineBuff[j & 1];
+        ST7735S_ExpandSpan(line, x, j, x1 - x);
+        ST7735_WriteData((uint8_t *)line, (size_t)(x1 - x) * sizeof(uint16_t));
+    }
+#else
+    if ((x == 0) && (x1 == LCD_ST7735.width)) {
+        /** full rows are contiguous in the buffer */
+        ST7735_WriteData((uint8_t *)&ScreenBuff[y * LCD_ST7735.width], (size_t)(y1 - y) * LCD_ST7735.width * sizeof(uint16_t));
+    } else {
+        for (int16_t j = y; j < y1; j++)
+            ST7735_WriteData((uint8_t *)&ScreenBuff[j * LCD_ST7735.width + x], (size_t)(x1 - x) * sizeof(uint16_t));
+    }
+#endif
+    LCD_ST7735S_Unselect();
+#endif
+}
+
+
+/** Pixel masks for each 2 bit combination, high bit is the first pixel */
+static const uint16_t mono_masks[4][2] = {
+        { 0x0000, 0x0000 }, { 0x0000, 0xFFFF }, { 0xFFFF, 0x0000 }, { 0xFFFF, 0xFFFF }
+};
+
+
+/**
+ * Expand count bits of a mono image to RGB565 span, 8 pixels per source byte.
+ * pairs hold the two pixel colors for each 2 bit combination, in transparent mode
+ * pixels of zero bits are kept.
+ */
+static void ST7735S_ExpandMono(uint16_t *dst, const uint8_t *src, uint32_t bit, int16_t count,
+                               const uint32_t *pairs, bool transparent)
+{
+    for (; count > 0; count -= 8, bit += 8, dst += 8) {
+        uint8_t n = (uint8_t)((count < 8) ? count : 8);
+        uint8_t bits = ST7735S_MonoBits(src, bit, n);
+
+        if (n < 8) {
+            /** tail pixel by pixel, first halves of pairs 3 and 0 are fg and bg */
+            for (uint8_t i = 0; i < n; i++, bits <<= 1) {
+                if (bits & 0x80)
+                    memcpy(&dst[i], &pairs[3], sizeof(uint16_t));
+                else if (!transparent)
+                    memcpy(&dst[i], &pairs[0], sizeof(uint16_t));
+            }
+            break;
+        }
+
+        if (transparent && (bits == 0))
+            continue;
+
+        for (uint8_t i = 0; i < 8; i += 2, bits <<= 2) {
+            uint8_t pair = bits >> 6;
+            uint32_t value = pairs[pair];
+
+            if (transparent && (pair != 3)) {
+                uint32_t mask;
+                uint32_t old;
+                memcpy(&mask, mono_masks[pair], sizeof(mask));
+                memcpy(&old, &dst[i], sizeof(old));
+                value = (value & mask) | (old & ~mask);
+            }
+            memcpy(&dst[i], &value, sizeof(value));
+        }
+    }
+}
+
+
+/** Pixel pairs of ST7735S_ExpandMono for swapped fg and bg, first pixel of each pair is the high bit */
+static void ST7735S_MonoPairs(uint16_t fg_be, uint16_t bg_be, uint32_t *pairs)
+{
+    for (uint8_t bits = 0; bits < 4; bits++) {
+        uint16_t pair[2] = { (bits & 0x02) ? fg_be : bg_be, (bits & 0x01) ? fg_be : bg_be };
+        memcpy(&pairs[bits], pair, sizeof(pair));
+    }
+}
+
+
+/**
+ * Draw mono bit stream (tImage layout) with fg color for set bits and bg color for zero bits,
+ * or only the set bits when transparent. Clipped once, source bytes are expanded to 8 pixels at a time.
+ */
+static void ST7735S_DrawMono(int16_t x, int16_t y, const uint8_t *pdata, int16_t width, int16_t height,
+                             uint16_t fg, uint16_t bg, bool transparent)
+{
+    ST7735S_Translate(&x, &y);
+
+    int16_t x0 = x;
+    int16_t y0 = y;
+    int16_t w = width;
+    int16_t h = height;
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    SwapBytes(&fg);
+    SwapBytes(&bg);
+
+#if (ST7735S_BUFFER_BPP == 1)
+    if (LCD_ST7735.target == NULL) {
+        uint8_t fg_index = ST7735S_ColorIndex(fg);
+        uint8_t bg_index = ST7735S_ColorIndex(bg);
+        for (int16_t j = 0; j < h; j++)
+            ST7735S_MonoRow(x, y + j, pdata, (uint32_t)(y - y0 + j) * width + (x - x0), w,
+                            fg_index, bg_index, transparent);
+        return;
+    }
+#elif (ST7735S_BUFFER_BPP == 0)
+    /** panel can't be read back, runs of set bits are sent as fills */
+    if (transparent && (LCD_ST7735.target == NULL)) {
+        for (int16_t j = 0; j < h; j++) {
+            uint32_t bit = (uint32_t)(y - y0 + j) * width + (x - x0);
+            int16_t i = 0;
+
+            while (i < w) {
+                int16_t start = i;
+                while ((i < w) && (pdata[(bit + i) >> 3] & (0x80 >> ((bit + i) & 0x07))))
+                    i++;
+                if (i > start)
+                    ST7735S_StreamFill(x + start, y + j, i - start, 1, fg);
+                i++;
+            }
+        }
+        return;
+    }
+#endif
+    uint32_t pairs[4];
+    ST7735S_MonoPairs(fg, bg, pairs);
+
+    // rows, bits of the image are not aligned to rows
+    for (int16_t j = 0; j < h; j++) {
+        uint32_t bit = (uint32_t)(y - y0 + j) * width + (x - x0);
+        uint16_t *dst = ST7735S_SpanBegin(x, y + j, w, transparent);
+
+        ST7735S_ExpandMono(dst, pdata, bit, w, pairs, transparent);
+        ST7735S_SpanEnd(dst, x, y + j, w);
+    }
+}
+
+
+/** Colors of each coverage level for one fg and bg pair, panel byte order */
+static struct {
+    uint16_t fg;
+    uint16_t bg;
+    uint8_t bpp;
+    uint16_t colors[16];
+} CoverageRamp = { 0, 0, 0, {0} };
+
+
+/** Ramp of fg over bg for bpp coverage levels, rebuilt only when the colors change */
+static const uint16_t *ST7735S_CoverageRamp(uint16_t fg, uint16_t bg, uint8_t bpp)
+{
+    if ((CoverageRamp.bpp != bpp) || (CoverageRamp.fg != fg) || (CoverageRamp.bg != bg)) {
+        uint8_t max = (uint8_t)((1 << bpp) - 1);
+
+        for (uint8_t level = 0; level <= max; level++) {
+            uint16_t color = ST7735S_Blend565(fg, bg, (uint8_t)((level * 32 + max / 2) / max));
+            SwapBytes(&color);
+            CoverageRamp.colors[level] = color;
+        }
+        CoverageRamp.fg = fg;
+        CoverageRamp.bg = bg;
+        CoverageRamp.bpp = bpp;
+    }
+
+    return CoverageRamp.colors;
+}
+
+
+/** Coverage level of pixel index, pixels never cross a byte at 2 and 4 bpp */
+static inline uint8_t ST7735S_CoverageLevel(const uint8_t *src, uint32_t index, uint8_t bpp)
+{
+    uint32_t bit = index * bpp;
+
+    return (uint8_t)((src[bit >> 3] >> (8 - bpp - (bit & 0x07))) & ((1 << bpp) - 1));
+}
+
+
+/**
+ * Draw anti-aliased bitmap of 2 or 4 bpp coverage levels (0 - bg, max - fg).
+ * Opaque pixels are looked up in the fg/bg ramp, transparent ones are blended
+ * over the pixels already drawn.
+ */
+static void ST7735S_DrawCoverage(int16_t x, int16_t y, const uint8_t *pdata, int16_t width, int16_t height,
+                                 uint8_t bpp, uint16_t fg, uint16_t bg, bool transparent)
+{
+    ST7735S_Translate(&x, &y);
+
+    int16_t x0 = x;
+    int16_t y0 = y;
+    int16_t w = width;
+    int16_t h = height;
+    uint8_t max = (uint8_t)((1 << bpp) - 1);
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+#if (ST7735S_BUFFER_BPP == 0)
+    /** panel can't be read back, pixels at least half covered are sent as fills */
+    if (transparent && (LCD_ST7735.target == NULL)) {
+        uint16_t fg_be = fg;
+        SwapBytes(&fg_be);
+
+        for (int16_t j = 0; j < h; j++) {
+            uint32_t index = (uint32_t)(y - y0 + j) * width + (x - x0);
+            int16_t i = 0;
+
+            while (i < w) {
+                int16_t start = i;
+                while ((i < w) && (ST7735S_CoverageLevel(pdata, index + i, bpp) > max / 2))
+                    i++;
+                if (i > start)
+                    ST7735S_StreamFill(x + start, y + j, i - start, 1, fg_be);
+                i++;
+            }
+        }
+        return;
+    }
+#endif
+
+    if (!transparent) {
+        /** solid background, every pixel is a ramp lookup */
+        const uint16_t *ramp = ST7735S_CoverageRamp(fg, bg, bpp);
+
+        for (int16_t j = 0; j < h; j++) {
+            uint32_t index = (uint32_t)(y - y0 + j) * width + (x - x0);
+            uint16_t *dst = ST7735S_SpanBegin(x, y + j, w, false);
+
+            for (int16_t i = 0; i < w; i++)
+                dst[i] = ramp[ST7735S_CoverageLevel(pdata, index + i, bpp)];
+            ST7735S_SpanEnd(dst, x, y + j, w);
+        }
+        return;
+    }
+
+    uint16_t fg_be = fg;
+    SwapBytes(&fg_be);
+
+    for (int16_t j = 0; j < h; j++) {
+        uint32_t index = (uint32_t)(y - y0 + j) * width + (x - x0);
+        uint16_t *dst = ST7735S_SpanBegin(x, y + j, w, true);
+
+        for (int16_t i = 0; i < w; i++) {
+            uint8_t level = ST7735S_CoverageLevel(pdata, index + i, bpp);
+
+            if (level == max) {
+                dst[i] = fg_be;
+            } else if (level != 0) {
+                uint16_t color = dst[i];
+                SwapBytes(&color);
+                color = ST7735S_Blend565(fg, color, (uint8_t)((level * 32 + max / 2) / max));
+                SwapBytes(&color);
+                dst[i] = color;
+            }
+        }
+        ST7735S_SpanEnd(dst, x, y + j, w);
+    }
+}
+
+
+/**
+ * RLE data of images with IMAGE_RLE is a sequence of packets: a signed count element, count > 0 repeats
+ * the next element count times, count < 0 is followed by -count literal elements. Elements are bytes
+ * of the bit stream for tImage and pixels for tImage_RGB, packets continue over row ends like the data.
+ */
+
+/** Streaming decoder of RLE bit stream, levels are drawn with colors (opaque) or blended over the span */
+typedef struct {
+    const uint8_t *src;     /** repeated byte, or next literal byte */
+    uint16_t count;         /** bytes left in the packet */
+    bool repeat;
+    uint8_t phase;          /** pixels of the current byte already decoded */
+    uint8_t bpp;
+    uint8_t per_byte_log2;  /** pixels per byte 8, 4 or 2 */
+    bool transparent;
+    const uint16_t *colors; /** panel byte order color of each level */
+    uint32_t pairs[4];      /** ST7735S_ExpandMono pairs of 1 bpp literals */
+    uint16_t fg;
+} ST7735S_rle_t;
+
+
+/** Pixels left in the packet, the next packet header is read when it's used up */
+static inline uint32_t ST7735S_RlePixels(ST7735S_rle_t *rle)
+{
+    if (rle->count == 0) {
+        int8_t count = (int8_t)*rle->src++;
+
+        rle->repeat = count > 0;
+        rle->count = (uint16_t)(rle->repeat ? count : -count);
+        rle->phase = 0;
+    }
+    return ((uint32_t)rle->count << rle->per_byte_log2) - rle->phase;
+}
+
+
+/** Move past n pixels of the packet */
+static inline void ST7735S_RleSkip(ST7735S_rle_t *rle, uint32_t n)
+{
+    uint32_t pos = rle->phase + n;
+    uint16_t bytes = (uint16_t)(pos >> rle->per_byte_log2);
+
+    rle->phase = (uint8_t)(pos & ((1u << rle->per_byte_log2) - 1));
+    rle->count -= bytes;
+    if (!rle->repeat)
+        rle->src += bytes;
+    else if (rle->count == 0)
+        rle->src++;
+}
+
+
+/** Level of pixel pos of a repeated byte or of the literal bytes */
+static inline uint8_t ST7735S_RleLevel(const ST7735S_rle_t *rle, uint32_t pos)
+{
+    if (rle->repeat)
+        pos &= (1u << rle->per_byte_log2) - 1;
+    return ST7735S_CoverageLevel(rle->src, pos, rle->bpp);
+}
+
+
+/** n pixels of the packet from pixel offset pos to dst, a repeat of an empty or full byte is one fill */
+static void ST7735S_RleSpan(const ST7735S_rle_t *rle, uint16_t *dst, uint32_t pos, int16_t n)
+{
+    uint8_t max = (uint8_t)((1 << rle->bpp) - 1);
+
+    if (rle->repeat && ((*rle->src == 0x00) || (*rle->src == 0xFF))) {
+        if (*rle->src == 0xFF)
+            ST7735S_FillSpan(dst, rle->colors[max], n);
+        else if (!rle->transparent)
+            ST7735S_FillSpan(dst, rle->colors[0], n);
+        return;
+    }
+
+    if (!rle->repeat && (rle->bpp == 1)) {
+        ST7735S_ExpandMono(dst, rle->src, pos, n, rle->pairs, rle->transparent);
+        return;
+    }
+
+    for (int16_t i = 0; i < n; i++) {
+        uint8_t level = ST7735S_RleLevel(rle, pos + (uint32_t)i);
+
+        if (!rle->transparent || (level == max)) {
+            dst[i] = rle->colors[level];
+        } else if (level != 0) {
+            uint16_t color = dst[i];
+            SwapBytes(&color);
+            color = ST7735S_Blend565(rle->fg, color, (uint8_t)((level * 32 + max / 2) / max));
+            SwapBytes(&color);
+            dst[i] = color;
+        }
+    }
+}
+
+
+/** Decode width pixels, pixels [first, first + count) of them go to dst */
+static void ST7735S_RleRow(ST7735S_rle_t *rle, uint16_t *dst, uint32_t width, uint32_t first, uint32_t count)
+{
+    uint32_t col = 0;
+
+    while (col < width) {
+        uint32_t n = ST7735S_RlePixels(rle);
+        if (n > width - col)
+            n = width - col;
+
+        uint32_t from = (col > first) ? col : first;
+        uint32_t to = (col + n < first + count) ? col + n : first + count;
+
+        if (from < to)
+            ST7735S_RleSpan(rle, dst + (from - first), rle->phase + (from - col), (int16_t)(to - from));
+        ST7735S_RleSkip(rle, n);
+        col += n;
+    }
+}
+
+
+static void ST7735S_RleInit(ST7735S_rle_t *rle, const uint8_t *src, uint8_t bpp, uint16_t fg, uint16_t bg,
+                            bool transparent, uint16_t *mono_colors)
+{
+    rle->src = src;
+    rle->count = 0;
+    rle->repeat = false;
+    rle->phase = 0;
+    rle->bpp = bpp;
+    rle->per_byte_log2 = (uint8_t)((bpp == 1) ? 3 : (bpp == 2) ? 2 : 1);
+    rle->transparent = transparent;
+    rle->fg = fg;
+
+    if (bpp > 1) {
+        rle->colors = ST7735S_CoverageRamp(fg, bg, bpp);
+    } else {
+        mono_colors[0] = bg;
+        mono_colors[1] = fg;
+        SwapBytes(&mono_colors[0]);
+        SwapBytes(&mono_colors[1]);
+        ST7735S_MonoPairs(mono_colors[1], mono_colors[0], rle->pairs);
+        rle->colors = mono_colors;
+    }
+}
+
+
+/**
+ * Draw RLE bit stream of 1, 2 or 4 bpp (tImage or glyph with IMAGE_RLE), decoded into the
+ * spans of the visible rows. Repeats of empty or full bytes are span fills.
+ */
+static void ST7735S_DrawRle(int16_t x, int16_t y, const uint8_t *src, int16_t width, int16_t height,
+                            uint8_t bpp, uint16_t fg, uint16_t bg, bool transparent)
+{
+    ST7735S_Translate(&x, &y);
+
+    int16_t x0 = x;
+    int16_t y0 = y;
+    int16_t w = width;
+    int16_t h = height;
+    uint16_t mono_colors[2];
+    ST7735S_rle_t rle;
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    ST7735S_RleInit(&rle, src, bpp, fg, bg, transparent, mono_colors);
+
+#if (ST7735S_BUFFER_BPP == 0)
+    /** panel can't be read back, rows are decoded to levels and covered pixels are sent as fills */
+    static const uint16_t levels[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+    bool stream_levels = transparent && (LCD_ST7735.target == NULL);
+
+    if (stream_levels) {
+        rle.transparent = false;
+        rle.colors = levels;
+        ST7735S_MonoPairs(1, 0, rle.pairs);
+    }
+#endif
+
+    /** rows above the clip are decoded without output */
+    ST7735S_RleRow(&rle, NULL, (uint32_t)(y - y0) * width, 0, 0);
+
+    for (int16_t j = 0; j < h; j++) {
+#if (ST7735S_BUFFER_BPP == 0)
+        if (stream_levels) {
+            uint8_t half = (uint8_t)(((1 << bpp) - 1) / 2);
+            uint16_t fg_be = fg;
+            int16_t i = 0;
+
+            SwapBytes(&fg_be);
+            ST7735S_RleRow(&rle, LineBuff[0], (uint32_t)width, (uint32_t)(x - x0), (uint32_t)w);
+            while (i < w) {
+                int16_t start = i;
+                while ((i < w) && (LineBuff[0][i] > half))
+                    i++;
+                if (i > start)
+                    ST7735S_StreamFill(x + start, y + j, i - start, 1, fg_be);
+                i++;
+            }
+            continue;
+        }
+#endif
+        uint16_t *dst = ST7735S_SpanBegin(x, y + j, w, transparent);
+
+        ST7735S_RleRow(&rle, dst, (uint32_t)width, (uint32_t)(x - x0), (uint32_t)w);
+        ST7735S_SpanEnd(dst, x, y + j, w);
+    }
+}
+
+
+/** Draw mono image (font glyph) with fg and bg colors, or only the set bits when transparent, for text over pictures */
+void LCD_ST7735S_Draw_Bitmap_Mono(int16_t x, int16_t y, const tImage *image, uint16_t fg, uint16_t bg, bool transparent)
+{
+    if (image->flags & IMAGE_RLE) {
+        ST7735S_DrawRle(x, y, image->data, image->width, image->height, 1, fg, bg, transparent);
+        return;
+    }
+    ST7735S_DrawMono(x, y, image->data, image->width, image->height, fg, bg, transparent);
+}
+
+
+/** Opaque mono image on black background */
+void Draw_Bitmap_Mono(int x, int y, const tImage *image, uint16_t color565)
+{
+    LCD_ST7735S_Draw_Bitmap_Mono((int16_t)x, (int16_t)y, image, color565, ST7735_BLACK, false);
+}
+
+
+/**
+ * Glyph of the code: index into the dense range, then the page table,
+ * binary search only for fonts without them
+ */
+const tChar *find_char_by_code(int code, const tFont *font)
+{
+    int16_t count = font->length;
+    int16_t first = 0;
+    int16_t last = count - 1;
+    int16_t mid = 0;
+
+    if ((code >= font->first_code) && (code - font->first_code < font->dense))
+        return &font->chars[code - font->first_code];
+
+    if (font->pages != NULL) {
+        if ((code < 0) || (code / FONT_PAGE_SIZE >= font->page_count))
+            return (0);
+
+        const int16_t *page = font->pages[code / FONT_PAGE_SIZE];
+        if ((page == NULL) || (page[code % FONT_PAGE_SIZE] < 0))
+            return (0);
+        return &font->chars[page[code % FONT_PAGE_SIZE]];
+    }
+
+    if (count > 0) {
+        if ((code >= font->chars[0].code) && (code <= font->chars[count - 1].code)) {
+            while (last >= first) {
+                mid = first + ((last - first) / 2);
+
+                if (font->chars[mid].code < code)
+                    first = mid + 1;
+                else if (font->chars[mid].code > code)
+                    last = mid - 1;
+                else
+                    break;
+            }
+
+            if (font->chars[mid].code == code)
+                return (&font->chars[mid]);
+        }
+    }
+
+    return (0);
+}
+
+
+/** Code point of malformed UTF-8 sequences */
+#define UTF8_REPLACEMENT 0xFFFD
+
+/**
+ * Decode next UTF-8 character of the string and advance past it, single pass, no strlen.
+ * Malformed sequences (bad lead or continuation byte, overlong form, surrogate, above U+10FFFF)
+ * give UTF8_REPLACEMENT and skip one byte. Returns false at the end of the string.
+ */
+static bool ST7735S_Utf8Next(const char **str, uint32_t *code)
+{
+    const uint8_t *s = (const uint8_t *)*str;
+    uint32_t c = s[0];
+    uint32_t min;
+    uint8_t len;
+
+    if (c == 0)
+        return false;
+
+    if (c < 0x80) {
+        *code = c;
+        *str += 1;
+        return true;
+    }
+
+    if ((c & 0xE0) == 0xC0) {
+        len = 2;
+        min = 0x80;
+        c &= 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+        len = 3;
+        min = 0x800;
+        c &= 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+        len = 4;
+        min = 0x10000;
+        c &= 0x07;
+    } else {
+        len = 1;
+        min = UINT32_MAX;
+    }
+
+    /** terminating zero fails the continuation test, nothing is read past it */
+    for (uint8_t i = 1; i < len; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            min = UINT32_MAX;
+            break;
+        }
+        c = (c << 6) | (s[i] & 0x3F);
+    }
+
+    if ((c < min) || (c > 0x10FFFF) || ((c >= 0xD800) && (c <= 0xDFFF))) {
+        *code = UTF8_REPLACEMENT;
+        *str += 1;
+        return true;
+    }
+
+    *code = c;
+    *str += len;
+    return true;
+}
+
+
+/** Glyph bitmap of tFont, either format */
+typedef struct {
+    const uint8_t *data;
+    int16_t width;
+    int16_t height;
+    int16_t advance;    /** pen movement to the next glyph */
+    int16_t bearing;    /** bitmap x offset from the pen */
+    uint8_t bpp;        /** 1 mono, 2 and 4 coverage */
+    uint8_t flags;      /** tImage flags */
+} ST7735S_glyph_t;
+
+
+/** Bearing and advance of glyph index, monospaced fonts advance by the bitmap width */
+static void ST7735S_GlyphMetrics(const tFont *font, uint32_t index, ST7735S_glyph_t *glyph)
+{
+    glyph->bpp = (uint8_t)((font->bpp > 1) ? font->bpp : 1);
+
+    if (font->metrics != NULL) {
+        glyph->bearing = font->metrics[index].bearing;
+        glyph->advance = font->metrics[index].advance;
+    } else {
+        glyph->bearing = 0;
+        glyph->advance = glyph->width;
+    }
+}
+
+
+/** Find glyph of the code, packed fonts are addressed arithmetically */
+static bool ST7735S_FindGlyph(uint32_t code, const tFont *font, ST7735S_glyph_t *glyph)
+{
+    const tFontPacked *packed = font->packed;
+
+    if (packed != NULL) {
+        if ((code < packed->first_code) || (code - packed->first_code >= packed->count))
+            return false;
+        glyph->data = packed->data + (code - packed->first_code) * packed->stride;
+        glyph->width = packed->width;
+        glyph->height = packed->height;
+        glyph->flags = 0;
+        ST7735S_GlyphMetrics(font, code - packed->first_code, glyph);
+        return true;
+    }
+
+    const tChar *ch = find_char_by_code((int)code, font);
+    if (ch == NULL)
+        return false;
+    glyph->data = ch->image->data;
+    glyph->width = ch->image->width;
+    glyph->height = ch->image->height;
+    glyph->flags = ch->image->flags;
+    ST7735S_GlyphMetrics(font, (uint32_t)(ch - font->chars), glyph);
+    return true;
+}
+
+
+/** Pen adjustment between two glyphs, binary search of the sorted kerning pairs */
+static int16_t ST7735S_Kerning(const tFont *font, uint32_t left, uint32_t right)
+{
+    if ((font->kerning == NULL) || (left > UINT16_MAX) || (right > UINT16_MAX))
+        return 0;
+
+    uint32_t key = (left << 16) | right;
+    int lo = 0;
+    int hi = font->kerning_count - 1;
+
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        const tKernPair *pair = &font->kerning[mid];
+        uint32_t mid_key = ((uint32_t)pair->left << 16) | pair->right;
+
+        if (mid_key == key)
+            return pair->adjust;
+        if (mid_key < key)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+
+    return 0;
+}
+
+
+/** Glyph cache slot header, slots are linked in most recently used order */
+typedef struct {
+    const tFont *font;          /** NULL for an empty slot */
+    uint32_t code;
+    uint16_t fg;
+    uint16_t bg;
+    int16_t width;
+    int16_t height;
+    uint16_t prev;
+    uint16_t next;
+} ST7735S_glyph_entry_t;
+
+
+/**
+ * Split arena to glyph slots of slot_pixels (largest width * height of the cached fonts).
+ * Returns the number of slots, 0 if the arena is too small. Glyphs larger than a slot are drawn uncached.
+ */
+uint16_t LCD_ST7735S_GlyphCache_Init(LCD_ST7735S_GlyphCache_t *cache, void *arena, uint32_t size, uint16_t slot_pixels)
+{
+    uintptr_t start = ((uintptr_t)arena + sizeof(void *) - 1) & ~(uintptr_t)(sizeof(void *) - 1);
+    uint32_t slot_size = sizeof(ST7735S_glyph_entry_t) + (uint32_t)slot_pixels * sizeof(uint16_t);
+
+    memset(cache, 0, sizeof(*cache));
+    size -= (uint32_t)(start - (uintptr_t)arena);
+    if ((slot_pixels == 0) || (size > UINT32_MAX / 2) || (size / slot_size == 0))
+        return 0;
+
+    uint32_t count = size / slot_size;
+    if (count > UINT16_MAX)
+        count = UINT16_MAX;
+
+    ST7735S_glyph_entry_t *entries = (ST7735S_glyph_entry_t *)start;
+    for (uint16_t i = 0; i < count; i++) {
+        entries[i].font = NULL;
+        entries[i].prev = (uint16_t)(i - 1);
+        entries[i].next = (uint16_t)(i + 1);
+    }
+
+    cache->entries = entries;
+    cache->pixels = (uint16_t *)&entries[count];
+    cache->count = (uint16_t)count;
+    cache->slot_pixels = slot_pixels;
+    cache->head = 0;
+    cache->tail = (uint16_t)(count - 1);
+    return cache->count;
+}
+
+
+/** Use cache for opaque text, NULL disables caching */
+void LCD_ST7735S_SetGlyphCache(LCD_ST7735S_GlyphCache_t *cache)
+{
+    LCD_ST7735.glyph_cache = cache;
+}
+
+
+/** Make slot the most recently used */
+static void ST7735S_GlyphCacheTouch(LCD_ST7735S_GlyphCache_t *cache, uint16_t slot)
+{
+    ST7735S_glyph_entry_t *entries = cache->entries;
+
+    if (slot == cache->head)
+        return;
+
+    if (slot == cache->tail)
+        cache->tail = entries[slot].prev;
+    else
+        entries[entries[slot].next].prev = entries[slot].prev;
+    entries[entries[slot].prev].next = entries[slot].next;
+
+    entries[slot].next = cache->head;
+    entries[cache->head].prev = slot;
+    cache->head = slot;
+}
+
+
+/**
+ * Expanded glyph from the cache, built in the least recently used slot on miss.
+ * Returns NULL if the glyph doesn't fit a slot.
+ */
+static const uint16_t *ST7735S_GlyphCacheGet(LCD_ST7735S_GlyphCache_t *cache, const tFont *font, uint32_t code,
+                                             const ST7735S_glyph_t *glyph, uint16_t fg, uint16_t bg)
+{
+    ST7735S_glyph_entry_t *entries = cache->entries;
+    uint16_t slot = cache->head;
+
+    if ((uint32_t)glyph->width * glyph->height > cache->slot_pixels)
+        return NULL;
+
+    /** walk in use order, glyphs drawn every frame are found first */
+    for (uint16_t i = 0; i < cache->count; i++) {
+        ST7735S_glyph_entry_t *entry = &entries[slot];
+        if (entry->font == NULL)
+            break;
+        if ((entry->code == code) && (entry->font == font) && (entry->fg == fg) && (entry->bg == bg)) {
+            cache->hits++;
+            ST7735S_GlyphCacheTouch(cache, slot);
+            return &cache->pixels[(uint32_t)slot * cache->slot_pixels];
+        }
+        slot = entry->next;
+    }
+
+    cache->misses++;
+    slot = cache->tail;
+    ST7735S_GlyphCacheTouch(cache, slot);
+
+    ST7735S_glyph_entry_t *entry = &entries[slot];
+    uint16_t *pixels = &cache->pixels[(uint32_t)slot * cache->slot_pixels];
+    uint16_t fg_be = fg;
+    uint16_t bg_be = bg;
+    uint32_t pairs[4];
+
+    entry->font = font;
+    entry->code = code;
+    entry->fg = fg;
+    entry->bg = bg;
+    entry->width = glyph->width;
+    entry->height = glyph->height;
+
+    /** glyph pixels are continuous across rows, so are the cached pixels */
+    if (glyph->flags & IMAGE_RLE) {
+        uint16_t mono_colors[2];
+        ST7735S_rle_t rle;
+        uint32_t count = (uint32_t)glyph->width * glyph->height;
+
+        ST7735S_RleInit(&rle, glyph->data, glyph->bpp, fg, bg, false, mono_colors);
+        ST7735S_RleRow(&rle, pixels, count, 0, count);
+        return pixels;
+    }
+
+    if (glyph->bpp > 1) {
+        const uint16_t *ramp = ST7735S_CoverageRamp(fg, bg, glyph->bpp);
+
+        for (uint32_t i = 0; i < (uint32_t)glyph->width * glyph->height; i++)
+            pixels[i] = ramp[ST7735S_CoverageLevel(glyph->data, i, glyph->bpp)];
+        return pixels;
+    }
+
+    SwapBytes(&fg_be);
+    SwapBytes(&bg_be);
+    ST7735S_MonoPairs(fg_be, bg_be, pairs);
+    ST7735S_ExpandMono(pixels, glyph->data, 0, glyph->width * glyph->height, pairs, false);
+    return pixels;
+}
+
+
+/** Glyph cache used by text drawn with these colors, NULL to draw glyph bits */
+static LCD_ST7735S_GlyphCache_t *ST7735S_TextCache(bool transparent)
+{
+    if (transparent)
+        return NULL;
+
+#if (ST7735S_BUFFER_BPP == 1)
+    /** glyph bits go to the mono screen buffer directly */
+    if (LCD_ST7735.target == NULL)
+        return NULL;
+#endif
+
+    return LCD_ST7735.glyph_cache;
+}
+
+
+/**
+ * Draw glyph with the pen at x. Opaque text paints bg over the whole advance, painted is the right
+ * edge of text already drawn on the line: a kerned glyph reaching into it only adds its ink there.
+ */
+static void ST7735S_DrawGlyph(int16_t x, int16_t y, const tFont *font, uint32_t code, const ST7735S_glyph_t *glyph,
+                              uint16_t fg, uint16_t bg, bool transparent, LCD_ST7735S_GlyphCache_t *cache,
+                              int16_t *painted)
+{
+    const uint16_t *pixels = NULL;
+    int16_t x1 = (int16_t)(x + glyph->bearing);
+    int16_t right = (int16_t)(x1 + glyph->width);
+    int16_t end = (int16_t)(x + glyph->advance);
+
+    if (end < right)
+        end = right;
+
+    if (!transparent) {
+        int16_t from = (x > *painted) ? x : *painted;
+
+        if (x1 < *painted) {
+            transparent = true;
+            cache = NULL;
+        } else if (from < x1) {
+            LCD_ST7735S_FillRect(from, y, (int16_t)(x1 - from), glyph->height, bg);
+            from = right;
+        } else {
+            from = right;
+        }
+        if (from < end)
+            LCD_ST7735S_FillRect(from, y, (int16_t)(end - from), glyph->height, bg);
+        if (end > *painted)
+            *painted = end;
+    }
+
+    if (cache != NULL)
+        pixels = ST7735S_GlyphCacheGet(cache, font, code, glyph, fg, bg);
+
+    if (pixels != NULL) {
+        const tImage_RGB image = { pixels, (uint16_t)glyph->width, (uint16_t)glyph->height,
+                                   16, IMAGE_RGB_BIG_ENDIAN };
+        LCD_ST7735S_Draw_RGB_Bitmap(x1, y, &image);
+    } else if (glyph->flags & IMAGE_RLE) {
+        ST7735S_DrawRle(x1, y, glyph->data, glyph->width, glyph->height, glyph->bpp, fg, bg, transparent);
+    } else if (glyph->bpp > 1) {
+        ST7735S_DrawCoverage(x1, y, glyph->data, glyph->width, glyph->height, glyph->bpp, fg, bg, transparent);
+    } else {
+        ST7735S_DrawMono(x1, y, glyph->data, glyph->width, glyph->height, fg, bg, transparent);
+    }
+}
+
+
+/** Draw string with fg and bg colors, or only the glyph pixels when transparent */
+void LCD_ST7735S_DrawString(const char *str, int16_t x, int16_t y, const tFont *font,
+                            uint16_t fg, uint16_t bg, bool transparent)
+{
+    uint32_t code;
+    uint32_t prev = 0;
+    ST7735S_glyph_t glyph;
+    int16_t x1 = x;
+    int16_t painted = INT16_MIN;
+
+    LCD_ST7735S_GlyphCache_t *cache = ST7735S_TextCache(transparent);
+
+    while (ST7735S_Utf8Next(&str, &code)) {
+        if (ST7735S_FindGlyph(code, font, &glyph)) {
+            x1 += ST7735S_Kerning(font, prev, code);
+            ST7735S_DrawGlyph(x1, y, font, code, &glyph, fg, bg, transparent, cache, &painted);
+            x1 += glyph.advance;
+            prev = code;
+        }
+    }
+}
+
+
+/** Size of the string drawn with font, lines are separated by '\n' */
+void LCD_ST7735_MeasureString(const char *str, const tFont *font, int16_t *w, int16_t *h)
+{
+    uint32_t code;
+    uint32_t prev = 0;
+    ST7735S_glyph_t glyph;
+    int16_t line_w = 0;
+    int16_t line_h = 0;
+    int16_t lines = 1;
+
+    *w = 0;
+
+    while (ST7735S_Utf8Next(&str, &code)) {
+        if (code == '\n') {
+            line_w = 0;
+            lines++;
+            prev = 0;
+        } else if (ST7735S_FindGlyph(code, font, &glyph)) {
+            line_w += ST7735S_Kerning(font, prev, code) + glyph.advance;
+            prev = code;
+            if (line_w > *w)
+                *w = line_w;
+            if (glyph.height > line_h)
+                line_h = glyph.height;
+        }
+    }
+
+    *h = (int16_t)(lines * line_h);
+}
+
+
+/** Pen width of glyphs [first, last) */
+static int16_t ST7735S_LayoutWidth(const LCD_ST7735S_LayoutGlyph_t *glyphs, uint16_t first, uint16_t last)
+{
+    int16_t width = 0;
+
+    for (uint16_t i = first; i < last; i++)
+        width += ((i > first) ? glyphs[i].kern : 0) + glyphs[i].advance;
+
+    return width;
+}
+
+
+/**
+ * Decode str once and place its glyphs in a box_w x box_h box, 0 is unbounded.
+ * Lines break at '\n' and, with LCD_LAYOUT_WRAP, at the last space that fits.
+ * Text beyond the box or the glyph capacity is dropped, ended by "..." with LCD_LAYOUT_ELLIPSIS.
+ * Returns false when the text was truncated.
+ */
+bool LCD_ST7735S_Layout(LCD_ST7735S_Layout_t *layout, const char *str, const tFont *font,
+                        int16_t box_w, int16_t box_h, LCD_ST7735S_align_t align, uint8_t flags)
+{
+    LCD_ST7735S_LayoutGlyph_t *g = layout->glyphs;
+    ST7735S_glyph_t glyph;
+    ST7735S_glyph_t dot = {0};
+    uint32_t code;
+    uint32_t prev = 0;
+    uint16_t count = 0;
+    int16_t line_h = 0;
+    bool more = false;
+    bool fits = true;
+
+    layout->font = font;
+
+    /** decode and look up every glyph once, '\n' is kept as a zero width break */
+    while (ST7735S_Utf8Next(&str, &code)) {
+        if (count == layout->capacity) {
+            more = true;
+            break;
+        }
+        if (code == '\n') {
+            g[count] = (LCD_ST7735S_LayoutGlyph_t){ NULL, code, 0, 0, 0, 0, 0, 0, 0, 0 };
+            prev = 0;
+        } else if (ST7735S_FindGlyph(code, font, &glyph)) {
+            g[count] = (LCD_ST7735S_LayoutGlyph_t){ glyph.data, code, 0, 0, glyph.advance,
+                                                    (uint8_t)glyph.width, (uint8_t)glyph.height,
+                                                    (int8_t)glyph.bearing,
+                                                    (int8_t)ST7735S_Kerning(font, prev, code), glyph.flags };
+            prev = code;
+            if (glyph.height > line_h)
+                line_h = glyph.height;
+        } else {
+            continue;
+        }
+        count++;
+    }
+
+    bool dots = ((flags & LCD_LAYOUT_ELLIPSIS) != 0) && ST7735S_FindGlyph('.', font, &dot);
+    int16_t dots_w = dots ? (int16_t)(3 * dot.advance) : 0;
+
+    uint16_t max_lines = UINT16_MAX;
+    if ((box_h > 0) && (line_h > 0))
+        max_lines = (box_h >= line_h) ? (uint16_t)(box_h / line_h) : 1;
+
+    uint16_t out = 0;
+    uint16_t start = 0;
+    uint16_t lines = 0;
+    int16_t width = 0;
+
+    /** lines are placed in order, so out never passes start and glyphs are compacted in place */
+    while (((start < count) || (lines == 0)) && (lines < max_lines)) {
+        uint16_t end = count;
+        uint16_t next = count;
+        uint16_t space = UINT16_MAX;
+        int16_t pen = 0;
+
+        for (uint16_t i = start; i < count; i++) {
+            if (g[i].code == '\n') {
+                end = i;
+                next = i + 1;
+                break;
+            }
+            int16_t step = (int16_t)(((i > start) ? g[i].kern : 0) + g[i].advance);
+
+            if (((flags & LCD_LAYOUT_WRAP) != 0) && (box_w > 0) && (i > start) && (pen + step > box_w)) {
+                if (space != UINT16_MAX) {
+                    end = space;
+                    next = space + 1;
+                } else {
+                    end = i;
+                    next = i;
+                }
+                break;
+            }
+            if (g[i].code == ' ')
+                space = i;
+            pen += step;
+        }
+
+        int16_t line_w = ST7735S_LayoutWidth(g, start, end);
+        bool cut = ((lines + 1 == max_lines) && (next < count)) || ((next >= count) && more);
+        bool wide = (box_w > 0) && (line_w > box_w);
+        bool ellipsis = false;
+
+        if (cut || wide) {
+            int16_t limit = box_w;
+
+            fits = false;
+            if (dots) {
+                ellipsis = true;
+                if (limit > 0)
+                    limit -= dots_w;
+            }
+            if (box_w > 0) {
+                while ((end > start) && (line_w > limit))
+                    line_w = ST7735S_LayoutWidth(g, start, --end);
+            }
+            /**
+             * the dots also need room in the glyph array, before the unread glyphs of the next
+             * line when more lines follow; no room even for an empty line drops them
+             */
+            uint16_t room = cut ? layout->capacity : next;
+            while (ellipsis && (end > start) && (out + (end - start) + 3 > room))
+                line_w = ST7735S_LayoutWidth(g, start, --end);
+            if (ellipsis && (out + (end - start) + 3 > room))
+                ellipsis = false;
+            if (ellipsis)
+                line_w += dots_w;
+        }
+
+        int16_t x = 0;
+        if ((box_w > 0) && (line_w < box_w)) {
+            if (align == LCD_ALIGN_CENTER)
+                x = (int16_t)((box_w - line_w) / 2);
+            else if (align == LCD_ALIGN_RIGHT)
+                x = (int16_t)(box_w - line_w);
+        }
+        int16_t y = (int16_t)(lines * line_h);
+        int16_t line_x = x;
+
+        for (uint16_t i = start; i < end; i++) {
+            if (i > start)
+                x += g[i].kern;
+            g[out] = g[i];
+            g[out].x = x;
+            g[out].y = y;
+            x += g[out++].advance;
+        }
+        for (uint8_t i = 0; ellipsis && (i < 3); i++) {
+            g[out] = (LCD_ST7735S_LayoutGlyph_t){ dot.data, '.', x, y, dot.advance,
+                                                  (uint8_t)dot.width, (uint8_t)dot.height, (int8_t)dot.bearing, 0,
+                                                  dot.flags };
+            x += g[out++].advance;
+        }
+
+        line_w = (int16_t)(x - line_x);
+        if (line_w > width)
+            width = line_w;
+        lines++;
+        start = next;
+        if (cut)
+            break;
+    }
+
+    layout->count = out;
+    layout->lines = lines;
+    layout->width = width;
+    layout->height = (int16_t)(lines * line_h);
+
+    return fits;
+}
+
+
+/** Draw the layout with its box at x, y, without decoding or looking up glyphs again */
+void LCD_ST7735S_DrawLayout(const LCD_ST7735S_Layout_t *layout, int16_t x, int16_t y,
+                            uint16_t fg, uint16_t bg, bool transparent)
+{
+    LCD_ST7735S_GlyphCache_t *cache = ST7735S_TextCache(transparent);
+    int16_t painted = INT16_MIN;
+
+    for (uint16_t i = 0; i < layout->count; i++) {
+        const LCD_ST7735S_LayoutGlyph_t *g = &layout->glyphs[i];
+        const ST7735S_glyph_t glyph = { g->data, g->width, g->height, g->advance, g->bearing,
+                                        (uint8_t)((layout->font->bpp > 1) ? layout->font->bpp : 1), g->flags };
+
+        if ((i > 0) && (g->y != layout->glyphs[i - 1].y))
+            painted = INT16_MIN;
+        ST7735S_DrawGlyph((int16_t)(x + g->x), (int16_t)(y + g->y), layout->font, g->code, &glyph,
+                          fg, bg, transparent, cache, &painted);
+    }
+}
+
+
+/** Characters a number field can show */
+static const char ST7735S_NumberChars[] = "0123456789-. ";
+
+
+/** x extent of a glyph around the pen: ink and advance */
+static void ST7735S_GlyphBox(const ST7735S_glyph_t *glyph, int16_t *left, int16_t *right)
+{
+    *left = (glyph->bearing < 0) ? glyph->bearing : 0;
+    *right = (int16_t)(glyph->bearing + glyph->width);
+    if (*right < glyph->advance)
+        *right = glyph->advance;
+}
+
+
+/** Draw one character centered in a w x h cell, the rest of the cell is bg */
+static void ST7735S_DrawNumberCell(const LCD_ST7735S_Number_t *num, int16_t x, char c, LCD_ST7735S_GlyphCache_t *cache)
+{
+    ST7735S_glyph_t glyph;
+    int16_t left;
+    int16_t right;
+    int16_t painted = INT16_MIN;
+
+    if (!ST7735S_FindGlyph((uint8_t)c, num->font, &glyph)) {
+        LCD_ST7735S_FillRect(x, num->y, num->cell_w, num->cell_h, num->bg);
+        return;
+    }
+
+    ST7735S_GlyphBox(&glyph, &left, &right);
+    int16_t pen = (int16_t)(x - left + (num->cell_w - (right - left)) / 2);
+
+    if (pen + left > x)
+        LCD_ST7735S_FillRect(x, num->y, (int16_t)(pen + left - x), num->cell_h, num->bg);
+    if (x + num->cell_w > pen + right)
+        LCD_ST7735S_FillRect((int16_t)(pen + right), num->y, (int16_t)(x + num->cell_w - pen - right), num->cell_h, num->bg);
+    if (num->cell_h > glyph.height)
+        LCD_ST7735S_FillRect((int16_t)(pen + left), (int16_t)(num->y + glyph.height), (int16_t)(right - left),
+                             (int16_t)(num->cell_h - glyph.height), num->bg);
+
+    ST7735S_DrawGlyph(pen, num->y, num->font, (uint8_t)c, &glyph, num->fg, num->bg, false, cache, &painted);
+}
+
+
+/**
+ * Draw the characters of the field which differ from the shown ones, and send them
+ * (runs of adjacent cells as one rectangle) when drawing on the screen.
+ */
+static void ST7735S_DrawNumber(LCD_ST7735S_Number_t *num, const char *text)
+{
+    LCD_ST7735S_GlyphCache_t *cache = ST7735S_TextCache(false);
+    bool screen = (LCD_ST7735.target == SCREEN_TARGET);
+    int16_t x = num->x;
+    uint8_t run = 0;
+
+    for (uint8_t i = 0; i <= num->cells; i++) {
+        if ((i < num->cells) && (text[i] != num->shown[i])) {
+            ST7735S_DrawNumberCell(num, (int16_t)(num->x + i * num->cell_w), text[i], cache);
+            num->shown[i] = text[i];
+            if (run++ == 0)
+                x = (int16_t)(num->x + i * num->cell_w);
+        } else if (run > 0) {
+            if (screen)
+                LCD_ST7735S_UpdateRect((int16_t)(x + LCD_ST7735.state.offset_x), (int16_t)(num->y + LCD_ST7735.state.offset_y),
+                                       (int16_t)(run * num->cell_w), num->cell_h);
+            run = 0;
+        }
+    }
+}
+
+
+/**
+ * Format value / 10^decimals right aligned into cells characters, without sprintf.
+ * A value which doesn't fit shows as dashes.
+ */
+static void ST7735S_FormatFixed(char *text, uint8_t cells, int32_t value, uint8_t decimals)
+{
+    /** sign, 10 digits and point */
+    char buf[12];
+    uint32_t mag = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+    uint8_t len = 0;
+    uint8_t digits = 0;
+
+    if (decimals > 9)
+        decimals = 9;
+
+    do {
+        if ((decimals > 0) && (digits == decimals))
+            buf[sizeof(buf) - ++len] = '.';
+        buf[sizeof(buf) - ++len] = (char)('0' + mag % 10);
+        mag /= 10;
+        digits++;
+    } while ((mag != 0) || (digits <= decimals));
+
+    if (value < 0)
+        buf[sizeof(buf) - ++len] = '-';
+
+    if (len > cells) {
+        memset(text, '-', cells);
+        return;
+    }
+    memset(text, ' ', cells - len);
+    memcpy(&text[cells - len], &buf[sizeof(buf) - len], len);
+}
+
+
+/**
+ * Number field of cells characters at x, y (up to LCD_NUMBER_CELLS). Cells are as wide as the
+ * widest digit, sign or point of the font. Nothing is drawn until the first value.
+ */
+void LCD_ST7735S_Number_Init(LCD_ST7735S_Number_t *num, int16_t x, int16_t y, uint8_t cells,
+                             const tFont *font, uint16_t fg, uint16_t bg)
+{
+    ST7735S_glyph_t glyph;
+    int16_t left;
+    int16_t right;
+
+    memset(num, 0, sizeof(*num));
+    num->font = font;
+    num->x = x;
+    num->y = y;
+    num->fg = fg;
+    num->bg = bg;
+    num->cells = (cells > LCD_NUMBER_CELLS) ? LCD_NUMBER_CELLS : cells;
+
+    for (const char *c = ST7735S_NumberChars; *c != '\0'; c++) {
+        if (ST7735S_FindGlyph((uint8_t)*c, font, &glyph)) {
+            ST7735S_GlyphBox(&glyph, &left, &right);
+            if (right - left > num->cell_w)
+                num->cell_w = (uint8_t)(right - left);
+            if (glyph.height > num->cell_h)
+                num->cell_h = (uint8_t)glyph.height;
+        }
+    }
+}
+
+
+/** Colors of the field, a change redraws all of it with the next value */
+void LCD_ST7735S_Number_SetColor(LCD_ST7735S_Number_t *num, uint16_t fg, uint16_t bg)
+{
+    if ((fg != num->fg) || (bg != num->bg))
+        memset(num->shown, 0, sizeof(num->shown));
+    num->fg = fg;
+    num->bg = bg;
+}
+
+
+/** Draw value right aligned in the field, only changed characters are drawn and sent */
+void LCD_ST7735S_DrawInt(LCD_ST7735S_Number_t *num, int32_t value)
+{
+    LCD_ST7735S_DrawFixed(num, value, 0);
+}
+
+
+/** Draw value / 10^decimals (1234, 2 is "12.34", up to 9 decimals), only changed characters are drawn and sent */
+void LCD_ST7735S_DrawFixed(LCD_ST7735S_Number_t *num, int32_t value, uint8_t decimals)
+{
+    char text[LCD_NUMBER_CELLS];
+
+    ST7735S_FormatFixed(text, num->cells, value, decimals);
+    ST7735S_DrawNumber(num, text);
+}
+
+
+/** Draw value rounded to decimals (up to 9), only changed characters are drawn and sent */
+void LCD_ST7735S_DrawFloat(LCD_ST7735S_Number_t *num, float value, uint8_t decimals)
+{
+    float scaled = value;
+    char text[LCD_NUMBER_CELLS];
+
+    if (decimals > 9)
+        decimals = 9;
+    for (uint8_t i = 0; i < decimals; i++)
+        scaled *= 10.0f;
+    scaled += (scaled < 0.0f) ? -0.5f : 0.5f;
+
+    /** false for NaN too */
+    if ((scaled > -2147483648.0f) && (scaled < 2147483648.0f))
+        ST7735S_FormatFixed(text, num->cells, (int32_t)scaled, decimals);
+    else
+        memset(text, '-', num->cells);
+    ST7735S_DrawNumber(num, text);
+}
+
+
+void LCD_ST7735_DrawString(const char *str, int x, int y, const tFont *font, uint32_t color)
+{
+    LCD_ST7735S_DrawString(str, (int16_t)x, (int16_t)y, font, (uint16_t)color, ST7735_BLACK, false);
+}
+
+
+void LCD_ST7735S_SetOrientation(LCD_ST7735S_rotation_t rotation)
+{
+    uint8_t madctl;
+
+    switch ((uint8_t)rotation) {
+        case   LCD_R0: { madctl = 0b01100000;
+            LCD_ST7735.width = ST7735_WIDTH;
+            LCD_ST7735.height = ST7735_HEIGHT;
+            LCD_ST7735.xstart = ST7735_XSTART;
+            LCD_ST7735.ystart = ST7735_YSTART;
+            LCD_ST7735.scroll_vertical = false;
+            LCD_ST7735.scroll_reverse = true;
+            break;
+        }
+        case  LCD_R90: { madctl = 0b11000000;
+            LCD_ST7735.width = ST7735_HEIGHT;
+            LCD_ST7735.height = ST7735_WIDTH;
+            LCD_ST7735.xstart = ST7735_YSTART;
+            LCD_ST7735.ystart = ST7735_XSTART;
+            LCD_ST7735.scroll_vertical = true;
+            LCD_ST7735.scroll_reverse = true;
+            break;
+        }
+        case LCD_R180: { madctl = 0b10100000;
+            LCD_ST7735.width = ST7735_WIDTH;
+            LCD_ST7735.height = ST7735_HEIGHT;
+            LCD_ST7735.xstart = ST7735_XSTART;
+            LCD_ST7735.ystart = ST7735_YSTART;
+            LCD_ST7735.scroll_vertical = false;
+            LCD_ST7735.scroll_reverse = false;
+            break;
+        }
+        case LCD_R270: { madctl = 0b01000000;
+            LCD_ST7735.width = ST7735_HEIGHT;
+            LCD_ST7735.height = ST7735_WIDTH;
+            LCD_ST7735.xstart = ST7735_YSTART;
+            LCD_ST7735.ystart = ST7735_XSTART;
+            LCD_ST7735.scroll_vertical = true;
+            LCD_ST7735.scroll_reverse = false;
+            break;
+        }
+    }
+    if (LCD_ST7735.target == SCREEN_TARGET) {
+        LCD_ST7735.target_width = LCD_ST7735.width;
+        LCD_ST7735.target_height = LCD_ST7735.height;
+    }
+    ST7735S_ResetClip();
+
+    LCD_ST7735S_Select();
+    ST7735_WriteCommand(ST7735_MADCTL);
+    ST7735_WriteData(&madctl, sizeof(madctl));
+    LCD_ST7735S_Unselect();
+}
+
+
+
+/** Set the vertical scroll start address, the frame memory line shown first in the scroll area */
+void LCD_ST7735S_Scroll(uint8_t line) {
+
+    /** frame memory has up to 162 lines */
+    if (line < 162) {
+        LCD_ST7735S_Select();
+        ST7735_WriteCommand(ST7735_VSCSAD);
+        uint8_t data[] = {line >> 8, line & 0xFF};
+        ST7735_WriteData(data, 2);
+        LCD_ST7735S_Unselect();
+    }
+
+}
+
+
+/**
+ * Set the scroll area to lines [x_start, x_stop) of the scroll axis, the rest of the screen is fixed.
+ * The panel scrolls along x in LCD_R0 and LCD_R180, along y in LCD_R90 and LCD_R270
+ * (see LCD_ST7735S_ScrollVertical), start and stop are x or y coordinates then.
+ */
+void LCD_ST7735S_ScrollArea(uint8_t x_start, uint8_t x_stop)
+{
+    if ((x_start >= x_stop) || (x_stop > ST7735_WIDTH) || (ST7735S_FRAME_LINES < 160))
+        return;
+
+    /** tfa: top fixed area, nr of frame memory lines before the scroll area */
+    uint16_t tfa = ST7735_XSTART + (LCD_ST7735.scroll_reverse ? ST7735_WIDTH - x_stop : x_start);
+    /** vsa: height of the vertical scrolling area in nr of lines */
+    uint16_t vsa = x_stop - x_start;
+    /** bfa: bottom fixed area, nr of frame memory lines after the scroll area */
+    uint16_t bfa = ST7735S_FRAME_LINES - tfa - vsa;
+
+    uint8_t CMD[] = { tfa >> 8, tfa & 0xFF,
+                      vsa >> 8, vsa & 0xFF,
+                      bfa >> 8, bfa & 0xFF };
+
+    LCD_ST7735.scroll_first = (uint8_t)tfa;
+    LCD_ST7735.scroll_lines = (uint8_t)vsa;
+
+    LCD_ST7735S_Select();
+    ST7735_WriteCommand(ST7735_SCRLAR);
+    ST7735_WriteData(CMD, sizeof(CMD));
+    LCD_ST7735S_Unselect();
+
+}
+
+
+/**
+ * Scroll the area set by LCD_ST7735S_ScrollArea, what is drawn offset lines after its start
+ * is shown at the start, the area wraps around. Nothing is redrawn or sent but the scroll address.
+ */
+void LCD_ST7735S_ScrollOffset(uint8_t offset)
+{
+    uint8_t lines = LCD_ST7735.scroll_lines;
+
+    /** same limit as LCD_ST7735S_ScrollArea, the panel can't scroll then */
+    if (ST7735S_FRAME_LINES < 160)
+        return;
+
+    offset %= lines;
+    if (LCD_ST7735.scroll_reverse && (offset != 0))
+        offset = lines - offset;
+
+    LCD_ST7735S_Scroll(LCD_ST7735.scroll_first + offset);
+}
+
+
+/** Panel scrolls along y in the current orientation, and hardware scrolling is supported by the panel */
+bool LCD_ST7735S_ScrollVertical(void)
+{
+    return LCD_ST7735.scroll_vertical && (ST7735S_FRAME_LINES >= 160);
+}
+
+
+/** Screen size in the current orientation */
+int16_t LCD_ST7735S_Width(void)
+{
+    return LCD_ST7735.width;
+}
+
+
+int16_t LCD_ST7735S_Height(void)
+{
+    return LCD_ST7735.height;
+}
+
+
+/** Decode width pixels of RLE image data, pixels [first, first + count) of them go to dst */
+static const uint16_t *ST7735S_RleRowRGB(const uint16_t *src, int32_t *left, uint16_t *dst, uint32_t width,
+                                         uint32_t first, uint32_t count, uint8_t flags)
+{
+    uint32_t col = 0;
+
+    while (col < width) {
+        if (*left == 0)
+            *left = (int16_t)*src++;
+
+        bool repeat = *left > 0;
+        uint32_t n = (uint32_t)(repeat ? *left : -*left);
+        if (n > width - col)
+            n = width - col;
+
+        uint32_t from = (col > first) ? col : first;
+        uint32_t to = (col + n < first + count) ? col + n : first + count;
+
+        if (from < to) {
+            if (repeat) {
+                uint16_t color = *src;
+                if (!(flags & IMAGE_RGB_BIG_ENDIAN))
+                    SwapBytes(&color);
+                ST7735S_FillSpan(dst + (from - first), color, (int16_t)(to - from));
+            } else {
+                ST7735S_CopyImageSpan(dst + (from - first), src + (from - col), (int16_t)(to - from), flags);
+            }
+        }
+
+        if (repeat) {
+            *left -= (int32_t)n;
+            if (*left == 0)
+                src++;
+        } else {
+            *left += (int32_t)n;
+            src += n;
+        }
+        col += n;
+    }
+
+    return src;
+}
+
+
+/** Draw RLE image decoded into the spans of the visible rows, repeated pixels are span fills */
+static void ST7735S_DrawRleRGB(int16_t x, int16_t y, const tImage_RGB *image)
+{
+    ST7735S_Translate(&x, &y);
+
+    int16_t x0 = x;
+    int16_t y0 = y;
+    int16_t w = image->width;
+    int16_t h = image->height;
+    const uint16_t *src = image->data;
+    int32_t left = 0;
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    /** rows above the clip are decoded without output */
+    src = ST7735S_RleRowRGB(src, &left, NULL, (uint32_t)(y - y0) * image->width, 0, 0, image->flags);
+
+    for (int16_t j = 0; j < h; j++) {
+        uint16_t *dst = ST7735S_SpanBegin(x, y + j, w, false);
+
+        src = ST7735S_RleRowRGB(src, &left, dst, image->width, (uint32_t)(x - x0), (uint32_t)w, image->flags);
+        ST7735S_SpanEnd(dst, x, y + j, w);
+    }
+}
+
+
+/**************************************************************************/
+/*!
+   @brief   Draw a 16-bit image (RGB 5/6/5) at the specified (x,y) position.
+   Image is clipped once, visible rows are copied with byte swap
+   (or as is for IMAGE_RGB_BIG_ENDIAN images), IMAGE_RLE images are decoded row by row.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    image  16-bit color bitmap
+*/
+/**************************************************************************/
+void LCD_ST7735S_Draw_RGB_Bitmap(int16_t x, int16_t y, const tImage_RGB *image)
+{
+    if (image->flags & IMAGE_RLE) {
+        ST7735S_DrawRleRGB(x, y, image);
+        return;
+    }
+
+    ST7735S_Translate(&x, &y);
+
+    int16_t x0 = x;
+    int16_t y0 = y;
+    int16_t w = image->width;
+    int16_t h = image->height;
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    const uint16_t *src = image->data + (y - y0) * image->width + (x - x0);
+
+#if (ST7735S_BUFFER_BPP == 0)
+    /** panel order rows go out as they are */
+    if ((LCD_ST7735.target == NULL) && (image->flags & IMAGE_RGB_BIG_ENDIAN)) {
+        for (int16_t j = 0; j < h; j++, src += image->width)
+            ST7735S_StreamSpan(x, y + j, w, src);
+        return;
+    }
+#endif
+    for (int16_t j = 0; j < h; j++) {
+        uint16_t *dst = ST7735S_SpanBegin(x, y + j, w, false);
+        ST7735S_CopyImageSpan(dst, src, w, image->flags);
+        ST7735S_SpanEnd(dst, x, y + j, w);
+        src += image->width;
+    }
+}
+
+
+/** Length of the opaque run from the start of src, pixel order as stored in the image */
+static inline int16_t ST7735S_OpaqueRun(const uint16_t *src, int16_t count, uint16_t key)
+{
+    int16_t n = 0;
+    while ((n < count) && (src[n] != key))
+        n++;
+    return n;
+}
+
+
+static inline int16_t ST7735S_KeyRun(const uint16_t *src, int16_t count, uint16_t key)
+{
+    int16_t n = 0;
+    while ((n < count) && (src[n] == key))
+        n++;
+    return n;
+}
+
+
+/**
+ * Draw image skipping pixels of the key color (native RGB565).
+ * Rows are split to opaque runs on the fly, every run is copied at once.
+ * For images drawn often build the runs once with LCD_ST7735S_Build_RGB_Runs. IMAGE_RLE images are not drawn.
+ */
+void LCD_ST7735S_Draw_RGB_Bitmap_Keyed(int16_t x, int16_t y, const tImage_RGB *image, uint16_t key)
+{
+    if (image->flags & IMAGE_RLE)
+        return;
+
+    ST7735S_Translate(&x, &y);
+
+    int16_t x0 = x;
+    int16_t y0 = y;
+    int16_t w = image->width;
+    int16_t h = image->height;
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    if (image->flags & IMAGE_RGB_BIG_ENDIAN)
+        SwapBytes(&key);
+
+    const uint16_t *src = image->data + (y - y0) * image->width + (x - x0);
+
+    /** every opaque run is its own span, key pixels are never read or written */
+    for (int16_t j = 0; j < h; j++) {
+        int16_t i = 0;
+
+        while (i < w) {
+            i += ST7735S_KeyRun(src + i, w - i, key);
+            int16_t n = ST7735S_OpaqueRun(src + i, w - i, key);
+            if (n > 0) {
+                uint16_t *dst = ST7735S_SpanBegin(x + i, y + j, n, false);
+                ST7735S_CopyImageSpan(dst, src + i, n, image->flags);
+                ST7735S_SpanEnd(dst, x + i, y + j, n);
+            }
+            i += n;
+        }
+        src += image->width;
+    }
+}
+
+
+/** Split image rows to opaque runs, only counts them when rows == NULL */
+static uint32_t ST7735S_ScanRuns(const tImage_RGB *image, uint16_t key, uint16_t *rows, tImage_RGB_Run *run)
+{
+    const uint16_t *src = image->data;
+    uint32_t count = 0;
+
+    for (uint16_t j = 0; j < image->height; j++) {
+        int16_t i = 0;
+
+        if (rows != NULL)
+            rows[j] = (uint16_t)count;
+
+        while (i < image->width) {
+            i += ST7735S_KeyRun(src + i, image->width - i, key);
+            int16_t n = ST7735S_OpaqueRun(src + i, image->width - i, key);
+            if (n > 0) {
+                if (rows != NULL) {
+                    run[count].start = i;
+                    run[count].length = n;
+                }
+                count++;
+            }
+            i += n;
+        }
+        src += image->width;
+    }
+
+    if (rows != NULL)
+        rows[image->height] = (uint16_t)count;
+
+    return count;
+}
+
+
+/**
+ * Build opaque run lists of the image for key color (native RGB565) in user buffer.
+ * With buffer == NULL returns the needed buffer size in uint16_t words, otherwise
+ * returns the used size or 0 if the buffer is too small. IMAGE_RLE images have no runs, 0 is returned.
+ */
+uint32_t LCD_ST7735S_Build_RGB_Runs(const tImage_RGB *image, uint16_t key, tImage_RGB_Runs *runs,
+                                    uint16_t *buffer, uint32_t buffer_len)
+{
+    if (image->flags & IMAGE_RLE)
+        return 0;
+
+    /** row index first, runs after it on a word boundary */
+    uint32_t header = image->height + 1;
+    header += header & 1;
+
+    if (image->flags & IMAGE_RGB_BIG_ENDIAN)
+        SwapBytes(&key);
+
+    uint32_t size = header + ST7735S_ScanRuns(image, key, NULL, NULL) * 2;
+
+    if (buffer == NULL)
+        return size;
+    if (buffer_len < size)
+        return 0;
+
+    runs->image = image;
+    runs->rows = buffer;
+    runs->runs = (const tImage_RGB_Run *)(buffer + header);
+    ST7735S_ScanRuns(image, key, buffer, (tImage_RGB_Run *)(buffer + header));
+
+    return size;
+}
+
+
+/** Draw color keyed image from prebuilt runs, no per pixel key test */
+void LCD_ST7735S_Draw_RGB_Bitmap_Runs(int16_t x, int16_t y, const tImage_RGB_Runs *runs)
+{
+    ST7735S_Translate(&x, &y);
+
+    const tImage_RGB *image = runs->image;
+    int16_t x0 = x;
+    int16_t y0 = y;
+    int16_t w = image->width;
+    int16_t h = image->height;
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    /** visible columns in image coordinates */
+    int16_t left = x - x0;
+    int16_t right = left + w;
+
+    for (int16_t j = y - y0; j < y - y0 + h; j++) {
+        const uint16_t *src = image->data + j * image->width;
+
+        for (uint16_t r = runs->rows[j]; r < runs->rows[j + 1]; r++) {
+            int16_t start = runs->runs[r].start;
+            int16_t end = start + runs->runs[r].length;
+
+            if (start < left)
+                start = left;
+            if (end > right)
+                end = right;
+            if (end > start) {
+                int16_t dst_x = x + start - left;
+                uint16_t *dst = ST7735S_SpanBegin(dst_x, y0 + j, end - start, false);
+                ST7735S_CopyImageSpan(dst, src + start, end - start, image->flags);
+                ST7735S_SpanEnd(dst, dst_x, y0 + j, end - start);
+            }
+        }
+    }
+}
+
+
+/** Columns per coordinate table of the scaled blit, tables live on the stack */
+#define SCALE_TABLE_SIZE 64
+
+static inline uint16_t ST7735S_ImagePixel(const uint16_t *src, uint8_t flags)
+{
+    uint16_t color = *src;
+    if (flags & IMAGE_RGB_BIG_ENDIAN)
+        SwapBytes(&color);
+    return color;
+}
+
+
+/** Source coordinate of destination pixel center, 16.16 fixed point, bilinear samples between pixels */
+static inline int64_t ST7735S_ScaleStart(int32_t step, int16_t first, LCD_ST7735S_scale_t mode)
+{
+    int64_t pos = (int64_t)step * first + step / 2;
+    if (mode == LCD_SCALE_BILINEAR)
+        pos -= 1L << 15;
+    return pos;
+}
+
+
+/**
+ * Draw image scaled to w x h pixels. Source coordinates are stepped in 16.16 fixed point,
+ * column coordinates are tabulated once per call, so the inner loop has no divisions.
+ * IMAGE_RLE images and images over INT16_MAX pixels wide or high (16.16 would overflow) are not drawn.
+ */
+void LCD_ST7735S_Draw_RGB_Bitmap_Scaled(int16_t x, int16_t y, int16_t w, int16_t h,
+                                        const tImage_RGB *image, LCD_ST7735S_scale_t mode)
+{
+    ST7735S_Translate(&x, &y);
+
+    int16_t x0 = x;
+    int16_t y0 = y;
+
+    if ((image->width == 0) || (image->height == 0) || (w <= 0) || (h <= 0) || (image->flags & IMAGE_RLE))
+        return;
+    if ((image->width > INT16_MAX) || (image->height > INT16_MAX))
+        return;
+
+    int32_t step_x = ((int32_t)image->width << 16) / w;
+    int32_t step_y = ((int32_t)image->height << 16) / h;
+    int32_t max_u = ((int32_t)image->width - 1) << 16;
+    int32_t max_v = ((int32_t)image->height - 1) << 16;
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    uint16_t column[SCALE_TABLE_SIZE];
+    uint8_t weight[SCALE_TABLE_SIZE];
+
+    for (int16_t chunk = 0; chunk < w; chunk += SCALE_TABLE_SIZE) {
+        int16_t count = (w - chunk < SCALE_TABLE_SIZE) ? (w - chunk) : SCALE_TABLE_SIZE;
+        /** int64, a step of a large image shrunk to a few pixels passes INT32_MAX */
+        int64_t u = ST7735S_ScaleStart(step_x, x - x0 + chunk, mode);
+
+        for (int16_t i = 0; i < count; i++, u += step_x) {
+            int32_t pos = (u < 0) ? 0 : ((u > max_u) ? max_u : (int32_t)u);
+            column[i] = (uint16_t)(pos >> 16);
+            weight[i] = (uint8_t)((pos >> 11) & 0x1F);
+        }
+
+        int64_t v = ST7735S_ScaleStart(step_y, y - y0, mode);
+
+        for (int16_t j = 0; j < h; j++, v += step_y) {
+            int32_t pos = (v < 0) ? 0 : ((v > max_v) ? max_v : (int32_t)v);
+            const uint16_t *row0 = image->data + (pos >> 16) * image->width;
+            uint16_t *dst = ST7735S_SpanBegin(x + chunk, y + j, count, false);
+
+            if (mode == LCD_SCALE_NEAREST) {
+                if (image->flags & IMAGE_RGB_BIG_ENDIAN) {
+                    for (int16_t i = 0; i < count; i++)
+                        dst[i] = row0[column[i]];
+                } else {
+                    for (int16_t i = 0; i < count; i++) {
+                        uint16_t color = row0[column[i]];
+                        SwapBytes(&color);
+                        dst[i] = color;
+                    }
+                }
+                ST7735S_SpanEnd(dst, x + chunk, y + j, count);
+                continue;
+            }
+
+            uint8_t wy = (uint8_t)((pos >> 11) & 0x1F);
+            const uint16_t *row1 = (wy != 0) ? row0 + image->width : row0;
+
+            for (int16_t i = 0; i < count; i++) {
+                const uint16_t *p0 = row0 + column[i];
+                const uint16_t *p1 = row1 + column[i];
+                uint8_t wx = weight[i];
+                /** weight 0 never reads past the last column */
+                uint16_t top = ST7735S_ImagePixel(p0, image->flags);
+                uint16_t bottom = ST7735S_ImagePixel(p1, image->flags);
+
+                if (wx != 0) {
+                    top = ST7735S_Blend565(ST7735S_ImagePixel(p0 + 1, image->flags), top, wx);
+                    bottom = ST7735S_Blend565(ST7735S_ImagePixel(p1 + 1, image->flags), bottom, wx);
+                }
+                uint16_t color = ST7735S_Blend565(bottom, top, wy);
+                SwapBytes(&color);
+                dst[i] = color;
+            }
+            ST7735S_SpanEnd(dst, x + chunk, y + j, count);
+        }
+    }
+}
+
+
+/** sin(0..90 degrees) in 2.14 fixed point */
+static const int16_t sin_table[91] = {
+            0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+         2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+         5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+         8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+        10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+        12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+        14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+        15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+        16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+        16384
+};
+
+
+/** sin of angle in degrees, 16.16 fixed point */
+static int32_t ST7735S_Sin(int16_t angle)
+{
+    angle %= 360;
+    if (angle < 0)
+        angle += 360;
+
+    if (angle <= 90)
+        return (int32_t)sin_table[angle] << 2;
+    if (angle <= 180)
+        return (int32_t)sin_table[180 - angle] << 2;
+    if (angle <= 270)
+        return -((int32_t)sin_table[angle - 180] << 2);
+    return -((int32_t)sin_table[360 - angle] << 2);
+}
+
+
+static int32_t ST7735S_DivFloor(int32_t a, int32_t b)
+{
+    int32_t q = a / b;
+    if (((a % b) != 0) && ((a < 0) != (b < 0)))
+        q--;
+    return q;
+}
+
+
+/** Narrow [*first, *last] to the steps i where lo <= pos + i * step < hi */
+static void ST7735S_StepRange(int32_t pos, int32_t step, int32_t lo, int32_t hi, int16_t *first, int16_t *last)
+{
+    int32_t i0, i1;
+
+    if (step == 0) {
+        if ((pos < lo) || (pos >= hi))
+            *last = *first - 1;
+        return;
+    }
+
+    if (step > 0) {
+        i0 = -ST7735S_DivFloor(pos - lo, step);
+        i1 = ST7735S_DivFloor(hi - 1 - pos, step);
+    } else {
+        i0 = -ST7735S_DivFloor(hi - 1 - pos, -step);
+        i1 = ST7735S_DivFloor(pos - lo, -step);
+    }
+
+    if (i0 > *first)
+        *first = (int16_t)((i0 > *last + 1) ? *last + 1 : i0);
+    if (i1 < *last)
+        *last = (int16_t)((i1 < *first - 1) ? *first - 1 : i1);
+}
+
+
+/**
+ * Draw image rotated by angle (degrees, clockwise) around its center placed at (cx, cy).
+ * Destination box is clipped once, every row is inverse mapped to the image in
+ * 16.16 fixed point and only the span which hits the image is walked. IMAGE_RLE images are not drawn.
+ */
+void LCD_ST7735S_Draw_RGB_Bitmap_Rotated(int16_t cx, int16_t cy, const tImage_RGB *image, int16_t angle)
+{
+    if (image->flags & IMAGE_RLE)
+        return;
+
+    ST7735S_Translate(&cx, &cy);
+
+    int32_t sin = ST7735S_Sin(angle);
+    int32_t cos = ST7735S_Sin(angle + 90);
+    int32_t abs_sin = (sin < 0) ? -sin : sin;
+    int32_t abs_cos = (cos < 0) ? -cos : cos;
+    int32_t w_fp = (int32_t)image->width << 16;
+    int32_t h_fp = (int32_t)image->height << 16;
+
+    /** bounding box of the rotated image */
+    int16_t half_w = (int16_t)(((abs_cos * image->width + abs_sin * image->height) >> 17) + 1);
+    int16_t half_h = (int16_t)(((abs_sin * image->width + abs_cos * image->height) >> 17) + 1);
+    int16_t x = cx - half_w;
+    int16_t y = cy - half_h;
+    int16_t w = 2 * half_w + 1;
+    int16_t h = 2 * half_h + 1;
+
+    if (!ST7735S_ClipRect(&x, &y, &w, &h))
+        return;
+
+    for (int16_t j = 0; j < h; j++) {
+        int32_t dx = x - cx;
+        int32_t dy = y + j - cy;
+        /** inverse rotation of the first pixel of the row, image center is the origin */
+        int32_t u = cos * dx + sin * dy + (w_fp >> 1);
+        int32_t v = cos * dy - sin * dx + (h_fp >> 1);
+        int16_t first = 0;
+        int16_t last = w - 1;
+
+        ST7735S_StepRange(u, cos, 0, w_fp, &first, &last);
+        ST7735S_StepRange(v, -sin, 0, h_fp, &first, &last);
+        if (first > last)
+            continue;
+
+        uint16_t *dst = ST7735S_SpanBegin(x + first, y + j, last - first + 1, false);
+        u += cos * first;
+        v -= sin * first;
+
+        for (int16_t i = first; i <= last; i++) {
+            uint16_t color = image->data[(v >> 16) * image->width + (u >> 16)];
+            if (!(image->flags & IMAGE_RGB_BIG_ENDIAN))
+                SwapBytes(&color);
+            dst[i - first] = color;
+            u += cos;
+            v -= sin;
+        }
+        ST7735S_SpanEnd(dst, x + first, y + j, last - first + 1);
+    }
+}
+
+
+/** Copy canvas to the current target (row memcpy), clip and translate apply */
+void LCD_ST7735S_Blit_Canvas(int16_t x, int16_t y, const LCD_ST7735S_Canvas_t *canvas)
+{
+    const tImage_RGB image = { canvas->buffer, (uint16_t)canvas->width, (uint16_t)canvas->height,
+                               16, IMAGE_RGB_BIG_ENDIAN };
+
+    LCD_ST7735S_Draw_RGB_Bitmap(x, y, &image);
+}
+
+
+/**
+ * Send IMAGE_RGB_BIG_ENDIAN image straight to the panel, bypassing the screen buffer.
+ * x, y are screen coordinates like in LCD_ST7735S_UpdateRect, the drawing target, its clip and translate don't apply.
+ * Image must be completely on screen and not RLE, returns false otherwise (use LCD_ST7735S_Draw_RGB_Bitmap).
+ * Note: next LCD_ST7735S_Update() overwrites the area with the screen buffer content.
+ */
+bool LCD_ST7735S_Send_RGB_Bitmap(int16_t x, int16_t y, const tImage_RGB *image)
+{
+    if (!(image->flags & IMAGE_RGB_BIG_ENDIAN) || (image->flags & IMAGE_RLE) || (image->width == 0) || (image->height == 0))
+        return false;
+
+    if ((x < 0) || (y < 0) || ((int32_t)x + image->width > LCD_ST7735.width) ||
+        ((int32_t)y + image->height > LCD_ST7735.height))
+        return false;
+
+    LCD_ST7735S_Select();
+    ST7735_SetAddressWindow(x, y, x + image->width - 1, y + image->height - 1);
+    ST7735_WriteData((uint8_t *)image->data, (size_t)image->width * image->height * sizeof(uint16_t));
+    LCD_ST7735S_Unselect();
+
+    return true;
+}
+
+void LCD_ST7735S_Clear(void)
+{
+#if (ST7735S_BUFFER_BPP == 0)
+    ST7735S_StreamFill(0, 0, LCD_ST7735.width, LCD_ST7735.height, ST7735_BLACK);
+#else
+    memset(ScreenBuff, 0, sizeof(ScreenBuff));
+#endif
 
 }
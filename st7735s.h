@@ -83,6 +83,8 @@
 //#define ST7735_COLOR565(r, g, b) (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3))
 
 typedef uint8_t (*spi_write)(uint8_t *pData, uint16_t Size);
+/** Send count times the same 2 bytes (color in panel byte order), e.g. DMA with fixed source address */
+typedef uint8_t (*spi_fill)(uint16_t color_be, uint32_t count);
 typedef void (*write_pin)(uint32_t port, uint32_t pin, uint8_t state);
 
 
@@ -99,9 +101,101 @@ typedef struct {
     LCD_ST7735_GPIO_t cs;
     LCD_ST7735_GPIO_t data;
     LCD_ST7735_GPIO_t backlight;
+    spi_fill spi_fill_color;    /** optional, used by fills without screen buffer */
 } LCD_ST7735_ctx_t;
 
 
+/** Offscreen drawing target, pixels are stored in panel byte order */
+typedef struct {
+    uint16_t *buffer;
+    int16_t width;
+    int16_t height;
+} LCD_ST7735S_Canvas_t;
+
+
+/**
+ * LRU cache of glyphs expanded to panel byte order RGB565 with fg and bg applied.
+ * Slots and their headers live in the user arena, see LCD_ST7735S_GlyphCache_Init.
+ */
+typedef struct {
+    void *entries;
+    uint16_t *pixels;
+    uint16_t count;             /** slots */
+    uint16_t slot_pixels;       /** largest glyph (width * height) a slot holds */
+    uint16_t head;              /** most recently used slot */
+    uint16_t tail;              /** least recently used slot, reused on miss */
+    uint32_t hits;
+    uint32_t misses;
+} LCD_ST7735S_GlyphCache_t;
+
+
+/** Glyph placed by LCD_ST7735S_Layout, pen position is relative to the layout box */
+typedef struct {
+    const uint8_t *data;
+    uint32_t code;
+    int16_t x;
+    int16_t y;
+    int16_t advance;
+    uint8_t width;
+    uint8_t height;
+    int8_t bearing;
+    int8_t kern;                /** pen adjustment after the previous glyph of the line */
+    uint8_t flags;              /** tImage flags */
+} LCD_ST7735S_LayoutGlyph_t;
+
+
+/**
+ * Text laid out once and drawn any number of times with LCD_ST7735S_DrawLayout.
+ * glyphs and capacity are provided by the user.
+ */
+typedef struct {
+    LCD_ST7735S_LayoutGlyph_t *glyphs;
+    uint16_t capacity;
+    uint16_t count;             /** glyphs placed */
+    uint16_t lines;
+    int16_t width;              /** widest line */
+    int16_t height;             /** lines * line height */
+    const tFont *font;
+} LCD_ST7735S_Layout_t;
+
+
+typedef enum {
+    LCD_ALIGN_LEFT,
+    LCD_ALIGN_CENTER,
+    LCD_ALIGN_RIGHT
+} LCD_ST7735S_align_t;
+
+/** LCD_ST7735S_Layout flags */
+#define LCD_LAYOUT_WRAP         0x01    /** break lines at spaces, or inside words longer than the box */
+#define LCD_LAYOUT_ELLIPSIS     0x02    /** end truncated text with "..." */
+
+
+/** Characters of the widest number field */
+#define LCD_NUMBER_CELLS 12
+
+/**
+ * Fixed width number field, see LCD_ST7735S_DrawInt. It keeps the characters on screen,
+ * a new value only redraws and sends the ones that changed.
+ */
+typedef struct {
+    const tFont *font;
+    int16_t x;
+    int16_t y;
+    uint16_t fg;
+    uint16_t bg;
+    uint8_t cells;              /** field width in characters */
+    uint8_t cell_w;
+    uint8_t cell_h;
+    char shown[LCD_NUMBER_CELLS];   /** characters on screen, 0 is not drawn yet */
+} LCD_ST7735S_Number_t;
+
+
+typedef enum {
+    LCD_SCALE_NEAREST,
+    LCD_SCALE_BILINEAR
+} LCD_ST7735S_scale_t;
+
+
 typedef enum {
     LCD_R0,
     LCD_R90,
@@ -114,18 +208,70 @@ void LCD_ST7735S_Init(LCD_ST7735_ctx_t *data);
 void LCD_ST7735S_SetOrientation(LCD_ST7735S_rotation_t rotation);
 void LCD_ST7735S_Scroll(uint8_t);
 void LCD_ST7735S_ScrollArea(uint8_t x_start, uint8_t x_stop);
+void LCD_ST7735S_ScrollOffset(uint8_t offset);
+bool LCD_ST7735S_ScrollVertical(void);
+int16_t LCD_ST7735S_Width(void);
+int16_t LCD_ST7735S_Height(void);
 void LCD_ST7735S_Update(void);
+void LCD_ST7735S_UpdateRect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+bool LCD_ST7735S_PushClip(int16_t x, int16_t y, int16_t w, int16_t h);
+void LCD_ST7735S_PopClip(void);
+void LCD_ST7735S_Translate(int16_t dx, int16_t dy);
+
+void LCD_ST7735S_Canvas_Init(LCD_ST7735S_Canvas_t *canvas, uint16_t *buffer, int16_t width, int16_t height);
+void LCD_ST7735S_SetTarget(LCD_ST7735S_Canvas_t *canvas);
+void LCD_ST7735S_Blit_Canvas(int16_t x, int16_t y, const LCD_ST7735S_Canvas_t *canvas);
 
 void LCD_ST7735S_DrawPixel(int16_t x, int16_t y, uint16_t color);
 void LCD_ST7735_FastDrawPixel(uint16_t x, uint16_t y, uint16_t color);
+void LCD_ST7735S_DrawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+void LCD_ST7735S_DrawCircleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+void LCD_ST7735S_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void LCD_ST7735S_FillRectGradientH(int16_t x, int16_t y, int16_t w, int16_t h,
+                                   uint16_t color_left, uint16_t color_right, bool dither);
+void LCD_ST7735S_FillRectGradientV(int16_t x, int16_t y, int16_t w, int16_t h,
+                                   uint16_t color_top, uint16_t color_bottom, bool dither);
+void LCD_ST7735S_FillRectGradientRadial(int16_t x, int16_t y, int16_t w, int16_t h,
+                                        int16_t cx, int16_t cy, int16_t radius,
+                                        uint16_t color_center, uint16_t color_edge, bool dither);
 void LCD_ST7735_DrawString(const char *str, int x, int y, const tFont *font, uint32_t color);
+void LCD_ST7735S_DrawString(const char *str, int16_t x, int16_t y, const tFont *font,
+                            uint16_t fg, uint16_t bg, bool transparent);
+uint16_t LCD_ST7735S_GlyphCache_Init(LCD_ST7735S_GlyphCache_t *cache, void *arena, uint32_t size, uint16_t slot_pixels);
+void LCD_ST7735S_SetGlyphCache(LCD_ST7735S_GlyphCache_t *cache);
+void LCD_ST7735_MeasureString(const char *str, const tFont *font, int16_t *w, int16_t *h);
+bool LCD_ST7735S_Layout(LCD_ST7735S_Layout_t *layout, const char *str, const tFont *font,
+                        int16_t box_w, int16_t box_h, LCD_ST7735S_align_t align, uint8_t flags);
+void LCD_ST7735S_DrawLayout(const LCD_ST7735S_Layout_t *layout, int16_t x, int16_t y,
+                            uint16_t fg, uint16_t bg, bool transparent);
+void LCD_ST7735S_Number_Init(LCD_ST7735S_Number_t *num, int16_t x, int16_t y, uint8_t cells,
+                             const tFont *font, uint16_t fg, uint16_t bg);
+void LCD_ST7735S_Number_SetColor(LCD_ST7735S_Number_t *num, uint16_t fg, uint16_t bg);
+void LCD_ST7735S_DrawInt(LCD_ST7735S_Number_t *num, int32_t value);
+void LCD_ST7735S_DrawFixed(LCD_ST7735S_Number_t *num, int32_t value, uint8_t decimals);
+void LCD_ST7735S_DrawFloat(LCD_ST7735S_Number_t *num, float value, uint8_t decimals);
 
 void LCD_ST7735S_Backlight(bool enable);
 void Draw_Bitmap_Mono(int x, int y, const tImage *image, uint16_t color565);
+void LCD_ST7735S_Draw_Bitmap_Mono(int16_t x, int16_t y, const tImage *image, uint16_t fg, uint16_t bg, bool transparent);
 void LCD_ST7735S_Draw_RGB_Bitmap(int16_t x, int16_t y, const tImage_RGB *image);
+bool LCD_ST7735S_Send_RGB_Bitmap(int16_t x, int16_t y, const tImage_RGB *image);
+/** IMAGE_RLE images are only decoded by LCD_ST7735S_Draw_RGB_Bitmap, the blits below skip them */
+void LCD_ST7735S_Draw_RGB_Bitmap_Keyed(int16_t x, int16_t y, const tImage_RGB *image, uint16_t key);
+uint32_t LCD_ST7735S_Build_RGB_Runs(const tImage_RGB *image, uint16_t key, tImage_RGB_Runs *runs,
+                                    uint16_t *buffer, uint32_t buffer_len);
+void LCD_ST7735S_Draw_RGB_Bitmap_Runs(int16_t x, int16_t y, const tImage_RGB_Runs *runs);
+void LCD_ST7735S_Draw_RGB_Bitmap_Scaled(int16_t x, int16_t y, int16_t w, int16_t h,
+                                        const tImage_RGB *image, LCD_ST7735S_scale_t mode);
+void LCD_ST7735S_Draw_RGB_Bitmap_Rotated(int16_t cx, int16_t cy, const tImage_RGB *image, int16_t angle);
 
 void LCD_ST7735S_Clear(void);
 
+/** Palette of the indexed screen buffer, only with ST7735S_BUFFER_INDEX8 or ST7735S_BUFFER_INDEX4 */
+void LCD_ST7735S_SetPalette(const uint16_t *colors, uint16_t count);
+void LCD_ST7735S_SetPaletteColor(uint8_t index, uint16_t color);
+
 
 
 #endif //_ST7735S_H
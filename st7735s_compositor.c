@@ -0,0 +1,302 @@
+/**
+ *     st7735 display library
+ *
+ *     Copyright (c) 2020 Vitaliy Nimych (Cvetaev) @ cvetaevvitaliy@gmail.com
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *          http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "st7735s_compositor.h"
+#include "st7735s_settings.h"
+
+
+static int32_t Rect_Area(const LCD_ST7735S_Rect_t *r)
+{
+    return (int32_t)r->w * r->h;
+}
+
+
+/** Bounding box, computed in int32 and clamped so far apart rectangles don't wrap */
+static LCD_ST7735S_Rect_t Rect_Union(const LCD_ST7735S_Rect_t *a, const LCD_ST7735S_Rect_t *b)
+{
+    LCD_ST7735S_Rect_t r;
+    int32_t x1 = ((int32_t)a->x + a->w > (int32_t)b->x + b->w) ? (int32_t)a->x + a->w : (int32_t)b->x + b->w;
+    int32_t y1 = ((int32_t)a->y + a->h > (int32_t)b->y + b->h) ? (int32_t)a->y + a->h : (int32_t)b->y + b->h;
+    int32_t w, h;
+
+    r.x = (a->x < b->x) ? a->x : b->x;
+    r.y = (a->y < b->y) ? a->y : b->y;
+    w = x1 - r.x;
+    h = y1 - r.y;
+    r.w = (int16_t)((w > INT16_MAX) ? INT16_MAX : w);
+    r.h = (int16_t)((h > INT16_MAX) ? INT16_MAX : h);
+    return r;
+}
+
+
+/** Rectangles share pixels */
+static bool Rect_Overlap(const LCD_ST7735S_Rect_t *a, const LCD_ST7735S_Rect_t *b)
+{
+    return ((int32_t)a->x < (int32_t)b->x + b->w) && ((int32_t)b->x < (int32_t)a->x + a->w) &&
+           ((int32_t)a->y < (int32_t)b->y + b->h) && ((int32_t)b->y < (int32_t)a->y + a->h);
+}
+
+
+/**
+ * Union covers no more pixels than the two rectangles apart: heavily overlapping ones
+ * or neighbours along a full edge. Rectangles touching at a corner are kept apart.
+ */
+static bool Rect_Mergeable(const LCD_ST7735S_Rect_t *a, const LCD_ST7735S_Rect_t *b)
+{
+    LCD_ST7735S_Rect_t u = Rect_Union(a, b);
+
+    return Rect_Area(&u) <= Rect_Area(a) + Rect_Area(b);
+}
+
+
+static LCD_ST7735S_Rect_t Sprite_Rect(const LCD_ST7735S_Sprite_t *sprite)
+{
+    LCD_ST7735S_Rect_t r = { sprite->x, sprite->y, 0, 0 };
+
+    if (sprite->image != NULL) {
+        r.w = (int16_t)sprite->image->width;
+        r.h = (int16_t)sprite->image->height;
+    }
+    return r;
+}
+
+
+static void Compositor_Dirty(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Rect_t rect)
+{
+    if ((rect.w <= 0) || (rect.h <= 0))
+        return;
+
+    /** merge with every rectangle it merges cheaply with, the union can merge with more of them */
+    for (uint8_t i = 0; i < comp->dirty_count; ) {
+        if (Rect_Mergeable(&comp->dirty[i], &rect)) {
+            rect = Rect_Union(&comp->dirty[i], &rect);
+            comp->dirty[i] = comp->dirty[--comp->dirty_count];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (comp->dirty_count < ST7735S_DIRTY_RECTS) {
+        comp->dirty[comp->dirty_count++] = rect;
+        return;
+    }
+
+    /** list is full, grow the rectangle which grows the least */
+    uint8_t best = 0;
+    int32_t best_growth = INT32_MAX;
+    for (uint8_t i = 0; i < comp->dirty_count; i++) {
+        LCD_ST7735S_Rect_t u = Rect_Union(&comp->dirty[i], &rect);
+        int32_t growth = Rect_Area(&u) - Rect_Area(&comp->dirty[i]);
+        if (growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    rect = Rect_Union(&comp->dirty[best], &rect);
+    comp->dirty[best] = comp->dirty[--comp->dirty_count];
+    Compositor_Dirty(comp, rect);
+}
+
+
+/** Sprite area before and after a change, union when it is cheap */
+static void Compositor_DirtyMove(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Rect_t old_rect, LCD_ST7735S_Rect_t new_rect)
+{
+    if (Rect_Mergeable(&old_rect, &new_rect)) {
+        Compositor_Dirty(comp, Rect_Union(&old_rect, &new_rect));
+    } else {
+        Compositor_Dirty(comp, old_rect);
+        Compositor_Dirty(comp, new_rect);
+    }
+}
+
+
+void LCD_ST7735S_Compositor_Init(LCD_ST7735S_Compositor_t *comp, const tImage_RGB *background, uint16_t background_color)
+{
+    memset(comp, 0, sizeof(*comp));
+    comp->background = background;
+    comp->background_color = background_color;
+
+    /** first render composes the whole screen */
+    LCD_ST7735S_Compositor_Invalidate(comp, 0, 0, INT16_MAX, INT16_MAX);
+}
+
+
+/** Insert sprite to the list sorted by z, sprites with equal z keep insertion order */
+static void Compositor_Insert(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite)
+{
+    LCD_ST7735S_Sprite_t **link = &comp->sprites;
+
+    while ((*link != NULL) && ((*link)->z <= sprite->z))
+        link = &(*link)->next;
+
+    sprite->next = *link;
+    *link = sprite;
+}
+
+
+static void Compositor_Unlink(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite)
+{
+    for (LCD_ST7735S_Sprite_t **link = &comp->sprites; *link != NULL; link = &(*link)->next) {
+        if (*link == sprite) {
+            *link = sprite->next;
+            sprite->next = NULL;
+            return;
+        }
+    }
+}
+
+
+void LCD_ST7735S_Compositor_Add(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite)
+{
+    Compositor_Insert(comp, sprite);
+    if (sprite->visible)
+        Compositor_Dirty(comp, Sprite_Rect(sprite));
+}
+
+
+void LCD_ST7735S_Compositor_Remove(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite)
+{
+    Compositor_Unlink(comp, sprite);
+    if (sprite->visible)
+        Compositor_Dirty(comp, Sprite_Rect(sprite));
+}
+
+
+void LCD_ST7735S_Compositor_Invalidate(LCD_ST7735S_Compositor_t *comp, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    LCD_ST7735S_Rect_t rect = { x, y, w, h };
+
+    /** keep coordinates in the range the union arithmetic can handle */
+    if (rect.x < 0) {
+        rect.w += rect.x;
+        rect.x = 0;
+    }
+    if (rect.y < 0) {
+        rect.h += rect.y;
+        rect.y = 0;
+    }
+    if (rect.w > ST7735_WIDTH + ST7735_HEIGHT)
+        rect.w = ST7735_WIDTH + ST7735_HEIGHT;
+    if (rect.h > ST7735_WIDTH + ST7735_HEIGHT)
+        rect.h = ST7735_WIDTH + ST7735_HEIGHT;
+
+    Compositor_Dirty(comp, rect);
+}
+
+
+void LCD_ST7735S_Sprite_Move(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite, int16_t x, int16_t y)
+{
+    LCD_ST7735S_Rect_t old_rect = Sprite_Rect(sprite);
+
+    if ((sprite->x == x) && (sprite->y == y))
+        return;
+
+    sprite->x = x;
+    sprite->y = y;
+    if (sprite->visible)
+        Compositor_DirtyMove(comp, old_rect, Sprite_Rect(sprite));
+}
+
+
+void LCD_ST7735S_Sprite_SetVisible(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite, bool visible)
+{
+    if (sprite->visible == visible)
+        return;
+
+    sprite->visible = visible;
+    Compositor_Dirty(comp, Sprite_Rect(sprite));
+}
+
+
+void LCD_ST7735S_Sprite_SetZ(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite, int8_t z)
+{
+    if (sprite->z == z)
+        return;
+
+    Compositor_Unlink(comp, sprite);
+    sprite->z = z;
+    Compositor_Insert(comp, sprite);
+    if (sprite->visible)
+        Compositor_Dirty(comp, Sprite_Rect(sprite));
+}
+
+
+void LCD_ST7735S_Sprite_SetImage(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite,
+                                 const tImage_RGB *image, const tImage_RGB_Runs *runs)
+{
+    LCD_ST7735S_Rect_t old_rect = Sprite_Rect(sprite);
+
+    sprite->image = image;
+    sprite->runs = runs;
+    if (sprite->visible)
+        Compositor_DirtyMove(comp, old_rect, Sprite_Rect(sprite));
+}
+
+
+static bool Compositor_BackgroundCovers(const LCD_ST7735S_Compositor_t *comp, const LCD_ST7735S_Rect_t *rect)
+{
+    const tImage_RGB *image = comp->background;
+
+    return (image != NULL) && (rect->x >= 0) && (rect->y >= 0) &&
+           ((int32_t)rect->x + rect->w <= image->width) && ((int32_t)rect->y + rect->h <= image->height);
+}
+
+
+/**
+ * Recompose dirty regions into the screen buffer and send only them to the panel.
+ * Dirty regions are in screen coordinates: the screen is selected as the drawing target,
+ * which also resets the clip, the translate and the clip stack.
+ */
+void LCD_ST7735S_Compositor_Render(LCD_ST7735S_Compositor_t *comp)
+{
+    uint8_t i;
+
+    LCD_ST7735S_SetTarget(NULL);
+
+    for (i = 0; i < comp->dirty_count; i++) {
+        const LCD_ST7735S_Rect_t *rect = &comp->dirty[i];
+
+        if (!LCD_ST7735S_PushClip(rect->x, rect->y, rect->w, rect->h))
+            break;
+
+        /** color fills what a smaller background image doesn't cover */
+        if (!Compositor_BackgroundCovers(comp, rect))
+            LCD_ST7735S_FillRect(rect->x, rect->y, rect->w, rect->h, comp->background_color);
+        if (comp->background != NULL)
+            LCD_ST7735S_Draw_RGB_Bitmap(0, 0, comp->background);
+
+        for (LCD_ST7735S_Sprite_t *sprite = comp->sprites; sprite != NULL; sprite = sprite->next) {
+            LCD_ST7735S_Rect_t sprite_rect = Sprite_Rect(sprite);
+
+            if (!sprite->visible || (sprite->image == NULL) || !Rect_Overlap(&sprite_rect, rect))
+                continue;
+
+            if (sprite->runs != NULL)
+                LCD_ST7735S_Draw_RGB_Bitmap_Runs(sprite->x, sprite->y, sprite->runs);
+            else
+                LCD_ST7735S_Draw_RGB_Bitmap(sprite->x, sprite->y, sprite->image);
+        }
+
+        LCD_ST7735S_PopClip();
+        LCD_ST7735S_UpdateRect(rect->x, rect->y, rect->w, rect->h);
+    }
+
+    /** rectangles not rendered are kept for the next call */
+    comp->dirty_count -= i;
+    memmove(comp->dirty, &comp->dirty[i], comp->dirty_count * sizeof(comp->dirty[0]));
+}
@@ -0,0 +1,66 @@
+/**
+ *     st7735 display library
+ *
+ *     Copyright (c) 2020 Vitaliy Nimych (Cvetaev) @ cvetaevvitaliy@gmail.com
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *          http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _ST7735S_COMPOSITOR_H
+#define _ST7735S_COMPOSITOR_H
+#include <stdint.h>
+#include <stdbool.h>
+#include "st7735s.h"
+
+/** Number of dirty rectangles tracked between renders, closest ones are merged when full */
+#ifndef ST7735S_DIRTY_RECTS
+#define ST7735S_DIRTY_RECTS 8
+#endif
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+} LCD_ST7735S_Rect_t;
+
+typedef struct LCD_ST7735S_Sprite {
+    const tImage_RGB *image;
+    const tImage_RGB_Runs *runs;        /** optional, transparent sprite drawn by opaque runs */
+    int16_t x;
+    int16_t y;
+    int8_t z;                           /** higher z is drawn on top */
+    bool visible;
+    struct LCD_ST7735S_Sprite *next;    /** managed by the compositor, sorted by z */
+} LCD_ST7735S_Sprite_t;
+
+typedef struct {
+    const tImage_RGB *background;       /** static background drawn at (0, 0), or NULL */
+    uint16_t background_color;          /** used where the background doesn't cover the screen */
+    LCD_ST7735S_Sprite_t *sprites;
+    uint8_t dirty_count;
+    LCD_ST7735S_Rect_t dirty[ST7735S_DIRTY_RECTS];
+} LCD_ST7735S_Compositor_t;
+
+void LCD_ST7735S_Compositor_Init(LCD_ST7735S_Compositor_t *comp, const tImage_RGB *background, uint16_t background_color);
+void LCD_ST7735S_Compositor_Add(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite);
+void LCD_ST7735S_Compositor_Remove(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite);
+void LCD_ST7735S_Compositor_Invalidate(LCD_ST7735S_Compositor_t *comp, int16_t x, int16_t y, int16_t w, int16_t h);
+void LCD_ST7735S_Compositor_Render(LCD_ST7735S_Compositor_t *comp);
+
+void LCD_ST7735S_Sprite_Move(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite, int16_t x, int16_t y);
+void LCD_ST7735S_Sprite_SetVisible(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite, bool visible);
+void LCD_ST7735S_Sprite_SetZ(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite, int8_t z);
+void LCD_ST7735S_Sprite_SetImage(LCD_ST7735S_Compositor_t *comp, LCD_ST7735S_Sprite_t *sprite,
+                                 const tImage_RGB *image, const tImage_RGB_Runs *runs);
+
+#endif //_ST7735S_COMPOSITOR_H
@@ -0,0 +1,344 @@
+/**
+ *     st7735 display library
+ *
+ *     Copyright (c) 2020 Vitaliy Nimych (Cvetaev) @ cvetaevvitaliy@gmail.com
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *          http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "st7735s_console.h"
+#include "st7735s_settings.h"
+
+
+/** Largest glyph of the font, or largest advance of a proportional one */
+static void Console_CellSize(const tFont *font, uint8_t *w, uint8_t *h)
+{
+    int count = font->length;
+
+    *w = 0;
+    *h = 0;
+    if (font->packed != NULL) {
+        *w = font->packed->width;
+        *h = font->packed->height;
+        count = font->packed->count;
+    } else {
+        for (int i = 0; i < font->length; i++) {
+            const tImage *image = font->chars[i].image;
+            if (image->width > *w)
+                *w = (uint8_t)image->width;
+            if (image->height > *h)
+                *h = (uint8_t)image->height;
+        }
+    }
+
+    if (font->metrics != NULL) {
+        *w = 0;
+        for (int i = 0; i < count; i++) {
+            if (font->metrics[i].advance > *w)
+                *w = font->metrics[i].advance;
+        }
+    }
+}
+
+
+static char *Console_Utf8(char *str, uint32_t code)
+{
+    if (code < 0x80) {
+        *str++ = (char)code;
+    } else if (code < 0x800) {
+        *str++ = (char)(0xC0 | (code >> 6));
+        *str++ = (char)(0x80 | (code & 0x3F));
+    } else {
+        *str++ = (char)(0xE0 | (code >> 12));
+        *str++ = (char)(0x80 | ((code >> 6) & 0x3F));
+        *str++ = (char)(0x80 | (code & 0x3F));
+    }
+    *str = '\0';
+    return str;
+}
+
+
+/** Screen y of a console line, lines move in the band when the panel scrolls */
+static int16_t Console_LineY(const LCD_ST7735S_Console_t *con, uint8_t row)
+{
+    uint8_t line = con->hardware ? (uint8_t)((con->top + row) % con->rows) : row;
+
+    return (int16_t)(con->y + line * con->cell_h);
+}
+
+
+static uint16_t *Console_Cells(const LCD_ST7735S_Console_t *con, uint8_t row)
+{
+    return &con->cells[((con->top + row) % con->rows) * con->cols];
+}
+
+
+/** Draw a cell, glyph narrower than the cell (or missing) is completed with bg */
+static void Console_DrawCell(const LCD_ST7735S_Console_t *con, uint8_t row, uint8_t col, uint16_t code)
+{
+    int16_t x = (int16_t)(col * con->cell_w);
+    int16_t y = Console_LineY(con, row);
+    int16_t w = 0;
+    int16_t h;
+    char str[4];
+
+    if (code != 0) {
+        Console_Utf8(str, code);
+        LCD_ST7735_MeasureString(str, con->font, &w, &h);
+        if (w > 0)
+            LCD_ST7735S_DrawString(str, x, y, con->font, con->fg, con->bg, false);
+    }
+    if (w < con->cell_w)
+        LCD_ST7735S_FillRect((int16_t)(x + w), y, (int16_t)(con->cell_w - w), con->cell_h, con->bg);
+}
+
+
+/** Send what was drawn on the cursor line */
+static void Console_Flush(LCD_ST7735S_Console_t *con)
+{
+    if (con->dirty_x0 < con->dirty_x1)
+        LCD_ST7735S_UpdateRect(con->dirty_x0, Console_LineY(con, con->row),
+                               (int16_t)(con->dirty_x1 - con->dirty_x0), con->cell_h);
+    con->dirty_x0 = INT16_MAX;
+    con->dirty_x1 = 0;
+}
+
+
+static void Console_ClearLine(LCD_ST7735S_Console_t *con, uint8_t row)
+{
+    int16_t y = Console_LineY(con, row);
+
+    if (con->cells != NULL)
+        memset(Console_Cells(con, row), 0, con->cols * sizeof(con->cells[0]));
+
+    LCD_ST7735S_FillRect(0, y, con->width, con->cell_h, con->bg);
+    LCD_ST7735S_UpdateRect(0, y, con->width, con->cell_h);
+}
+
+
+/** Redraw all lines from the cells, empty cells at line ends are one fill */
+static void Console_Redraw(LCD_ST7735S_Console_t *con)
+{
+    for (uint8_t row = 0; row < con->rows; row++) {
+        const uint16_t *cells = Console_Cells(con, row);
+        uint8_t end = con->cols;
+
+        while ((end > 0) && (cells[end - 1] == 0))
+            end--;
+        for (uint8_t col = 0; col < end; col++)
+            Console_DrawCell(con, row, col, cells[col]);
+        LCD_ST7735S_FillRect((int16_t)(end * con->cell_w), Console_LineY(con, row),
+                             (int16_t)(con->width - end * con->cell_w), con->cell_h, con->bg);
+    }
+    LCD_ST7735S_UpdateRect(0, con->y, con->width, (int16_t)(con->rows * con->cell_h));
+}
+
+
+/**
+ * Make the line below the last one. The panel scrolls the band by a line and the line
+ * which scrolled out is cleared and sent as the new last line, nothing else is drawn.
+ */
+static void Console_Scroll(LCD_ST7735S_Console_t *con)
+{
+    if (con->hardware) {
+        Console_ClearLine(con, 0);
+        con->top = (uint8_t)((con->top + 1) % con->rows);
+        LCD_ST7735S_ScrollOffset((uint8_t)(con->top * con->cell_h));
+    } else if (con->cells != NULL) {
+        memset(Console_Cells(con, 0), 0, con->cols * sizeof(con->cells[0]));
+        con->top = (uint8_t)((con->top + 1) % con->rows);
+        Console_Redraw(con);
+    } else {
+        con->row = 0;
+        Console_ClearLine(con, 0);
+    }
+}
+
+
+static void Console_Newline(LCD_ST7735S_Console_t *con)
+{
+    Console_Flush(con);
+    con->col = 0;
+    if (con->row + 1 < con->rows) {
+        con->row++;
+        /** wrapped console, the line still shows the previous page */
+        if (!con->hardware && (con->cells == NULL))
+            Console_ClearLine(con, con->row);
+    } else {
+        Console_Scroll(con);
+    }
+}
+
+
+static void Console_Glyph(LCD_ST7735S_Console_t *con, uint16_t code)
+{
+    int16_t x = (int16_t)(con->col * con->cell_w);
+
+    if (con->col >= con->cols) {
+        Console_Newline(con);
+        x = 0;
+    }
+
+    if (con->cells != NULL)
+        Console_Cells(con, con->row)[con->col] = code;
+    Console_DrawCell(con, con->row, con->col, code);
+    con->col++;
+
+    if (x < con->dirty_x0)
+        con->dirty_x0 = x;
+    if (x + con->cell_w > con->dirty_x1)
+        con->dirty_x1 = (int16_t)(x + con->cell_w);
+}
+
+
+static void Console_Put(LCD_ST7735S_Console_t *con, uint32_t code)
+{
+    switch (code) {
+        case '\n':
+            Console_Newline(con);
+            break;
+        case '\r':
+            con->col = 0;
+            break;
+        case '\b':
+            if ((con->col > 0) && (con->col <= con->cols))
+                con->col--;
+            break;
+        case '\t':
+            do {
+                Console_Glyph(con, ' ');
+            } while ((con->col % ST7735S_CONSOLE_TAB != 0) && (con->col < con->cols));
+            break;
+        default:
+            /** cells hold 16 bit codes */
+            if ((code >= 0x20) && (code <= 0xFFFF))
+                Console_Glyph(con, (uint16_t)code);
+            break;
+    }
+}
+
+
+/** Collect UTF-8 sequences, a character is put when its last byte arrives */
+static void Console_Byte(LCD_ST7735S_Console_t *con, uint8_t b)
+{
+    if ((con->rows == 0) || (con->cols == 0))
+        return;
+
+    if ((con->pending > 0) && ((b & 0xC0) == 0x80)) {
+        con->code = (con->code << 6) | (b & 0x3F);
+        if (--con->pending == 0)
+            Console_Put(con, con->code);
+        return;
+    }
+
+    con->pending = 0;
+    if (b < 0x80) {
+        Console_Put(con, b);
+    } else if ((b & 0xE0) == 0xC0) {
+        con->code = b & 0x1F;
+        con->pending = 1;
+    } else if ((b & 0xF0) == 0xE0) {
+        con->code = b & 0x0F;
+        con->pending = 2;
+    } else if ((b & 0xF8) == 0xF0) {
+        con->code = b & 0x07;
+        con->pending = 3;
+    }
+}
+
+
+/**
+ * Console in the full width band [y, y + height) of the screen, cell size is the largest glyph.
+ * cells (rows * cols codes, rows = height / cell height, cols = width / cell width) are optional,
+ * they are only used when the panel can't scroll the band. The band is cleared.
+ */
+void LCD_ST7735S_Console_Init(LCD_ST7735S_Console_t *con, const tFont *font, uint16_t fg, uint16_t bg,
+                              int16_t y, int16_t height, uint16_t *cells, uint16_t cells_count)
+{
+    int16_t cols = 0;
+    int16_t rows = 0;
+
+    memset(con, 0, sizeof(*con));
+    con->font = font;
+    con->fg = fg;
+    con->bg = bg;
+    con->width = LCD_ST7735S_Width();
+    if (y < 0) {
+        height += y;
+        y = 0;
+    }
+    if (height > LCD_ST7735S_Height() - y)
+        height = LCD_ST7735S_Height() - y;
+    con->y = y;
+    con->height = (height > 0) ? height : 0;
+
+    Console_CellSize(font, &con->cell_w, &con->cell_h);
+    if ((con->cell_w > 0) && (con->cell_h > 0)) {
+        cols = con->width / con->cell_w;
+        rows = con->height / con->cell_h;
+    }
+    con->cols = (uint8_t)((cols > UINT8_MAX) ? UINT8_MAX : cols);
+    con->rows = (uint8_t)((rows > UINT8_MAX) ? UINT8_MAX : rows);
+
+    if ((cells != NULL) && (cells_count >= con->rows * con->cols))
+        con->cells = cells;
+
+    con->hardware = LCD_ST7735S_ScrollVertical() && (con->rows > 0);
+    if (con->hardware)
+        LCD_ST7735S_ScrollArea((uint8_t)con->y, (uint8_t)(con->y + con->rows * con->cell_h));
+
+    LCD_ST7735S_Console_Clear(con);
+}
+
+
+/** Clear the band and the cells, cursor to the top left */
+void LCD_ST7735S_Console_Clear(LCD_ST7735S_Console_t *con)
+{
+    con->top = 0;
+    con->row = 0;
+    con->col = 0;
+    con->pending = 0;
+    con->dirty_x0 = INT16_MAX;
+    con->dirty_x1 = 0;
+    if (con->cells != NULL)
+        memset(con->cells, 0, con->rows * con->cols * sizeof(con->cells[0]));
+    if (con->hardware)
+        LCD_ST7735S_ScrollOffset(0);
+
+    LCD_ST7735S_FillRect(0, con->y, con->width, con->height, con->bg);
+    LCD_ST7735S_UpdateRect(0, con->y, con->width, con->height);
+}
+
+
+/** Colors of the next characters, bg is also used by new lines */
+void LCD_ST7735S_Console_SetColor(LCD_ST7735S_Console_t *con, uint16_t fg, uint16_t bg)
+{
+    con->fg = fg;
+    con->bg = bg;
+}
+
+
+/** Put a byte of UTF-8 text: a character, '\n', '\r', '\b' or '\t', and send the changed cell */
+void LCD_ST7735S_Console_Putc(LCD_ST7735S_Console_t *con, char c)
+{
+    Console_Byte(con, (uint8_t)c);
+    Console_Flush(con);
+}
+
+
+/** Put a string, each line it changes is sent once */
+void LCD_ST7735S_Console_Puts(LCD_ST7735S_Console_t *con, const char *str)
+{
+    while (*str != '\0')
+        Console_Byte(con, (uint8_t)*str++);
+    Console_Flush(con);
+}
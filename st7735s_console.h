@@ -0,0 +1,65 @@
+/**
+ *     st7735 display library
+ *
+ *     Copyright (c) 2020 Vitaliy Nimych (Cvetaev) @ cvetaevvitaliy@gmail.com
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *          http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _ST7735S_CONSOLE_H
+#define _ST7735S_CONSOLE_H
+#include <stdint.h>
+#include <stdbool.h>
+#include "st7735s.h"
+
+/** Tab stops every ST7735S_CONSOLE_TAB columns */
+#ifndef ST7735S_CONSOLE_TAB
+#define ST7735S_CONSOLE_TAB 4
+#endif
+
+/**
+ * Character cell terminal in a band of full screen width.
+ * When the panel scrolls along y (LCD_R90, LCD_R270) the band is the hardware scroll area:
+ * a new line is drawn over the line which scrolled out and only that line is sent.
+ * Otherwise the cells (optional, rows * cols codes) are redrawn one line up,
+ * without them the cursor wraps to the top line. Text is drawn on the screen target, in screen coordinates.
+ */
+typedef struct {
+    const tFont *font;
+    uint16_t fg;
+    uint16_t bg;
+    int16_t y;                  /** band top */
+    int16_t height;             /** band height, rows * cell_h of it scroll */
+    int16_t width;
+    uint8_t cell_w;
+    uint8_t cell_h;
+    uint8_t cols;
+    uint8_t rows;
+    uint8_t col;                /** cursor, col == cols wraps at the next character */
+    uint8_t row;                /** cursor line on screen, 0 is the top one */
+    uint8_t top;                /** band line (and cells row) shown as the top line */
+    bool hardware;              /** scrolled by the panel */
+    uint16_t *cells;
+    uint32_t code;              /** UTF-8 character being received */
+    uint8_t pending;            /** its continuation bytes still expected */
+    int16_t dirty_x0;           /** drawn but not sent part of the cursor line, x0 >= x1 is none */
+    int16_t dirty_x1;
+} LCD_ST7735S_Console_t;
+
+void LCD_ST7735S_Console_Init(LCD_ST7735S_Console_t *con, const tFont *font, uint16_t fg, uint16_t bg,
+                              int16_t y, int16_t height, uint16_t *cells, uint16_t cells_count);
+void LCD_ST7735S_Console_Clear(LCD_ST7735S_Console_t *con);
+void LCD_ST7735S_Console_SetColor(LCD_ST7735S_Console_t *con, uint16_t fg, uint16_t bg);
+void LCD_ST7735S_Console_Putc(LCD_ST7735S_Console_t *con, char c);
+void LCD_ST7735S_Console_Puts(LCD_ST7735S_Console_t *con, const char *str);
+
+#endif //_ST7735S_CONSOLE_H
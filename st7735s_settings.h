@@ -40,6 +40,41 @@
 #define ST7735S_160X80_MINI_CHINE
 
 
+/****************************************
+ * Screen buffer format, RGB565 if nothing is defined
+ *
+ * 16 bpp RGB565, ST7735_WIDTH * ST7735_HEIGHT * 2 bytes
+ * #define ST7735S_BUFFER_RGB565
+ *
+ * 8 bpp palette indexed, 256 colors, 1 byte per pixel
+ * #define ST7735S_BUFFER_INDEX8
+ *
+ * 4 bpp palette indexed, 16 colors, 2 pixels per byte
+ * #define ST7735S_BUFFER_INDEX4
+ *
+ * 1 bpp monochrome, palette entry 0 is background, 1 is foreground, 8 pixels per byte
+ * #define ST7735S_BUFFER_MONO
+ *
+ * no screen buffer, primitives are sent straight to the panel, LCD_ST7735S_Update() does nothing
+ * #define ST7735S_BUFFER_NONE
+ * **************************************/
+#if defined(ST7735S_BUFFER_INDEX8)
+#define ST7735S_BUFFER_BPP 8
+#elif defined(ST7735S_BUFFER_INDEX4)
+#define ST7735S_BUFFER_BPP 4
+#elif defined(ST7735S_BUFFER_MONO)
+#define ST7735S_BUFFER_BPP 1
+#elif defined(ST7735S_BUFFER_NONE)
+#define ST7735S_BUFFER_BPP 0
+#else
+#define ST7735S_BUFFER_BPP 16
+#endif
+
+/** Depth of LCD_ST7735S_PushClip stack */
+#ifndef ST7735S_CLIP_DEPTH
+#define ST7735S_CLIP_DEPTH 8
+#endif
+
 #define ST7735_MADCTL_MY  0x80
 #define ST7735_MADCTL_MX  0x40
 #define ST7735_MADCTL_MV  0x20